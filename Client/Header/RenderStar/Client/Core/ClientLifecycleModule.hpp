@@ -1,8 +1,11 @@
 #pragma once
 
+#include "RenderStar/Client/Render/Shader/RsslVariantCache.hpp"
 #include "RenderStar/Common/Component/GameObject.hpp"
 #include "RenderStar/Common/Module/AbstractModule.hpp"
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace RenderStar::Client::Render
@@ -12,10 +15,13 @@ namespace RenderStar::Client::Render
     class IUniformManager;
     class IUniformBindingHandle;
     class ITextureManager;
+    class IShaderManager;
+    class IShaderProgram;
 }
 
 namespace RenderStar::Client::Render::Affectors
 {
+    class MapGeometryRenderAffector;
     class SkyboxRenderAffector;
 }
 
@@ -34,11 +40,22 @@ namespace RenderStar::Client::Render::Framework
     class RenderingFrameworkModule;
 }
 
+namespace RenderStar::Common::Asset
+{
+    class AssetModule;
+    class AssetLocation;
+}
+
 namespace RenderStar::Common::Event
 {
     struct EventResult;
 }
 
+namespace RenderStar::Common::Event::Events
+{
+    struct AssetReloadEvent;
+}
+
 namespace RenderStar::Client::Core
 {
     class ClientLifecycleModule final : public Common::Module::AbstractModule
@@ -56,8 +73,29 @@ namespace RenderStar::Client::Core
 
     private:
 
+        enum class ShaderTarget
+        {
+            SCENE_COLOR,
+            SHADOW_MAP,
+            OVERLAY
+        };
+
         Common::Event::EventResult OnRenderInitializeEvent(Common::Module::ModuleContext&, Render::IRenderBackend*);
         Common::Event::EventResult OnRenderFrameEvent(Render::IRenderBackend*);
+        Common::Event::EventResult OnAssetReloadEvent(const Common::Event::Events::AssetReloadEvent& event);
+
+        std::unique_ptr<Render::IShaderProgram> BuildShader(
+            const Common::Asset::AssetLocation& location,
+            ShaderTarget target,
+            std::optional<Render::Shader::RsslPermutationMask> permutation = std::nullopt);
+
+        // Parses and emits every shader the lifecycle builds at startup in one batch with a shared include cache
+        void CompileStartupShaders();
+
+        [[nodiscard]]
+        Render::Shader::RsslTarget GetRsslTarget() const;
+
+        void ConfigureSceneShaderVariants(Render::Affectors::MapGeometryRenderAffector& affector);
 
         void SetupGameplayLogic(Common::Module::ModuleContext& context);
         void SetupMainLoop() const;
@@ -65,6 +103,12 @@ namespace RenderStar::Client::Core
         Render::IBufferManager* cachedBufferManager = nullptr;
         Render::IUniformManager* cachedUniformManager = nullptr;
         Render::ITextureManager* cachedTextureManager = nullptr;
+        Render::IShaderManager* cachedShaderManager = nullptr;
+        Render::IRenderBackend* cachedBackend = nullptr;
+
+        Common::Asset::AssetModule* assetModule = nullptr;
+        Render::Shader::RsslVariantCache shaderVariants;
+        std::optional<std::chrono::steady_clock::time_point> pendingReloadDetectedAt;
 
         Common::Component::GameObject playerEntity = Common::Component::GameObject::Invalid();
 
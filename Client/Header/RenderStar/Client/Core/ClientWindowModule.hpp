@@ -34,6 +34,9 @@ namespace RenderStar::Client::Core
 
         Render::RenderBackend GetPreferredBackend() const;
 
+        // No window is created; Tick counts frames instead of polling events
+        bool IsHeadless() const;
+
     protected:
 
         void OnInitialize(Common::Module::ModuleContext& context) override;
@@ -53,5 +56,8 @@ namespace RenderStar::Client::Core
         int32_t height;
         Render::RenderBackend preferredBackend;
         bool forceBackend;
+        uint32_t headlessFrameLimit;
+        uint32_t headlessFrameCount;
+        bool closeRequested;
     };
 }
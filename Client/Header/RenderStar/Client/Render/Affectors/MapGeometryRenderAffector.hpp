@@ -1,18 +1,31 @@
 #pragma once
 
+#include "RenderStar/Client/Render/Backend/IndirectDraw.hpp"
+#include "RenderStar/Client/Render/Culling/FrustumCuller.hpp"
+#include "RenderStar/Client/Render/Framework/ClusteredLightingData.hpp"
+#include "RenderStar/Client/Render/Framework/SceneLightingData.hpp"
 #include "RenderStar/Client/Render/Resource/IBufferHandle.hpp"
 #include "RenderStar/Client/Render/Resource/ITextureHandle.hpp"
 #include "RenderStar/Client/Render/Resource/IUniformBindingHandle.hpp"
 #include "RenderStar/Client/Render/Resource/IShaderProgram.hpp"
 #include "RenderStar/Client/Render/Resource/Mesh.hpp"
+#include "RenderStar/Client/Render/Resource/UniformUpdateCache.hpp"
+#include "RenderStar/Client/Render/Shader/RsslTypes.hpp"
+#include "RenderStar/Common/Asset/AssetFuture.hpp"
+#include "RenderStar/Common/Asset/IBinaryAsset.hpp"
 #include "RenderStar/Common/Component/AbstractAffector.hpp"
+#include "RenderStar/Common/Component/GameObject.hpp"
 #include "RenderStar/Common/Scene/MapbinLoader.hpp"
 #include <glm/glm.hpp>
+#include <array>
+#include <functional>
 #include <memory>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+namespace RenderStar::Common::Component { struct Transform; }
 namespace RenderStar::Common::Scene { class SceneModule; }
 namespace RenderStar::Common::Asset { class AssetModule; }
 namespace RenderStar::Common::Physics { class PhysicsModule; }
@@ -51,10 +64,20 @@ namespace RenderStar::Client::Render::Affectors
             ITextureHandle* detailNormalMap = nullptr;
         };
 
+        struct MaterialPermutationBits
+        {
+            Shader::RsslPermutationMask normalMap = 0;
+            Shader::RsslPermutationMask emissionMap = 0;
+            Shader::RsslPermutationMask detailMap = 0;
+        };
+
+        using ShaderVariantFactory = std::function<std::unique_ptr<IShaderProgram>(Shader::RsslPermutationMask)>;
+
         void Affect(Common::Component::ComponentModule& componentModule) override;
 
         void SetupRenderState(IBufferManager* bufferManager, IUniformManager* uniformManager, ITextureManager* textureManager);
         void SetShader(std::unique_ptr<IShaderProgram> shader);
+        void SetShaderVariantFactory(ShaderVariantFactory factory, MaterialPermutationBits bits);
 
         void CheckForNewMapGeometry(Common::Component::ComponentModule& componentModule);
 
@@ -66,55 +89,137 @@ namespace RenderStar::Client::Render::Affectors
             Common::Component::ComponentModule& componentModule);
 
         void SetSceneLightingBuffer(IBufferHandle* buffer);
+        void SetLightClusterBuffers(const Framework::LightClusterBuffers& buffers);
         void SetShadowShader(std::unique_ptr<IShaderProgram> shader);
-        void SetShadowMapTexture(ITextureHandle* texture);
+        void SetShadowCascadeTextures(const std::array<ITextureHandle*, Framework::MAX_SHADOW_CASCADES>& textures);
         void Render(Common::Component::ComponentModule& componentModule, IRenderBackend* backend, const glm::mat4& viewProjection);
-        void RenderShadowDepth(Common::Component::ComponentModule& componentModule, IRenderBackend* backend, const glm::mat4& lightViewProjection);
+
+        // Culls the casters of one cascade; false when the map it drew earlier is still valid and can be reused
+        bool PrepareShadowCascade(Common::Component::ComponentModule& componentModule, uint32_t cascade, const glm::mat4& lightViewProjection);
+        // Draws the casters found by the last PrepareShadowCascade for that cascade
+        void RenderShadowCascade(Common::Component::ComponentModule& componentModule, IRenderBackend* backend, uint32_t cascade);
         void Cleanup();
 
+        // Starts a new window for the upload counters below
+        void BeginFrame();
+
+        [[nodiscard]]
+        UniformUploadStatistics GetUploadStatistics() const;
+
     protected:
 
         void OnInitialize(Common::Module::ModuleContext& context) override;
 
     private:
 
-        struct UniformSlot
+        static constexpr size_t MATERIAL_TEXTURE_COUNT = 9;
+
+        struct ShaderVariant
         {
+            std::unique_ptr<IShaderProgram> shader;
+        };
+
+        // Built the first time a material is drawn and never written again
+        struct MaterialResources
+        {
+            IShaderProgram* shader = nullptr;
             std::unique_ptr<IBufferHandle> buffer;
-            std::unique_ptr<IBufferHandle> materialBuffer;
-            std::unique_ptr<IUniformBindingHandle> binding;
+            std::array<ITextureHandle*, MATERIAL_TEXTURE_COUNT> textures{};
         };
 
-        struct ShadowUniformSlot
+        // Per-object constants and descriptor sets that live as long as the scene; index matches cullEntities
+        struct ObjectSlot
         {
             std::unique_ptr<IBufferHandle> buffer;
             std::unique_ptr<IUniformBindingHandle> binding;
+            std::array<std::unique_ptr<IUniformBindingHandle>, Framework::MAX_SHADOW_CASCADES> shadowBindings;
+            const MaterialResources* material = nullptr;
         };
 
-        UniformSlot& AcquireUniformSlot();
-        ShadowUniformSlot& AcquireShadowUniformSlot();
+        // Every visible cluster of one material, drawn by a single multi-draw-indirect call
+        struct IndirectBatch
+        {
+            int32_t materialId = 0;
+            const MaterialResources* material = nullptr;
+            std::unique_ptr<IUniformBindingHandle> binding;
+        };
 
-        std::unique_ptr<IShaderProgram> shader;
+        // A cascade is redrawn only when its light frustum, its caster set or a caster's transform changed
+        struct ShadowCascadeState
+        {
+            std::unique_ptr<IBufferHandle> passBuffer;
+            std::unique_ptr<IUniformBindingHandle> indirectBinding;
+            std::vector<std::unique_ptr<IBufferHandle>> argumentBuffers;
+            std::vector<uint32_t> casters;
+            glm::mat4 viewProjection{1.0f};
+            uint64_t casterSignature = 0;
+            glm::mat4 drawnViewProjection{1.0f};
+            uint64_t drawnSignature = 0;
+            bool drawn = false;
+        };
+
+        Shader::RsslPermutationMask SelectPermutation(const LoadedMaterial* material) const;
+        ShaderVariant& AcquireShaderVariant(Shader::RsslPermutationMask permutation);
+        const MaterialResources& AcquireMaterial(int32_t materialId);
+        ObjectSlot* PrepareObject(uint32_t index, const Common::Component::Transform& transform, int32_t framesInFlight);
+        void BindSceneResources(IUniformBindingHandle& binding, const MaterialResources& material, IBufferHandle* objectBuffer,
+            UniformUpdateCache& updates, uint32_t object, int32_t frameIndex, ITextureHandle* defaultTexture) const;
+        void SubmitShadowCascadeObjects(Common::Component::ComponentModule& componentModule, IRenderBackend* backend, uint32_t cascade, int32_t frameIndex);
+        void ReleaseObjectState();
+
+        [[nodiscard]]
+        bool CanDrawIndirect(IRenderBackend* backend) const;
+        IBufferHandle* AcquireStaticObjectBuffer();
+        IBufferHandle* UploadIndirectArguments(std::vector<std::unique_ptr<IBufferHandle>>& buffers, int32_t frameIndex, int32_t framesInFlight,
+            std::span<const DrawIndexedIndirectCommand> commands, UniformUpdateCache& updates);
+        void PrepareIndirectBindings(int32_t framesInFlight);
+        void SubmitSceneIndirect(IRenderBackend* backend, int32_t frameIndex, ITextureHandle* defaultTexture);
+        void SubmitShadowCascadeIndirect(IRenderBackend* backend, uint32_t cascade, int32_t frameIndex);
+
+        ShaderVariant defaultVariant;
+        std::unordered_map<Shader::RsslPermutationMask, ShaderVariant> shaderVariants;
+        ShaderVariantFactory variantFactory;
+        MaterialPermutationBits permutationBits;
         std::unique_ptr<IShaderProgram> shadowShader;
-        std::vector<ShadowUniformSlot> shadowUniformPool;
-        size_t shadowUniformPoolIndex = 0;
-        ITextureHandle* shadowMapTexture = nullptr;
+        std::array<ShadowCascadeState, Framework::MAX_SHADOW_CASCADES> shadowCascades;
+        std::array<ITextureHandle*, Framework::MAX_SHADOW_CASCADES> shadowCascadeTextures{};
         IBufferManager* bufferManager = nullptr;
         IUniformManager* uniformManager = nullptr;
         ITextureManager* textureManager = nullptr;
         std::unordered_map<int32_t, LoadedMaterial> loadedMaterials;
-        std::vector<UniformSlot> uniformPool;
-        size_t uniformPoolIndex = 0;
+        std::unordered_map<int32_t, MaterialResources> materialResources;
+        std::vector<ObjectSlot> objectSlots;
+        UniformUpdateCache sceneUpdates;
+        UniformUpdateCache shadowUpdates;
 
-        std::vector<std::unique_ptr<Resource::Mesh>> sceneMeshes;
+        // Every group's vertices and indices in one pair of buffers; clusters are index ranges into it
+        std::unique_ptr<Resource::Mesh> sceneMesh;
         std::vector<std::unique_ptr<ITextureHandle>> sceneTextures;
 
+        // World-space bounds of every scene mesh; cullEntities[i] owns box i
+        Culling::FrustumCuller sceneCuller;
+        std::vector<Common::Component::GameObject> cullEntities;
+        std::vector<uint32_t> visibleIndices;
+
+        // Draw ids match cullEntities. The scene batches by material; shadows need no textures, so all casters share batch 0.
+        IndirectDrawBuilder sceneIndirectDraws;
+        IndirectDrawBuilder shadowIndirectDraws;
+        std::vector<IndirectBatch> indirectBatches;
+        std::vector<std::unique_ptr<IBufferHandle>> sceneArgumentBuffers;
+        // Map clusters never move, so indirect draws share one object block built from the map transform
+        std::unique_ptr<IBufferHandle> staticObjectBuffer;
+        glm::mat4 staticWorldMatrix{1.0f};
+        // Objects are the indirect batches, followed by one per shadow cascade
+        UniformUpdateCache indirectUpdates;
+
         IBufferHandle* sceneLightingBuffer = nullptr;
+        Framework::LightClusterBuffers lightClusterBuffers;
 
         Common::Scene::SceneModule* sceneModule = nullptr;
         Common::Asset::AssetModule* assetModule = nullptr;
         Common::Physics::PhysicsModule* physicsModule = nullptr;
         std::unordered_set<int32_t> processedMapEntities;
         std::unordered_set<int32_t> physicsProcessedEntities;
+        std::unordered_map<int32_t, Common::Asset::AssetFuture<Common::Asset::IBinaryAsset>> pendingMapLoads;
     };
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "RenderStar/Client/Render/Framework/ClusteredLightingData.hpp"
 #include "RenderStar/Client/Render/Resource/IBufferHandle.hpp"
 #include "RenderStar/Client/Render/Resource/IShaderProgram.hpp"
 #include "RenderStar/Client/Render/Resource/IUniformBindingHandle.hpp"
@@ -28,6 +29,7 @@ namespace RenderStar::Client::Render::Affectors
         void SetupRenderState(IBufferManager* bufferManager, IUniformManager* uniformManager, ITextureManager* textureManager);
         void SetShader(std::unique_ptr<IShaderProgram> shader);
         void SetSceneLightingBuffer(IBufferHandle* buffer);
+        void SetLightClusterBuffers(const Framework::LightClusterBuffers& buffers);
         void Cleanup();
 
         void Render(Common::Component::ComponentModule& componentModule, IRenderBackend* backend,
@@ -53,5 +55,6 @@ namespace RenderStar::Client::Render::Affectors
         std::vector<UniformSlot> uniformPool;
         size_t uniformPoolIndex = 0;
         IBufferHandle* sceneLightingBuffer = nullptr;
+        Framework::LightClusterBuffers lightClusterBuffers;
     };
 }
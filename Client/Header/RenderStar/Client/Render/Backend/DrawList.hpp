@@ -0,0 +1,213 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace RenderStar::Client::Render
+{
+    class IShaderProgram;
+    class IUniformBindingHandle;
+    class IMesh;
+
+    // A draw the backend may reorder within its run of sorted submissions
+    struct SortedDrawSubmission
+    {
+        IShaderProgram* shader = nullptr;
+        IUniformBindingHandle* uniformBinding = nullptr;
+        int32_t frameIndex = 0;
+        IMesh* mesh = nullptr;
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+        // Draws that share textures and material constants should share a key
+        uint32_t materialKey = 0;
+        // Normalized view depth in [0, 1]; nearer draws sort first within a pipeline and material
+        float depth = 0.0f;
+    };
+
+    // Bit layout, most significant first: pass (12) | pipeline (16) | material (20) | depth (16)
+    struct DrawSortKey
+    {
+        static constexpr uint32_t PASS_BITS = 12;
+        static constexpr uint32_t PIPELINE_BITS = 16;
+        static constexpr uint32_t MATERIAL_BITS = 20;
+        static constexpr uint32_t DEPTH_BITS = 16;
+
+        static constexpr uint32_t MAX_PASS = (1u << PASS_BITS) - 1;
+
+        [[nodiscard]]
+        static uint64_t Make(uint32_t pass, uint32_t pipeline, uint32_t material, float depth);
+
+        [[nodiscard]]
+        static uint64_t MakeOrdered(uint32_t pass, uint64_t sequence);
+
+        [[nodiscard]]
+        static uint32_t GetPass(const uint64_t key) { return static_cast<uint32_t>(key >> (64 - PASS_BITS)); }
+    };
+
+    // Stable LSD radix sort of [0, keys.size()) by key, eight bits per digit.
+    // Digits on which every key agrees are skipped, so the pass bits rarely cost a full scatter.
+    void RadixSortByKey(std::span<const uint64_t> keys, std::vector<uint32_t>& order, std::vector<uint32_t>& scratch);
+
+    // Per-frame draw commands and their sort keys. Ordered commands (scissor changes, fullscreen
+    // passes, anything submitted without a key) keep their position relative to everything else;
+    // a run of consecutive sorted commands between them is free to reorder by key.
+    template <typename Command>
+    class DrawList
+    {
+    public:
+
+        void AddOrdered(const Command& command)
+        {
+            if (sortedRunOpen)
+                AdvancePass();
+
+            sortedRunOpen = false;
+            Push(command, DrawSortKey::MakeOrdered(pass, orderedSequence++));
+        }
+
+        void AddSorted(const Command& command, const void* pipeline, const uint32_t materialKey, const float depth)
+        {
+            if (!sortedRunOpen && !commands.empty())
+                AdvancePass();
+
+            sortedRunOpen = true;
+
+            auto [iterator, inserted] = pipelineIds.try_emplace(pipeline, static_cast<uint32_t>(pipelineIds.size()));
+            Push(command, DrawSortKey::Make(pass, iterator->second, materialKey, depth));
+        }
+
+        // Indices into GetCommands() in execution order, valid until the next Add or Clear
+        std::span<const uint32_t> Sort()
+        {
+            if (overflowed)
+            {
+                order.resize(commands.size());
+
+                for (uint32_t i = 0; i < order.size(); ++i)
+                    order[i] = i;
+            }
+            else
+            {
+                RadixSortByKey(keys, order, scratch);
+            }
+
+            return order;
+        }
+
+        void Clear()
+        {
+            commands.clear();
+            keys.clear();
+            order.clear();
+            pipelineIds.clear();
+            pass = 0;
+            orderedSequence = 0;
+            sortedRunOpen = false;
+            overflowed = false;
+        }
+
+        [[nodiscard]]
+        std::span<const Command> GetCommands() const { return commands; }
+
+        [[nodiscard]]
+        std::span<const uint64_t> GetKeys() const { return keys; }
+
+        [[nodiscard]]
+        bool IsEmpty() const { return commands.empty(); }
+
+    private:
+
+        void Push(const Command& command, const uint64_t key)
+        {
+            commands.push_back(command);
+            keys.push_back(key);
+        }
+
+        void AdvancePass()
+        {
+            // Past the last pass the keys can no longer express the ordering, so fall back to submission order
+            if (pass == DrawSortKey::MAX_PASS)
+                overflowed = true;
+            else
+                ++pass;
+        }
+
+        std::vector<Command> commands;
+        std::vector<uint64_t> keys;
+        std::vector<uint32_t> order;
+        std::vector<uint32_t> scratch;
+        std::unordered_map<const void*, uint32_t> pipelineIds;
+        uint32_t pass = 0;
+        uint64_t orderedSequence = 0;
+        bool sortedRunOpen = false;
+        bool overflowed = false;
+    };
+
+    // Remembers the last bound pipeline, resource binding and geometry so executors can skip
+    // redundant binds. Changing the pipeline forgets the binding, since layouts may differ.
+    class DrawStateTracker
+    {
+    public:
+
+        bool SetPipeline(const void* pipeline)
+        {
+            if (pipeline == currentPipeline)
+                return false;
+
+            currentPipeline = pipeline;
+            currentBinding = nullptr;
+            ++pipelineChanges;
+            return true;
+        }
+
+        bool SetBinding(const void* binding, const int32_t frameIndex)
+        {
+            if (binding == currentBinding && frameIndex == currentFrameIndex)
+                return false;
+
+            currentBinding = binding;
+            currentFrameIndex = frameIndex;
+            ++bindingChanges;
+            return true;
+        }
+
+        bool SetGeometry(const void* geometry)
+        {
+            if (geometry == currentGeometry)
+                return false;
+
+            currentGeometry = geometry;
+            ++geometryChanges;
+            return true;
+        }
+
+        // Call when something outside the tracker disturbed the bound state
+        void Invalidate()
+        {
+            currentPipeline = nullptr;
+            currentBinding = nullptr;
+            currentGeometry = nullptr;
+        }
+
+        [[nodiscard]]
+        uint32_t GetPipelineChanges() const { return pipelineChanges; }
+
+        [[nodiscard]]
+        uint32_t GetBindingChanges() const { return bindingChanges; }
+
+        [[nodiscard]]
+        uint32_t GetGeometryChanges() const { return geometryChanges; }
+
+    private:
+
+        const void* currentPipeline = nullptr;
+        const void* currentBinding = nullptr;
+        const void* currentGeometry = nullptr;
+        int32_t currentFrameIndex = -1;
+        uint32_t pipelineChanges = 0;
+        uint32_t bindingChanges = 0;
+        uint32_t geometryChanges = 0;
+    };
+}
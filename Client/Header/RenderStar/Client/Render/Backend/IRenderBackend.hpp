@@ -2,6 +2,8 @@
 
 #include "RenderStar/Client/Render/Backend/RenderBackend.hpp"
 #include "RenderStar/Client/Render/Backend/BackendCapabilities.hpp"
+#include "RenderStar/Client/Render/Backend/DrawList.hpp"
+#include "RenderStar/Client/Render/Backend/IndirectDraw.hpp"
 #include <cstdint>
 
 struct GLFWwindow;
@@ -62,6 +64,10 @@ namespace RenderStar::Client::Render
         virtual IRenderCommandQueue* GetCommandQueue() = 0;
 
         virtual void SubmitDrawCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, int32_t frameIndex, IMesh* mesh) = 0;
+        virtual void SubmitDrawRangeCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, int32_t frameIndex, IMesh* mesh, uint32_t firstIndex, uint32_t indexCount) = 0;
+        virtual void SubmitSortedDrawCommand(const SortedDrawSubmission& submission) = 0;
+        // Sorts with the submission's pipeline and material; only valid when the capabilities report multi-draw-indirect
+        virtual void SubmitIndirectDrawCommand(const IndirectDrawSubmission& submission) = 0;
         virtual void ExecuteDrawCommands() = 0;
 
         virtual void BeginOverlayPass() = 0;
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace RenderStar::Client::Render
+{
+    class IShaderProgram;
+    class IUniformBindingHandle;
+    class IMesh;
+    class IBufferHandle;
+
+    // Same layout as VkDrawIndexedIndirectCommand and OpenGL's DrawElementsIndirectCommand, so it uploads as is
+    struct DrawIndexedIndirectCommand
+    {
+        uint32_t indexCount = 0;
+        uint32_t instanceCount = 0;
+        uint32_t firstIndex = 0;
+        int32_t vertexOffset = 0;
+        uint32_t firstInstance = 0;
+    };
+
+    static_assert(sizeof(DrawIndexedIndirectCommand) == 20);
+
+    // A run of indexed draws read from an argument buffer; every draw shares the pipeline, binding and mesh
+    struct IndirectDrawSubmission
+    {
+        IShaderProgram* shader = nullptr;
+        IUniformBindingHandle* uniformBinding = nullptr;
+        int32_t frameIndex = 0;
+        IMesh* mesh = nullptr;
+        IBufferHandle* argumentBuffer = nullptr;
+        // In commands, not bytes
+        uint32_t firstCommand = 0;
+        uint32_t commandCount = 0;
+        uint32_t materialKey = 0;
+    };
+
+    // Where one batch's commands sit in the built argument list
+    struct IndirectDrawBatch
+    {
+        uint32_t batch = 0;
+        uint32_t firstCommand = 0;
+        uint32_t commandCount = 0;
+    };
+
+    // Builds multi-draw-indirect arguments from culling results on the CPU. Static draws are registered once
+    // with the batch (pipeline and resources) they belong to; Build compacts the visible ones into one
+    // contiguous run per batch and merges draws whose index ranges touch into a single command.
+    class IndirectDrawBuilder
+    {
+    public:
+
+        // Ids are handed out in registration order, so they can match a culler's box indices
+        uint32_t AddDraw(uint32_t batch, uint32_t firstIndex, uint32_t indexCount, int32_t vertexOffset = 0);
+
+        void Clear();
+
+        // Unknown ids and empty draws are skipped. Ids in ascending order within a batch keep
+        // registration order, which is what lets neighbouring ranges merge.
+        void Build(std::span<const uint32_t> visibleDraws);
+
+        // Batches are in ascending batch order; batches with no visible draw are left out
+        [[nodiscard]]
+        std::span<const IndirectDrawBatch> GetBatches() const { return batches; }
+
+        [[nodiscard]]
+        std::span<const DrawIndexedIndirectCommand> GetCommands() const { return commands; }
+
+        [[nodiscard]]
+        size_t GetDrawCount() const { return draws.size(); }
+
+        [[nodiscard]]
+        uint32_t GetBatchCount() const { return batchCount; }
+
+    private:
+
+        struct StaticDraw
+        {
+            uint32_t batch = 0;
+            uint32_t firstIndex = 0;
+            uint32_t indexCount = 0;
+            int32_t vertexOffset = 0;
+        };
+
+        std::vector<StaticDraw> draws;
+        uint32_t batchCount = 0;
+        std::vector<uint32_t> batchStarts;
+        std::vector<uint32_t> grouped;
+        std::vector<DrawIndexedIndirectCommand> commands;
+        std::vector<IndirectDrawBatch> batches;
+    };
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "RenderStar/Common/Utility/WorkerPool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace RenderStar::Client::Render
+{
+    // A contiguous run of the execution order, recorded by one worker into its own command buffer
+    struct CommandChunk
+    {
+        uint32_t first = 0;
+        uint32_t count = 0;
+        uint32_t worker = 0;
+    };
+
+    struct RecordingWorkerStatistics
+    {
+        uint32_t chunks = 0;
+        uint32_t commands = 0;
+        double recordMilliseconds = 0.0;
+    };
+
+    // Backend side of ParallelCommandRecorder::Record
+    class ICommandChunkRecorder
+    {
+    public:
+
+        virtual ~ICommandChunkRecorder() = default;
+
+        // Runs on the chunk's worker thread; worker 0 is the calling thread
+        virtual void RecordChunk(const CommandChunk& chunk, uint32_t chunkIndex, std::span<const uint32_t> commands) = 0;
+
+        // Runs on the calling thread after every chunk is recorded; chunks are in execution order
+        virtual void ExecuteChunks(std::span<const CommandChunk> chunks) = 0;
+    };
+
+    // Splits an ordered command list into one contiguous chunk per worker and records the chunks in parallel.
+    // Chunk i always goes to worker i, so a backend can give every worker its own command pool. The worker
+    // threads are created once and reused by every Record.
+    class ParallelCommandRecorder
+    {
+    public:
+
+        static constexpr uint32_t DEFAULT_MINIMUM_CHUNK_SIZE = 64;
+
+        // A worker count of 0 picks one per hardware thread, up to eight
+        explicit ParallelCommandRecorder(size_t workerCount = 0, uint32_t minimumChunkSize = DEFAULT_MINIMUM_CHUNK_SIZE);
+
+        // At most workerCount chunks, none smaller than minimumChunkSize unless there is only one
+        [[nodiscard]]
+        static std::vector<CommandChunk> Partition(uint32_t commandCount, uint32_t workerCount, uint32_t minimumChunkSize);
+
+        [[nodiscard]]
+        std::vector<CommandChunk> Partition(uint32_t commandCount) const;
+
+        // Records every chunk, then hands them to ExecuteChunks in order
+        void Record(std::span<const CommandChunk> chunks, std::span<const uint32_t> order, ICommandChunkRecorder& recorder);
+
+        [[nodiscard]]
+        uint32_t GetWorkerCount() const { return workerCount; }
+
+        // Accumulated since the last ResetStatistics, indexed by worker
+        [[nodiscard]]
+        std::span<const RecordingWorkerStatistics> GetStatistics() const { return statistics; }
+
+        void ResetStatistics();
+
+    private:
+
+        Common::Utility::WorkerPool workers;
+        uint32_t workerCount;
+        uint32_t minimumChunkSize;
+        std::vector<RecordingWorkerStatistics> statistics;
+    };
+}
@@ -7,6 +7,19 @@ namespace RenderStar::Client::Render
     enum class RenderBackend : int32_t
     {
         OPENGL,
-        VULKAN
+        VULKAN,
+        // No window and no GPU; records every command into a frame log for CPU-side benchmarks
+        HEADLESS
     };
+
+    inline const char* GetRenderBackendName(const RenderBackend backend)
+    {
+        switch (backend)
+        {
+            case RenderBackend::OPENGL: return "OpenGL";
+            case RenderBackend::VULKAN: return "Vulkan";
+            case RenderBackend::HEADLESS: return "Headless";
+        }
+        return "Unknown";
+    }
 }
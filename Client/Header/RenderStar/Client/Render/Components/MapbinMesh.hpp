@@ -1,5 +1,6 @@
 #pragma once
 
+#include "RenderStar/Client/Render/Culling/BoundingVolume.hpp"
 #include <cstdint>
 
 namespace RenderStar::Client::Render::Resource
@@ -13,5 +14,10 @@ namespace RenderStar::Client::Render::Components
     {
         Resource::Mesh* mesh = nullptr;
         int32_t materialId = 0;
+        // Index range drawn from the shared mesh; an indexCount of 0 draws the whole mesh
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+        Culling::BoundingBox bounds;
+        Culling::BoundingSphere boundingSphere;
     };
 }
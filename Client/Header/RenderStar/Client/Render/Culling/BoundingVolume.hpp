@@ -0,0 +1,55 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <limits>
+
+namespace RenderStar::Client::Render::Culling
+{
+    struct BoundingBox
+    {
+        glm::vec3 min = glm::vec3(std::numeric_limits<float>::max());
+        glm::vec3 max = glm::vec3(std::numeric_limits<float>::lowest());
+
+        void Expand(const glm::vec3& point)
+        {
+            min = glm::min(min, point);
+            max = glm::max(max, point);
+        }
+
+        [[nodiscard]]
+        bool IsValid() const { return min.x <= max.x && min.y <= max.y && min.z <= max.z; }
+
+        [[nodiscard]]
+        glm::vec3 GetCenter() const { return (min + max) * 0.5f; }
+
+        [[nodiscard]]
+        glm::vec3 GetExtents() const { return (max - min) * 0.5f; }
+
+        // Smallest axis-aligned box enclosing this box after an affine transform
+        [[nodiscard]]
+        BoundingBox Transformed(const glm::mat4& matrix) const
+        {
+            const glm::vec3 center = glm::vec3(matrix * glm::vec4(GetCenter(), 1.0f));
+            const glm::vec3 extents = GetExtents();
+
+            glm::vec3 transformedExtents(0.0f);
+
+            for (int axis = 0; axis < 3; ++axis)
+                transformedExtents += glm::abs(glm::vec3(matrix[axis])) * extents[axis];
+
+            return { center - transformedExtents, center + transformedExtents };
+        }
+    };
+
+    struct BoundingSphere
+    {
+        glm::vec3 center = glm::vec3(0.0f);
+        float radius = 0.0f;
+
+        [[nodiscard]]
+        static BoundingSphere FromBox(const BoundingBox& box)
+        {
+            return { box.GetCenter(), glm::length(box.GetExtents()) };
+        }
+    };
+}
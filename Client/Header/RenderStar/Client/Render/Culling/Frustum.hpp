@@ -0,0 +1,35 @@
+#pragma once
+
+#include "RenderStar/Client/Render/Culling/BoundingVolume.hpp"
+#include <array>
+#include <glm/glm.hpp>
+
+namespace RenderStar::Client::Render::Culling
+{
+    // Six inward-facing planes (xyz = normal, w = distance); a point p is inside a plane when dot(xyz, p) + w >= 0
+    struct Frustum
+    {
+        enum Plane : size_t
+        {
+            LEFT_PLANE,
+            RIGHT_PLANE,
+            BOTTOM_PLANE,
+            TOP_PLANE,
+            NEAR_PLANE,
+            FAR_PLANE,
+            PLANE_COUNT
+        };
+
+        std::array<glm::vec4, PLANE_COUNT> planes{};
+
+        // Expects a zero-to-one depth range, matching GLM_FORCE_DEPTH_ZERO_TO_ONE
+        [[nodiscard]]
+        static Frustum FromViewProjection(const glm::mat4& viewProjection);
+
+        [[nodiscard]]
+        bool Intersects(const BoundingBox& box) const;
+
+        [[nodiscard]]
+        bool Intersects(const BoundingSphere& sphere) const;
+    };
+}
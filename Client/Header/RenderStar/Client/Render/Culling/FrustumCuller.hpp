@@ -0,0 +1,38 @@
+#pragma once
+
+#include "RenderStar/Client/Render/Culling/BoundingVolume.hpp"
+#include "RenderStar/Client/Render/Culling/Frustum.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace RenderStar::Client::Render::Culling
+{
+    // Holds axis-aligned boxes as structure-of-arrays centers and extents, padded to whole
+    // batches of eight, so one frustum test covers a full AVX register of boxes at a time.
+    class FrustumCuller
+    {
+    public:
+
+        static constexpr size_t BATCH_SIZE = 8;
+
+        uint32_t Add(const BoundingBox& box);
+        void Set(uint32_t index, const BoundingBox& box);
+        void Clear();
+
+        // Writes the indices of every box that intersects the frustum, in ascending order
+        void Cull(const Frustum& frustum, std::vector<uint32_t>& visible) const;
+
+        [[nodiscard]]
+        size_t GetCount() const { return count; }
+
+    private:
+
+        std::vector<float> centerX;
+        std::vector<float> centerY;
+        std::vector<float> centerZ;
+        std::vector<float> extentX;
+        std::vector<float> extentY;
+        std::vector<float> extentZ;
+        size_t count = 0;
+    };
+}
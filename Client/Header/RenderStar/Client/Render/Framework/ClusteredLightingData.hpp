@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace RenderStar::Client::Render
+{
+    class IBufferHandle;
+}
+
+namespace RenderStar::Client::Render::Framework
+{
+    static constexpr uint32_t CLUSTER_GRID_X = 16;
+    static constexpr uint32_t CLUSTER_GRID_Y = 9;
+    static constexpr uint32_t CLUSTER_GRID_Z = 24;
+    static constexpr uint32_t CLUSTER_COUNT = CLUSTER_GRID_X * CLUSTER_GRID_Y * CLUSTER_GRID_Z;
+
+    // Both limits keep every block within the 16 KiB uniform buffer size all backends guarantee
+    static constexpr uint32_t MAX_CLUSTERED_LIGHTS = 192;
+    static constexpr uint32_t MAX_CLUSTER_LIGHT_INDICES = 16384;
+
+    struct ClusteredLightGPU
+    {
+        glm::vec4 positionAndRange{0.0f};
+        glm::vec4 colorAndIntensity{0.0f};
+        glm::vec4 directionAndAngle{0.0f};
+        // x: cosine of the inner cone, y: 1 for spot lights and 0 for point lights
+        glm::vec4 spotParams{0.0f};
+    };
+
+    // Binding 16: every light the clusters may reference, most relevant first
+    struct ClusteredLightData
+    {
+        // x: near depth, y: far depth, z and w: scale and bias mapping log(depth) to a slice
+        glm::vec4 depthParams{0.0f};
+        int32_t gridX = CLUSTER_GRID_X;
+        int32_t gridY = CLUSTER_GRID_Y;
+        int32_t gridZ = CLUSTER_GRID_Z;
+        int32_t lightCount = 0;
+        ClusteredLightGPU lights[MAX_CLUSTERED_LIGHTS]{};
+
+        static constexpr size_t Size() { return sizeof(ClusteredLightData); }
+    };
+
+    // Binding 17: (first index << 8) | light count for every cluster, read as uvec4 in the shader
+    struct ClusterGridData
+    {
+        uint32_t cells[CLUSTER_COUNT]{};
+
+        static constexpr size_t Size() { return sizeof(ClusterGridData); }
+    };
+
+    // Binding 18: one byte per light index, read as uvec4 in the shader
+    struct ClusterIndexData
+    {
+        uint8_t indices[MAX_CLUSTER_LIGHT_INDICES]{};
+
+        static constexpr size_t Size() { return sizeof(ClusterIndexData); }
+    };
+
+    struct LightClusterBuffers
+    {
+        IBufferHandle* lights = nullptr;
+        IBufferHandle* grid = nullptr;
+        IBufferHandle* indices = nullptr;
+    };
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "RenderStar/Client/Render/Framework/ClusteredLightingData.hpp"
+#include "RenderStar/Common/Utility/WorkerPool.hpp"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace RenderStar::Client::Render::Framework
+{
+    struct LightClusterView
+    {
+        glm::mat4 viewProjection{1.0f};
+        float nearDepth = 0.1f;
+        float farDepth = 1000.0f;
+    };
+
+    struct LightClusterStatistics
+    {
+        size_t candidateLights = 0;
+        size_t visibleLights = 0;
+        size_t packedLights = 0;
+        size_t indexCount = 0;
+        size_t droppedIndices = 0;
+    };
+
+    // Bins lights into a view-space froxel grid: screen tiles in x and y, logarithmic depth slices in z.
+    // Depth is clip-space w, so the shader recovers a fragment's cluster from the same view-projection.
+    class LightClusterBuilder
+    {
+    public:
+
+        struct ClusterRange
+        {
+            uint32_t minX = 0;
+            uint32_t maxX = 0;
+            uint32_t minY = 0;
+            uint32_t maxY = 0;
+            uint32_t minZ = 0;
+            uint32_t maxZ = 0;
+        };
+
+        // Lights below this count are binned on the calling thread
+        static constexpr size_t PARALLEL_LIGHT_THRESHOLD = 32;
+
+        // A worker count of zero uses the hardware concurrency, capped at eight. The workers live as long as the builder.
+        explicit LightClusterBuilder(size_t workerCount = 0);
+
+        // Keeps the most relevant visible lights and writes the light, grid and index blocks
+        void Build(std::span<const ClusteredLightGPU> candidates, const LightClusterView& view);
+
+        // Clusters a light can touch, or nothing when it lies outside the view
+        static std::optional<ClusterRange> ComputeClusterRange(const glm::vec4& positionAndRange, const LightClusterView& view);
+
+        static uint32_t GetClusterIndex(const uint32_t x, const uint32_t y, const uint32_t z)
+        {
+            return (z * CLUSTER_GRID_Y + y) * CLUSTER_GRID_X + x;
+        }
+
+        // Indices into GetLightData().lights, most relevant first
+        [[nodiscard]]
+        std::span<const uint8_t> GetClusterLights(uint32_t cluster) const;
+
+        [[nodiscard]]
+        const ClusteredLightData& GetLightData() const { return lightData; }
+
+        [[nodiscard]]
+        const ClusterGridData& GetGridData() const { return gridData; }
+
+        [[nodiscard]]
+        const ClusterIndexData& GetIndexData() const { return indexData; }
+
+        [[nodiscard]]
+        const LightClusterStatistics& GetStatistics() const { return statistics; }
+
+    private:
+
+        struct Candidate
+        {
+            uint32_t source = 0;
+            float relevance = 0.0f;
+            ClusterRange range;
+        };
+
+        void BinSlices(bool parallel, bool fill);
+
+        // Largest per-cluster light count that keeps the whole grid within MAX_CLUSTER_LIGHT_INDICES
+        static uint32_t ComputeClusterCap(std::span<const uint32_t> counts);
+
+        ClusteredLightData lightData;
+        ClusterGridData gridData;
+        ClusterIndexData indexData;
+        LightClusterStatistics statistics;
+
+        std::vector<Candidate> visible;
+        std::vector<ClusterRange> ranges;
+        std::vector<uint32_t> counts;
+        std::vector<uint32_t> cursors;
+        Common::Utility::WorkerPool workers;
+    };
+}
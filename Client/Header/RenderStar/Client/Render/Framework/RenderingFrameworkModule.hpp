@@ -1,11 +1,15 @@
 #pragma once
 
+#include "RenderStar/Client/Render/Framework/LightClusterBuilder.hpp"
 #include "RenderStar/Client/Render/Framework/PostProcessData.hpp"
 #include "RenderStar/Client/Render/Framework/SceneLightingData.hpp"
+#include "RenderStar/Client/Render/Framework/ShadowCascadeBuilder.hpp"
 #include "RenderStar/Client/Render/Resource/IBufferHandle.hpp"
 #include "RenderStar/Common/Module/AbstractModule.hpp"
 #include <glm/glm.hpp>
 #include <memory>
+#include <span>
+#include <vector>
 
 namespace RenderStar::Common::Component { class ComponentModule; }
 
@@ -22,10 +26,13 @@ namespace RenderStar::Client::Render::Framework
 
         void SetupRenderState(IBufferManager* bufferManager);
         void CollectSceneData(Common::Component::ComponentModule& componentModule,
-                              const glm::vec3& cameraPosition);
+                              const glm::vec3& cameraPosition, const LightClusterView& view);
         IBufferHandle* GetSceneLightingBuffer() const;
+        LightClusterBuffers GetLightClusterBuffers() const;
+        const LightClusterStatistics& GetLightClusterStatistics() const;
         const SceneLightingData& GetSceneLightingData() const;
-        glm::mat4 GetLightViewProjection() const;
+        std::span<const ShadowCascade> GetShadowCascades() const;
+        void SetShadowCascadeSettings(const ShadowCascadeSettings& settings);
         void SetAmbientLight(glm::vec3 color, float intensity);
 
         void UploadPostProcessData(const PostProcessData& data);
@@ -42,6 +49,12 @@ namespace RenderStar::Client::Render::Framework
 
         std::unique_ptr<IBufferHandle> sceneLightingBuffer;
         SceneLightingData sceneLightingData{};
+        std::unique_ptr<IBufferHandle> clusterLightBuffer;
+        std::unique_ptr<IBufferHandle> clusterGridBuffer;
+        std::unique_ptr<IBufferHandle> clusterIndexBuffer;
+        std::vector<ClusteredLightGPU> clusterCandidates;
+        LightClusterBuilder clusterBuilder;
+        ShadowCascadeBuilder shadowCascades;
         std::unique_ptr<IBufferHandle> postProcessBuffer;
         PostProcessData postProcessData = PostProcessData::Defaults();
         glm::vec3 ambientColor = glm::vec3(0.15f);
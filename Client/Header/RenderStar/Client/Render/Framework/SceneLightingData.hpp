@@ -5,22 +5,7 @@
 
 namespace RenderStar::Client::Render::Framework
 {
-    static constexpr int32_t MAX_POINT_LIGHTS = 16;
-    static constexpr int32_t MAX_SPOT_LIGHTS = 8;
-
-    struct PointLightGPU
-    {
-        glm::vec4 positionAndRange;
-        glm::vec4 colorAndIntensity;
-    };
-
-    struct SpotLightGPU
-    {
-        glm::vec4 positionAndRange;
-        glm::vec4 directionAndAngle;
-        glm::vec4 colorAndIntensity;
-        glm::vec4 spotParams{0.0f};
-    };
+    static constexpr uint32_t MAX_SHADOW_CASCADES = 4;
 
     struct SceneLightingData
     {
@@ -30,12 +15,13 @@ namespace RenderStar::Client::Render::Framework
         glm::vec4 directionalColor{0.0f};
         int32_t pointLightCount = 0;
         int32_t spotLightCount = 0;
+        int32_t shadowCascadeCount = 0;
         int32_t _pad0 = 0;
-        int32_t _pad1 = 0;
-        glm::mat4 directionalLightVP{1.0f};
+        glm::mat4 cascadeViewProjections[MAX_SHADOW_CASCADES]{ glm::mat4(1.0f), glm::mat4(1.0f), glm::mat4(1.0f), glm::mat4(1.0f) };
+        // x: far view depth, y: world size of a texel, z: depth bias, w: light-space depth range
+        glm::vec4 cascadeParams[MAX_SHADOW_CASCADES]{};
         glm::vec4 shadowParams{0.0f};
-        PointLightGPU pointLights[MAX_POINT_LIGHTS]{};
-        SpotLightGPU spotLights[MAX_SPOT_LIGHTS]{};
+        glm::mat4 viewProjection{1.0f};
 
         static constexpr size_t Size() { return sizeof(SceneLightingData); }
     };
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "RenderStar/Client/Render/Framework/SceneLightingData.hpp"
+#include <glm/glm.hpp>
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace RenderStar::Client::Render::Framework
+{
+    struct ShadowCascadeSettings
+    {
+        uint32_t cascadeCount = MAX_SHADOW_CASCADES;
+        // Cascades stop here even when the camera sees further
+        float shadowDistance = 150.0f;
+        // 0 spaces the splits evenly, 1 logarithmically
+        float splitLambda = 0.75f;
+        float mapResolution = 2048.0f;
+        // Depth kept in front of each cascade for casters outside the camera frustum
+        float casterDistance = 100.0f;
+        float depthBiasTexels = 4.0f;
+    };
+
+    struct ShadowCascade
+    {
+        glm::mat4 viewProjection{1.0f};
+        float nearDepth = 0.0f;
+        float farDepth = 0.0f;
+        // World size of one shadow map texel
+        float texelSize = 0.0f;
+        // World distance between the light's near and far planes
+        float depthRange = 0.0f;
+        // Bias in stored depth units that matches depthBiasTexels texels of world distance
+        float depthBias = 0.0f;
+    };
+
+    // Splits the camera frustum into depth slices and fits a texel-snapped orthographic light frustum around each.
+    // Depths are clip-space w, the same measure the scene shader compares against the splits.
+    class ShadowCascadeBuilder
+    {
+    public:
+
+        void SetSettings(const ShadowCascadeSettings& newSettings);
+
+        [[nodiscard]]
+        const ShadowCascadeSettings& GetSettings() const { return settings; }
+
+        // Covers the camera's depth range up to the shadow distance
+        void Build(const glm::mat4& viewProjection, float nearDepth, float farDepth, const glm::vec3& lightDirection);
+
+        // Drops every cascade, e.g. when the scene has no directional light
+        void Clear() { cascadeCount = 0; }
+
+        // Entry 0 is nearDepth and entry count is farDepth; unused entries repeat farDepth
+        static std::array<float, MAX_SHADOW_CASCADES + 1> ComputeSplitDepths(float nearDepth, float farDepth, uint32_t count, float lambda);
+
+        // Fits one cascade around the slice of the camera frustum between two depths
+        static ShadowCascade FitCascade(const glm::mat4& viewProjection, float nearDepth, float farDepth,
+                                        const glm::vec3& lightDirection, const ShadowCascadeSettings& settings);
+
+        [[nodiscard]]
+        std::span<const ShadowCascade> GetCascades() const { return { cascades.data(), cascadeCount }; }
+
+    private:
+
+        ShadowCascadeSettings settings;
+        std::array<ShadowCascade, MAX_SHADOW_CASCADES> cascades{};
+        uint32_t cascadeCount = 0;
+    };
+}
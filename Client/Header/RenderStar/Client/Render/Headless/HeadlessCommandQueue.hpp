@@ -0,0 +1,74 @@
+#pragma once
+
+#include "RenderStar/Client/Render/Backend/DrawList.hpp"
+#include "RenderStar/Client/Render/Command/IRenderCommandBuffer.hpp"
+#include "RenderStar/Client/Render/Command/IRenderCommandQueue.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessFrameLog.hpp"
+#include <memory>
+#include <vector>
+
+namespace RenderStar::Client::Render::Headless
+{
+    class HeadlessCommandBuffer : public IRenderCommandBuffer
+    {
+    public:
+
+        void Begin() override;
+        void End() override;
+
+        void BindPipeline(IShaderProgram* shader) override;
+        void BindVertexBuffer(IBufferHandle* buffer, uint32_t binding) override;
+        void BindIndexBuffer(IBufferHandle* buffer, IndexType type) override;
+        void BindUniformSet(IUniformBindingHandle* uniforms, uint32_t set) override;
+
+        void Draw(uint32_t vertexCount, uint32_t firstVertex) override;
+        void DrawIndexed(uint32_t indexCount, uint32_t firstIndex) override;
+        void DrawMesh(IMesh* mesh) override;
+
+        void SetViewport(float x, float y, float width, float height) override;
+        void SetScissor(int32_t x, int32_t y, uint32_t width, uint32_t height) override;
+
+        void Reset() override;
+        bool IsRecording() const override;
+
+        [[nodiscard]]
+        const std::vector<HeadlessCommand>& GetCommands() const { return commands; }
+
+        [[nodiscard]]
+        const DrawStateTracker& GetState() const { return state; }
+
+    private:
+
+        void RecordDraw(uint32_t firstIndex, uint32_t elementCount);
+
+        std::vector<HeadlessCommand> commands;
+        DrawStateTracker state;
+        uint64_t shader = 0;
+        uint64_t binding = 0;
+        uint64_t geometry = 0;
+        bool recording = false;
+    };
+
+    // Submitting a buffer appends its commands and state changes to the current frame of the log
+    class HeadlessCommandQueue : public IRenderCommandQueue
+    {
+    public:
+
+        explicit HeadlessCommandQueue(HeadlessFrameLog* frameLog);
+
+        IRenderCommandBuffer* AcquireCommandBuffer() override;
+        void ReleaseCommandBuffer(IRenderCommandBuffer* buffer) override;
+        void Submit(IRenderCommandBuffer* buffer) override;
+
+        int32_t GetCurrentFrameIndex() const override;
+
+        void SetCurrentFrameIndex(int32_t index) { frameIndex = index; }
+
+    private:
+
+        HeadlessFrameLog* frameLog;
+        std::vector<std::unique_ptr<HeadlessCommandBuffer>> commandBufferPool;
+        std::vector<HeadlessCommandBuffer*> availableBuffers;
+        int32_t frameIndex = 0;
+    };
+}
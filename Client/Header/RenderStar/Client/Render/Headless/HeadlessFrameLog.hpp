@@ -0,0 +1,130 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace RenderStar::Client::Render::Headless
+{
+    enum class HeadlessCommandType
+    {
+        DRAW,
+        DRAW_INDIRECT,
+        DRAW_FULLSCREEN,
+        SET_SCISSOR,
+        CLEAR_SCISSOR,
+        BEGIN_OVERLAY,
+        END_OVERLAY,
+        BEGIN_TARGET,
+        END_TARGET,
+        BIND_INPUTS,
+        BARRIER,
+        BLIT
+    };
+
+    // One recorded command; fields its type does not use stay zero.
+    // Resources are identified by the ids the headless backend hands out, so logs compare across runs.
+    struct HeadlessCommand
+    {
+        HeadlessCommandType type = HeadlessCommandType::DRAW;
+        uint64_t shader = 0;
+        uint64_t binding = 0;
+        uint64_t mesh = 0;
+        int32_t frameIndex = 0;
+        uint32_t firstIndex = 0;
+        // Vertices or indices the draw consumes
+        uint32_t elementCount = 0;
+        int32_t x = 0;
+        int32_t y = 0;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        std::string target;
+        bool clear = false;
+        // Inputs bound, barriers issued or indirect commands read
+        uint32_t count = 0;
+    };
+
+    struct HeadlessFrameStatistics
+    {
+        uint32_t drawCalls = 0;
+        // Commands read by multi-draw-indirect calls, each of which counts as one draw call
+        uint32_t indirectCommands = 0;
+        uint64_t elementsDrawn = 0;
+        uint32_t pipelineChanges = 0;
+        uint32_t bindingChanges = 0;
+        uint32_t geometryChanges = 0;
+        uint32_t scissorChanges = 0;
+        uint32_t renderTargetChanges = 0;
+        uint32_t barriers = 0;
+        uint32_t bufferUploads = 0;
+        uint32_t textureUploads = 0;
+        uint64_t bytesUploaded = 0;
+        // Wall time between BeginFrame and EndFrame on the recording thread
+        double cpuMilliseconds = 0.0;
+
+        HeadlessFrameStatistics& operator+=(const HeadlessFrameStatistics& other);
+    };
+
+    struct HeadlessFrame
+    {
+        uint64_t index = 0;
+        std::vector<HeadlessCommand> commands;
+        HeadlessFrameStatistics statistics;
+    };
+
+    // Everything recorded between two EndFrame calls belongs to one frame, so uploads made while
+    // loading between frames are charged to the frame that first renders with them.
+    class HeadlessFrameLog
+    {
+    public:
+
+        static constexpr size_t DEFAULT_RETAINED_FRAMES = 8;
+
+        explicit HeadlessFrameLog(size_t retainedFrames = DEFAULT_RETAINED_FRAMES);
+
+        void BeginFrame();
+
+        void EndFrame();
+
+        void Record(const HeadlessCommand& command);
+
+        void RecordBufferUpload(size_t bytes);
+
+        void RecordTextureUpload(size_t bytes);
+
+        [[nodiscard]]
+        uint64_t NextResourceId() { return ++lastResourceId; }
+
+        [[nodiscard]]
+        HeadlessFrameStatistics& GetCurrentStatistics() { return current.statistics; }
+
+        [[nodiscard]]
+        const HeadlessFrame& GetCurrentFrame() const { return current; }
+
+        // The most recent completed frames, oldest first
+        [[nodiscard]]
+        const std::deque<HeadlessFrame>& GetCompletedFrames() const { return completed; }
+
+        // Summed over every completed frame, including ones no longer retained
+        [[nodiscard]]
+        const HeadlessFrameStatistics& GetTotals() const { return totals; }
+
+        [[nodiscard]]
+        uint64_t GetCompletedFrameCount() const { return current.index; }
+
+        void Clear();
+
+    private:
+
+        size_t retainedFrames;
+        HeadlessFrame current;
+        std::deque<HeadlessFrame> completed;
+        HeadlessFrameStatistics totals;
+        std::chrono::steady_clock::time_point frameStart;
+        bool frameStarted = false;
+        uint64_t lastResourceId = 0;
+    };
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "RenderStar/Client/Render/Resource/IBufferManager.hpp"
+#include "RenderStar/Client/Render/Resource/IShaderManager.hpp"
+#include "RenderStar/Client/Render/Resource/ITextureManager.hpp"
+#include "RenderStar/Client/Render/Resource/IUniformManager.hpp"
+#include <memory>
+#include <spdlog/spdlog.h>
+#include <string>
+#include <unordered_map>
+
+namespace RenderStar::Client::Render::Headless
+{
+    class HeadlessFrameLog;
+
+    class HeadlessBufferManager : public IBufferManager
+    {
+    public:
+
+        explicit HeadlessBufferManager(HeadlessFrameLog* frameLog);
+
+        std::unique_ptr<IBufferHandle> CreateBuffer(
+            BufferType type,
+            BufferUsage usage,
+            size_t size,
+            const void* initialData = nullptr) override;
+
+        std::unique_ptr<IBufferHandle> CreateVertexBuffer(
+            size_t size,
+            const void* data,
+            BufferUsage usage = BufferUsage::STATIC) override;
+
+        std::unique_ptr<IBufferHandle> CreateIndexBuffer(
+            size_t size,
+            const void* data,
+            BufferUsage usage = BufferUsage::STATIC) override;
+
+        std::unique_ptr<IBufferHandle> CreateUniformBuffer(
+            size_t size,
+            BufferUsage usage = BufferUsage::DYNAMIC) override;
+
+        std::unique_ptr<IMesh> CreateMesh(
+            const VertexLayout& layout,
+            PrimitiveType primitive = PrimitiveType::TRIANGLES) override;
+
+        void DestroyBuffer(IBufferHandle* buffer) override;
+
+    private:
+
+        HeadlessFrameLog* frameLog;
+    };
+
+    // Accepts any non-empty source or SPIR-V; nothing is compiled
+    class HeadlessShaderManager : public IShaderManager
+    {
+    public:
+
+        explicit HeadlessShaderManager(HeadlessFrameLog* frameLog);
+
+        std::unique_ptr<IShaderProgram> CreateFromSource(const ShaderSource& source) override;
+        std::unique_ptr<IShaderProgram> CreateFromBinary(const ShaderBinary& binary) override;
+
+        std::unique_ptr<IShaderProgram> CreateFromTextAssets(const Common::Asset::ITextAsset& vertexAsset, const Common::Asset::ITextAsset& fragmentAsset) override;
+        std::unique_ptr<IShaderProgram> CreateFromBinaryAssets(const Common::Asset::IBinaryAsset& vertexAsset, const Common::Asset::IBinaryAsset& fragmentAsset) override;
+
+        std::unique_ptr<IShaderProgram> CreateComputeFromTextAsset(const Common::Asset::ITextAsset& computeAsset) override;
+        std::unique_ptr<IShaderProgram> CreateComputeFromBinaryAsset(const Common::Asset::IBinaryAsset& computeAsset) override;
+
+        void DestroyShader(IShaderProgram* shader) override;
+
+    private:
+
+        std::shared_ptr<spdlog::logger> logger;
+        HeadlessFrameLog* frameLog;
+    };
+
+    class HeadlessUniformManager : public IUniformManager
+    {
+    public:
+
+        explicit HeadlessUniformManager(HeadlessFrameLog* frameLog);
+
+        void CreateUniformBuffer(
+            const std::string& name,
+            const UniformBinding& binding) override;
+
+        void UpdateUniformBuffer(
+            const std::string& name,
+            const void* data,
+            size_t size,
+            size_t offset = 0) override;
+
+        void BindUniformBuffer(const std::string& name, uint32_t bindingPoint) override;
+
+        IBufferHandle* GetUniformBuffer(const std::string& name) override;
+
+        void DestroyUniformBuffer(const std::string& name) override;
+
+        std::unique_ptr<IUniformBindingHandle> CreateBindingForShader(IShaderProgram* shader) override;
+
+    private:
+
+        std::shared_ptr<spdlog::logger> logger;
+        HeadlessFrameLog* frameLog;
+        std::unordered_map<std::string, std::unique_ptr<IBufferHandle>> uniformBuffers;
+        std::unordered_map<std::string, uint32_t> bufferBindings;
+    };
+
+    class HeadlessTextureManager : public ITextureManager
+    {
+    public:
+
+        explicit HeadlessTextureManager(HeadlessFrameLog* frameLog);
+
+        std::unique_ptr<ITextureHandle> CreateFromMemory(
+            const TextureDescription& description, const void* pixels) override;
+
+        bool UpdateRegion(ITextureHandle& texture, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* pixels) override;
+
+        bool SupportsFormat(TextureFormat format) const override;
+
+        ITextureHandle* GetDefaultTexture() override;
+
+    private:
+
+        std::shared_ptr<spdlog::logger> logger;
+        HeadlessFrameLog* frameLog;
+        std::unique_ptr<ITextureHandle> defaultTexture;
+    };
+}
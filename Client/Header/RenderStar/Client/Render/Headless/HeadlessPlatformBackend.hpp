@@ -0,0 +1,118 @@
+#pragma once
+
+#include "RenderStar/Client/Render/Platform/IRenderingPlatformBackend.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessResources.hpp"
+#include <memory>
+#include <spdlog/spdlog.h>
+
+namespace RenderStar::Client::Render::Headless
+{
+    class HeadlessRenderBackend;
+
+    // Colour and depth attachments are CPU textures that are never written; they exist so
+    // stages can bind and resize them exactly as they would on a GPU backend
+    class HeadlessRenderTarget : public Platform::IRenderTarget
+    {
+    public:
+
+        HeadlessRenderTarget(HeadlessFrameLog* frameLog, const Platform::RenderTargetDescription& description);
+
+        const std::string& GetName() const override;
+        ITextureHandle* GetColorAttachment(uint32_t index) const override;
+        ITextureHandle* GetDepthAttachment() const override;
+        uint32_t GetWidth() const override;
+        uint32_t GetHeight() const override;
+        void Resize(uint32_t width, uint32_t height) override;
+        Platform::RenderTargetType GetType() const override;
+        bool IsSwapchain() const override;
+        uint32_t GetSampleCount() const override;
+
+    private:
+
+        void Create();
+
+        HeadlessFrameLog* frameLog;
+        Platform::RenderTargetDescription description;
+        std::unique_ptr<HeadlessTextureHandle> colorAttachment;
+        std::unique_ptr<HeadlessTextureHandle> depthAttachment;
+    };
+
+    class HeadlessSwapchainTarget : public Platform::IRenderTarget
+    {
+    public:
+
+        HeadlessSwapchainTarget(uint32_t width, uint32_t height);
+
+        const std::string& GetName() const override;
+        ITextureHandle* GetColorAttachment(uint32_t index) const override;
+        ITextureHandle* GetDepthAttachment() const override;
+        uint32_t GetWidth() const override;
+        uint32_t GetHeight() const override;
+        void Resize(uint32_t width, uint32_t height) override;
+        Platform::RenderTargetType GetType() const override;
+        bool IsSwapchain() const override;
+
+    private:
+
+        std::string name;
+        uint32_t width;
+        uint32_t height;
+    };
+
+    // Compiles for the Vulkan GLSL target so the shader resolver exercises the default path
+    class HeadlessPlatformBackend : public Platform::IRenderingPlatformBackend
+    {
+    public:
+
+        explicit HeadlessPlatformBackend(HeadlessRenderBackend* backend);
+
+        Shader::RsslTarget GetRsslTarget() const override { return Shader::RsslTarget::VULKAN_GLSL; }
+
+        std::unique_ptr<Platform::IRenderTarget> CreateRenderTarget(
+            const Platform::RenderTargetDescription& description) override;
+
+        std::unique_ptr<Platform::IRenderTarget> CreateSwapchainTarget() override;
+
+        std::unique_ptr<IShaderProgram> CompileShader(
+            const std::string& vertexGlsl,
+            const std::string& fragmentGlsl) override;
+
+        std::unique_ptr<IShaderProgram> CompileComputeShader(
+            const std::string& computeGlsl) override;
+
+        void BindInputTextures(
+            const std::vector<Platform::IRenderTarget*>& inputs,
+            IShaderProgram* shader,
+            int32_t frameIndex) override;
+
+        void InsertBarriers(std::span<const Platform::RenderGraphBarrier> barriers) override;
+
+        void BeginRenderTarget(Platform::IRenderTarget* target, bool clear) override;
+        void EndRenderTarget(Platform::IRenderTarget* target) override;
+        void BlitToScreen(Platform::IRenderTarget* source) override;
+
+        IBufferManager* GetBufferManager() override;
+        IUniformManager* GetUniformManager() override;
+        ITextureManager* GetTextureManager() override;
+        IRenderCommandQueue* GetCommandQueue() override;
+
+        void SubmitDrawCommand(
+            IShaderProgram* shader,
+            IUniformBindingHandle* uniformBinding,
+            int32_t frameIndex,
+            IMesh* mesh) override;
+
+        void ExecuteDrawCommands() override;
+
+        void OnResize(uint32_t width, uint32_t height) override;
+        uint32_t GetWidth() const override;
+        uint32_t GetHeight() const override;
+        int32_t GetCurrentFrame() const override;
+        int32_t GetMaxFramesInFlight() const override;
+
+    private:
+
+        std::shared_ptr<spdlog::logger> logger;
+        HeadlessRenderBackend* backend;
+    };
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "RenderStar/Client/Render/Backend/IRenderBackend.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessFrameLog.hpp"
+#include <spdlog/spdlog.h>
+#include <memory>
+
+struct GLFWwindow;
+
+namespace RenderStar::Client::Render::Headless
+{
+    class HeadlessBufferManager;
+    class HeadlessUniformManager;
+    class HeadlessShaderManager;
+    class HeadlessTextureManager;
+    class HeadlessCommandQueue;
+    class HeadlessShaderProgram;
+    class HeadlessMesh;
+    class HeadlessBufferHandle;
+
+    struct HeadlessDrawCommand
+    {
+        enum class Type { Draw, DrawIndirect, SetScissor, ClearScissor };
+        Type type = Type::Draw;
+
+        HeadlessShaderProgram* shader = nullptr;
+        IUniformBindingHandle* uniformBinding = nullptr;
+        int32_t frameIndex = 0;
+        HeadlessMesh* mesh = nullptr;
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+
+        const HeadlessBufferHandle* argumentBuffer = nullptr;
+        uint32_t firstCommand = 0;
+        uint32_t commandCount = 0;
+
+        int32_t scissorX = 0, scissorY = 0;
+        uint32_t scissorW = 0, scissorH = 0;
+    };
+
+    // Runs without a window or GPU. Executing the draw list sorts and state-tracks exactly as the
+    // OpenGL backend does, then records the result into a frame log instead of issuing it.
+    class HeadlessRenderBackend : public IRenderBackend
+    {
+    public:
+
+        static constexpr int32_t MAX_FRAMES_IN_FLIGHT = 2;
+
+        explicit HeadlessRenderBackend(size_t retainedFrames = HeadlessFrameLog::DEFAULT_RETAINED_FRAMES);
+
+        ~HeadlessRenderBackend() override;
+
+        [[nodiscard]]
+        RenderBackend GetType() const override;
+
+        [[nodiscard]]
+        const BackendCapabilities& GetCapabilities() const override;
+
+        // The window handle is ignored and may be null
+        void Initialize(GLFWwindow* windowHandle, uint32_t width, uint32_t height) override;
+
+        void Destroy() override;
+
+        void BeginFrame() override;
+
+        void EndFrame() override;
+
+        void WaitIdle() override;
+
+        void OnResize(uint32_t width, uint32_t height) override;
+
+        [[nodiscard]]
+        uint32_t GetWidth() const override;
+
+        [[nodiscard]]
+        uint32_t GetHeight() const override;
+
+        [[nodiscard]]
+        int32_t GetCurrentFrame() const override;
+
+        [[nodiscard]]
+        int32_t GetMaxFramesInFlight() const override;
+
+        IBufferManager* GetBufferManager() override;
+        IShaderManager* GetShaderManager() override;
+        IUniformManager* GetUniformManager() override;
+        ITextureManager* GetTextureManager() override;
+        IGraphicsResourceManager* GetResourceManager() override;
+        IRenderCommandQueue* GetCommandQueue() override;
+
+        void SubmitDrawCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, int32_t frameIndex, IMesh* mesh) override;
+        void SubmitDrawRangeCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, int32_t frameIndex, IMesh* mesh, uint32_t firstIndex, uint32_t indexCount) override;
+        void SubmitSortedDrawCommand(const SortedDrawSubmission& submission) override;
+        // Reads the arguments back from the CPU buffer at execution, as a GPU would
+        void SubmitIndirectDrawCommand(const IndirectDrawSubmission& submission) override;
+        void ExecuteDrawCommands() override;
+
+        void BeginOverlayPass() override;
+        void EndOverlayPass() override;
+
+        void SetScissorRect(int32_t x, int32_t y, uint32_t w, uint32_t h) override;
+        void ClearScissorRect() override;
+
+        void SubmitSetScissor(int32_t x, int32_t y, uint32_t w, uint32_t h) override;
+        void SubmitClearScissor() override;
+
+        [[nodiscard]]
+        bool IsInitialized() const override;
+
+        [[nodiscard]]
+        HeadlessFrameLog& GetFrameLog() { return frameLog; }
+
+        [[nodiscard]]
+        const HeadlessFrameLog& GetFrameLog() const { return frameLog; }
+
+    private:
+
+        static HeadlessDrawCommand ResolveDrawCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, int32_t frameIndex, IMesh* mesh, uint32_t firstIndex, uint32_t indexCount);
+
+        static uint32_t CountIndirectElements(const HeadlessBufferHandle& argumentBuffer, uint32_t firstCommand, uint32_t commandCount);
+
+        void RecordMarker(HeadlessCommandType type);
+        void RecordScissor(int32_t x, int32_t y, uint32_t w, uint32_t h);
+        void RecordClearScissor();
+
+        std::shared_ptr<spdlog::logger> logger;
+        uint32_t width;
+        uint32_t height;
+        int32_t currentFrame;
+        bool initialized;
+        BackendCapabilities capabilities;
+        HeadlessFrameLog frameLog;
+        DrawList<HeadlessDrawCommand> drawCommands;
+        std::unique_ptr<HeadlessBufferManager> bufferManager;
+        std::unique_ptr<HeadlessUniformManager> uniformManager;
+        std::unique_ptr<HeadlessShaderManager> shaderManager;
+        std::unique_ptr<HeadlessTextureManager> textureManager;
+        std::unique_ptr<HeadlessCommandQueue> commandQueue;
+    };
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "RenderStar/Client/Render/Resource/IBufferHandle.hpp"
+#include "RenderStar/Client/Render/Resource/IMesh.hpp"
+#include "RenderStar/Client/Render/Resource/IShaderManager.hpp"
+#include "RenderStar/Client/Render/Resource/IShaderProgram.hpp"
+#include "RenderStar/Client/Render/Resource/ITextureHandle.hpp"
+#include "RenderStar/Client/Render/Resource/IUniformBindingHandle.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace RenderStar::Client::Render::Headless
+{
+    class HeadlessFrameLog;
+
+    // Every headless resource is plain CPU memory tagged with an id from the frame log
+
+    class HeadlessBufferHandle : public IBufferHandle
+    {
+    public:
+
+        HeadlessBufferHandle(HeadlessFrameLog* frameLog, BufferType type, BufferUsage usage, size_t size, const void* initialData);
+        ~HeadlessBufferHandle() override;
+
+        void Release() override;
+        GraphicsResourceType GetResourceType() const override;
+
+        void SetData(const void* data, size_t size) override;
+        void SetSubData(const void* data, size_t size, size_t offset) override;
+
+        size_t GetSize() const override;
+        BufferType GetType() const override;
+        BufferUsage GetUsage() const override;
+        bool IsValid() const override;
+
+        [[nodiscard]]
+        uint64_t GetId() const { return id; }
+
+        [[nodiscard]]
+        const std::vector<uint8_t>& GetContents() const { return contents; }
+
+    private:
+
+        HeadlessFrameLog* frameLog;
+        uint64_t id;
+        BufferType type;
+        BufferUsage usage;
+        std::vector<uint8_t> contents;
+    };
+
+    class HeadlessMesh : public IMesh
+    {
+    public:
+
+        HeadlessMesh(HeadlessFrameLog* frameLog, const VertexLayout& layout, PrimitiveType primitive);
+        ~HeadlessMesh() override;
+
+        void Release() override;
+        GraphicsResourceType GetResourceType() const override;
+
+        void SetVertexData(const void* data, size_t size) override;
+        void SetIndexData(const void* data, size_t size, IndexType indexType) override;
+
+        int32_t GetVertexCount() const override;
+        int32_t GetIndexCount() const override;
+
+        const VertexLayout& GetVertexLayout() const override;
+        PrimitiveType GetPrimitiveType() const override;
+
+        bool HasIndices() const override;
+        bool IsValid() const override;
+
+        [[nodiscard]]
+        uint64_t GetId() const { return id; }
+
+    private:
+
+        HeadlessFrameLog* frameLog;
+        uint64_t id;
+        VertexLayout layout;
+        PrimitiveType primitive;
+        std::vector<uint8_t> vertexData;
+        std::vector<uint8_t> indexData;
+        IndexType indexType = IndexType::UINT32;
+        int32_t vertexCount = 0;
+        int32_t indexCount = 0;
+    };
+
+    class HeadlessShaderProgram : public IShaderProgram
+    {
+    public:
+
+        // Binary programs keep an empty source; validity is decided by the manager that built them
+        HeadlessShaderProgram(HeadlessFrameLog* frameLog, ShaderSource source, bool compute, bool valid);
+        ~HeadlessShaderProgram() override;
+
+        void Release() override;
+        GraphicsResourceType GetResourceType() const override;
+
+        bool IsValid() const override;
+
+        [[nodiscard]]
+        uint64_t GetId() const { return id; }
+
+        [[nodiscard]]
+        bool IsCompute() const { return compute; }
+
+        [[nodiscard]]
+        const ShaderSource& GetSource() const { return source; }
+
+    private:
+
+        uint64_t id;
+        ShaderSource source;
+        bool compute;
+        bool valid;
+    };
+
+    class HeadlessTextureHandle : public ITextureHandle
+    {
+    public:
+
+        HeadlessTextureHandle(HeadlessFrameLog* frameLog, const TextureDescription& description, const void* pixels);
+        ~HeadlessTextureHandle() override;
+
+        void Release() override;
+        GraphicsResourceType GetResourceType() const override;
+
+        uint32_t GetWidth() const override;
+        uint32_t GetHeight() const override;
+        bool IsValid() const override;
+
+        // Copies a tightly packed RGBA8 rectangle into mip level 0; the caller checks bounds.
+        // Textures created without pixels, such as render target attachments, allocate on first write.
+        void WriteRegion(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* pixels);
+
+        [[nodiscard]]
+        uint64_t GetId() const { return id; }
+
+        [[nodiscard]]
+        const TextureDescription& GetDescription() const { return description; }
+
+        [[nodiscard]]
+        const std::vector<uint8_t>& GetPixels() const { return pixels; }
+
+    private:
+
+        HeadlessFrameLog* frameLog;
+        uint64_t id;
+        TextureDescription description;
+        std::vector<uint8_t> pixels;
+    };
+
+    class HeadlessUniformBinding : public IUniformBindingHandle
+    {
+    public:
+
+        explicit HeadlessUniformBinding(HeadlessFrameLog* frameLog);
+        ~HeadlessUniformBinding() override;
+
+        void Release() override;
+        GraphicsResourceType GetResourceType() const override;
+
+        void Bind(int32_t frameIndex) override;
+        void UpdateBuffer(int32_t binding, IBufferHandle* buffer, size_t size, int32_t frameIndex = -1) override;
+        void UpdateTexture(int32_t binding, ITextureHandle* texture, int32_t frameIndex = -1) override;
+        uint64_t GetNativeHandle(int32_t frameIndex) const override;
+        void Destroy() override;
+        bool IsDestroyed() const override;
+
+        [[nodiscard]]
+        uint64_t GetId() const { return id; }
+
+        [[nodiscard]]
+        ITextureHandle* GetTexture(int32_t binding) const;
+
+    private:
+
+        uint64_t id;
+        std::unordered_map<int32_t, IBufferHandle*> buffers;
+        std::unordered_map<int32_t, ITextureHandle*> textures;
+    };
+
+    // Frame log id of a headless resource; 0 for null or resources from another backend
+    [[nodiscard]]
+    uint64_t GetHeadlessResourceId(const IGraphicsResource* resource);
+}
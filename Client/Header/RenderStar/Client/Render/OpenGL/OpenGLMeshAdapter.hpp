@@ -23,6 +23,9 @@ namespace RenderStar::Client::Render::OpenGL
         void Unbind();
 
         void Draw();
+        void DrawRange(uint32_t firstIndex, uint32_t count);
+        // One glMultiDrawElementsIndirect over commandCount DrawIndexedIndirectCommands of the given buffer
+        void DrawIndirect(uint32_t argumentBuffer, uint32_t firstCommand, uint32_t commandCount);
         void DrawInstanced(int32_t instanceCount);
 
         void SetVertexData(const void* data, size_t size) override;
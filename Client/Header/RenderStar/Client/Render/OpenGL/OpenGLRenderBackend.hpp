@@ -14,16 +14,25 @@ namespace RenderStar::Client::Render::OpenGL
     class OpenGLShaderManagerAdapter;
     class OpenGLTextureManager;
     class OpenGLCommandQueue;
+    class OpenGLShaderProgram;
+    class OpenGLMeshAdapter;
 
+    // Shader and mesh are resolved to their OpenGL types once, at submission
     struct OpenGLDrawCommand
     {
-        enum class Type { Draw, SetScissor, ClearScissor };
+        enum class Type { Draw, DrawIndirect, SetScissor, ClearScissor };
         Type type = Type::Draw;
 
-        IShaderProgram* shader = nullptr;
+        OpenGLShaderProgram* shader = nullptr;
         IUniformBindingHandle* uniformBinding = nullptr;
         int32_t frameIndex = 0;
-        IMesh* mesh = nullptr;
+        OpenGLMeshAdapter* mesh = nullptr;
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+
+        uint32_t argumentBuffer = 0;
+        uint32_t firstCommand = 0;
+        uint32_t commandCount = 0;
 
         int32_t scissorX = 0, scissorY = 0;
         uint32_t scissorW = 0, scissorH = 0;
@@ -77,6 +86,9 @@ namespace RenderStar::Client::Render::OpenGL
         IRenderCommandQueue* GetCommandQueue() override;
 
         void SubmitDrawCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, int32_t frameIndex, IMesh* mesh) override;
+        void SubmitDrawRangeCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, int32_t frameIndex, IMesh* mesh, uint32_t firstIndex, uint32_t indexCount) override;
+        void SubmitSortedDrawCommand(const SortedDrawSubmission& submission) override;
+        void SubmitIndirectDrawCommand(const IndirectDrawSubmission& submission) override;
         void ExecuteDrawCommands() override;
 
         void BeginOverlayPass() override;
@@ -93,6 +105,8 @@ namespace RenderStar::Client::Render::OpenGL
 
     private:
 
+        static OpenGLDrawCommand ResolveDrawCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, int32_t frameIndex, IMesh* mesh, uint32_t firstIndex, uint32_t indexCount);
+
         std::shared_ptr<spdlog::logger> logger;
         GLFWwindow* window;
         uint32_t width;
@@ -100,7 +114,7 @@ namespace RenderStar::Client::Render::OpenGL
         int32_t currentFrame;
         bool initialized;
         BackendCapabilities capabilities;
-        std::vector<OpenGLDrawCommand> drawCommands;
+        DrawList<OpenGLDrawCommand> drawCommands;
         std::unique_ptr<OpenGLBufferManagerAdapter> bufferManager;
         std::unique_ptr<OpenGLUniformManagerAdapter> uniformManager;
         std::unique_ptr<OpenGLShaderManagerAdapter> shaderManager;
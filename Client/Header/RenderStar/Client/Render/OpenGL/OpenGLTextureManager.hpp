@@ -19,13 +19,19 @@ namespace RenderStar::Client::Render::OpenGL
         std::unique_ptr<ITextureHandle> CreateFromMemory(
             const TextureDescription& description, const void* pixels) override;
 
+        bool UpdateRegion(ITextureHandle& texture, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* pixels) override;
+
+        bool SupportsFormat(TextureFormat format) const override;
+
         ITextureHandle* GetDefaultTexture() override;
 
     private:
 
         void CreateDefaultTexture();
+        void UploadCompressedLevels(const TextureDescription& description, const void* pixels) const;
 
         std::shared_ptr<spdlog::logger> logger;
+        bool supportsS3TC = false;
         std::unique_ptr<ITextureHandle> defaultTexture;
     };
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "RenderStar/Client/Render/Platform/IRenderTarget.hpp"
+#include "RenderStar/Client/Render/Platform/RenderGraph.hpp"
 #include "RenderStar/Client/Render/Resource/IShaderProgram.hpp"
 #include "RenderStar/Client/Render/Resource/IShaderManager.hpp"
 #include "RenderStar/Client/Render/Resource/IUniformBindingHandle.hpp"
@@ -8,6 +9,7 @@
 #include "RenderStar/Client/Render/Resource/VertexLayout.hpp"
 #include "RenderStar/Client/Render/Shader/RsslTypes.hpp"
 #include <memory>
+#include <span>
 #include <vector>
 
 namespace RenderStar::Client::Render
@@ -55,6 +57,9 @@ namespace RenderStar::Client::Render::Platform
             IShaderProgram* shader,
             int32_t frameIndex) {}
 
+        // Issued before a render graph step; backends that track hazards themselves can ignore it
+        virtual void InsertBarriers(std::span<const RenderGraphBarrier> barriers) {}
+
         virtual void BeginRenderTarget(IRenderTarget* target, bool clear) = 0;
 
         virtual void EndRenderTarget(IRenderTarget* target) = 0;
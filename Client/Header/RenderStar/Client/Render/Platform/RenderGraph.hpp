@@ -0,0 +1,136 @@
+#pragma once
+
+#include "RenderStar/Client/Render/Resource/ITextureHandle.hpp"
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace RenderStar::Common::Configuration
+{
+    class IConfiguration;
+}
+
+namespace RenderStar::Client::Render::Platform
+{
+    // The presentation target; imported by the graph, so never created, aliased or culled
+    inline constexpr std::string_view SWAPCHAIN_TARGET = "SWAPCHAIN";
+
+    struct RenderGraphTargetConfig
+    {
+        std::string name;
+        TextureFormat format = TextureFormat::RGBA8;
+        bool hasDepth = false;
+        bool matchSwapchain = true;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t sampleCount = 1;
+        float scale = 1.0f;
+        // Keeps the target out of aliasing and culling, e.g. when code outside the stage list reads it
+        bool persistent = false;
+    };
+
+    struct RenderGraphStageConfig
+    {
+        std::string name;
+        std::string type;
+        std::string shader;
+        std::string output;
+        std::string vertexFormat;
+        bool clear = true;
+        std::vector<std::string> inputs;
+    };
+
+    struct RenderGraphConfig
+    {
+        std::vector<RenderGraphTargetConfig> targets;
+        std::vector<RenderGraphStageConfig> stages;
+
+        // Reads target_names, targets, stage_order and stages as laid out in render_settings.xml
+        static RenderGraphConfig Load(const Common::Configuration::IConfiguration& configuration);
+    };
+
+    enum class RenderGraphAccess
+    {
+        NONE,
+        WRITE,
+        READ
+    };
+
+    // A dependency between the previous access to a physical target and the next one
+    struct RenderGraphBarrier
+    {
+        uint32_t target = 0;
+        RenderGraphAccess before = RenderGraphAccess::NONE;
+        RenderGraphAccess after = RenderGraphAccess::NONE;
+    };
+
+    struct RenderGraphPhysicalTarget
+    {
+        // Named after its first logical target; the colour format is the widest of all of them
+        RenderGraphTargetConfig description;
+        // Logical targets stored here, in the order their lifetimes begin
+        std::vector<std::string> aliases;
+        bool transient = false;
+    };
+
+    struct RenderGraphStep
+    {
+        // Index into RenderGraphConfig::stages
+        uint32_t stage = 0;
+        // Issued before the stage runs
+        std::vector<RenderGraphBarrier> barriers;
+    };
+
+    // First and last step that touch a logical target
+    struct RenderGraphLifetime
+    {
+        uint32_t firstStep = 0;
+        uint32_t lastStep = 0;
+    };
+
+    // Stage list compiled against the declared inputs and outputs of each stage.
+    // Stages that nothing downstream reads are culled, transient targets whose lifetimes never overlap
+    // share one physical target, and each step carries only the barriers its accesses need.
+    class RenderGraph
+    {
+    public:
+
+        static RenderGraph Compile(const RenderGraphConfig& config);
+
+        [[nodiscard]]
+        std::span<const RenderGraphStep> GetSteps() const { return steps; }
+
+        [[nodiscard]]
+        std::span<const RenderGraphPhysicalTarget> GetPhysicalTargets() const { return physicalTargets; }
+
+        // Empty for the swapchain, unknown names and targets only culled stages use
+        [[nodiscard]]
+        std::optional<uint32_t> FindPhysicalTarget(const std::string& logicalName) const;
+
+        [[nodiscard]]
+        std::optional<RenderGraphLifetime> GetLifetime(const std::string& logicalName) const;
+
+        [[nodiscard]]
+        const std::vector<std::string>& GetCulledStages() const { return culledStages; }
+
+        // Configuration problems found while compiling; the graph is still usable
+        [[nodiscard]]
+        const std::vector<std::string>& GetWarnings() const { return warnings; }
+
+        [[nodiscard]]
+        size_t GetBarrierCount() const;
+
+    private:
+
+        std::vector<RenderGraphStep> steps;
+        std::vector<RenderGraphPhysicalTarget> physicalTargets;
+        std::unordered_map<std::string, uint32_t> physicalByName;
+        std::unordered_map<std::string, RenderGraphLifetime> lifetimes;
+        std::vector<std::string> culledStages;
+        std::vector<std::string> warnings;
+    };
+}
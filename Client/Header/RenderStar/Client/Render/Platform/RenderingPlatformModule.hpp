@@ -4,6 +4,8 @@
 #include "RenderStar/Client/Render/Platform/IRenderPlatformStage.hpp"
 #include "RenderStar/Client/Render/Platform/IRenderTarget.hpp"
 #include "RenderStar/Client/Render/Platform/IRenderingPlatformBackend.hpp"
+#include "RenderStar/Client/Render/Platform/RenderGraph.hpp"
+#include "RenderStar/Client/Render/Shader/RsslTypes.hpp"
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -52,6 +54,9 @@ namespace RenderStar::Client::Render::Platform
 
         IRenderPlatformStage* GetStage(const std::string& name) const;
 
+        // A stage shader from the startup batch, so other modules can reuse it instead of compiling it again
+        const Shader::RsslBatchProgram* FindStageShader(const std::string& name) const;
+
         [[nodiscard]]
         std::vector<std::type_index> GetDependencies() const override;
 
@@ -63,6 +68,7 @@ namespace RenderStar::Client::Render::Platform
     private:
 
         void LoadConfiguration(Common::Module::ModuleContext& context);
+        void CompileGraph();
         void CreateRenderTargets();
         void CreateStages(Common::Module::ModuleContext& context);
         void Freeze();
@@ -74,30 +80,10 @@ namespace RenderStar::Client::Render::Platform
         bool frozen = false;
         bool enabled = false;
 
-        struct TargetConfig
-        {
-            std::string name;
-            TextureFormat format = TextureFormat::RGBA8;
-            bool hasDepth = false;
-            bool matchSwapchain = true;
-            uint32_t width = 0;
-            uint32_t height = 0;
-            uint32_t sampleCount = 1;
-            float scale = 1.0f;
-        };
-
-        struct StageConfig
-        {
-            std::string name;
-            std::string type;
-            std::string shader;
-            std::string output;
-            std::string vertexFormat;
-            bool clear = true;
-            std::vector<std::string> inputs;
-        };
-
-        std::vector<TargetConfig> targetConfigs;
-        std::vector<StageConfig> stageConfigs;
+        RenderGraphConfig graphConfig;
+        RenderGraph graph;
+        // Stage run by each render graph step; null where the stage failed to build
+        std::vector<IRenderPlatformStage*> stepStages;
+        Shader::RsslBatchResult stageShaders;
     };
 }
@@ -11,7 +11,8 @@ namespace RenderStar::Client::Render
         VERTEX,
         INDEX,
         UNIFORM,
-        STORAGE
+        STORAGE,
+        INDIRECT
     };
 
     enum class BufferUsage
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "RenderStar/Client/Render/Resource/IGraphicsResource.hpp"
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 
 namespace RenderStar::Client::Render
@@ -11,7 +13,11 @@ namespace RenderStar::Client::Render
         RGBA16F,
         RGBA32F,
         DEPTH24_STENCIL8,
-        DEPTH32F
+        DEPTH32F,
+        BC1_RGBA,
+        BC3_RGBA,
+        BC4_R,
+        BC5_RG
     };
 
     enum class TextureWrapMode
@@ -36,6 +42,53 @@ namespace RenderStar::Client::Render
         TextureFilterMode minFilter = TextureFilterMode::LINEAR;
         TextureFilterMode magFilter = TextureFilterMode::LINEAR;
         bool generateMipmaps = true;
+        uint32_t mipLevels = 1;
+
+        [[nodiscard]]
+        bool IsCompressed() const
+        {
+            return GetBlockSize() != 0;
+        }
+
+        [[nodiscard]]
+        size_t GetBlockSize() const
+        {
+            switch (format)
+            {
+                case TextureFormat::BC1_RGBA:
+                case TextureFormat::BC4_R:
+                    return 8;
+                case TextureFormat::BC3_RGBA:
+                case TextureFormat::BC5_RG:
+                    return 16;
+                default:
+                    return 0;
+            }
+        }
+
+        [[nodiscard]]
+        uint32_t GetLevelWidth(uint32_t level) const
+        {
+            return std::max(1u, width >> level);
+        }
+
+        [[nodiscard]]
+        uint32_t GetLevelHeight(uint32_t level) const
+        {
+            return std::max(1u, height >> level);
+        }
+
+        [[nodiscard]]
+        size_t GetLevelSize(uint32_t level) const
+        {
+            size_t levelWidth = GetLevelWidth(level);
+            size_t levelHeight = GetLevelHeight(level);
+
+            if (!IsCompressed())
+                return levelWidth * levelHeight * 4;
+
+            return ((levelWidth + 3) / 4) * ((levelHeight + 3) / 4) * GetBlockSize();
+        }
     };
 
     class ITextureHandle : public IGraphicsResource
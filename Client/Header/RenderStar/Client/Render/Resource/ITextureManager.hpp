@@ -14,6 +14,11 @@ namespace RenderStar::Client::Render
         virtual std::unique_ptr<ITextureHandle> CreateFromMemory(
             const TextureDescription& description, const void* pixels) = 0;
 
+        // Overwrites a rectangle of mip level 0 of an uncompressed RGBA8 texture; pixels are tightly packed
+        virtual bool UpdateRegion(ITextureHandle& texture, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* pixels) = 0;
+
+        virtual bool SupportsFormat(TextureFormat format) const = 0;
+
         virtual ITextureHandle* GetDefaultTexture() = 0;
     };
 }
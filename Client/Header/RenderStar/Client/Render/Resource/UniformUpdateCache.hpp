@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace RenderStar::Client::Render
+{
+    struct UniformUploadStatistics
+    {
+        size_t uploadBytes = 0;
+        size_t bufferUploads = 0;
+        size_t skippedUploads = 0;
+        size_t descriptorUpdates = 0;
+    };
+
+    // Remembers, per persistent object, which constants version was last uploaded and which resource
+    // each binding of each per-frame descriptor set holds, so callers only touch what actually changed.
+    class UniformUpdateCache
+    {
+    public:
+
+        static constexpr uint32_t MAX_BINDINGS = 24;
+
+        // Forgets every object; all of them need an upload and a full set of bindings afterwards
+        void Reset(uint32_t objectCount, uint32_t frameCount);
+        void Clear();
+
+        // True, and counted as an upload of the given size, when the object was never uploaded or changed version since
+        bool ClaimUpload(uint32_t object, uint32_t version, size_t bytes);
+
+        // Counts an upload that is not tied to an object, such as a shared per-pass block
+        void RecordUpload(size_t bytes);
+
+        // Forces the next ClaimUpload of the object to succeed
+        void Invalidate(uint32_t object);
+
+        // True, and counted as a descriptor update, when the binding of the frame's set does not hold the resource yet.
+        // A frame of -1 addresses the sets of every frame at once.
+        bool ClaimBinding(uint32_t object, int32_t frame, uint32_t binding, const void* resource);
+
+        // Starts a new statistics window
+        void BeginFrame();
+
+        [[nodiscard]]
+        const UniformUploadStatistics& GetStatistics() const { return statistics; }
+
+        [[nodiscard]]
+        uint32_t GetObjectCount() const { return objectCount; }
+
+    private:
+
+        static constexpr uint64_t NEVER_UPLOADED = ~uint64_t{0};
+
+        const void*& BoundResource(uint32_t object, uint32_t frame, uint32_t binding);
+
+        std::vector<uint64_t> uploadedVersions;
+        std::vector<const void*> boundResources;
+        uint32_t objectCount = 0;
+        uint32_t frameCount = 0;
+        UniformUploadStatistics statistics;
+    };
+}
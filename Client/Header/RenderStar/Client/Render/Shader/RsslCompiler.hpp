@@ -30,12 +30,29 @@ namespace RenderStar::Client::Render::Shader
             const RsslParseResult& parsed,
             RsslTarget target = RsslTarget::VULKAN_GLSL);
 
+        static RsslCompileResult Compile(
+            const RsslParseResult& parsed,
+            RsslTarget target,
+            RsslPermutationMask permutation);
+
+        static RsslBatchResult CompileBatch(
+            const std::vector<RsslBatchSource>& sources,
+            const IncludeResolver& resolver,
+            const std::vector<RsslTarget>& targets = {RsslTarget::VULKAN_GLSL, RsslTarget::OPENGL_GLSL},
+            size_t workerCount = 0);
+
     private:
 
         static std::string EmitStageGlsl(
             const RsslParseResult& parsed,
             const RsslStageSection& stage,
-            RsslTarget target);
+            RsslTarget target,
+            RsslPermutationMask permutation);
+
+        static std::string EmitPermutationConstants(
+            const RsslParseResult& parsed,
+            RsslTarget target,
+            RsslPermutationMask permutation);
 
         static std::string EmitSharedDeclarations(const RsslParseResult& parsed);
 
@@ -2,8 +2,10 @@
 
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace RenderStar::Client::Render::Shader
@@ -23,6 +25,10 @@ namespace RenderStar::Client::Render::Shader
         OPENGL_GLSL
     };
 
+    using RsslPermutationMask = uint32_t;
+
+    constexpr size_t RSSL_MAX_PERMUTATION_KEYS = 32;
+
     struct RsslUniformBlock
     {
         std::string name;
@@ -60,11 +66,15 @@ namespace RenderStar::Client::Render::Shader
         std::vector<RsslSampler> samplers;
         std::vector<RsslStageSection> stages;
         std::string sharedGlsl;
+        std::vector<std::string> permutationKeys;
         std::vector<std::string> errors;
 
         bool HasStage(RsslStageType type) const;
         const RsslStageSection* GetStage(RsslStageType type) const;
         bool IsValid() const;
+
+        RsslPermutationMask GetPermutationBit(std::string_view key) const;
+        RsslPermutationMask GetFullPermutationMask() const;
     };
 
     struct RsslCompileResult
@@ -77,6 +87,44 @@ namespace RenderStar::Client::Render::Shader
         bool IsValid() const;
     };
 
+    // ── Batch compilation ───────────────────────────────────────────────
+
+    struct RsslBatchSource
+    {
+        std::string name;
+        std::string source;
+    };
+
+    struct RsslBatchProgram
+    {
+        std::string name;
+        RsslParseResult parsed;
+        std::vector<RsslTarget> targets;
+        std::vector<RsslCompileResult> compiled;
+        std::vector<std::string> includes;
+
+        const RsslCompileResult* GetCompiled(RsslTarget target) const;
+        bool IsValid() const;
+    };
+
+    struct RsslDependencyManifest
+    {
+        std::map<std::string, std::vector<std::string>> includesByProgram;
+        std::map<std::string, std::vector<std::string>> programsByInclude;
+
+        std::vector<std::string> GetAffectedPrograms(const std::string& includePath) const;
+    };
+
+    struct RsslBatchResult
+    {
+        std::vector<RsslBatchProgram> programs;
+        RsslDependencyManifest dependencies;
+        size_t parsedIncludeCount = 0;
+
+        const RsslBatchProgram* Find(const std::string& name) const;
+        bool IsValid() const;
+    };
+
     // ── Token types ─────────────────────────────────────────────────────
 
     enum class RsslTokenType
@@ -90,6 +138,7 @@ namespace RenderStar::Client::Render::Shader
         AT_SAMPLER,
         AT_INPUT,
         AT_OUTPUT,
+        AT_PERMUTATION,
 
         KW_STRUCT,
         KW_CONST,
@@ -165,6 +214,7 @@ namespace RenderStar::Client::Render::Shader
         UNIFORM_BLOCK,
         SAMPLER_DECL,
         CONSTANT_DECL,
+        PERMUTATION_DECL,
         STAGE_SECTION,
         SHARED_GLSL,
         PROGRAM
@@ -249,6 +299,13 @@ namespace RenderStar::Client::Render::Shader
         RsslConstantDecl() : RsslAstNode(RsslNodeKind::CONSTANT_DECL) {}
     };
 
+    struct RsslPermutationDecl : RsslAstNode
+    {
+        std::string name;
+
+        RsslPermutationDecl() : RsslAstNode(RsslNodeKind::PERMUTATION_DECL) {}
+    };
+
     struct RsslStageIODecl
     {
         std::string name;
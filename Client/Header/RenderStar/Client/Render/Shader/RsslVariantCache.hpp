@@ -0,0 +1,63 @@
+#pragma once
+
+#include "RenderStar/Client/Render/Shader/RsslTypes.hpp"
+#include <compare>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace RenderStar::Client::Render::Shader
+{
+    struct RsslVariantKey
+    {
+        std::string program;
+        RsslTarget target = RsslTarget::VULKAN_GLSL;
+        RsslPermutationMask permutation = 0;
+
+        auto operator<=>(const RsslVariantKey&) const = default;
+    };
+
+    struct RsslVariantCacheStatistics
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        size_t variantCount = 0;
+    };
+
+    class RsslVariantCache
+    {
+    public:
+
+        void Register(const std::string& program, RsslParseResult parsed);
+
+        // Registers a batch-compiled program and keeps the full-permutation variants the batch already emitted
+        void Register(const RsslBatchProgram& program);
+        void Invalidate(const std::string& program);
+        void Clear();
+
+        [[nodiscard]]
+        bool Contains(const std::string& program) const;
+
+        [[nodiscard]]
+        std::shared_ptr<const RsslParseResult> GetParsed(const std::string& program) const;
+
+        [[nodiscard]]
+        RsslVariantKey MakeKey(const std::string& program, RsslTarget target, RsslPermutationMask permutation) const;
+
+        std::shared_ptr<const RsslCompileResult> GetOrCompile(const std::string& program, RsslTarget target, RsslPermutationMask permutation);
+
+        [[nodiscard]]
+        RsslVariantCacheStatistics GetStatistics() const;
+
+    private:
+
+        [[nodiscard]]
+        RsslVariantKey MakeKeyLocked(const std::string& program, RsslTarget target, RsslPermutationMask permutation) const;
+
+        std::map<std::string, std::shared_ptr<const RsslParseResult>> programs;
+        std::map<RsslVariantKey, std::shared_ptr<const RsslCompileResult>> variants;
+        RsslVariantCacheStatistics statistics;
+        mutable std::mutex mutex;
+    };
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "RenderStar/Client/Render/Vulkan/ISpirvCompiler.hpp"
+#include <spdlog/spdlog.h>
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+namespace RenderStar::Client::Render::Vulkan
+{
+    class GlslcSpirvCompiler final : public ISpirvCompiler
+    {
+    public:
+
+        static constexpr std::string_view TARGET_ENVIRONMENT = "vulkan1.3";
+
+        GlslcSpirvCompiler();
+
+        [[nodiscard]]
+        std::string GetVersion() const override;
+
+        [[nodiscard]]
+        std::string GetTargetEnvironment() const override;
+
+        std::vector<uint32_t> Compile(const SpirvCompileJob& job) override;
+
+    private:
+
+        static std::optional<std::filesystem::path> FindExecutable();
+
+        std::optional<std::filesystem::path> executable;
+        std::atomic<uint64_t> invocationCounter;
+        std::shared_ptr<spdlog::logger> logger;
+    };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "RenderStar/Client/Render/Vulkan/VulkanShaderStage.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace RenderStar::Client::Render::Vulkan
+{
+    struct SpirvCompileJob
+    {
+        std::string source;
+        VulkanShaderStage stage;
+        std::string name;
+    };
+
+    class ISpirvCompiler
+    {
+    public:
+
+        virtual ~ISpirvCompiler() = default;
+
+        [[nodiscard]]
+        virtual std::string GetVersion() const = 0;
+
+        [[nodiscard]]
+        virtual std::string GetTargetEnvironment() const = 0;
+
+        virtual std::vector<uint32_t> Compile(const SpirvCompileJob& job) = 0;
+    };
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "RenderStar/Client/Render/Vulkan/ISpirvCompiler.hpp"
+#include <spdlog/spdlog.h>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace RenderStar::Client::Render::Vulkan
+{
+    struct SpirvCacheStatistics
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        uint64_t storeFailures = 0;
+        size_t residentBytes = 0;
+        size_t byteBudget = 0;
+    };
+
+    class SpirvCache
+    {
+    public:
+
+        static constexpr size_t DEFAULT_BYTE_BUDGET = 64ull * 1024 * 1024;
+        static constexpr uint32_t SPIRV_MAGIC = 0x07230203;
+        static constexpr std::string_view FILE_EXTENSION = ".spv";
+        static constexpr std::string_view TEMPORARY_EXTENSION = ".tmp";
+
+        SpirvCache(std::filesystem::path directory, std::unique_ptr<ISpirvCompiler> compiler, size_t byteBudget = DEFAULT_BYTE_BUDGET);
+
+        SpirvCache(const SpirvCache&) = delete;
+        SpirvCache& operator=(const SpirvCache&) = delete;
+
+        std::vector<uint32_t> GetOrCompile(const SpirvCompileJob& job);
+        std::vector<std::vector<uint32_t>> GetOrCompileBatch(std::span<const SpirvCompileJob> jobs);
+
+        [[nodiscard]]
+        std::string ComputeKey(const SpirvCompileJob& job) const;
+
+        void Trim();
+        void Clear();
+
+        [[nodiscard]]
+        SpirvCacheStatistics GetStatistics() const;
+
+        [[nodiscard]]
+        const std::filesystem::path& GetDirectory() const;
+
+        static std::filesystem::path GetDefaultDirectory();
+        static size_t GetDefaultWorkerCount();
+
+    private:
+
+        std::optional<std::vector<uint32_t>> Read(const std::string& key);
+        void Store(const std::string& key, const std::vector<uint32_t>& spirv);
+        void TrimLocked();
+
+        [[nodiscard]]
+        std::filesystem::path GetEntryPath(const std::string& key) const;
+
+        std::filesystem::path directory;
+        std::unique_ptr<ISpirvCompiler> compiler;
+        std::string compilerVersion;
+        std::string targetEnvironment;
+
+        SpirvCacheStatistics statistics;
+        mutable std::mutex mutex;
+
+        std::shared_ptr<spdlog::logger> logger;
+    };
+}
@@ -22,7 +22,8 @@ namespace RenderStar::Client::Render::Vulkan
         INDEX,
         UNIFORM,
         STAGING,
-        STORAGE
+        STORAGE,
+        INDIRECT
     };
 
     class VulkanBufferModule
@@ -2,6 +2,7 @@
 
 #include <vulkan/vulkan.h>
 #include <spdlog/spdlog.h>
+#include <array>
 #include <vector>
 
 namespace RenderStar::Client::Render::Vulkan
@@ -18,8 +19,18 @@ namespace RenderStar::Client::Render::Vulkan
 
         void AllocateCommandBuffers(VkDevice device, uint32_t count);
 
+        // One pool per worker and frame in flight, so workers record secondary buffers without locking
+        void CreateWorkerCommandPools(VkDevice device, uint32_t graphicsQueueFamily, uint32_t workerCount, uint32_t frameCount);
+
+        // Call once the frame's fence has signalled; recycles every secondary buffer of that frame
+        void ResetWorkerCommandPools(uint32_t frame);
+
+        // Safe to call concurrently for different workers
+        VkCommandBuffer AcquireSecondaryCommandBuffer(uint32_t frame, uint32_t worker);
+
         void BeginRecording(VkCommandBuffer commandBuffer);
 
+        // The pass is begun lazily, so its first user can choose inline or secondary contents
         void BeginRenderPass(
             VkRenderPass renderPass,
             VkFramebuffer framebuffer,
@@ -30,6 +41,17 @@ namespace RenderStar::Client::Render::Vulkan
 
         void EndRenderPass();
 
+        // Begins a pending render pass with the given contents and returns what the active pass uses
+        VkSubpassContents ResolveRenderPassContents(VkSubpassContents preferred);
+
+        // Returns the primary buffer, first beginning any pending render pass inline
+        VkCommandBuffer GetInlineCommandBuffer();
+
+        // Dynamic state of the active pass; replayed at the start of every secondary buffer
+        void SetViewport(const VkViewport& viewport);
+
+        void SetScissor(const VkRect2D& scissor);
+
         void EndRecording();
 
         void Destroy(VkDevice device);
@@ -44,12 +66,40 @@ namespace RenderStar::Client::Render::Vulkan
 
         bool IsRenderPassActive() const;
 
+        VkRenderPass GetActiveRenderPass() const;
+
+        VkFramebuffer GetActiveFramebuffer() const;
+
+        const VkViewport& GetActiveViewport() const;
+
+        const VkRect2D& GetActiveScissor() const;
+
     private:
 
+        struct WorkerCommandPool
+        {
+            VkCommandPool pool = VK_NULL_HANDLE;
+            std::vector<VkCommandBuffer> buffers;
+            size_t used = 0;
+        };
+
+        void RecordRenderPassBegin(VkSubpassContents contents);
+
         std::shared_ptr<spdlog::logger> logger;
+        VkDevice workerDevice;
         VkCommandPool commandPool;
         std::vector<VkCommandBuffer> commandBuffers;
         VkCommandBuffer currentCommandBuffer;
+        // Indexed by frame * workerCount + worker
+        std::vector<WorkerCommandPool> workerPools;
+        uint32_t workerCount = 0;
+
+        VkRenderPassBeginInfo renderPassInfo{};
+        std::array<VkClearValue, 3> clearValues{};
+        VkViewport viewport{};
+        VkRect2D scissor{};
+        VkSubpassContents renderPassContents = VK_SUBPASS_CONTENTS_INLINE;
         bool renderPassActive = false;
+        bool renderPassRecorded = false;
     };
 }
@@ -41,6 +41,9 @@ namespace RenderStar::Client::Render::Vulkan
 
         uint32_t GetPresentQueueFamily() const;
 
+        // Whether one vkCmdDrawIndexedIndirect may read more than one command
+        bool SupportsMultiDrawIndirect() const;
+
     private:
 
         void PickPhysicalDevice(VkInstance instance, VkSurfaceKHR surface);
@@ -61,6 +64,7 @@ namespace RenderStar::Client::Render::Vulkan
         uint32_t graphicsQueueFamily;
         uint32_t presentQueueFamily;
         VkSurfaceKHR surface;
+        bool multiDrawIndirect;
 
         static constexpr const char* SWAPCHAIN_EXTENSION = VK_KHR_SWAPCHAIN_EXTENSION_NAME;
         static constexpr const char* VALIDATION_LAYER = "VK_LAYER_KHRONOS_validation";
@@ -39,6 +39,12 @@ namespace RenderStar::Client::Render::Vulkan
         VkIndexType GetVulkanIndexType() const;
 
         void RecordDrawCommands(VkCommandBuffer commandBuffer);
+        void RecordDrawRangeCommands(VkCommandBuffer commandBuffer, uint32_t firstIndex, uint32_t count);
+
+        // For callers that track bound state: bind once, then record any number of draws
+        void BindBuffers(VkCommandBuffer commandBuffer);
+        void RecordBoundDrawCommands(VkCommandBuffer commandBuffer);
+        void RecordBoundDrawRangeCommands(VkCommandBuffer commandBuffer, uint32_t firstIndex, uint32_t count);
 
     private:
 
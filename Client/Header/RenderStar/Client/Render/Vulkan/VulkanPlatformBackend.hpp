@@ -51,6 +51,8 @@ namespace RenderStar::Client::Render::Vulkan
             IShaderProgram* shader,
             int32_t frameIndex) override;
 
+        void InsertBarriers(std::span<const Platform::RenderGraphBarrier> barriers) override;
+
         void BeginRenderTarget(Platform::IRenderTarget* target, bool clear) override;
         void EndRenderTarget(Platform::IRenderTarget* target) override;
         void BlitToScreen(Platform::IRenderTarget* source) override;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "RenderStar/Client/Render/Backend/IRenderBackend.hpp"
+#include "RenderStar/Client/Render/Backend/ParallelCommandRecorder.hpp"
 #include "RenderStar/Client/Render/Vulkan/VulkanInstanceModule.hpp"
 #include "RenderStar/Client/Render/Vulkan/VulkanSurfaceModule.hpp"
 #include "RenderStar/Client/Render/Vulkan/VulkanDeviceModule.hpp"
@@ -22,20 +23,32 @@
 #include <spdlog/spdlog.h>
 #include <vector>
 #include <memory>
+#include <span>
 
 struct GLFWwindow;
 
 namespace RenderStar::Client::Render::Vulkan
 {
+    class VulkanShaderProgram;
+    class VulkanUniformBinding;
+    class VulkanMesh;
+
+    // Shader, binding and mesh are resolved to their Vulkan types once, at submission
     struct VulkanDrawCommand
     {
-        enum class Type { Draw, SetScissor, ClearScissor };
+        enum class Type { Draw, DrawIndirect, SetScissor, ClearScissor };
         Type type = Type::Draw;
 
-        IShaderProgram* shader = nullptr;
-        IUniformBindingHandle* uniformBinding = nullptr;
+        VulkanShaderProgram* shader = nullptr;
+        const VulkanUniformBinding* uniformBinding = nullptr;
         int32_t frameIndex = 0;
-        IMesh* mesh = nullptr;
+        VulkanMesh* mesh = nullptr;
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+
+        VkBuffer argumentBuffer = VK_NULL_HANDLE;
+        VkDeviceSize argumentOffset = 0;
+        uint32_t commandCount = 0;
 
         int32_t scissorX = 0, scissorY = 0;
         uint32_t scissorW = 0, scissorH = 0;
@@ -47,6 +60,8 @@ namespace RenderStar::Client::Render::Vulkan
 
         static constexpr int32_t MAX_FRAMES_IN_FLIGHT = 2;
         static constexpr VkFormat DEPTH_FORMAT = VK_FORMAT_D32_SFLOAT;
+        // Smaller batches are recorded inline; thread start-up would cost more than it saves
+        static constexpr uint32_t PARALLEL_RECORDING_THRESHOLD = 256;
 
         VulkanRenderBackend();
 
@@ -90,6 +105,9 @@ namespace RenderStar::Client::Render::Vulkan
         IRenderCommandQueue* GetCommandQueue() override;
 
         void SubmitDrawCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, int32_t frameIndex, IMesh* mesh) override;
+        void SubmitDrawRangeCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, int32_t frameIndex, IMesh* mesh, uint32_t firstIndex, uint32_t indexCount) override;
+        void SubmitSortedDrawCommand(const SortedDrawSubmission& submission) override;
+        void SubmitIndirectDrawCommand(const IndirectDrawSubmission& submission) override;
         void ExecuteDrawCommands() override;
 
         void BeginOverlayPass() override;
@@ -103,6 +121,10 @@ namespace RenderStar::Client::Render::Vulkan
 
         bool IsInitialized() const override;
 
+        // Secondary command buffer recording since the start of the current frame, indexed by worker
+        [[nodiscard]]
+        std::span<const RecordingWorkerStatistics> GetRecordingStatistics() const;
+
         VkDevice GetDevice() const;
         VkPhysicalDevice GetPhysicalDevice() const;
         VmaAllocator GetAllocator() const;
@@ -118,6 +140,10 @@ namespace RenderStar::Client::Render::Vulkan
 
     private:
 
+        static VulkanDrawCommand ResolveDrawCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, int32_t frameIndex, IMesh* mesh, uint32_t firstIndex, uint32_t indexCount);
+
+        void ExecuteDrawCommandsInSecondaries(std::span<const VulkanDrawCommand> commands, std::span<const uint32_t> order);
+
         void RecreateSwapchain();
         void CreateDepthResources();
         void DestroyDepthResources();
@@ -131,7 +157,8 @@ namespace RenderStar::Client::Render::Vulkan
         bool initialized;
         bool framebufferResized;
         BackendCapabilities capabilities;
-        std::vector<VulkanDrawCommand> drawCommands;
+        DrawList<VulkanDrawCommand> drawCommands;
+        ParallelCommandRecorder commandRecorder;
 
         VulkanInstanceModule instanceModule;
         VulkanSurfaceModule surfaceModule;
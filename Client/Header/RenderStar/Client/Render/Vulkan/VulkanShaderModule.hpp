@@ -1,20 +1,17 @@
 #pragma once
 
+#include "RenderStar/Client/Render/Vulkan/SpirvCache.hpp"
+#include "RenderStar/Client/Render/Vulkan/VulkanShaderStage.hpp"
 #include <vulkan/vulkan.h>
 #include <spdlog/spdlog.h>
+#include <memory>
 #include <vector>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace RenderStar::Client::Render::Vulkan
 {
-    enum class VulkanShaderStage
-    {
-        VERTEX,
-        FRAGMENT,
-        COMPUTE
-    };
-
     struct VulkanShader
     {
         VkShaderModule module;
@@ -41,6 +38,7 @@ namespace RenderStar::Client::Render::Vulkan
         VulkanShader LoadShaderFromSpirv(const std::vector<uint32_t>& spirvCode, VulkanShaderStage stage) const;
 
         VulkanShader LoadShaderFromGlsl(const std::string& glslSource, VulkanShaderStage stage, const std::string& filename);
+        std::pair<VulkanShader, VulkanShader> LoadShaderPairFromGlsl(const std::string& vertexGlsl, const std::string& fragmentGlsl, const std::string& name);
         VulkanShader LoadShaderFromFile(const std::string& filePath, VulkanShaderStage stage);
 
         void DestroyShader(VulkanShader& shader) const;
@@ -55,5 +53,7 @@ namespace RenderStar::Client::Render::Vulkan
 
         std::shared_ptr<spdlog::logger> logger;
         VkDevice device;
+
+        std::unique_ptr<SpirvCache> spirvCache;
     };
 }
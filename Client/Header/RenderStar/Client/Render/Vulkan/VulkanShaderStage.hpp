@@ -0,0 +1,11 @@
+#pragma once
+
+namespace RenderStar::Client::Render::Vulkan
+{
+    enum class VulkanShaderStage
+    {
+        VERTEX,
+        FRAGMENT,
+        COMPUTE
+    };
+}
@@ -30,6 +30,7 @@ namespace RenderStar::Client::Render::Vulkan
         uint32_t GetHeight() const override;
         bool IsValid() const override;
 
+        VkImage GetImage() const;
         VkImageView GetImageView() const;
         VkSampler GetSampler() const;
 
@@ -21,19 +21,25 @@ namespace RenderStar::Client::Render::Vulkan
         std::unique_ptr<ITextureHandle> CreateFromMemory(
             const TextureDescription& description, const void* pixels) override;
 
+        bool UpdateRegion(ITextureHandle& texture, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* pixels) override;
+
+        bool SupportsFormat(TextureFormat format) const override;
+
         ITextureHandle* GetDefaultTexture() override;
 
     private:
 
         void CreateDefaultTexture();
         void TransitionImageLayout(VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout, uint32_t mipLevels);
-        void CopyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height);
+        void CopyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height, int32_t offsetX = 0, int32_t offsetY = 0);
+        void CopyLevelsToImage(VkBuffer buffer, VkImage image, const TextureDescription& description, uint32_t mipLevels);
         void GenerateMipmaps(VkImage image, uint32_t width, uint32_t height, uint32_t mipLevels);
         VkCommandBuffer BeginSingleTimeCommands();
         void EndSingleTimeCommands(VkCommandBuffer commandBuffer);
 
         VkSamplerAddressMode ToVulkanWrapMode(TextureWrapMode mode) const;
         VkFilter ToVulkanFilter(TextureFilterMode mode) const;
+        VkFormat ToVulkanFormat(TextureFormat format) const;
 
         std::shared_ptr<spdlog::logger> logger;
         VkPhysicalDevice physicalDevice;
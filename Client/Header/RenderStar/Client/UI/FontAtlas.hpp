@@ -1,7 +1,13 @@
 #pragma once
 
+#include "RenderStar/Client/UI/SkylinePacker.hpp"
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
+#include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -21,22 +27,197 @@ namespace RenderStar::Client::UI
         float width, height;
     };
 
+    struct ShapedGlyph
+    {
+        GlyphInfo glyph;
+        float x;
+        uint32_t slot;
+    };
+
+    // A string laid out on one line at one font size; offsets are relative to the pen start
+    struct ShapedRun
+    {
+        std::vector<ShapedGlyph> glyphs;
+        float width = 0.0f;
+        float lineHeight = 0.0f;
+        float visibleHeight = 0.0f;
+        uint64_t lastUsedBuild = 0;
+    };
+
+    enum class GlyphRenderMode
+    {
+        // Oversampled coverage rasterized per pixel size
+        Coverage,
+        // One signed distance field per glyph, rendered once at SDF_BASE_SIZE and scaled in the shader
+        SignedDistance
+    };
+
+    struct FontAtlasStatistics
+    {
+        size_t faceCount = 0;
+        size_t glyphCount = 0;
+        size_t rasterizedGlyphs = 0;
+        size_t repacks = 0;
+        size_t cachedRuns = 0;
+        size_t runCacheHits = 0;
+        size_t runCacheMisses = 0;
+        size_t uploadedBytes = 0;
+        double pageOccupancy = 0.0;
+    };
+
+    // One texture page shared by every font and size. Glyphs are rasterized on first use and
+    // skyline-packed; when the page fills up, glyphs not used by the current build are evicted
+    // and the survivors are packed again, which moves their UVs (see GetLayoutGeneration).
+    // In SignedDistance mode a face has a single set of glyphs that serves every pixel size.
     class FontAtlas
     {
     public:
 
-        bool Build(const std::vector<uint8_t>& ttfData, float pixelSize, Render::ITextureManager* textureManager);
+        FontAtlas();
+        ~FontAtlas();
+
+        FontAtlas(const FontAtlas&) = delete;
+        FontAtlas& operator=(const FontAtlas&) = delete;
+
+        bool Initialize(Render::ITextureManager* textureManager, uint32_t pageSize = DEFAULT_PAGE_SIZE);
+        void Release();
+
+        // Drops every face, glyph and cached run; the page texture is kept
+        void Clear();
+
+        // Switching modes clears the atlas
+        void SetRenderMode(GlyphRenderMode mode);
+
+        [[nodiscard]]
+        GlyphRenderMode GetRenderMode() const { return renderMode; }
+
+        [[nodiscard]]
+        int32_t FindFace(const std::string& key) const;
+
+        // The font data is copied; returns the existing face when key is already registered
+        int32_t AddFace(const std::string& key, const std::vector<uint8_t>& ttfData);
+
+        // Starts a new build; glyphs and runs touched after this count as in use for eviction
+        void BeginBuild();
+
+        [[nodiscard]]
+        const ShapedRun* Shape(int32_t face, float pixelSize, std::string_view text);
+
+        // Renders the glyphs of `characters` ahead of use, in parallel when there are enough of them
+        void Prewarm(int32_t face, float pixelSize, std::string_view characters);
 
-        const GlyphInfo* GetGlyph(uint32_t codepoint) const;
-        Render::ITextureHandle* GetTexture() const;
-        float GetLineHeight() const;
-        float GetVisibleHeight() const;
+        // Uploads the region of the page written since the last flush
+        bool Flush();
+
+        [[nodiscard]]
+        Render::ITextureHandle* GetTexture() const { return texture.get(); }
+
+        [[nodiscard]]
+        uint64_t GetLayoutGeneration() const { return layoutGeneration; }
+
+        [[nodiscard]]
+        FontAtlasStatistics GetStatistics() const;
+
+        static constexpr uint32_t DEFAULT_PAGE_SIZE = 1024;
+        static constexpr uint32_t OVERSAMPLE = 2;
+        static constexpr uint32_t GLYPH_PADDING = 1;
+        static constexpr size_t MAX_CACHED_RUNS = 4096;
+
+        static constexpr float SDF_BASE_SIZE = 32.0f;
+        static constexpr float SDF_SPREAD = 4.0f;
+        static constexpr uint32_t SDF_SUPERSAMPLE = 4;
+
+        // Fewer new glyphs than this are rendered on the calling thread
+        static constexpr size_t PARALLEL_GLYPH_THRESHOLD = 8;
 
     private:
 
-        std::unordered_map<uint32_t, GlyphInfo> glyphs;
-        std::unique_ptr<Render::ITextureHandle> atlasTexture;
-        float lineHeight = 0.0f;
-        float visibleHeight = 0.0f;
+        struct FontFace;
+
+        struct FontInstance
+        {
+            int32_t face = -1;
+            float pixelSize = 0.0f;
+            float scale = 0.0f;
+            float lineHeight = 0.0f;
+            float visibleHeight = 0.0f;
+
+            // Slot per codepoint: UNRESOLVED until looked up, MISSING when the font has no glyph
+            std::array<int32_t, 128> ascii{};
+            std::unordered_map<uint32_t, int32_t> extended;
+        };
+
+        struct GlyphSlot
+        {
+            uint64_t instanceKey;
+            uint32_t codepoint;
+            int32_t glyphIndex;
+            GlyphInfo info;
+            uint32_t x, y, width, height;
+            uint64_t lastUsedBuild;
+        };
+
+        struct GlyphJob
+        {
+            const FontInstance* instance;
+            int32_t glyphIndex;
+        };
+
+        // A rendered glyph waiting to be placed; info carries metrics but no UVs yet
+        struct GlyphBitmap
+        {
+            std::vector<uint8_t> pixels;
+            uint32_t width = 0;
+            uint32_t height = 0;
+            GlyphInfo info{};
+        };
+
+        static constexpr int32_t UNRESOLVED = -2;
+        static constexpr int32_t MISSING = -1;
+
+        static int32_t& SlotEntry(FontInstance& instance, uint32_t codepoint);
+
+        FontInstance* GetInstance(int32_t face, float pixelSize, uint64_t& outKey);
+        void CollectUnresolved(FontInstance& instance, std::string_view text);
+        void ResolveGlyphs(FontInstance& instance, uint64_t instanceKey);
+
+        // Thread-safe: reads only immutable face data
+        std::vector<GlyphBitmap> RenderGlyphs(std::span<const GlyphJob> jobs) const;
+        GlyphBitmap RenderCoverage(const FontInstance& instance, int32_t glyphIndex) const;
+        GlyphBitmap RenderDistanceField(const FontInstance& instance, int32_t glyphIndex) const;
+
+        bool Allocate(GlyphSlot& slot, uint32_t width, uint32_t height);
+        bool Place(GlyphSlot& slot, const GlyphBitmap& bitmap);
+        bool Repack();
+        void ResetPage();
+        void MarkDirty(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+        std::vector<std::unique_ptr<FontFace>> faces;
+        std::unordered_map<std::string, int32_t> faceKeys;
+        std::unordered_map<uint64_t, FontInstance> instances;
+        std::vector<GlyphSlot> slots;
+
+        std::unordered_map<std::string, ShapedRun> runCache;
+        std::string runKeyScratch;
+        std::vector<uint32_t> codepointScratch;
+        std::vector<uint32_t> pendingScratch;
+
+        SkylinePacker packer;
+        std::vector<uint8_t> pagePixels;
+        uint32_t pageSize = 0;
+        GlyphRenderMode renderMode = GlyphRenderMode::Coverage;
+        uint32_t dirtyMinX = 0, dirtyMinY = 0, dirtyMaxX = 0, dirtyMaxY = 0;
+
+        Render::ITextureManager* textureManager = nullptr;
+        std::unique_ptr<Render::ITextureHandle> texture;
+
+        uint64_t currentBuild = 1;
+        uint64_t layoutGeneration = 1;
+
+        size_t rasterizedGlyphs = 0;
+        size_t repacks = 0;
+        size_t runCacheHits = 0;
+        size_t runCacheMisses = 0;
+        size_t uploadedBytes = 0;
     };
 }
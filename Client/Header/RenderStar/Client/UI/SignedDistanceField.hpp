@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace RenderStar::Client::UI
+{
+    // Converts an 8-bit coverage bitmap (texels >= 128 are inside) into a signed distance field.
+    // The source is usually rasterized `downsample` times larger than the output; each output texel
+    // averages the distances of its source block. The result is (width / downsample) x (height / downsample)
+    // bytes: 128 on the edge, rising inside, saturating `spread` output texels away from it.
+    std::vector<uint8_t> GenerateSignedDistanceField(std::span<const uint8_t> coverage, uint32_t width, uint32_t height, uint32_t downsample, float spread);
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace RenderStar::Client::UI
+{
+    struct PackedRect
+    {
+        uint32_t x = 0;
+        uint32_t y = 0;
+    };
+
+    // Bottom-left skyline rectangle packer. Rects cannot be freed individually;
+    // callers reclaim space by resetting and packing the survivors again.
+    class SkylinePacker
+    {
+    public:
+
+        void Reset(uint32_t width, uint32_t height);
+
+        [[nodiscard]]
+        std::optional<PackedRect> Pack(uint32_t width, uint32_t height);
+
+        [[nodiscard]]
+        uint64_t GetUsedArea() const { return usedArea; }
+
+        [[nodiscard]]
+        uint32_t GetWidth() const { return atlasWidth; }
+
+        [[nodiscard]]
+        uint32_t GetHeight() const { return atlasHeight; }
+
+    private:
+
+        struct Node
+        {
+            uint32_t x;
+            uint32_t y;
+            uint32_t width;
+        };
+
+        [[nodiscard]]
+        std::optional<uint32_t> FitAt(size_t index, uint32_t width, uint32_t height) const;
+
+        std::vector<Node> skyline;
+        uint32_t atlasWidth = 0;
+        uint32_t atlasHeight = 0;
+        uint64_t usedArea = 0;
+    };
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "RenderStar/Client/UI/UIVertex.hpp"
+#include "RenderStar/Client/UI/UibinTypes.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace RenderStar::Client::Render
+{
+    class ITextureHandle;
+}
+
+namespace RenderStar::Client::UI
+{
+    struct UIScissorRect
+    {
+        int32_t x = 0, y = 0;
+        uint32_t width = 0, height = 0;
+
+        bool operator==(const UIScissorRect&) const = default;
+    };
+
+    struct UIQuad
+    {
+        float x = 0.0f, y = 0.0f, width = 0.0f, height = 0.0f;
+        float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+        UibinColor tint;
+        float rotationDegrees = 0.0f;
+        float cornerRadius = 0.0f;
+        bool distanceField = false;
+    };
+
+    struct UIDrawRun
+    {
+        Render::ITextureHandle* texture = nullptr;
+        std::optional<UIScissorRect> scissor;
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+    };
+
+    struct UIBatchStatistics
+    {
+        size_t primitiveCount = 0;
+        size_t culledCount = 0;
+        size_t drawCount = 0;
+        size_t vertexBytes = 0;
+        size_t indexBytes = 0;
+    };
+
+    class UIBatcher
+    {
+    public:
+
+        void Begin(float screenWidth, float screenHeight);
+        void End();
+
+        void PushScissor(const UIScissorRect& rect);
+        void PopScissor();
+
+        void AddQuad(Render::ITextureHandle* texture, const UIQuad& quad);
+        void AddGeometry(Render::ITextureHandle* texture, std::span<const UIVertex> vertices, std::span<const uint32_t> indices);
+
+        [[nodiscard]]
+        std::span<const UIVertex> GetVertices() const { return vertices; }
+
+        [[nodiscard]]
+        std::span<const uint32_t> GetIndices() const { return indices; }
+
+        [[nodiscard]]
+        std::span<const UIDrawRun> GetRuns() const { return runs; }
+
+        [[nodiscard]]
+        UIBatchStatistics GetStatistics() const;
+
+        [[nodiscard]]
+        bool IsEmpty() const { return runs.empty(); }
+
+        static constexpr size_t MERGE_LOOKBACK = 16;
+
+    private:
+
+        struct Bounds
+        {
+            float minX, minY, maxX, maxY;
+
+            [[nodiscard]]
+            bool Overlaps(const Bounds& other) const
+            {
+                return minX < other.maxX && other.minX < maxX && minY < other.maxY && other.minY < maxY;
+            }
+        };
+
+        struct Batch
+        {
+            Render::ITextureHandle* texture = nullptr;
+            std::optional<UIScissorRect> scissor;
+            Bounds bounds{};
+            std::vector<uint32_t> indices;
+        };
+
+        std::optional<Bounds> ClipToActiveArea(const Bounds& bounds) const;
+        Batch& SelectBatch(Render::ITextureHandle* texture, const Bounds& bounds);
+
+        std::vector<UIVertex> vertices;
+        std::vector<uint32_t> indices;
+        std::vector<UIDrawRun> runs;
+
+        std::vector<Batch> batches;
+        size_t batchCount = 0;
+
+        std::vector<UIScissorRect> scissorStack;
+        float screenWidth = 0.0f;
+        float screenHeight = 0.0f;
+        size_t primitiveCount = 0;
+        size_t culledCount = 0;
+    };
+}
@@ -1,226 +1,173 @@
 #pragma once
 
 #include "RenderStar/Client/UI/UibinComponents.hpp"
-#include <string>
-#include <vector>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string_view>
+#include <utility>
 
 namespace RenderStar::Client::UI
 {
-    struct UIElement
+    // Rect resolved on the last layout pass, reused while its inputs are unchanged
+    struct UIElementLayout
     {
-        std::string id;
-        std::string name;
-        std::vector<UIComponent> components;
-        std::vector<UIElement> children;
+        TransformData transform;
+        float parentX = 0.0f, parentY = 0.0f, parentW = 0.0f, parentH = 0.0f;
+        float scaleX = 0.0f, scaleY = 0.0f;
+        float x = 0.0f, y = 0.0f, w = 0.0f, h = 0.0f;
+        bool valid = false;
 
-        const TransformData* GetTransform() const
+        bool Matches(const TransformData& t, float px, float py, float pw, float ph, float sx, float sy) const
         {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::Transform)
-                    return &c.transform;
-            return nullptr;
+            return valid && parentX == px && parentY == py && parentW == pw && parentH == ph && scaleX == sx && scaleY == sy
+                && transform.x == t.x && transform.y == t.y && transform.scaleX == t.scaleX && transform.scaleY == t.scaleY
+                && transform.rotationDegrees == t.rotationDegrees && transform.anchors == t.anchors && transform.stretch == t.stretch;
         }
+    };
 
-        const ImageData* GetImage() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::Image)
-                    return &c.image;
-            return nullptr;
-        }
+    // Children of a flattened element: the first child directly follows its parent and every
+    // further sibling follows the subtree of the one before it
+    template<typename Element>
+    class UIChildRange
+    {
+    public:
 
-        const TextData* GetText() const
+        class Iterator
         {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::Text)
-                    return &c.text;
-            return nullptr;
-        }
+        public:
 
-        const PanelData* GetPanel() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::Panel)
-                    return &c.panel;
-            return nullptr;
-        }
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::remove_const_t<Element>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Element*;
+            using reference = Element&;
 
-        const ButtonData* GetButton() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::Button)
-                    return &c.button;
-            return nullptr;
-        }
+            Iterator() = default;
+            Iterator(Element* element, uint32_t remaining) : element(element), remaining(remaining) {}
 
-        const ProgressBarData* GetProgressBar() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::ProgressBar)
-                    return &c.progressBar;
-            return nullptr;
-        }
+            Element& operator*() const { return *element; }
+            Element* operator->() const { return element; }
 
-        const ToggleData* GetToggle() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::Toggle)
-                    return &c.toggle;
-            return nullptr;
-        }
+            Iterator& operator++()
+            {
+                element += element->subtreeSize;
+                --remaining;
+                return *this;
+            }
 
-        ToggleData* GetToggle()
-        {
-            for (auto& c : components)
-                if (c.kind == UIComponentKind::Toggle)
-                    return &c.toggle;
-            return nullptr;
-        }
+            Iterator operator++(int)
+            {
+                Iterator previous = *this;
+                ++*this;
+                return previous;
+            }
 
-        const DropdownData* GetDropdown() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::Dropdown)
-                    return &c.dropdown;
-            return nullptr;
-        }
+            bool operator==(const Iterator& other) const { return remaining == other.remaining; }
 
-        DropdownData* GetDropdown()
-        {
-            for (auto& c : components)
-                if (c.kind == UIComponentKind::Dropdown)
-                    return &c.dropdown;
-            return nullptr;
-        }
+        private:
 
-        const TextInputData* GetTextInput() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::TextInput)
-                    return &c.textInput;
-            return nullptr;
-        }
+            Element* element = nullptr;
+            uint32_t remaining = 0;
+        };
 
-        TextInputData* GetTextInput()
-        {
-            for (auto& c : components)
-                if (c.kind == UIComponentKind::TextInput)
-                    return &c.textInput;
-            return nullptr;
-        }
+        UIChildRange(Element* first, uint32_t count) : first(first), count(count) {}
 
-        const ModalData* GetModal() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::Modal)
-                    return &c.modal;
-            return nullptr;
-        }
+        Iterator begin() const { return {first, count}; }
+        Iterator end() const { return {}; }
 
-        const IconData* GetIcon() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::Icon)
-                    return &c.icon;
-            return nullptr;
-        }
+        [[nodiscard]]
+        size_t size() const { return count; }
 
-        const SpriteData* GetSprite() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::Sprite)
-                    return &c.sprite;
-            return nullptr;
-        }
+        [[nodiscard]]
+        bool empty() const { return count == 0; }
 
-        const StackLayoutData* GetStackLayout() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::StackLayout)
-                    return &c.stackLayout;
-            return nullptr;
-        }
+    private:
 
-        const GridLayoutData* GetGridLayout() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::GridLayout)
-                    return &c.gridLayout;
-            return nullptr;
-        }
+        Element* first;
+        uint32_t count;
+    };
 
-        const ScrollBoxData* GetScrollBox() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::ScrollBox)
-                    return &c.scrollBox;
-            return nullptr;
-        }
+    // One node of a UibinScene. Elements only exist inside the scene's depth-first element array:
+    // descendants follow their ancestor contiguously, and ids, names and component data live in
+    // storage owned by the scene.
+    struct UIElement
+    {
+        static constexpr size_t COMPONENT_KIND_COUNT = static_cast<size_t>(UIComponentKind::Unknown);
+        static constexpr uint32_t NO_PARENT = std::numeric_limits<uint32_t>::max();
+        static constexpr int32_t NO_COMPONENT = -1;
 
-        const TabContainerData* GetTabContainer() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::TabContainer)
-                    return &c.tabContainer;
-            return nullptr;
-        }
+        std::string_view id;
+        std::string_view name;
 
-        const RadialMenuData* GetRadialMenu() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::RadialMenu)
-                    return &c.radialMenu;
-            return nullptr;
-        }
+        uint32_t index = 0;
+        uint32_t parent = NO_PARENT;
+        // This element plus all of its descendants
+        uint32_t subtreeSize = 1;
+        uint32_t childCount = 0;
 
-        const MinimapData* GetMinimap() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::Minimap)
-                    return &c.minimap;
-            return nullptr;
-        }
+        // Row in the scene's table for each component kind; the first component of a kind wins
+        std::array<int32_t, COMPONENT_KIND_COUNT> componentRows;
+        UIComponentTables* components = nullptr;
 
-        const DragSlotData* GetDragSlot() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::DragSlot)
-                    return &c.dragSlot;
-            return nullptr;
-        }
+        mutable UIElementLayout layout;
 
-        const ListRepeaterData* GetListRepeater() const
-        {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::ListRepeater)
-                    return &c.listRepeater;
-            return nullptr;
-        }
+        UIElement() { componentRows.fill(NO_COMPONENT); }
+
+        UIChildRange<UIElement> Children() { return {this + 1, childCount}; }
+        UIChildRange<const UIElement> Children() const { return {this + 1, childCount}; }
 
-        const TooltipData* GetTooltip() const
+        [[nodiscard]]
+        bool HasComponent(UIComponentKind kind) const
         {
-            for (const auto& c : components)
-                if (c.kind == UIComponentKind::Tooltip)
-                    return &c.tooltip;
-            return nullptr;
+            return kind != UIComponentKind::Unknown && componentRows[static_cast<size_t>(kind)] != NO_COMPONENT;
         }
 
-        UIElement* FindById(const std::string& searchId)
+        template<typename T>
+        const T* Get() const
         {
-            if (id == searchId) return this;
-            for (auto& child : children)
-                if (auto* found = child.FindById(searchId))
-                    return found;
-            return nullptr;
+            constexpr UIComponentKind kind = ComponentKindOf<T>();
+            static_assert(kind != UIComponentKind::Unknown, "Not a component data type");
+
+            const int32_t row = componentRows[static_cast<size_t>(kind)];
+
+            if (row == NO_COMPONENT || !components)
+                return nullptr;
+
+            return &std::get<static_cast<size_t>(kind)>(*components)[static_cast<size_t>(row)];
         }
 
-        UIElement* FindByName(const std::string& searchName)
+        template<typename T>
+        T* Get()
         {
-            if (name == searchName) return this;
-            for (auto& child : children)
-                if (auto* found = child.FindByName(searchName))
-                    return found;
-            return nullptr;
+            return const_cast<T*>(std::as_const(*this).template Get<T>());
         }
+
+        const TransformData* GetTransform() const { return Get<TransformData>(); }
+        const ImageData* GetImage() const { return Get<ImageData>(); }
+        const TextData* GetText() const { return Get<TextData>(); }
+        const PanelData* GetPanel() const { return Get<PanelData>(); }
+        const ButtonData* GetButton() const { return Get<ButtonData>(); }
+        const ProgressBarData* GetProgressBar() const { return Get<ProgressBarData>(); }
+        const ToggleData* GetToggle() const { return Get<ToggleData>(); }
+        ToggleData* GetToggle() { return Get<ToggleData>(); }
+        const DropdownData* GetDropdown() const { return Get<DropdownData>(); }
+        DropdownData* GetDropdown() { return Get<DropdownData>(); }
+        const TextInputData* GetTextInput() const { return Get<TextInputData>(); }
+        TextInputData* GetTextInput() { return Get<TextInputData>(); }
+        const ModalData* GetModal() const { return Get<ModalData>(); }
+        const IconData* GetIcon() const { return Get<IconData>(); }
+        const SpriteData* GetSprite() const { return Get<SpriteData>(); }
+        const StackLayoutData* GetStackLayout() const { return Get<StackLayoutData>(); }
+        const GridLayoutData* GetGridLayout() const { return Get<GridLayoutData>(); }
+        const ScrollBoxData* GetScrollBox() const { return Get<ScrollBoxData>(); }
+        const TabContainerData* GetTabContainer() const { return Get<TabContainerData>(); }
+        const RadialMenuData* GetRadialMenu() const { return Get<RadialMenuData>(); }
+        const MinimapData* GetMinimap() const { return Get<MinimapData>(); }
+        const DragSlotData* GetDragSlot() const { return Get<DragSlotData>(); }
+        const ListRepeaterData* GetListRepeater() const { return Get<ListRepeaterData>(); }
+        const TooltipData* GetTooltip() const { return Get<TooltipData>(); }
     };
 }
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace RenderStar::Client::UI
+{
+    struct UIElement;
+
+    // Uniform grid over screen space holding interactive element rects in paint order.
+    // Query returns the most recently inserted rect under the point, i.e. the topmost one.
+    class UISpatialIndex
+    {
+    public:
+
+        void Reset(float width, float height, float cellSize = DEFAULT_CELL_SIZE);
+        void Clear();
+
+        void Insert(const UIElement* element, float x, float y, float w, float h);
+
+        [[nodiscard]]
+        const UIElement* Query(double x, double y) const;
+
+        [[nodiscard]]
+        size_t GetEntryCount() const { return entries.size(); }
+
+        static constexpr float DEFAULT_CELL_SIZE = 64.0f;
+
+    private:
+
+        struct Entry
+        {
+            const UIElement* element;
+            float x, y, w, h;
+
+            [[nodiscard]]
+            bool Contains(double px, double py) const
+            {
+                return px >= x && px <= x + w && py >= y && py <= y + h;
+            }
+        };
+
+        [[nodiscard]]
+        int32_t CellCoordinate(double value, int32_t count) const;
+
+        std::vector<Entry> entries;
+        std::vector<std::vector<uint32_t>> cells;
+        int32_t columns = 0;
+        int32_t rows = 0;
+        float cellSize = DEFAULT_CELL_SIZE;
+    };
+}
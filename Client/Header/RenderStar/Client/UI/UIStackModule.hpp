@@ -2,10 +2,15 @@
 
 #include "RenderStar/Client/UI/UibinScene.hpp"
 #include "RenderStar/Client/UI/FontAtlas.hpp"
+#include "RenderStar/Client/UI/UIBatcher.hpp"
+#include "RenderStar/Client/UI/UISpatialIndex.hpp"
+#include "RenderStar/Common/Asset/AssetLocation.hpp"
 #include "RenderStar/Common/Module/AbstractModule.hpp"
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -28,6 +33,11 @@ namespace RenderStar::Client::Input
     class ClientInputModule;
 }
 
+namespace RenderStar::Common::Asset
+{
+    class AssetModule;
+}
+
 namespace RenderStar::Client::UI
 {
 
@@ -36,6 +46,7 @@ namespace RenderStar::Client::UI
     public:
 
         void PushLayer(UibinScene scene);
+        void PushLayer(UibinScene scene, Common::Asset::AssetLocation source);
         void PopLayer();
         void ClearLayers();
 
@@ -44,11 +55,20 @@ namespace RenderStar::Client::UI
 
         size_t GetLayerCount() const { return layerStack.size(); }
 
+        // The last built frame is resubmitted until something marks the UI dirty.
+        // FindById/FindByName do this for callers that edit the returned element.
+        void MarkDirty() { ++contentGeneration; }
+
+        size_t ReloadLayers(const std::vector<Common::Asset::AssetLocation>& affected, Common::Asset::AssetModule& assetModule);
+
         void Render(Render::IRenderBackend* backend);
 
         void SetupRenderState(Render::IBufferManager* bm, Render::IUniformManager* um, Render::ITextureManager* tm);
         void SetShader(std::unique_ptr<Render::IShaderProgram> shader);
         void SetDefaultFont(std::vector<uint8_t> fontData);
+
+        // Distance-field glyphs (the default) stay sharp at any scale and share one atlas entry per face
+        void SetGlyphRenderMode(GlyphRenderMode mode);
         void Cleanup();
 
         void ProcessInput(Input::ClientInputModule* input);
@@ -77,6 +97,7 @@ namespace RenderStar::Client::UI
         struct UILayer
         {
             UibinScene scene;
+            std::optional<Common::Asset::AssetLocation> source;
             std::unordered_map<std::string, std::unique_ptr<Render::ITextureHandle>> textures;
         };
 
@@ -85,51 +106,72 @@ namespace RenderStar::Client::UI
             float x, y, w, h;
         };
 
-        void RenderElement(const UIElement& element, Render::IRenderBackend* backend,
+        void BuildFrame();
+
+        void RenderElement(const UIElement& element,
             float parentX, float parentY, float parentW, float parentH);
 
         void ComputeRect(const TransformData& t,
             float parentX, float parentY, float parentW, float parentH,
             float& outX, float& outY, float& outW, float& outH) const;
 
-        void DrawQuad(Render::IRenderBackend* backend,
+        void DrawQuad(
             float x, float y, float w, float h,
             float u0, float v0, float u1, float v1,
             const UibinColor& tint, Render::ITextureHandle* texture,
-            float rotation = 0.0f, float cornerRadius = 0.0f);
+            float rotation = 0.0f, float cornerRadius = 0.0f, bool distanceField = false);
 
-        void DrawNineSlice(Render::IRenderBackend* backend,
+        void DrawNineSlice(
             float x, float y, float w, float h,
             int32_t sliceL, int32_t sliceT, int32_t sliceR, int32_t sliceB,
             Render::ITextureHandle* texture, const UibinColor& tint, float cornerRadius = 0.0f);
 
         Render::ITextureHandle* GetOrUploadTexture(const std::string& assetKey, UILayer& layer);
 
-        void RenderText(Render::IRenderBackend* backend,
+        float ScaledFontSize(int32_t pixelSize) const;
+        int32_t ResolveFontFace(const std::string& fontPath, UILayer& layer);
+
+        void RenderText(
             const TextData& textData, float x, float y, float w, float h,
             UILayer& layer);
 
         UIElement* HitTest(double cursorX, double cursorY);
-        UIElement* HitTestElement(UIElement& element, double cursorX, double cursorY);
+
+        // Drops everything that points into the layer stack; used when layers are added, removed or replaced
+        void InvalidateStructure();
 
         UniformSlot& AcquireUniformSlot();
 
-        void DrawArcSlice(Render::IRenderBackend* backend,
-            float cx, float cy, float outerR, Render::Resource::Mesh* arcMesh,
+        void SubmitBatches(Render::IRenderBackend* backend);
+
+        // Arc geometry is stored in unit space (0..1) and placed into the batch per draw
+        struct ArcGeometry
+        {
+            std::vector<UIVertex> vertices;
+            std::vector<uint32_t> indices;
+        };
+
+        void DrawArcSlice(
+            float cx, float cy, float outerR, const ArcGeometry& arc,
             const UibinColor& tint);
 
         struct ArcMeshSet
         {
-            std::vector<std::unique_ptr<Render::Resource::Mesh>> slices;
-            std::unique_ptr<Render::Resource::Mesh> outerRing;
-            std::unique_ptr<Render::Resource::Mesh> innerRing;
+            std::vector<ArcGeometry> slices;
+            ArcGeometry outerRing;
+            ArcGeometry innerRing;
             int sliceCount = 0;
             float radiusRatio = 0.0f;
         };
 
         ArcMeshSet& GetOrCreateArcMeshes(int sliceCount, float innerR, float outerR);
 
-        std::unique_ptr<Render::Resource::Mesh> quadMesh;
+        // All quads of a frame are collected here and uploaded once into the frame's batch mesh
+        UIBatcher batcher;
+        std::vector<std::unique_ptr<Render::Resource::Mesh>> batchMeshes; // one per frame-in-flight
+        std::vector<uint64_t> batchMeshGenerations; // content generation last uploaded into each batch mesh
+        std::vector<UIVertex> arcScratch;
+
         std::unique_ptr<Render::ITextureHandle> whiteTexture;
         std::unique_ptr<Render::IShaderProgram> shader;
 
@@ -139,7 +181,13 @@ namespace RenderStar::Client::UI
         std::vector<UILayer> layerStack;
         UILayer* currentRenderLayer = nullptr;
 
-        std::unordered_map<std::string, std::unique_ptr<FontAtlas>> fontCache;
+        // Glyphs of every font and size share one dynamically packed page
+        FontAtlas fontAtlas;
+        GlyphRenderMode glyphRenderMode = GlyphRenderMode::SignedDistance;
+
+        // Rendered in one parallel batch when a face is first used in distance-field mode
+        static constexpr std::string_view PREWARM_CHARACTERS =
+            " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
 
         Render::IBufferManager* bufferManager = nullptr;
         Render::IUniformManager* uniformManager = nullptr;
@@ -153,6 +201,13 @@ namespace RenderStar::Client::UI
         float scaleX = 1.0f;
         float scaleY = 1.0f;
 
+        // Retained frame state
+        uint64_t contentGeneration = 1;
+        uint64_t builtGeneration = 0;
+        float builtScreenW = 0.0f;
+        float builtScreenH = 0.0f;
+        UISpatialIndex hitIndex;
+
         // Input state
         std::unordered_map<std::string, ComputedRect> computedRects;
         std::unordered_map<std::string, std::function<void()>> clickHandlers;
@@ -6,10 +6,8 @@ namespace RenderStar::Client::UI
 {
     struct UIUniformData
     {
-        float posX, posY, width, height;
-        float u0, v0, u1, v1;
-        float tintR, tintG, tintB, tintA;
-        float screenW, screenH, rotation, cornerRadius;
+        float screenW, screenH;
+        float padding0, padding1;
 
         static constexpr size_t Size() { return sizeof(UIUniformData); }
     };
@@ -1,22 +1,21 @@
 #pragma once
 
-#include "RenderStar/Client/Render/Resource/IVertex.hpp"
 #include "RenderStar/Client/Render/Resource/VertexLayout.hpp"
-#include <span>
 
 namespace RenderStar::Client::UI
 {
-    struct UIVertex final : public Render::IVertex
+    struct UIVertex
     {
         static const Render::VertexLayout LAYOUT;
 
-        float posX, posY;
-        float texU, texV;
-
-        UIVertex();
-        UIVertex(float posX, float posY, float texU, float texV);
-
-        const Render::VertexLayout& GetLayout() const override;
-        void WriteTo(std::span<float> array, size_t offset) const override;
+        float posX = 0.0f, posY = 0.0f;
+        float texU = 0.0f, texV = 0.0f;
+        float colorR = 1.0f, colorG = 1.0f, colorB = 1.0f, colorA = 1.0f;
+        float localX = 0.0f, localY = 0.0f;
+        float width = 0.0f, height = 0.0f, cornerRadius = 0.0f;
+        // 1 when the texture alpha is a signed distance field rather than coverage
+        float distanceField = 0.0f;
     };
+
+    static_assert(sizeof(UIVertex) == sizeof(float) * 14, "UIVertex is uploaded as a raw float array");
 }
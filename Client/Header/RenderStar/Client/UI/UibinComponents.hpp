@@ -1,8 +1,11 @@
 #pragma once
 
 #include "RenderStar/Client/UI/UibinTypes.hpp"
-#include <string>
 #include <cstdint>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 namespace RenderStar::Client::UI
 {
@@ -215,30 +218,28 @@ namespace RenderStar::Client::UI
         Unknown
     };
 
-    struct UIComponent
-    {
-        UIComponentKind kind = UIComponentKind::Unknown;
-
-        TransformData    transform;
-        ImageData        image;
-        TextData         text;
-        PanelData        panel;
-        ButtonData       button;
-        ProgressBarData  progressBar;
-        ToggleData       toggle;
-        DropdownData     dropdown;
-        TextInputData    textInput;
-        IconData         icon;
-        SpriteData       sprite;
-        TooltipData      tooltip;
-        ModalData        modal;
-        TabContainerData tabContainer;
-        RadialMenuData   radialMenu;
-        MinimapData      minimap;
-        DragSlotData     dragSlot;
-        ListRepeaterData listRepeater;
-        StackLayoutData  stackLayout;
-        GridLayoutData   gridLayout;
-        ScrollBoxData    scrollBox;
-    };
+    // One table per component kind, in UIComponentKind order; elements refer to rows by index
+    using UIComponentTables = std::tuple<
+        std::vector<TransformData>, std::vector<ImageData>, std::vector<TextData>, std::vector<PanelData>,
+        std::vector<ButtonData>, std::vector<ProgressBarData>, std::vector<ToggleData>, std::vector<DropdownData>,
+        std::vector<TextInputData>, std::vector<IconData>, std::vector<SpriteData>, std::vector<TooltipData>,
+        std::vector<ModalData>, std::vector<TabContainerData>, std::vector<RadialMenuData>, std::vector<MinimapData>,
+        std::vector<DragSlotData>, std::vector<ListRepeaterData>, std::vector<StackLayoutData>, std::vector<GridLayoutData>,
+        std::vector<ScrollBoxData>>;
+
+    static_assert(std::tuple_size_v<UIComponentTables> == static_cast<size_t>(UIComponentKind::Unknown));
+
+    template<UIComponentKind Kind>
+    using UIComponentData = typename std::tuple_element_t<static_cast<size_t>(Kind), UIComponentTables>::value_type;
+
+    template<typename T, size_t Index = 0>
+    consteval UIComponentKind ComponentKindOf()
+    {
+        if constexpr (Index == std::tuple_size_v<UIComponentTables>)
+            return UIComponentKind::Unknown;
+        else if constexpr (std::is_same_v<std::tuple_element_t<Index, UIComponentTables>, std::vector<T>>)
+            return static_cast<UIComponentKind>(Index);
+        else
+            return ComponentKindOf<T, Index + 1>();
+    }
 }
@@ -20,10 +20,21 @@ namespace RenderStar::Client::UI
         static std::optional<UibinScene> Load(const Common::Asset::AssetLocation& location, Common::Asset::AssetModule& assetModule);
         static std::optional<UibinScene> Parse(std::span<const uint8_t> data);
 
+        static constexpr uint32_t MAGIC     = 0x5549424E;
+        static constexpr uint32_t VERSION_1 = 1;
+        static constexpr uint32_t VERSION_2 = 2;
+
+        // Version 2 layout; see uibin_format_spec.txt
+        static constexpr size_t V2_HEADER_SIZE       = 96;
+        static constexpr size_t V2_ELEMENT_SIZE      = 20 + 4 * UIElement::COMPONENT_KIND_COUNT;
+        static constexpr size_t V2_TABLE_ENTRY_SIZE  = 16;
+        static constexpr size_t V2_ASSET_ENTRY_SIZE  = 24;
+
     private:
 
-        static constexpr uint32_t MAGIC       = 0x5549424E;
-        static constexpr uint32_t VERSION     = 1;
-        static constexpr size_t   HEADER_SIZE = 16;
+        static std::optional<UibinScene> ParseV1(std::span<const uint8_t> data);
+        static std::optional<UibinScene> ParseV2(std::span<const uint8_t> data);
+
+        static constexpr size_t V1_HEADER_SIZE = 16;
     };
 }
@@ -1,27 +1,53 @@
 #pragma once
 
 #include "RenderStar/Client/UI/UIElement.hpp"
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace RenderStar::Client::UI
 {
+    // A UI scene flattened for traversal: elements in depth-first order with elements[0] as the root,
+    // component data in one table per kind, and ids and names interned in a single string table.
+    // Elements point into the scene's heap storage, so a scene can be moved but not copied.
     struct UibinScene
     {
-        UIElement root;
+        static constexpr uint32_t EMPTY_BUCKET = 0xFFFFFFFF;
+
+        std::vector<UIElement> elements;
+        std::unique_ptr<UIComponentTables> components = std::make_unique<UIComponentTables>();
+
+        // String i is stringData[stringOffsets[i], stringOffsets[i + 1]); string 0 is empty
+        std::vector<char> stringData;
+        std::vector<uint32_t> stringOffsets;
+
+        // Open-addressed hash of element ids (power-of-two size); the first element in depth-first order wins
+        std::vector<uint32_t> idBuckets;
+
         std::unordered_map<std::string, std::vector<uint8_t>> assets;
         double designWidth = 0.0;
         double designHeight = 0.0;
 
-        UIElement* FindById(const std::string& id)
-        {
-            return root.FindById(id);
-        }
+        UIElement* GetRoot() { return elements.empty() ? nullptr : &elements.front(); }
+        const UIElement* GetRoot() const { return elements.empty() ? nullptr : &elements.front(); }
+
+        const UIElement* FindById(std::string_view id) const;
+        UIElement* FindById(std::string_view id) { return const_cast<UIElement*>(std::as_const(*this).FindById(id)); }
+
+        const UIElement* FindByName(std::string_view name) const;
+        UIElement* FindByName(std::string_view name) { return const_cast<UIElement*>(std::as_const(*this).FindByName(name)); }
+
+        [[nodiscard]]
+        std::string_view GetString(uint32_t index) const;
+
+        [[nodiscard]]
+        size_t GetStringCount() const { return stringOffsets.empty() ? 0 : stringOffsets.size() - 1; }
+
+        void BuildIdIndex();
 
-        UIElement* FindByName(const std::string& name)
-        {
-            return root.FindByName(name);
-        }
+        static uint32_t HashId(std::string_view id);
     };
 }
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "RenderStar/Client/UI/UibinScene.hpp"
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace RenderStar::Client::UI
+{
+    // Assembles a flattened UibinScene. Elements must be added depth-first: the parent of a new
+    // element is the most recently added element or one of its ancestors.
+    class UibinSceneBuilder
+    {
+    public:
+
+        UibinSceneBuilder();
+
+        // Returns the new element's index, or NO_PARENT when parent breaks depth-first order
+        uint32_t AddElement(uint32_t parent, std::string_view id, std::string_view name);
+
+        // Later components of a kind the element already has get a row but stay unreferenced
+        template<typename T>
+        T& AddComponent(uint32_t element)
+        {
+            constexpr auto kind = static_cast<size_t>(ComponentKindOf<T>());
+
+            auto& table = std::get<kind>(*scene.components);
+            int32_t& row = scene.elements[element].componentRows[kind];
+
+            if (row == UIElement::NO_COMPONENT)
+                row = static_cast<int32_t>(table.size());
+
+            return table.emplace_back();
+        }
+
+        void SetDesignSize(double width, double height);
+        void AddAsset(std::string key, std::vector<uint8_t> data);
+
+        UibinScene Build();
+
+    private:
+
+        uint32_t Intern(std::string_view text);
+        void CloseElement();
+
+        UibinScene scene;
+        std::vector<uint32_t> openElements;
+        std::vector<std::pair<uint32_t, uint32_t>> elementStrings;
+        std::unordered_map<std::string, uint32_t> internedStrings;
+    };
+}
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "RenderStar/Client/UI/UibinComponents.hpp"
+
+namespace RenderStar::Client::UI
+{
+    // Field order of every component row in uibin v2 tables. The loader and writer both walk
+    // these lists, so appending a field here changes the row size and needs a format bump.
+    template<typename T>
+    struct UibinFields;
+
+    template<>
+    struct UibinFields<TransformData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v) { v(d.x); v(d.y); v(d.scaleX); v(d.scaleY); v(d.rotationDegrees); v(d.anchors); v(d.stretch); }
+    };
+
+    template<>
+    struct UibinFields<ImageData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v) { v(d.imagePath); v(d.tint); v(d.assetPath); }
+    };
+
+    template<>
+    struct UibinFields<TextData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v) { v(d.text); v(d.fontFamily); v(d.pixelSize); v(d.color); v(d.fontPath); v(d.assetPath); v(d.alignment); }
+    };
+
+    template<>
+    struct UibinFields<PanelData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v) { v(d.backgroundColor); v(d.borderColor); v(d.borderWidth); v(d.cornerRadius); }
+    };
+
+    template<>
+    struct UibinFields<ButtonData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v)
+        {
+            v(d.text); v(d.backgroundColor); v(d.textColor); v(d.fontFamily); v(d.pixelSize); v(d.fontPath); v(d.assetPath); v(d.imagePath);
+            v(d.sliceLeft); v(d.sliceTop); v(d.sliceRight); v(d.sliceBottom);
+        }
+    };
+
+    template<>
+    struct UibinFields<ProgressBarData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v) { v(d.value); v(d.fillColor); v(d.backgroundColor); v(d.borderColor); v(d.direction); v(d.cornerRadius); }
+    };
+
+    template<>
+    struct UibinFields<ToggleData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v) { v(d.checked); v(d.onColor); v(d.offColor); v(d.knobColor); v(d.label); }
+    };
+
+    template<>
+    struct UibinFields<DropdownData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v) { v(d.options); v(d.selectedIndex); v(d.backgroundColor); v(d.textColor); v(d.borderColor); v(d.fontFamily); v(d.pixelSize); }
+    };
+
+    template<>
+    struct UibinFields<TextInputData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v)
+        {
+            v(d.placeholder); v(d.text); v(d.backgroundColor); v(d.textColor); v(d.placeholderColor); v(d.borderColor); v(d.fontFamily); v(d.pixelSize);
+        }
+    };
+
+    template<>
+    struct UibinFields<IconData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v) { v(d.imagePath); v(d.tintColor); v(d.iconSize); v(d.assetPath); }
+    };
+
+    template<>
+    struct UibinFields<SpriteData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v) { v(d.imagePath); v(d.frameWidth); v(d.frameHeight); v(d.frameCount); v(d.currentFrame); v(d.columns); v(d.assetPath); }
+    };
+
+    template<>
+    struct UibinFields<TooltipData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v) { v(d.tooltipText); v(d.backgroundColor); v(d.textColor); v(d.borderColor); v(d.fontFamily); v(d.pixelSize); }
+    };
+
+    template<>
+    struct UibinFields<ModalData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v) { v(d.overlayColor); v(d.panelColor); v(d.borderColor); v(d.cornerRadius); v(d.visible); }
+    };
+
+    template<>
+    struct UibinFields<TabContainerData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v)
+        {
+            v(d.tabNames); v(d.activeTab); v(d.tabHeight); v(d.activeColor); v(d.inactiveColor); v(d.textColor); v(d.backgroundColor);
+        }
+    };
+
+    template<>
+    struct UibinFields<RadialMenuData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v)
+        {
+            v(d.sliceCount); v(d.innerRadius); v(d.outerRadius); v(d.sliceColor); v(d.borderColor); v(d.highlightColor); v(d.highlightIndex);
+        }
+    };
+
+    template<>
+    struct UibinFields<MinimapData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v) { v(d.backgroundColor); v(d.borderColor); v(d.viewportColor); v(d.borderWidth); v(d.shape); }
+    };
+
+    template<>
+    struct UibinFields<DragSlotData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v)
+        {
+            v(d.slotSize); v(d.backgroundColor); v(d.borderColor); v(d.emptyColor); v(d.cornerRadius); v(d.isEmpty); v(d.iconPath); v(d.assetPath);
+        }
+    };
+
+    template<>
+    struct UibinFields<ListRepeaterData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v)
+        {
+            v(d.itemCount); v(d.itemHeight); v(d.spacing); v(d.direction); v(d.itemColor); v(d.alternateColor); v(d.borderColor);
+        }
+    };
+
+    template<>
+    struct UibinFields<StackLayoutData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v) { v(d.direction); v(d.spacing); v(d.padding); }
+    };
+
+    template<>
+    struct UibinFields<GridLayoutData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v) { v(d.columns); v(d.spacingH); v(d.spacingV); v(d.padding); }
+    };
+
+    template<>
+    struct UibinFields<ScrollBoxData>
+    {
+        template<typename D, typename V>
+        static void Visit(D& d, V&& v) { v(d.direction); v(d.spacing); v(d.padding); }
+    };
+
+    // Encoded sizes: strings are uint32 string-table indices, bools are uint32, colours are four floats
+    template<typename Field>
+    constexpr uint32_t UibinFieldSize()
+    {
+        if constexpr (std::is_same_v<Field, double>)
+            return 8;
+        else if constexpr (std::is_same_v<Field, UibinColor>)
+            return 16;
+        else
+            return 4;
+    }
+
+    template<typename T>
+    uint32_t UibinRowSize()
+    {
+        uint32_t size = 0;
+        const T sample{};
+        UibinFields<T>::Visit(sample, [&size]<typename Field>(const Field&) { size += UibinFieldSize<Field>(); });
+        return size;
+    }
+}
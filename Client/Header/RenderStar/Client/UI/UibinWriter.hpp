@@ -0,0 +1,16 @@
+#pragma once
+
+#include "RenderStar/Client/UI/UibinScene.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace RenderStar::Client::UI
+{
+    // Serializes a scene as uibin version 2, the flat binary layout UibinLoader maps straight into a UibinScene
+    class UibinWriter
+    {
+    public:
+
+        static std::vector<uint8_t> Write(const UibinScene& scene);
+    };
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace RenderStar::Client::UI
+{
+    inline constexpr uint32_t REPLACEMENT_CODEPOINT = 0xFFFD;
+
+    // Decodes the codepoint starting at offset and advances offset past it.
+    // Malformed, overlong and surrogate sequences yield U+FFFD and consume a single byte.
+    inline uint32_t DecodeUtf8(std::string_view text, size_t& offset)
+    {
+        const auto lead = static_cast<uint8_t>(text[offset]);
+
+        if (lead < 0x80)
+        {
+            ++offset;
+            return lead;
+        }
+
+        size_t length;
+        uint32_t codepoint;
+        uint32_t minimum;
+
+        if ((lead & 0xE0) == 0xC0)
+        {
+            length = 2;
+            codepoint = lead & 0x1F;
+            minimum = 0x80;
+        }
+        else if ((lead & 0xF0) == 0xE0)
+        {
+            length = 3;
+            codepoint = lead & 0x0F;
+            minimum = 0x800;
+        }
+        else if ((lead & 0xF8) == 0xF0)
+        {
+            length = 4;
+            codepoint = lead & 0x07;
+            minimum = 0x10000;
+        }
+        else
+        {
+            ++offset;
+            return REPLACEMENT_CODEPOINT;
+        }
+
+        if (offset + length > text.size())
+        {
+            ++offset;
+            return REPLACEMENT_CODEPOINT;
+        }
+
+        for (size_t i = 1; i < length; ++i)
+        {
+            const auto continuation = static_cast<uint8_t>(text[offset + i]);
+
+            if ((continuation & 0xC0) != 0x80)
+            {
+                ++offset;
+                return REPLACEMENT_CODEPOINT;
+            }
+
+            codepoint = (codepoint << 6) | (continuation & 0x3F);
+        }
+
+        if (codepoint < minimum || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+        {
+            ++offset;
+            return REPLACEMENT_CODEPOINT;
+        }
+
+        offset += length;
+        return codepoint;
+    }
+}
@@ -33,14 +33,31 @@
 #include "RenderStar/Common/Asset/AssetModule.hpp"
 #include "RenderStar/Common/Component/ComponentModule.hpp"
 #include "RenderStar/Common/Component/Components/Transform.hpp"
+#include "RenderStar/Common/Configuration/ConfigurationModule.hpp"
+#include "RenderStar/Common/Event/Events/AssetReloadEvent.hpp"
 #include "RenderStar/Common/Module/ModuleContext.hpp"
 #include "RenderStar/Common/Scene/SceneModule.hpp"
 #include "RenderStar/Common/Time/TimeModule.hpp"
 
+#include <array>
+#include <stdexcept>
+
 using namespace RenderStar::Client::Render;
 
 namespace RenderStar::Client::Core
 {
+    namespace
+    {
+        constexpr std::string_view SCENE_GEOMETRY_SHADER = "renderstar:shader/scene_geometry.rssl";
+        constexpr std::string_view SHADOW_DEPTH_SHADER = "renderstar:shader/shadow_depth.rssl";
+        constexpr std::string_view SKY_SHADER = "renderstar:shader/sky.rssl";
+        constexpr std::string_view UI_SHADER = "renderstar:shader/ui.rssl";
+        constexpr std::array<std::string_view, 4> STARTUP_SHADERS = { SCENE_GEOMETRY_SHADER, SHADOW_DEPTH_SHADER, SKY_SHADER, UI_SHADER };
+        constexpr std::string_view DEFAULT_FONT = "renderstar:font/times.ttf";
+        constexpr std::string_view TEST_UI_LAYER = "renderstar:ui/test.uibin";
+        constexpr std::array<std::string_view, Render::Framework::MAX_SHADOW_CASCADES> SHADOW_CASCADE_TARGETS = { "shadow_map", "shadow_map_1", "shadow_map_2", "shadow_map_3" };
+    }
+
     void ClientLifecycleModule::OnInitialize(Common::Module::ModuleContext& context)
     {
         if (auto platformOpt = context.GetModule<Render::Platform::RenderingPlatformModule>(); platformOpt.has_value())
@@ -52,6 +69,23 @@ namespace RenderStar::Client::Core
         if (auto frameworkOpt = context.GetModule<Render::Framework::RenderingFrameworkModule>(); frameworkOpt.has_value())
             frameworkModule = &frameworkOpt->get();
 
+        if (auto assetOpt = context.GetModule<Common::Asset::AssetModule>(); assetOpt.has_value())
+        {
+            assetModule = &assetOpt->get();
+
+            // The file watcher is a development aid, so shipped clients leave it off unless configured
+            bool hotReload = false;
+
+            if (auto configurationModule = context.GetModule<Common::Configuration::ConfigurationModule>(); configurationModule.has_value())
+            {
+                if (auto configOpt = configurationModule->get().For<ClientLifecycleModule>("render_star"))
+                    hotReload = (*configOpt)->GetBoolean("asset_hot_reload").value_or(false);
+            }
+
+            if (hotReload && assetModule->EnableHotReload())
+                logger->info("Asset hot reload enabled");
+        }
+
         SetupGameplayLogic(context);
         SetupMainLoop();
 
@@ -85,6 +119,9 @@ namespace RenderStar::Client::Core
         cachedBufferManager = nullptr;
         cachedUniformManager = nullptr;
         cachedTextureManager = nullptr;
+        cachedShaderManager = nullptr;
+        cachedBackend = nullptr;
+        assetModule = nullptr;
 
         logger->info("ClientLifecycleModule cleanup complete");
     }
@@ -93,9 +130,7 @@ namespace RenderStar::Client::Core
     {
         logger->info("OnRenderInitializeEvent called, backend={}", static_cast<void*>(backend));
 
-        const auto assetModule = context.GetModule<Common::Asset::AssetModule>();
-
-        if (!assetModule.has_value())
+        if (!assetModule)
             return Common::Event::EventResult::Failure("AssetModule not found");
 
         IShaderManager* shaderManager = backend->GetShaderManager();
@@ -105,20 +140,15 @@ namespace RenderStar::Client::Core
         if (!shaderManager || !bufferManager || !uniformManager)
             return Common::Event::EventResult::Failure("Failed to get managers from renderer backent");
 
-        Render::Shader::RsslTarget rsslTarget = (backend->GetType() == Render::RenderBackend::OPENGL)
-            ? Render::Shader::RsslTarget::OPENGL_GLSL
-            : Render::Shader::RsslTarget::VULKAN_GLSL;
+        cachedBackend = backend;
+        cachedShaderManager = shaderManager;
 
-        const auto rsslAsset = assetModule->get().LoadText(
-            Common::Asset::AssetLocation::Parse("renderstar:shader/scene_geometry.rssl"));
+        CompileStartupShaders();
 
-        if (!rsslAsset.IsValid())
-            return Common::Event::EventResult::Failure("Failed to load scene_geometry.rssl asset");
+        auto shader = BuildShader(Common::Asset::AssetLocation::Parse(SCENE_GEOMETRY_SHADER), ShaderTarget::SCENE_COLOR);
 
-        auto compiled = Render::Shader::RsslCompiler::Compile(rsslAsset.Get()->GetContent(), rsslTarget);
-
-        if (!compiled.IsValid())
-            return Common::Event::EventResult::Failure("Failed to compile scene_geometry.rssl");
+        if (!shader)
+            return Common::Event::EventResult::Failure("Failed to create scene_geometry.rssl shader program");
 
         cachedBufferManager = bufferManager;
         cachedUniformManager = uniformManager;
@@ -127,73 +157,31 @@ namespace RenderStar::Client::Core
         if (auto cameraAffector = context.GetModule<Render::Affectors::CameraAffector>(); cameraAffector.has_value())
             cameraAffector->get().SetViewportSize(backend->GetWidth(), backend->GetHeight());
 
-        std::unique_ptr<Render::IShaderProgram> shader;
-
-        if (platformModule && platformModule->IsEnabled())
-        {
-            shader = platformModule->CompileShaderForTarget(
-                compiled.vertexGlsl, compiled.fragmentGlsl,
-                "scene_color", Render::Framework::LitVertex::LAYOUT);
-        }
-        else
-        {
-            shader = shaderManager->CreateFromSource(
-                Render::ShaderSource{compiled.vertexGlsl, compiled.fragmentGlsl, {}});
-        }
-
-        if (!shader || !shader->IsValid())
-            return Common::Event::EventResult::Failure("Failed to create shader program");
-
         if (frameworkModule)
             frameworkModule->SetupRenderState(bufferManager);
 
         Render::IBufferHandle* sceneLightingBuffer = frameworkModule ? frameworkModule->GetSceneLightingBuffer() : nullptr;
+        const Render::Framework::LightClusterBuffers lightClusterBuffers = frameworkModule ? frameworkModule->GetLightClusterBuffers() : Render::Framework::LightClusterBuffers{};
 
         if (auto mapGeometryAffector = context.GetModule<Render::Affectors::MapGeometryRenderAffector>(); mapGeometryAffector.has_value())
         {
             mapGeometryAffector->get().SetupRenderState(bufferManager, uniformManager, cachedTextureManager);
             mapGeometryAffector->get().SetSceneLightingBuffer(sceneLightingBuffer);
+            mapGeometryAffector->get().SetLightClusterBuffers(lightClusterBuffers);
             mapGeometryAffector->get().SetShader(std::move(shader));
+            ConfigureSceneShaderVariants(mapGeometryAffector->get());
 
-            const auto shadowRsslAsset = assetModule->get().LoadText(
-                Common::Asset::AssetLocation::Parse("renderstar:shader/shadow_depth.rssl"));
-
-            if (shadowRsslAsset.IsValid() && platformModule && platformModule->IsEnabled())
-            {
-                auto shadowCompiled = Render::Shader::RsslCompiler::Compile(shadowRsslAsset.Get()->GetContent(), rsslTarget);
-
-                if (shadowCompiled.IsValid())
-                {
-                    auto shadowShader = platformModule->CompileShaderForTarget(
-                        shadowCompiled.vertexGlsl, shadowCompiled.fragmentGlsl,
-                        "shadow_map", Render::Framework::LitVertex::LAYOUT);
-
-                    if (shadowShader && shadowShader->IsValid())
-                        mapGeometryAffector->get().SetShadowShader(std::move(shadowShader));
-                }
-            }
+            if (auto shadowShader = BuildShader(Common::Asset::AssetLocation::Parse(SHADOW_DEPTH_SHADER), ShaderTarget::SHADOW_MAP))
+                mapGeometryAffector->get().SetShadowShader(std::move(shadowShader));
         }
 
         if (auto playerRenderAffector = context.GetModule<Render::Affectors::PlayerRenderAffector>(); playerRenderAffector.has_value())
         {
             playerRenderAffector->get().SetupRenderState(bufferManager, uniformManager, cachedTextureManager);
             playerRenderAffector->get().SetSceneLightingBuffer(sceneLightingBuffer);
+            playerRenderAffector->get().SetLightClusterBuffers(lightClusterBuffers);
 
-            std::unique_ptr<Render::IShaderProgram> playerShader;
-
-            if (platformModule && platformModule->IsEnabled())
-            {
-                playerShader = platformModule->CompileShaderForTarget(
-                    compiled.vertexGlsl, compiled.fragmentGlsl,
-                    "scene_color", Render::Framework::LitVertex::LAYOUT);
-            }
-            else
-            {
-                playerShader = shaderManager->CreateFromSource(
-                    Render::ShaderSource{compiled.vertexGlsl, compiled.fragmentGlsl, {}});
-            }
-
-            if (playerShader && playerShader->IsValid())
+            if (auto playerShader = BuildShader(Common::Asset::AssetLocation::Parse(SCENE_GEOMETRY_SHADER), ShaderTarget::SCENE_COLOR))
                 playerRenderAffector->get().SetShader(std::move(playerShader));
         }
 
@@ -201,33 +189,8 @@ namespace RenderStar::Client::Core
         {
             skyboxAffector->get().SetupRenderState(bufferManager, uniformManager);
 
-            const auto skyRsslAsset = assetModule->get().LoadText(
-                Common::Asset::AssetLocation::Parse("renderstar:shader/sky.rssl"));
-
-            if (skyRsslAsset.IsValid())
-            {
-                auto skyCompiled = Render::Shader::RsslCompiler::Compile(skyRsslAsset.Get()->GetContent(), rsslTarget);
-
-                if (skyCompiled.IsValid())
-                {
-                    std::unique_ptr<Render::IShaderProgram> skyShader;
-
-                    if (platformModule && platformModule->IsEnabled())
-                    {
-                        skyShader = platformModule->CompileShaderForTarget(
-                            skyCompiled.vertexGlsl, skyCompiled.fragmentGlsl,
-                            "scene_color", Render::Framework::LitVertex::LAYOUT);
-                    }
-                    else
-                    {
-                        skyShader = shaderManager->CreateFromSource(
-                            Render::ShaderSource{skyCompiled.vertexGlsl, skyCompiled.fragmentGlsl, {}});
-                    }
-
-                    if (skyShader && skyShader->IsValid())
-                        skyboxAffector->get().SetShader(std::move(skyShader));
-                }
-            }
+            if (auto skyShader = BuildShader(Common::Asset::AssetLocation::Parse(SKY_SHADER), ShaderTarget::SCENE_COLOR))
+                skyboxAffector->get().SetShader(std::move(skyShader));
         }
 
         if (frameworkModule && platformModule && platformModule->IsEnabled())
@@ -260,8 +223,7 @@ namespace RenderStar::Client::Core
             uiStackModule = &uiOpt->get();
             uiStackModule->SetupRenderState(bufferManager, uniformManager, cachedTextureManager);
 
-            const auto fontAsset = assetModule->get().LoadBinary(
-                Common::Asset::AssetLocation::Parse("renderstar:font/times.ttf"));
+            const auto fontAsset = assetModule->LoadBinary(Common::Asset::AssetLocation::Parse(DEFAULT_FONT));
 
             if (fontAsset.IsValid())
             {
@@ -269,49 +231,17 @@ namespace RenderStar::Client::Core
             }
             else
             {
-                logger->warn("Default font renderstar:font/times.ttf not found");
+                logger->warn("Default font {} not found", DEFAULT_FONT);
             }
 
-            const auto uiRsslAsset = assetModule->get().LoadText(
-                Common::Asset::AssetLocation::Parse("renderstar:shader/ui.rssl"));
-
-            if (uiRsslAsset.IsValid())
+            if (auto uiShader = BuildShader(Common::Asset::AssetLocation::Parse(UI_SHADER), ShaderTarget::OVERLAY))
             {
-                auto uiCompiled = Render::Shader::RsslCompiler::Compile(uiRsslAsset.Get()->GetContent(), rsslTarget);
-
-                if (uiCompiled.IsValid())
-                {
-                    std::unique_ptr<Render::IShaderProgram> uiShader;
-
-                    if (platformModule && platformModule->IsEnabled())
-                    {
-                        uiShader = platformModule->CompileOverlayShader(
-                            uiCompiled.vertexGlsl, uiCompiled.fragmentGlsl, UI::UIVertex::LAYOUT);
-                    }
-                    else
-                    {
-                        uiShader = shaderManager->CreateFromSource(
-                            Render::ShaderSource{uiCompiled.vertexGlsl, uiCompiled.fragmentGlsl, {}});
-                    }
-
-                    if (uiShader && uiShader->IsValid())
-                    {
-                        uiStackModule->SetShader(std::move(uiShader));
-                        logger->info("UI shader compiled and assigned");
-                    }
-                    else
-                    {
-                        logger->error("Failed to create UI shader program");
-                    }
-                }
-                else
-                {
-                    logger->error("Failed to compile ui.rssl");
-                }
+                uiStackModule->SetShader(std::move(uiShader));
+                logger->info("UI shader compiled and assigned");
             }
             else
             {
-                logger->warn("ui.rssl asset not found");
+                logger->error("Failed to create UI shader program");
             }
         }
 
@@ -334,7 +264,11 @@ namespace RenderStar::Client::Core
         auto& playerModule = context->GetDependency<Gameplay::ClientPlayerModule>();
         auto mapGeometryAffectorOpt = context->GetModule<Render::Affectors::MapGeometryRenderAffector>();
 
+        if (mapGeometryAffectorOpt.has_value())
+            mapGeometryAffectorOpt->get().BeginFrame();
+
         glm::mat4 viewProjection(1.0f);
+        Render::Framework::LightClusterView clusterView;
 
         playerEntity = playerModule.GetLocalPlayerEntity();
         glm::vec3 cameraPosition(0.0f);
@@ -342,7 +276,11 @@ namespace RenderStar::Client::Core
         if (playerEntity.IsValid())
         {
             if (auto cameraOpt = componentModule.GetComponent<Components::Camera>(playerEntity); cameraOpt.has_value())
+            {
                 viewProjection = cameraOpt->get().GetViewProjectionMatrix();
+                clusterView.nearDepth = cameraOpt->get().nearPlane;
+                clusterView.farDepth = cameraOpt->get().farPlane;
+            }
 
             if (auto transformOpt = componentModule.GetComponent<Common::Component::Transform>(playerEntity); transformOpt.has_value())
                 cameraPosition = transformOpt->get().worldPosition;
@@ -350,7 +288,8 @@ namespace RenderStar::Client::Core
 
         if (frameworkModule)
         {
-            frameworkModule->CollectSceneData(componentModule, cameraPosition);
+            clusterView.viewProjection = viewProjection;
+            frameworkModule->CollectSceneData(componentModule, cameraPosition, clusterView);
 
             if (auto volumeAffectorOpt = context->GetModule<Render::Affectors::AdaptiveVolumeAffector>();
                 volumeAffectorOpt.has_value())
@@ -364,13 +303,29 @@ namespace RenderStar::Client::Core
         {
             if (frameworkModule && mapGeometryAffectorOpt.has_value())
             {
-                platformModule->BeginTarget("shadow_map", true);
-                mapGeometryAffectorOpt->get().RenderShadowDepth(componentModule, backend, frameworkModule->GetLightViewProjection());
-                backend->ExecuteDrawCommands();
-                platformModule->EndTarget("shadow_map");
+                auto& mapGeometryAffector = mapGeometryAffectorOpt->get();
+                const auto cascades = frameworkModule->GetShadowCascades();
+                std::array<Render::ITextureHandle*, Render::Framework::MAX_SHADOW_CASCADES> cascadeTextures{};
+
+                for (uint32_t cascade = 0; cascade < cascades.size(); ++cascade)
+                    cascadeTextures[cascade] = platformModule->GetTargetColorTexture(std::string(SHADOW_CASCADE_TARGETS[cascade]));
 
-                auto* shadowTex = platformModule->GetTargetColorTexture("shadow_map");
-                mapGeometryAffectorOpt->get().SetShadowMapTexture(shadowTex);
+                // Before preparing, so a recreated target (first frame, resize) is redrawn this frame rather than sampled empty
+                mapGeometryAffector.SetShadowCascadeTextures(cascadeTextures);
+
+                for (uint32_t cascade = 0; cascade < cascades.size(); ++cascade)
+                {
+                    const std::string target(SHADOW_CASCADE_TARGETS[cascade]);
+
+                    // Cascades whose light frustum and casters are unchanged keep the map drawn in an earlier frame
+                    if (!cascadeTextures[cascade] || !mapGeometryAffector.PrepareShadowCascade(componentModule, cascade, cascades[cascade].viewProjection))
+                        continue;
+
+                    platformModule->BeginTarget(target, true);
+                    mapGeometryAffector.RenderShadowCascade(componentModule, backend, cascade);
+                    backend->ExecuteDrawCommands();
+                    platformModule->EndTarget(target);
+                }
             }
 
             if (auto skyboxAffectorOpt = context->GetModule<Render::Affectors::SkyboxRenderAffector>(); skyboxAffectorOpt.has_value())
@@ -430,9 +385,303 @@ namespace RenderStar::Client::Core
 
         backend->EndFrame();
 
+        if (pendingReloadDetectedAt.has_value())
+        {
+            const auto latency = std::chrono::steady_clock::now() - *pendingReloadDetectedAt;
+            pendingReloadDetectedAt.reset();
+
+            if (assetModule)
+                assetModule->RecordReloadLatency(std::chrono::duration_cast<std::chrono::nanoseconds>(latency));
+
+            logger->info("Asset reload visible after {:.2f} ms", std::chrono::duration<double, std::milli>(latency).count());
+        }
+
         return Common::Event::EventResult::Success();
     }
 
+    Common::Event::EventResult ClientLifecycleModule::OnAssetReloadEvent(const Common::Event::Events::AssetReloadEvent& event)
+    {
+        if (auto configurationModule = context->GetModule<Common::Configuration::ConfigurationModule>(); configurationModule.has_value())
+            configurationModule->get().Reload(event.changed);
+
+        if (!cachedBackend || !assetModule)
+            return Common::Event::EventResult::Success();
+
+        const auto affects = [&event](const std::string_view identifier)
+        {
+            return event.Affects(Common::Asset::AssetLocation::Parse(identifier));
+        };
+
+        cachedBackend->WaitIdle();
+
+        // Changed shaders are parsed again on their next build; the rest keep their startup batch results
+        for (const std::string_view identifier : STARTUP_SHADERS)
+        {
+            if (affects(identifier))
+                shaderVariants.Invalidate(Common::Asset::AssetLocation::Parse(identifier).ToString());
+        }
+
+        size_t rebuilt = 0;
+
+        if (affects(SCENE_GEOMETRY_SHADER))
+        {
+            if (auto mapGeometryAffector = context->GetModule<Render::Affectors::MapGeometryRenderAffector>(); mapGeometryAffector.has_value())
+            {
+                if (auto shader = BuildShader(Common::Asset::AssetLocation::Parse(SCENE_GEOMETRY_SHADER), ShaderTarget::SCENE_COLOR))
+                {
+                    mapGeometryAffector->get().SetShader(std::move(shader));
+                    ConfigureSceneShaderVariants(mapGeometryAffector->get());
+                    ++rebuilt;
+                }
+            }
+
+            if (auto playerRenderAffector = context->GetModule<Render::Affectors::PlayerRenderAffector>(); playerRenderAffector.has_value())
+            {
+                if (auto shader = BuildShader(Common::Asset::AssetLocation::Parse(SCENE_GEOMETRY_SHADER), ShaderTarget::SCENE_COLOR))
+                {
+                    playerRenderAffector->get().SetShader(std::move(shader));
+                    ++rebuilt;
+                }
+            }
+        }
+
+        if (affects(SHADOW_DEPTH_SHADER))
+        {
+            if (auto mapGeometryAffector = context->GetModule<Render::Affectors::MapGeometryRenderAffector>(); mapGeometryAffector.has_value())
+            {
+                if (auto shader = BuildShader(Common::Asset::AssetLocation::Parse(SHADOW_DEPTH_SHADER), ShaderTarget::SHADOW_MAP))
+                {
+                    mapGeometryAffector->get().SetShadowShader(std::move(shader));
+                    ++rebuilt;
+                }
+            }
+        }
+
+        if (affects(SKY_SHADER))
+        {
+            if (auto skyboxAffector = context->GetModule<Render::Affectors::SkyboxRenderAffector>(); skyboxAffector.has_value())
+            {
+                if (auto shader = BuildShader(Common::Asset::AssetLocation::Parse(SKY_SHADER), ShaderTarget::SCENE_COLOR))
+                {
+                    skyboxAffector->get().SetShader(std::move(shader));
+                    ++rebuilt;
+                }
+            }
+        }
+
+        if (uiStackModule)
+        {
+            if (affects(UI_SHADER))
+            {
+                if (auto shader = BuildShader(Common::Asset::AssetLocation::Parse(UI_SHADER), ShaderTarget::OVERLAY))
+                {
+                    uiStackModule->SetShader(std::move(shader));
+                    ++rebuilt;
+                }
+            }
+
+            if (affects(DEFAULT_FONT))
+            {
+                if (const auto fontAsset = assetModule->LoadBinary(Common::Asset::AssetLocation::Parse(DEFAULT_FONT)); fontAsset.IsValid())
+                {
+                    uiStackModule->SetDefaultFont(fontAsset.Get()->GetData());
+                    ++rebuilt;
+                }
+            }
+
+            rebuilt += uiStackModule->ReloadLayers(event.affected, *assetModule);
+        }
+
+        if (rebuilt > 0)
+        {
+            logger->info("Rebuilt {} resources after change to {}", rebuilt, event.changed.ToString());
+
+            if (!pendingReloadDetectedAt.has_value() || event.detectedAt < *pendingReloadDetectedAt)
+                pendingReloadDetectedAt = event.detectedAt;
+        }
+
+        return Common::Event::EventResult::Success();
+    }
+
+    std::unique_ptr<IShaderProgram> ClientLifecycleModule::BuildShader(
+        const Common::Asset::AssetLocation& location,
+        const ShaderTarget target,
+        const std::optional<Render::Shader::RsslPermutationMask> permutation)
+    {
+        if (!assetModule || !cachedBackend || !cachedShaderManager)
+            return nullptr;
+
+        const bool platformEnabled = platformModule && platformModule->IsEnabled();
+
+        if (target == ShaderTarget::SHADOW_MAP && !platformEnabled)
+            return nullptr;
+
+        const auto programName = location.ToString();
+
+        if (!shaderVariants.Contains(programName))
+        {
+            assetModule->ClearDependencies(location);
+
+            const auto source = assetModule->LoadText(location);
+
+            if (!source.IsValid())
+            {
+                logger->warn("Shader source {} not found", programName);
+                return nullptr;
+            }
+
+            const Render::Shader::IncludeResolver resolver = [this, &location](const std::string& path, const std::string&)
+            {
+                const auto includeLocation = Common::Asset::AssetLocation::Of(location.GetNamespace(), "shader/" + path);
+
+                assetModule->RecordDependency(location, includeLocation);
+
+                const auto include = assetModule->LoadText(includeLocation);
+
+                if (!include.IsValid())
+                    throw std::runtime_error("Include not found: " + includeLocation.ToString());
+
+                return include.Get()->GetContent();
+            };
+
+            shaderVariants.Register(programName, Render::Shader::RsslCompiler::Parse(source.Get()->GetContent(), resolver, programName));
+        }
+
+        const auto parsed = shaderVariants.GetParsed(programName);
+        const auto compiled = shaderVariants.GetOrCompile(programName, GetRsslTarget(), permutation.value_or(parsed->GetFullPermutationMask()));
+
+        if (!compiled || !compiled->IsValid())
+        {
+            logger->error("Failed to compile {}", programName);
+            return nullptr;
+        }
+
+        std::unique_ptr<IShaderProgram> shader;
+
+        if (platformEnabled)
+        {
+            switch (target)
+            {
+                case ShaderTarget::SCENE_COLOR:
+                    shader = platformModule->CompileShaderForTarget(compiled->vertexGlsl, compiled->fragmentGlsl, "scene_color", Render::Framework::LitVertex::LAYOUT);
+                    break;
+                case ShaderTarget::SHADOW_MAP:
+                    shader = platformModule->CompileShaderForTarget(compiled->vertexGlsl, compiled->fragmentGlsl, "shadow_map", Render::Framework::LitVertex::LAYOUT);
+                    break;
+                case ShaderTarget::OVERLAY:
+                    shader = platformModule->CompileOverlayShader(compiled->vertexGlsl, compiled->fragmentGlsl, UI::UIVertex::LAYOUT);
+                    break;
+            }
+        }
+        else
+        {
+            shader = cachedShaderManager->CreateFromSource(Render::ShaderSource{compiled->vertexGlsl, compiled->fragmentGlsl, {}});
+        }
+
+        if (!shader || !shader->IsValid())
+            return nullptr;
+
+        return shader;
+    }
+
+    void ClientLifecycleModule::CompileStartupShaders()
+    {
+        const bool platformEnabled = platformModule && platformModule->IsEnabled();
+
+        std::vector<Render::Shader::RsslBatchSource> sources;
+        size_t reused = 0;
+
+        for (const std::string_view identifier : STARTUP_SHADERS)
+        {
+            if (identifier == SHADOW_DEPTH_SHADER && !platformEnabled)
+                continue;
+
+            const auto location = Common::Asset::AssetLocation::Parse(identifier);
+            const auto programName = location.ToString();
+
+            // Stages the render platform shares with the lifecycle, such as scene_geometry, are already compiled
+            if (const auto* program = platformEnabled ? platformModule->FindStageShader(programName) : nullptr; program && program->GetCompiled(GetRsslTarget()))
+            {
+                shaderVariants.Register(*program);
+                ++reused;
+                continue;
+            }
+
+            const auto source = assetModule->LoadText(location);
+
+            if (!source.IsValid())
+            {
+                logger->warn("Shader source {} not found", programName);
+                continue;
+            }
+
+            sources.push_back({programName, source.Get()->GetContent()});
+        }
+
+        const auto includeLocation = [](const std::string& requestingFile, const std::string& path)
+        {
+            return Common::Asset::AssetLocation::Of(Common::Asset::AssetLocation::Parse(requestingFile).GetNamespace(), "shader/" + path);
+        };
+
+        const Render::Shader::IncludeResolver resolver = [this, &includeLocation](const std::string& path, const std::string& requestingFile)
+        {
+            const auto location = includeLocation(requestingFile, path);
+            const auto include = assetModule->LoadText(location);
+
+            if (!include.IsValid())
+                throw std::runtime_error("Include not found: " + location.ToString());
+
+            return include.Get()->GetContent();
+        };
+
+        const auto batch = Render::Shader::RsslCompiler::CompileBatch(sources, resolver, {GetRsslTarget()});
+
+        for (const auto& [program, includes] : batch.dependencies.includesByProgram)
+        {
+            const auto location = Common::Asset::AssetLocation::Parse(program);
+
+            assetModule->ClearDependencies(location);
+
+            for (const auto& include : includes)
+                assetModule->RecordDependency(location, includeLocation(program, include));
+        }
+
+        for (const auto& program : batch.programs)
+            shaderVariants.Register(program);
+
+        logger->info("Compiled {} startup shaders ({} shared includes, {} reused from the render platform)", batch.programs.size(), batch.parsedIncludeCount, reused);
+    }
+
+    Render::Shader::RsslTarget ClientLifecycleModule::GetRsslTarget() const
+    {
+        return cachedBackend->GetType() == Render::RenderBackend::OPENGL
+            ? Render::Shader::RsslTarget::OPENGL_GLSL
+            : Render::Shader::RsslTarget::VULKAN_GLSL;
+    }
+
+    void ClientLifecycleModule::ConfigureSceneShaderVariants(Render::Affectors::MapGeometryRenderAffector& affector)
+    {
+        const auto location = Common::Asset::AssetLocation::Parse(SCENE_GEOMETRY_SHADER);
+        const auto parsed = shaderVariants.GetParsed(location.ToString());
+
+        if (!parsed || parsed->permutationKeys.empty())
+        {
+            affector.SetShaderVariantFactory(nullptr, {});
+            return;
+        }
+
+        affector.SetShaderVariantFactory(
+            [this, location](const Render::Shader::RsslPermutationMask permutation)
+            {
+                return BuildShader(location, ShaderTarget::SCENE_COLOR, permutation);
+            },
+            {
+                parsed->GetPermutationBit("HAS_NORMAL_MAP"),
+                parsed->GetPermutationBit("HAS_EMISSION_MAP"),
+                parsed->GetPermutationBit("HAS_DETAIL_MAP")
+            });
+    }
+
     void ClientLifecycleModule::SetupGameplayLogic(Common::Module::ModuleContext& context)
     {
         if (const auto coreEventBus = context.GetEventBus<Event::ClientCoreEventBus>(); !coreEventBus.has_value())
@@ -461,23 +710,28 @@ namespace RenderStar::Client::Core
             return OnRenderFrameEvent(event.backend);
         });
 
+        renderEventBus.value().get().Subscribe<Common::Event::Events::AssetReloadEvent>([this](const auto& event)
+        {
+            return OnAssetReloadEvent(event);
+        });
+
         auto& windowModule = context.GetDependency<ClientWindowModule>();
 
         if (auto cameraAffector = context.GetModule<Render::Affectors::CameraAffector>(); cameraAffector.has_value())
             cameraAffector->get().SetViewportSize(static_cast<int32_t>(windowModule.GetWidth()), static_cast<int32_t>(windowModule.GetHeight()));
 
-        auto& assetModule = context.GetDependency<Common::Asset::AssetModule>();
-
         const auto uiModule = context.GetModule<UI::UIStackModule>();
 
-        if (uiModule.has_value())
+        if (uiModule.has_value() && assetModule)
         {
-            auto scene = UI::UibinLoader::Load(
-                Common::Asset::AssetLocation::Parse("renderstar:ui/test.uibin"), assetModule);
+            const auto layerLocation = Common::Asset::AssetLocation::Parse(TEST_UI_LAYER);
+            auto scene = UI::UibinLoader::Load(layerLocation, *assetModule);
+
+            assetModule->RecordDependency(layerLocation, Common::Asset::AssetLocation::Parse(DEFAULT_FONT));
 
             if (scene.has_value())
             {
-                uiModule->get().PushLayer(std::move(*scene));
+                uiModule->get().PushLayer(std::move(*scene), layerLocation);
                 logger->info("Loaded test.uibin UI scene");
             }
             else
@@ -528,6 +782,8 @@ namespace RenderStar::Client::Core
         auto mapGeometryOpt = context->GetModule<Render::Affectors::MapGeometryRenderAffector>();
         Render::Affectors::MapGeometryRenderAffector* mapGeometryAffector = mapGeometryOpt.has_value() ? &mapGeometryOpt->get() : nullptr;
 
+        auto* reloadingAssetModule = assetModule;
+
         auto uiModuleOpt = context->GetModule<UI::UIStackModule>();
         UI::UIStackModule* uiModule = uiModuleOpt.has_value() ? &uiModuleOpt->get() : nullptr;
 
@@ -573,6 +829,9 @@ namespace RenderStar::Client::Core
 
             clientSceneModule->SendDirtyEntityUpdates();
 
+            if (reloadingAssetModule)
+                reloadingAssetModule->PublishReloads(renderEventBus);
+
             renderEventBus.Publish(Event::Events::ClientRenderFrameEvent(rendererModule->GetBackend()));
 
             inputModule->EndFrame();
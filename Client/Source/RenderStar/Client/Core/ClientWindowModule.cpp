@@ -9,7 +9,7 @@
 
 namespace RenderStar::Client::Core
 {
-    ClientWindowModule::ClientWindowModule() : window(nullptr), title("RenderStar"), width(800), height(600), preferredBackend(Render::RenderBackend::VULKAN), forceBackend(false) { }
+    ClientWindowModule::ClientWindowModule() : window(nullptr), title("RenderStar"), width(800), height(600), preferredBackend(Render::RenderBackend::VULKAN), forceBackend(false), headlessFrameLimit(0), headlessFrameCount(0), closeRequested(false) { }
 
     ClientWindowModule::~ClientWindowModule()
     {
@@ -23,20 +23,33 @@ namespace RenderStar::Client::Core
 
     void ClientWindowModule::Tick()
     {
-        glfwPollEvents();
+        if (IsHeadless())
+            ++headlessFrameCount;
+        else
+            glfwPollEvents();
     }
 
     bool ClientWindowModule::ShouldClose() const
     {
+        if (IsHeadless())
+            return closeRequested || (headlessFrameLimit > 0 && headlessFrameCount > headlessFrameLimit);
+
         return window != nullptr && glfwWindowShouldClose(window);
     }
 
     void ClientWindowModule::Close()
     {
-        if (window != nullptr)
+        if (IsHeadless())
+            closeRequested = true;
+        else if (window != nullptr)
             glfwSetWindowShouldClose(window, GLFW_TRUE);
     }
 
+    bool ClientWindowModule::IsHeadless() const
+    {
+        return preferredBackend == Render::RenderBackend::HEADLESS;
+    }
+
     GLFWwindow* ClientWindowModule::GetWindowHandle() const
     {
         return window;
@@ -54,6 +67,9 @@ namespace RenderStar::Client::Core
 
     uint32_t ClientWindowModule::GetFramebufferWidth() const
     {
+        if (window == nullptr)
+            return width;
+
         int framebufferWidth = 0;
         int framebufferHeight = 0;
         glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
@@ -62,6 +78,9 @@ namespace RenderStar::Client::Core
 
     uint32_t ClientWindowModule::GetFramebufferHeight() const
     {
+        if (window == nullptr)
+            return height;
+
         int framebufferWidth = 0;
         int framebufferHeight = 0;
         glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
@@ -77,6 +96,12 @@ namespace RenderStar::Client::Core
     {
         LoadConfiguration(moduleContext);
 
+        if (IsHeadless())
+        {
+            logger->info("ClientWindowModule initialized headless at {}x{}, frame limit {}", width, height, headlessFrameLimit);
+            return;
+        }
+
         if (!glfwInit())
         {
             logger->error("Failed to initialize GLFW");
@@ -141,7 +166,7 @@ namespace RenderStar::Client::Core
         {
             preferredBackend = Render::BackendFactory::DetectBestBackend();
             logger->info("No configuration found, using defaults with auto-detected backend: {}",
-                preferredBackend == Render::RenderBackend::VULKAN ? "VULKAN" : "OPENGL");
+                Render::GetRenderBackendName(preferredBackend));
             return;
         }
 
@@ -178,17 +203,23 @@ namespace RenderStar::Client::Core
                 preferredBackend = Render::RenderBackend::OPENGL;
             else if (backend == "VULKAN" || backend == "vulkan" || backend == "Vulkan")
                 preferredBackend = Render::RenderBackend::VULKAN;
+            else if (backend == "HEADLESS" || backend == "headless" || backend == "Headless")
+                preferredBackend = Render::RenderBackend::HEADLESS;
         }
         else
         {
             preferredBackend = Render::BackendFactory::DetectBestBackend();
             logger->info("No render_backend in configuration, auto-detected: {}",
-                preferredBackend == Render::RenderBackend::VULKAN ? "VULKAN" : "OPENGL");
+                Render::GetRenderBackendName(preferredBackend));
         }
 
         if (auto forceOptional = config->GetBoolean("force_render_backend"))
             forceBackend = *forceOptional;
 
-        logger->debug("Loaded configuration: title='{}', dimensions={}x{}, backend={}, force={}", title, width, height, preferredBackend == Render::RenderBackend::VULKAN ? "VULKAN" : "OPENGL", forceBackend);
+        // Frames a headless run renders before closing; 0 runs until Close()
+        if (auto frameLimitOptional = config->GetInteger("headless_frame_limit"); frameLimitOptional && *frameLimitOptional > 0)
+            headlessFrameLimit = static_cast<uint32_t>(*frameLimitOptional);
+
+        logger->debug("Loaded configuration: title='{}', dimensions={}x{}, backend={}, force={}", title, width, height, Render::GetRenderBackendName(preferredBackend), forceBackend);
     }
 }
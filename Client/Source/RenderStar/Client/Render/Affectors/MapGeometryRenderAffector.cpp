@@ -12,18 +12,39 @@
 #include "RenderStar/Client/Render/Resource/StandardUniforms.hpp"
 #include "RenderStar/Common/Asset/AssetModule.hpp"
 #include "RenderStar/Common/Asset/AssetLocation.hpp"
+#include "RenderStar/Common/Asset/IBinaryAsset.hpp"
 #include "RenderStar/Common/Component/ComponentModule.hpp"
 #include "RenderStar/Common/Component/Components/MapGeometry.hpp"
 #include "RenderStar/Common/Component/Components/Transform.hpp"
 #include "RenderStar/Common/Module/ModuleContext.hpp"
 #include "RenderStar/Common/Physics/PhysicsModule.hpp"
+#include "RenderStar/Common/Scene/MapbinClusterer.hpp"
 #include "RenderStar/Common/Scene/SceneModule.hpp"
+#include "RenderStar/Common/Scene/TextureTranscoder.hpp"
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <bit>
+#include <ranges>
 
 namespace RenderStar::Client::Render::Affectors
 {
     namespace
     {
+        // Sampler bindings of scene_geometry.rssl, in MaterialResources::textures order
+        constexpr std::array<uint32_t, 9> MATERIAL_TEXTURE_BINDINGS = { 1, 4, 5, 6, 7, 9, 10, 11, 12 };
+        constexpr std::array<uint32_t, Framework::MAX_SHADOW_CASCADES> SHADOW_CASCADE_BINDINGS = { 8, 13, 14, 15 };
+        constexpr uint32_t CLUSTERED_LIGHTS_BINDING = 16;
+        constexpr uint32_t CLUSTER_GRID_BINDING = 17;
+        constexpr uint32_t CLUSTER_INDICES_BINDING = 18;
+
+        constexpr uint64_t SIGNATURE_OFFSET = 14695981039346656037ull;
+        constexpr uint64_t SIGNATURE_PRIME = 1099511628211ull;
+
+        uint64_t MixSignature(const uint64_t signature, const uint64_t value)
+        {
+            return (signature ^ value) * SIGNATURE_PRIME;
+        }
+
         TextureWrapMode GlWrapToWrapMode(uint32_t glWrap)
         {
             if (glWrap == 0x812F)
@@ -38,6 +59,37 @@ namespace RenderStar::Client::Render::Affectors
             return TextureFilterMode::LINEAR;
         }
 
+        TextureFormat CompressedToTextureFormat(Common::Scene::CompressedTextureFormat format)
+        {
+            switch (format)
+            {
+                case Common::Scene::CompressedTextureFormat::BC1: return TextureFormat::BC1_RGBA;
+                case Common::Scene::CompressedTextureFormat::BC3: return TextureFormat::BC3_RGBA;
+                case Common::Scene::CompressedTextureFormat::BC4: return TextureFormat::BC4_R;
+                case Common::Scene::CompressedTextureFormat::BC5: return TextureFormat::BC5_RG;
+                default: return TextureFormat::RGBA8;
+            }
+        }
+
+        // Map draws are opaque and order-independent, so the backend may sort them by pipeline, material and depth
+        void SubmitMesh(IRenderBackend* backend, IShaderProgram* shader, IUniformBindingHandle* binding, int32_t frameIndex,
+            const Components::MapbinMesh& mapbinMesh, const uint32_t materialKey, const glm::mat4& viewProjection)
+        {
+            const glm::vec4 clip = viewProjection * glm::vec4(mapbinMesh.boundingSphere.center, 1.0f);
+
+            SortedDrawSubmission submission;
+            submission.shader = shader;
+            submission.uniformBinding = binding;
+            submission.frameIndex = frameIndex;
+            submission.mesh = mapbinMesh.mesh->GetUnderlyingMesh();
+            submission.firstIndex = mapbinMesh.firstIndex;
+            submission.indexCount = mapbinMesh.indexCount;
+            submission.materialKey = materialKey;
+            submission.depth = clip.w > 0.0f ? clip.z / clip.w : 0.0f;
+
+            backend->SubmitSortedDrawCommand(submission);
+        }
+
         glm::vec3 EulerToDirection(float rotXDeg, float rotYDeg, float rotZDeg)
         {
             glm::mat4 rot(1.0f);
@@ -92,9 +144,24 @@ namespace RenderStar::Client::Render::Affectors
         sceneLightingBuffer = buffer;
     }
 
+    void MapGeometryRenderAffector::SetLightClusterBuffers(const Framework::LightClusterBuffers& buffers)
+    {
+        lightClusterBuffers = buffers;
+    }
+
     void MapGeometryRenderAffector::SetShader(std::unique_ptr<IShaderProgram> s)
     {
-        shader = std::move(s);
+        ReleaseObjectState();
+        defaultVariant.shader = std::move(s);
+        shaderVariants.clear();
+    }
+
+    void MapGeometryRenderAffector::SetShaderVariantFactory(ShaderVariantFactory factory, const MaterialPermutationBits bits)
+    {
+        ReleaseObjectState();
+        variantFactory = std::move(factory);
+        permutationBits = bits;
+        shaderVariants.clear();
     }
 
     void MapGeometryRenderAffector::CheckForNewMapGeometry(Common::Component::ComponentModule& componentModule)
@@ -106,12 +173,34 @@ namespace RenderStar::Client::Render::Affectors
 
         for (auto [entity, mapGeometry] : pool)
         {
-            // Create physics collision meshes immediately (no render dependency)
-            if (!physicsProcessedEntities.contains(entity.id) && physicsModule)
+            bool needsPhysics = physicsModule && !physicsProcessedEntities.contains(entity.id);
+            bool needsRender = bufferManager && !processedMapEntities.contains(entity.id);
+
+            if (!needsPhysics && !needsRender)
+                continue;
+
+            auto pending = pendingMapLoads.find(entity.id);
+
+            if (pending == pendingMapLoads.end())
             {
-                auto scene = Common::Scene::MapbinLoader::Load(
-                    Common::Asset::AssetLocation::Parse(mapGeometry.assetPath), *assetModule);
+                pending = pendingMapLoads.emplace(entity.id, assetModule->LoadAsync<Common::Asset::IBinaryAsset>(
+                    Common::Asset::AssetLocation::Parse(mapGeometry.assetPath), Common::Asset::AssetLoadPriority::HIGH)).first;
+            }
+
+            if (!pending->second.IsReady())
+                continue;
+
+            auto binaryAsset = pending->second.Get();
+            pendingMapLoads.erase(pending);
 
+            std::optional<Common::Scene::MapbinScene> scene;
+
+            if (binaryAsset.IsValid())
+                scene = Common::Scene::MapbinLoader::Parse(binaryAsset->GetDataView());
+
+            // Create physics collision meshes immediately (no render dependency)
+            if (needsPhysics)
+            {
                 if (scene.has_value())
                 {
                     constexpr float mapScale = 0.1f;
@@ -139,17 +228,11 @@ namespace RenderStar::Client::Render::Affectors
             }
 
             // Create render meshes only when renderer is ready
-            if (processedMapEntities.contains(entity.id))
-                continue;
-
-            if (!bufferManager)
+            if (!needsRender)
                 continue;
 
             logger->info("CheckForNewMapGeometry: found new MapGeometry entity id={}, assetPath='{}'", entity.id, mapGeometry.assetPath);
 
-            auto scene = Common::Scene::MapbinLoader::Load(
-                Common::Asset::AssetLocation::Parse(mapGeometry.assetPath), *assetModule);
-
             if (!scene.has_value())
             {
                 logger->error("Failed to load/parse mapbin: {}", mapGeometry.assetPath);
@@ -171,9 +254,15 @@ namespace RenderStar::Client::Render::Affectors
         Common::Scene::SceneModule& sceneModule,
         Common::Component::ComponentModule& componentModule)
     {
-        sceneMeshes.clear();
+        ReleaseObjectState();
+        sceneMesh.reset();
         sceneTextures.clear();
         loadedMaterials.clear();
+        sceneCuller.Clear();
+        cullEntities.clear();
+        sceneIndirectDraws.Clear();
+        shadowIndirectDraws.Clear();
+        indirectBatches.clear();
 
         if (textureManager)
         {
@@ -198,7 +287,37 @@ namespace RenderStar::Client::Render::Affectors
                     desc.minFilter = GlFilterToFilterMode(slot.minFilter);
                     desc.magFilter = GlFilterToFilterMode(slot.magFilter);
 
-                    auto handle = textureManager->CreateFromMemory(desc, slot.pixelData.data());
+                    std::unique_ptr<ITextureHandle> handle;
+
+                    if (slot.compressedFormat != Common::Scene::CompressedTextureFormat::NONE && !slot.compressedMips.empty())
+                    {
+                        TextureFormat format = CompressedToTextureFormat(slot.compressedFormat);
+
+                        if (textureManager->SupportsFormat(format))
+                        {
+                            std::vector<uint8_t> levels;
+
+                            for (const auto& mip : slot.compressedMips)
+                                levels.insert(levels.end(), mip.data.begin(), mip.data.end());
+
+                            desc.format = format;
+                            desc.mipLevels = static_cast<uint32_t>(slot.compressedMips.size());
+                            desc.generateMipmaps = false;
+
+                            handle = textureManager->CreateFromMemory(desc, levels.data());
+                        }
+                        else if (slot.pixelData.empty())
+                        {
+                            const auto& baseLevel = slot.compressedMips.front();
+                            auto pixels = Common::Scene::TextureTranscoder::Decompress(slot.compressedFormat, baseLevel.data, baseLevel.width, baseLevel.height);
+
+                            if (!pixels.empty())
+                                handle = textureManager->CreateFromMemory(desc, pixels.data());
+                        }
+                    }
+
+                    if (!handle && !slot.pixelData.empty())
+                        handle = textureManager->CreateFromMemory(desc, slot.pixelData.data());
 
                     if (handle && handle->IsValid())
                     {
@@ -245,6 +364,14 @@ namespace RenderStar::Client::Render::Affectors
             }
         }
 
+        size_t clusterCount = 0;
+        std::unordered_map<int32_t, uint32_t> materialBatches;
+        std::vector<Framework::LitVertex> mergedVertices;
+        std::vector<uint32_t> mergedIndices;
+
+        sceneMesh = std::make_unique<Resource::Mesh>(*bufferManager, Framework::LitVertex::LAYOUT, PrimitiveType::TRIANGLES);
+        staticWorldMatrix = glm::scale(glm::mat4(1.0f), glm::vec3(0.1f));
+
         for (const auto& group : groups)
         {
             size_t vertexCount = group.vertexData.size() / 8;
@@ -299,26 +426,62 @@ namespace RenderStar::Client::Render::Affectors
                     t.x, t.y, t.z);
             }
 
-            auto mesh = std::make_unique<Resource::Mesh>(*bufferManager, Framework::LitVertex::LAYOUT, PrimitiveType::TRIANGLES);
+            // Each cluster is an index range with its own bounds
+            const auto clusterSet = Common::Scene::MapbinClusterer::Build(group);
+
+            if (clusterSet.clusters.empty())
+                continue;
+
+            // Indices are rebased onto the merged vertices, so every range draws with a vertex offset of 0
+            const auto baseVertex = static_cast<uint32_t>(mergedVertices.size());
+            const auto baseIndex = static_cast<uint32_t>(mergedIndices.size());
 
-            mesh->SetVertices(vertices);
-            mesh->SetIndexData(group.indices.data(), group.indices.size() * sizeof(uint32_t), IndexType::UINT32);
+            mergedVertices.insert(mergedVertices.end(), vertices.begin(), vertices.end());
 
-            auto entity = sceneModule.CreateEntity();
+            for (const uint32_t index : clusterSet.indices)
+                mergedIndices.push_back(baseVertex + index);
 
-            auto& transform = componentModule.AddComponent<Common::Component::Transform>(entity);
-            transform.scale = glm::vec3(0.1f);
-            transform.localMatrix = glm::scale(glm::mat4(1.0f), transform.scale);
-            transform.worldMatrix = transform.localMatrix;
-            transform.worldScale = transform.scale;
+            const auto [batch, inserted] = materialBatches.try_emplace(group.materialId, static_cast<uint32_t>(indirectBatches.size()));
 
-            auto& mapbinMesh = componentModule.AddComponent<Components::MapbinMesh>(entity);
-            mapbinMesh.mesh = mesh.get();
-            mapbinMesh.materialId = group.materialId;
+            if (inserted)
+                indirectBatches.emplace_back().materialId = group.materialId;
+
+            for (const auto& cluster : clusterSet.clusters)
+            {
+                auto entity = sceneModule.CreateEntity();
+
+                auto& transform = componentModule.AddComponent<Common::Component::Transform>(entity);
+                transform.scale = glm::vec3(0.1f);
+                transform.localMatrix = staticWorldMatrix;
+                transform.worldMatrix = transform.localMatrix;
+                transform.worldScale = transform.scale;
+
+                auto& mapbinMesh = componentModule.AddComponent<Components::MapbinMesh>(entity);
+                mapbinMesh.mesh = sceneMesh.get();
+                mapbinMesh.materialId = group.materialId;
+                mapbinMesh.firstIndex = baseIndex + cluster.firstIndex;
+                mapbinMesh.indexCount = cluster.indexCount;
+                mapbinMesh.bounds = Culling::BoundingBox{cluster.boundsMin, cluster.boundsMax}.Transformed(transform.worldMatrix);
+                mapbinMesh.boundingSphere = Culling::BoundingSphere::FromBox(mapbinMesh.bounds);
+
+                sceneCuller.Add(mapbinMesh.bounds);
+                sceneIndirectDraws.AddDraw(batch->second, mapbinMesh.firstIndex, mapbinMesh.indexCount);
+                shadowIndirectDraws.AddDraw(0, mapbinMesh.firstIndex, mapbinMesh.indexCount);
+                cullEntities.push_back(entity);
+            }
 
-            sceneMeshes.push_back(std::move(mesh));
+            clusterCount += clusterSet.clusters.size();
         }
 
+        if (!mergedIndices.empty())
+        {
+            sceneMesh->SetVertices(mergedVertices);
+            sceneMesh->SetIndexData(mergedIndices.data(), mergedIndices.size() * sizeof(uint32_t), IndexType::UINT32);
+        }
+
+        logger->info("Merged {} map groups into {} vertices and {} indices, split into {} culling clusters",
+            groups.size(), mergedVertices.size(), mergedIndices.size(), clusterCount);
+
         for (const auto& obj : gameObjects)
         {
             switch (obj.type)
@@ -411,16 +574,30 @@ namespace RenderStar::Client::Render::Affectors
 
     void MapGeometryRenderAffector::Render(Common::Component::ComponentModule& componentModule, IRenderBackend* backend, const glm::mat4& viewProjection)
     {
-        if (!backend || !shader || !shader->IsValid() || !bufferManager || !uniformManager)
+        if (!backend || !defaultVariant.shader || !defaultVariant.shader->IsValid() || !bufferManager || !uniformManager)
             return;
 
-        int32_t frameIndex = backend->GetCurrentFrame();
-        uniformPoolIndex = 0;
+        const int32_t frameIndex = backend->GetCurrentFrame();
+        ITextureHandle* defaultTex = textureManager ? textureManager->GetDefaultTexture() : nullptr;
 
-        auto& pool = componentModule.GetPool<Components::MapbinMesh>();
+        sceneCuller.Cull(Culling::Frustum::FromViewProjection(viewProjection), visibleIndices);
+
+        if (CanDrawIndirect(backend))
+        {
+            SubmitSceneIndirect(backend, frameIndex, defaultTex);
+            return;
+        }
 
-        for (auto [entity, mapbinMesh] : pool)
+        for (const uint32_t index : visibleIndices)
         {
+            const auto entity = cullEntities[index];
+            auto mapbinMeshOpt = componentModule.GetComponent<Components::MapbinMesh>(entity);
+
+            if (!mapbinMeshOpt.has_value())
+                continue;
+
+            auto& mapbinMesh = mapbinMeshOpt->get();
+
             if (!mapbinMesh.mesh || !mapbinMesh.mesh->IsValid())
                 continue;
 
@@ -429,117 +606,123 @@ namespace RenderStar::Client::Render::Affectors
             if (!transformOpt.has_value())
                 continue;
 
-            auto& transform = transformOpt->get();
-
-            StandardUniforms uniforms(transform.worldMatrix, viewProjection, glm::vec4(0.0f));
-
-            auto& slot = AcquireUniformSlot();
+            ObjectSlot* slot = PrepareObject(index, transformOpt->get(), backend->GetMaxFramesInFlight());
 
-            slot.buffer->SetSubData(&uniforms, StandardUniforms::Size(), 0);
+            if (!slot)
+                continue;
 
-            ITextureHandle* defaultTex = textureManager ? textureManager->GetDefaultTexture() : nullptr;
-            ITextureHandle* baseColorTex = defaultTex;
-            ITextureHandle* roughnessTex = defaultTex;
-            ITextureHandle* metallicTex = defaultTex;
-            ITextureHandle* aoTex = defaultTex;
-            ITextureHandle* emissionTex = defaultTex;
-            ITextureHandle* normalTex = defaultTex;
-            ITextureHandle* specularTex = defaultTex;
-            ITextureHandle* detailAlbedoTex = defaultTex;
-            ITextureHandle* detailNormalTex = defaultTex;
-            MaterialProperties matProps;
-
-            auto it = loadedMaterials.find(mapbinMesh.materialId);
-
-            if (it != loadedMaterials.end())
+            if (!slot->binding)
             {
-                const auto& mat = it->second;
-
-                if (mat.baseColor)
-                    baseColorTex = mat.baseColor;
-                if (mat.roughnessMap)
-                    roughnessTex = mat.roughnessMap;
-                if (mat.metallicMap)
-                    metallicTex = mat.metallicMap;
-                if (mat.aoMap)
-                    aoTex = mat.aoMap;
-                if (mat.emissionMap)
-                    emissionTex = mat.emissionMap;
-                if (mat.normalMap)
-                    normalTex = mat.normalMap;
-                if (mat.specularMap)
-                    specularTex = mat.specularMap;
-                if (mat.detailAlbedoMap)
-                    detailAlbedoTex = mat.detailAlbedoMap;
-                if (mat.detailNormalMap)
-                    detailNormalTex = mat.detailNormalMap;
-
-                float effectiveEmission = mat.emissionMap ? mat.emissionStrength : 0.0f;
-                float effectiveNormal = mat.normalMap ? mat.normalStrength : 0.0f;
-                float effectiveSpecular = mat.specularMap ? mat.specularStrength : 0.5f;
-                bool hasDetail = mat.detailAlbedoMap || mat.detailNormalMap;
-                float effectiveDetailScale = hasDetail ? mat.detailScale : 0.0f;
-                matProps = MaterialProperties(mat.roughness, mat.metallic, mat.aoStrength, effectiveEmission,
-                    effectiveNormal, effectiveSpecular, effectiveDetailScale);
+                slot->material = &AcquireMaterial(mapbinMesh.materialId);
+                slot->binding = uniformManager->CreateBindingForShader(slot->material->shader);
+
+                if (!slot->binding)
+                    continue;
             }
 
-            slot.materialBuffer->SetSubData(&matProps, MaterialProperties::Size(), 0);
+            BindSceneResources(*slot->binding, *slot->material, slot->buffer.get(), sceneUpdates, index, frameIndex, defaultTex);
 
-            if (slot.binding)
-            {
-                if (baseColorTex)
-                    slot.binding->UpdateTexture(1, baseColorTex, frameIndex);
-                if (roughnessTex)
-                    slot.binding->UpdateTexture(4, roughnessTex, frameIndex);
-                if (metallicTex)
-                    slot.binding->UpdateTexture(5, metallicTex, frameIndex);
-                if (aoTex)
-                    slot.binding->UpdateTexture(6, aoTex, frameIndex);
-                if (emissionTex)
-                    slot.binding->UpdateTexture(7, emissionTex, frameIndex);
-
-                if (shadowMapTexture)
-                    slot.binding->UpdateTexture(8, shadowMapTexture, frameIndex);
-
-                if (normalTex)
-                    slot.binding->UpdateTexture(9, normalTex, frameIndex);
-                if (specularTex)
-                    slot.binding->UpdateTexture(10, specularTex, frameIndex);
-                if (detailAlbedoTex)
-                    slot.binding->UpdateTexture(11, detailAlbedoTex, frameIndex);
-                if (detailNormalTex)
-                    slot.binding->UpdateTexture(12, detailNormalTex, frameIndex);
-
-                backend->SubmitDrawCommand(shader.get(), slot.binding.get(), frameIndex, mapbinMesh.mesh->GetUnderlyingMesh());
-            }
+            SubmitMesh(backend, slot->material->shader, slot->binding.get(), frameIndex, mapbinMesh, static_cast<uint32_t>(mapbinMesh.materialId), viewProjection);
         }
     }
 
     void MapGeometryRenderAffector::SetShadowShader(std::unique_ptr<IShaderProgram> s)
     {
+        ReleaseObjectState();
         shadowShader = std::move(s);
     }
 
-    void MapGeometryRenderAffector::SetShadowMapTexture(ITextureHandle* texture)
+    void MapGeometryRenderAffector::SetShadowCascadeTextures(const std::array<ITextureHandle*, Framework::MAX_SHADOW_CASCADES>& textures)
     {
-        shadowMapTexture = texture;
+        for (size_t cascade = 0; cascade < textures.size(); ++cascade)
+        {
+            // A new target starts empty, so whatever was drawn into the old one has to be drawn again
+            if (shadowCascadeTextures[cascade] != textures[cascade])
+                shadowCascades[cascade].drawn = false;
+
+            shadowCascadeTextures[cascade] = textures[cascade];
+        }
     }
 
-    void MapGeometryRenderAffector::RenderShadowDepth(
+    bool MapGeometryRenderAffector::PrepareShadowCascade(
         Common::Component::ComponentModule& componentModule,
-        IRenderBackend* backend,
+        const uint32_t cascade,
         const glm::mat4& lightViewProjection)
     {
-        if (!backend || !shadowShader || !shadowShader->IsValid() || !bufferManager || !uniformManager)
+        if (cascade >= shadowCascades.size() || !shadowShader || !shadowShader->IsValid())
+            return false;
+
+        ShadowCascadeState& state = shadowCascades[cascade];
+        sceneCuller.Cull(Culling::Frustum::FromViewProjection(lightViewProjection), state.casters);
+
+        uint64_t signature = SIGNATURE_OFFSET;
+
+        for (const uint32_t index : state.casters)
+        {
+            auto transformOpt = componentModule.GetComponent<Common::Component::Transform>(cullEntities[index]);
+            const uint32_t version = transformOpt.has_value() ? transformOpt->get().version : 0;
+
+            signature = MixSignature(MixSignature(signature, index), version);
+        }
+
+        state.viewProjection = lightViewProjection;
+        state.casterSignature = signature;
+
+        return !state.drawn || state.drawnSignature != signature || state.drawnViewProjection != lightViewProjection;
+    }
+
+    void MapGeometryRenderAffector::RenderShadowCascade(
+        Common::Component::ComponentModule& componentModule,
+        IRenderBackend* backend,
+        const uint32_t cascade)
+    {
+        if (cascade >= shadowCascades.size() || !backend || !shadowShader || !shadowShader->IsValid() || !bufferManager || !uniformManager)
             return;
 
-        int32_t frameIndex = backend->GetCurrentFrame();
-        shadowUniformPoolIndex = 0;
+        const int32_t frameIndex = backend->GetCurrentFrame();
+        ShadowCascadeState& state = shadowCascades[cascade];
+
+        if (!state.passBuffer)
+            state.passBuffer = bufferManager->CreateUniformBuffer(sizeof(glm::mat4));
+
+        if (!state.passBuffer)
+            return;
 
-        auto& pool = componentModule.GetPool<Components::MapbinMesh>();
+        state.passBuffer->SetSubData(&state.viewProjection, sizeof(glm::mat4), 0);
+        shadowUpdates.RecordUpload(sizeof(glm::mat4));
 
-        for (auto [entity, mapbinMesh] : pool)
+        if (CanDrawIndirect(backend))
+            SubmitShadowCascadeIndirect(backend, cascade, frameIndex);
+        else
+            SubmitShadowCascadeObjects(componentModule, backend, cascade, frameIndex);
+
+        state.drawnViewProjection = state.viewProjection;
+        state.drawnSignature = state.casterSignature;
+        state.drawn = true;
+    }
+
+    void MapGeometryRenderAffector::SubmitShadowCascadeObjects(
+        Common::Component::ComponentModule& componentModule,
+        IRenderBackend* backend,
+        const uint32_t cascade,
+        const int32_t frameIndex)
+    {
+        ShadowCascadeState& state = shadowCascades[cascade];
+
+        // Every cascade has its own descriptor sets, so each takes two of the cache's binding slots
+        const uint32_t objectBinding = cascade * 2;
+        const uint32_t passBinding = cascade * 2 + 1;
+
+        for (const uint32_t index : state.casters)
         {
+            const auto entity = cullEntities[index];
+            auto mapbinMeshOpt = componentModule.GetComponent<Components::MapbinMesh>(entity);
+
+            if (!mapbinMeshOpt.has_value())
+                continue;
+
+            auto& mapbinMesh = mapbinMeshOpt->get();
+
             if (!mapbinMesh.mesh || !mapbinMesh.mesh->IsValid())
                 continue;
 
@@ -548,90 +731,398 @@ namespace RenderStar::Client::Render::Affectors
             if (!transformOpt.has_value())
                 continue;
 
-            auto& transform = transformOpt->get();
+            ObjectSlot* slot = PrepareObject(index, transformOpt->get(), backend->GetMaxFramesInFlight());
 
-            StandardUniforms uniforms(transform.worldMatrix, lightViewProjection, glm::vec4(0.0f));
+            if (!slot)
+                continue;
 
-            auto& slot = AcquireShadowUniformSlot();
+            auto& shadowBinding = slot->shadowBindings[cascade];
 
-            slot.buffer->SetSubData(&uniforms, StandardUniforms::Size(), 0);
+            if (!shadowBinding)
+                shadowBinding = uniformManager->CreateBindingForShader(shadowShader.get());
 
-            if (slot.binding)
-                backend->SubmitDrawCommand(shadowShader.get(), slot.binding.get(), frameIndex, mapbinMesh.mesh->GetUnderlyingMesh());
+            if (!shadowBinding)
+                continue;
+
+            if (shadowUpdates.ClaimBinding(index, frameIndex, objectBinding, slot->buffer.get()))
+                shadowBinding->UpdateBuffer(0, slot->buffer.get(), StandardUniforms::Size(), frameIndex);
+
+            if (shadowUpdates.ClaimBinding(index, frameIndex, passBinding, state.passBuffer.get()))
+                shadowBinding->UpdateBuffer(1, state.passBuffer.get(), sizeof(glm::mat4), frameIndex);
+
+            SubmitMesh(backend, shadowShader.get(), shadowBinding.get(), frameIndex, mapbinMesh, 0, state.viewProjection);
         }
     }
 
     void MapGeometryRenderAffector::Cleanup()
     {
-        sceneMeshes.clear();
+        sceneMesh.reset();
         sceneTextures.clear();
         loadedMaterials.clear();
-        uniformPool.clear();
-        uniformPoolIndex = 0;
-        shadowUniformPool.clear();
-        shadowUniformPoolIndex = 0;
+        sceneCuller.Clear();
+        cullEntities.clear();
+        visibleIndices.clear();
+        sceneIndirectDraws.Clear();
+        shadowIndirectDraws.Clear();
+        indirectBatches.clear();
+        sceneArgumentBuffers.clear();
+        defaultVariant = {};
+        shaderVariants.clear();
+        variantFactory = nullptr;
+        permutationBits = {};
+        ReleaseObjectState();
+
+        for (auto& cascade : shadowCascades)
+            cascade = {};
+
         processedMapEntities.clear();
         physicsProcessedEntities.clear();
-        shader.reset();
+
+        for (auto& pendingLoad : pendingMapLoads | std::views::values)
+            pendingLoad.Cancel();
+
+        pendingMapLoads.clear();
         shadowShader.reset();
-        shadowMapTexture = nullptr;
+        shadowCascadeTextures = {};
         bufferManager = nullptr;
         uniformManager = nullptr;
         textureManager = nullptr;
         sceneLightingBuffer = nullptr;
+        lightClusterBuffers = {};
+    }
+
+    Shader::RsslPermutationMask MapGeometryRenderAffector::SelectPermutation(const LoadedMaterial* material) const
+    {
+        Shader::RsslPermutationMask permutation = 0;
+
+        if (!material)
+            return permutation;
+
+        if (material->normalMap)
+            permutation |= permutationBits.normalMap;
+        if (material->emissionMap)
+            permutation |= permutationBits.emissionMap;
+        if (material->detailAlbedoMap || material->detailNormalMap)
+            permutation |= permutationBits.detailMap;
+
+        return permutation;
+    }
+
+    MapGeometryRenderAffector::ShaderVariant& MapGeometryRenderAffector::AcquireShaderVariant(const Shader::RsslPermutationMask permutation)
+    {
+        if (!variantFactory)
+            return defaultVariant;
+
+        auto [iterator, inserted] = shaderVariants.try_emplace(permutation);
+        auto& variant = iterator->second;
+
+        if (inserted)
+        {
+            variant.shader = variantFactory(permutation);
+
+            if (!variant.shader || !variant.shader->IsValid())
+                logger->warn("Failed to build scene shader variant 0x{:x}, using the default variant", permutation);
+        }
+
+        if (!variant.shader || !variant.shader->IsValid())
+            return defaultVariant;
+
+        return variant;
+    }
+
+    const MapGeometryRenderAffector::MaterialResources& MapGeometryRenderAffector::AcquireMaterial(const int32_t materialId)
+    {
+        auto [iterator, inserted] = materialResources.try_emplace(materialId);
+        auto& resources = iterator->second;
+
+        if (!inserted)
+            return resources;
+
+        auto it = loadedMaterials.find(materialId);
+        const LoadedMaterial* material = it != loadedMaterials.end() ? &it->second : nullptr;
+
+        resources.shader = AcquireShaderVariant(SelectPermutation(material)).shader.get();
+
+        MaterialProperties matProps;
+
+        if (material)
+        {
+            const auto& mat = *material;
+
+            resources.textures = {
+                mat.baseColor, mat.roughnessMap, mat.metallicMap, mat.aoMap, mat.emissionMap,
+                mat.normalMap, mat.specularMap, mat.detailAlbedoMap, mat.detailNormalMap
+            };
+
+            float effectiveEmission = mat.emissionMap ? mat.emissionStrength : 0.0f;
+            float effectiveNormal = mat.normalMap ? mat.normalStrength : 0.0f;
+            float effectiveSpecular = mat.specularMap ? mat.specularStrength : 0.5f;
+            bool hasDetail = mat.detailAlbedoMap || mat.detailNormalMap;
+            float effectiveDetailScale = hasDetail ? mat.detailScale : 0.0f;
+            matProps = MaterialProperties(mat.roughness, mat.metallic, mat.aoStrength, effectiveEmission,
+                effectiveNormal, effectiveSpecular, effectiveDetailScale);
+        }
+
+        resources.buffer = bufferManager->CreateUniformBuffer(MaterialProperties::Size());
+
+        if (resources.buffer)
+        {
+            resources.buffer->SetSubData(&matProps, MaterialProperties::Size(), 0);
+            sceneUpdates.RecordUpload(MaterialProperties::Size());
+        }
+
+        return resources;
+    }
+
+    MapGeometryRenderAffector::ObjectSlot* MapGeometryRenderAffector::PrepareObject(const uint32_t index, const Common::Component::Transform& transform, const int32_t framesInFlight)
+    {
+        if (objectSlots.size() != cullEntities.size())
+        {
+            objectSlots.clear();
+            objectSlots.resize(cullEntities.size());
+
+            const auto objectCount = static_cast<uint32_t>(cullEntities.size());
+            const auto frameCount = static_cast<uint32_t>(std::max(framesInFlight, 1));
+
+            sceneUpdates.Reset(objectCount, frameCount);
+            shadowUpdates.Reset(objectCount, frameCount);
+        }
+
+        auto& slot = objectSlots[index];
+
+        if (!slot.buffer)
+            slot.buffer = bufferManager->CreateUniformBuffer(StandardUniforms::Size());
+
+        if (!slot.buffer)
+            return nullptr;
+
+        // The view-projection lives in SceneLighting and ShadowPass, so the object block only changes with its transform
+        if (sceneUpdates.ClaimUpload(index, transform.version, StandardUniforms::Size()))
+        {
+            const StandardUniforms uniforms(transform.worldMatrix, glm::mat4(1.0f), glm::vec4(0.0f));
+            slot.buffer->SetSubData(&uniforms, StandardUniforms::Size(), 0);
+        }
+
+        return &slot;
+    }
+
+    void MapGeometryRenderAffector::BindSceneResources(
+        IUniformBindingHandle& binding,
+        const MaterialResources& material,
+        IBufferHandle* objectBuffer,
+        UniformUpdateCache& updates,
+        const uint32_t object,
+        const int32_t frameIndex,
+        ITextureHandle* defaultTexture) const
+    {
+        // Descriptor sets persist per frame in flight, so only bindings whose resource changed are rewritten
+        const auto bindBuffer = [&](const uint32_t slot, IBufferHandle* buffer, const size_t size)
+        {
+            if (buffer && updates.ClaimBinding(object, frameIndex, slot, buffer))
+                binding.UpdateBuffer(static_cast<int32_t>(slot), buffer, size, frameIndex);
+        };
+
+        const auto bindTexture = [&](const uint32_t slot, ITextureHandle* texture)
+        {
+            if (texture && updates.ClaimBinding(object, frameIndex, slot, texture))
+                binding.UpdateTexture(static_cast<int32_t>(slot), texture, frameIndex);
+        };
+
+        bindBuffer(0, objectBuffer, StandardUniforms::Size());
+        bindBuffer(2, sceneLightingBuffer, Framework::SceneLightingData::Size());
+        bindBuffer(3, material.buffer.get(), MaterialProperties::Size());
+        bindBuffer(CLUSTERED_LIGHTS_BINDING, lightClusterBuffers.lights, Framework::ClusteredLightData::Size());
+        bindBuffer(CLUSTER_GRID_BINDING, lightClusterBuffers.grid, Framework::ClusterGridData::Size());
+        bindBuffer(CLUSTER_INDICES_BINDING, lightClusterBuffers.indices, Framework::ClusterIndexData::Size());
+
+        for (size_t i = 0; i < MATERIAL_TEXTURE_BINDINGS.size(); ++i)
+            bindTexture(MATERIAL_TEXTURE_BINDINGS[i], material.textures[i] ? material.textures[i] : defaultTexture);
+
+        for (size_t i = 0; i < SHADOW_CASCADE_BINDINGS.size(); ++i)
+            bindTexture(SHADOW_CASCADE_BINDINGS[i], shadowCascadeTextures[i] ? shadowCascadeTextures[i] : defaultTexture);
+    }
+
+    void MapGeometryRenderAffector::ReleaseObjectState()
+    {
+        objectSlots.clear();
+        materialResources.clear();
+        sceneUpdates.Clear();
+        shadowUpdates.Clear();
+        indirectUpdates.Clear();
+        staticObjectBuffer.reset();
+
+        for (auto& batch : indirectBatches)
+        {
+            batch.material = nullptr;
+            batch.binding.reset();
+        }
+
+        for (auto& cascade : shadowCascades)
+        {
+            cascade.indirectBinding.reset();
+            cascade.drawn = false;
+        }
+    }
+
+    bool MapGeometryRenderAffector::CanDrawIndirect(IRenderBackend* backend) const
+    {
+        return backend->GetCapabilities().supportsMultiDrawIndirect && sceneMesh && sceneMesh->IsValid()
+            && sceneIndirectDraws.GetDrawCount() == cullEntities.size();
     }
 
-    MapGeometryRenderAffector::UniformSlot& MapGeometryRenderAffector::AcquireUniformSlot()
+    IBufferHandle* MapGeometryRenderAffector::AcquireStaticObjectBuffer()
     {
-        if (uniformPoolIndex < uniformPool.size())
-            return uniformPool[uniformPoolIndex++];
+        if (staticObjectBuffer)
+            return staticObjectBuffer.get();
 
-        UniformSlot slot;
-        slot.buffer = bufferManager->CreateUniformBuffer(StandardUniforms::Size());
-        slot.materialBuffer = bufferManager->CreateUniformBuffer(MaterialProperties::Size());
-        slot.binding = uniformManager->CreateBindingForShader(shader.get());
+        staticObjectBuffer = bufferManager->CreateUniformBuffer(StandardUniforms::Size());
 
-        if (slot.binding)
+        if (!staticObjectBuffer)
+            return nullptr;
+
+        const StandardUniforms uniforms(staticWorldMatrix, glm::mat4(1.0f), glm::vec4(0.0f));
+        staticObjectBuffer->SetSubData(&uniforms, StandardUniforms::Size(), 0);
+        sceneUpdates.RecordUpload(StandardUniforms::Size());
+
+        return staticObjectBuffer.get();
+    }
+
+    IBufferHandle* MapGeometryRenderAffector::UploadIndirectArguments(
+        std::vector<std::unique_ptr<IBufferHandle>>& buffers,
+        const int32_t frameIndex,
+        const int32_t framesInFlight,
+        const std::span<const DrawIndexedIndirectCommand> commands,
+        UniformUpdateCache& updates)
+    {
+        if (commands.empty() || frameIndex < 0)
+            return nullptr;
+
+        // One buffer per frame in flight, so arguments a queued frame still reads are never overwritten
+        buffers.resize(std::max({ buffers.size(), static_cast<size_t>(framesInFlight), static_cast<size_t>(frameIndex) + 1 }));
+
+        auto& buffer = buffers[frameIndex];
+        const size_t bytes = commands.size_bytes();
+
+        if (!buffer || buffer->GetSize() < bytes)
+            buffer = bufferManager->CreateBuffer(BufferType::INDIRECT, BufferUsage::DYNAMIC, std::bit_ceil(bytes));
+
+        if (!buffer)
+            return nullptr;
+
+        buffer->SetSubData(commands.data(), bytes, 0);
+        updates.RecordUpload(bytes);
+
+        return buffer.get();
+    }
+
+    void MapGeometryRenderAffector::PrepareIndirectBindings(const int32_t framesInFlight)
+    {
+        const auto objectCount = static_cast<uint32_t>(indirectBatches.size() + shadowCascades.size());
+
+        if (indirectUpdates.GetObjectCount() != objectCount)
+            indirectUpdates.Reset(objectCount, static_cast<uint32_t>(std::max(framesInFlight, 1)));
+    }
+
+    void MapGeometryRenderAffector::SubmitSceneIndirect(IRenderBackend* backend, const int32_t frameIndex, ITextureHandle* defaultTexture)
+    {
+        sceneIndirectDraws.Build(visibleIndices);
+
+        const int32_t framesInFlight = backend->GetMaxFramesInFlight();
+        IBufferHandle* objectBuffer = AcquireStaticObjectBuffer();
+        IBufferHandle* arguments = UploadIndirectArguments(sceneArgumentBuffers, frameIndex, framesInFlight, sceneIndirectDraws.GetCommands(), sceneUpdates);
+
+        if (!objectBuffer || !arguments)
+            return;
+
+        PrepareIndirectBindings(framesInFlight);
+
+        for (const IndirectDrawBatch& run : sceneIndirectDraws.GetBatches())
         {
-            slot.binding->UpdateBuffer(0, slot.buffer.get(), StandardUniforms::Size());
+            IndirectBatch& batch = indirectBatches[run.batch];
 
-            if (textureManager)
+            if (!batch.binding)
             {
-                slot.binding->UpdateTexture(1, textureManager->GetDefaultTexture());
-                slot.binding->UpdateTexture(4, textureManager->GetDefaultTexture());
-                slot.binding->UpdateTexture(5, textureManager->GetDefaultTexture());
-                slot.binding->UpdateTexture(6, textureManager->GetDefaultTexture());
-                slot.binding->UpdateTexture(7, textureManager->GetDefaultTexture());
-                slot.binding->UpdateTexture(8, textureManager->GetDefaultTexture());
-                slot.binding->UpdateTexture(9, textureManager->GetDefaultTexture());
-                slot.binding->UpdateTexture(10, textureManager->GetDefaultTexture());
-                slot.binding->UpdateTexture(11, textureManager->GetDefaultTexture());
-                slot.binding->UpdateTexture(12, textureManager->GetDefaultTexture());
+                batch.material = &AcquireMaterial(batch.materialId);
+                batch.binding = uniformManager->CreateBindingForShader(batch.material->shader);
+
+                if (!batch.binding)
+                    continue;
             }
 
-            if (sceneLightingBuffer)
-                slot.binding->UpdateBuffer(2, sceneLightingBuffer, Framework::SceneLightingData::Size());
+            BindSceneResources(*batch.binding, *batch.material, objectBuffer, indirectUpdates, run.batch, frameIndex, defaultTexture);
+
+            IndirectDrawSubmission submission;
+            submission.shader = batch.material->shader;
+            submission.uniformBinding = batch.binding.get();
+            submission.frameIndex = frameIndex;
+            submission.mesh = sceneMesh->GetUnderlyingMesh();
+            submission.argumentBuffer = arguments;
+            submission.firstCommand = run.firstCommand;
+            submission.commandCount = run.commandCount;
+            submission.materialKey = static_cast<uint32_t>(batch.materialId);
 
-            slot.binding->UpdateBuffer(3, slot.materialBuffer.get(), MaterialProperties::Size());
+            backend->SubmitIndirectDrawCommand(submission);
         }
+    }
+
+    void MapGeometryRenderAffector::SubmitShadowCascadeIndirect(IRenderBackend* backend, const uint32_t cascade, const int32_t frameIndex)
+    {
+        ShadowCascadeState& state = shadowCascades[cascade];
+        shadowIndirectDraws.Build(state.casters);
 
-        uniformPool.push_back(std::move(slot));
-        return uniformPool[uniformPoolIndex++];
+        const int32_t framesInFlight = backend->GetMaxFramesInFlight();
+        IBufferHandle* objectBuffer = AcquireStaticObjectBuffer();
+        IBufferHandle* arguments = UploadIndirectArguments(state.argumentBuffers, frameIndex, framesInFlight, shadowIndirectDraws.GetCommands(), shadowUpdates);
+
+        if (!objectBuffer || !arguments)
+            return;
+
+        if (!state.indirectBinding)
+            state.indirectBinding = uniformManager->CreateBindingForShader(shadowShader.get());
+
+        if (!state.indirectBinding)
+            return;
+
+        PrepareIndirectBindings(framesInFlight);
+
+        const auto object = static_cast<uint32_t>(indirectBatches.size()) + cascade;
+
+        if (indirectUpdates.ClaimBinding(object, frameIndex, 0, objectBuffer))
+            state.indirectBinding->UpdateBuffer(0, objectBuffer, StandardUniforms::Size(), frameIndex);
+
+        if (indirectUpdates.ClaimBinding(object, frameIndex, 1, state.passBuffer.get()))
+            state.indirectBinding->UpdateBuffer(1, state.passBuffer.get(), sizeof(glm::mat4), frameIndex);
+
+        IndirectDrawSubmission submission;
+        submission.shader = shadowShader.get();
+        submission.uniformBinding = state.indirectBinding.get();
+        submission.frameIndex = frameIndex;
+        submission.mesh = sceneMesh->GetUnderlyingMesh();
+        submission.argumentBuffer = arguments;
+        submission.commandCount = static_cast<uint32_t>(shadowIndirectDraws.GetCommands().size());
+
+        backend->SubmitIndirectDrawCommand(submission);
     }
 
-    MapGeometryRenderAffector::ShadowUniformSlot& MapGeometryRenderAffector::AcquireShadowUniformSlot()
+    void MapGeometryRenderAffector::BeginFrame()
     {
-        if (shadowUniformPoolIndex < shadowUniformPool.size())
-            return shadowUniformPool[shadowUniformPoolIndex++];
+        sceneUpdates.BeginFrame();
+        shadowUpdates.BeginFrame();
+        indirectUpdates.BeginFrame();
+    }
 
-        ShadowUniformSlot slot;
-        slot.buffer = bufferManager->CreateUniformBuffer(StandardUniforms::Size());
-        slot.binding = uniformManager->CreateBindingForShader(shadowShader.get());
+    UniformUploadStatistics MapGeometryRenderAffector::GetUploadStatistics() const
+    {
+        const auto& scene = sceneUpdates.GetStatistics();
+        const auto& shadow = shadowUpdates.GetStatistics();
+        const auto& indirect = indirectUpdates.GetStatistics();
 
-        if (slot.binding)
-            slot.binding->UpdateBuffer(0, slot.buffer.get(), StandardUniforms::Size());
+        UniformUploadStatistics total;
+        total.uploadBytes = scene.uploadBytes + shadow.uploadBytes + indirect.uploadBytes;
+        total.bufferUploads = scene.bufferUploads + shadow.bufferUploads + indirect.bufferUploads;
+        total.skippedUploads = scene.skippedUploads + shadow.skippedUploads + indirect.skippedUploads;
+        total.descriptorUpdates = scene.descriptorUpdates + shadow.descriptorUpdates + indirect.descriptorUpdates;
 
-        shadowUniformPool.push_back(std::move(slot));
-        return shadowUniformPool[shadowUniformPoolIndex++];
+        return total;
     }
 }
@@ -42,6 +42,11 @@ namespace RenderStar::Client::Render::Affectors
         sceneLightingBuffer = buffer;
     }
 
+    void PlayerRenderAffector::SetLightClusterBuffers(const Framework::LightClusterBuffers& buffers)
+    {
+        lightClusterBuffers = buffers;
+    }
+
     void PlayerRenderAffector::Cleanup()
     {
         uniformPool.clear();
@@ -52,6 +57,7 @@ namespace RenderStar::Client::Render::Affectors
         uniformManager = nullptr;
         textureManager = nullptr;
         sceneLightingBuffer = nullptr;
+        lightClusterBuffers = {};
     }
 
     void PlayerRenderAffector::Render(Common::Component::ComponentModule& componentModule, IRenderBackend* backend,
@@ -276,11 +282,21 @@ namespace RenderStar::Client::Render::Affectors
                 slot.binding->UpdateTexture(10, textureManager->GetDefaultTexture());
                 slot.binding->UpdateTexture(11, textureManager->GetDefaultTexture());
                 slot.binding->UpdateTexture(12, textureManager->GetDefaultTexture());
+                slot.binding->UpdateTexture(13, textureManager->GetDefaultTexture());
+                slot.binding->UpdateTexture(14, textureManager->GetDefaultTexture());
+                slot.binding->UpdateTexture(15, textureManager->GetDefaultTexture());
             }
 
             if (sceneLightingBuffer)
                 slot.binding->UpdateBuffer(2, sceneLightingBuffer, Framework::SceneLightingData::Size());
 
+            if (lightClusterBuffers.lights)
+            {
+                slot.binding->UpdateBuffer(16, lightClusterBuffers.lights, Framework::ClusteredLightData::Size());
+                slot.binding->UpdateBuffer(17, lightClusterBuffers.grid, Framework::ClusterGridData::Size());
+                slot.binding->UpdateBuffer(18, lightClusterBuffers.indices, Framework::ClusterIndexData::Size());
+            }
+
             slot.binding->UpdateBuffer(3, slot.materialBuffer.get(), MaterialProperties::Size());
         }
 
@@ -1,4 +1,5 @@
 #include "RenderStar/Client/Render/Backend/BackendFactory.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessRenderBackend.hpp"
 #include "RenderStar/Client/Render/OpenGL/OpenGLRenderBackend.hpp"
 #include "RenderStar/Client/Render/Vulkan/VulkanRenderBackend.hpp"
 
@@ -49,6 +50,14 @@ namespace RenderStar::Client::Render
             100
         };
 
+        // Only ever selected explicitly; the priority keeps it out of detection
+        registry[RenderBackend::HEADLESS] = BackendEntry
+        {
+            [] { return std::make_unique<Headless::HeadlessRenderBackend>(); },
+            [] { return true; },
+            -1
+        };
+
         initialized = true;
     }
 
@@ -0,0 +1,73 @@
+#include "RenderStar/Client/Render/Backend/DrawList.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace RenderStar::Client::Render
+{
+    uint64_t DrawSortKey::Make(const uint32_t pass, const uint32_t pipeline, const uint32_t material, const float depth)
+    {
+        constexpr uint32_t DEPTH_MAX = (1u << DEPTH_BITS) - 1;
+
+        const float clamped = std::isnan(depth) ? 0.0f : std::clamp(depth, 0.0f, 1.0f);
+        const auto quantizedDepth = static_cast<uint64_t>(clamped * static_cast<float>(DEPTH_MAX));
+
+        uint64_t key = std::min(pass, MAX_PASS);
+        key = (key << PIPELINE_BITS) | (pipeline & ((1u << PIPELINE_BITS) - 1));
+        key = (key << MATERIAL_BITS) | (material & ((1u << MATERIAL_BITS) - 1));
+        key = (key << DEPTH_BITS) | quantizedDepth;
+
+        return key;
+    }
+
+    uint64_t DrawSortKey::MakeOrdered(const uint32_t pass, const uint64_t sequence)
+    {
+        constexpr uint32_t LOW_BITS = 64 - PASS_BITS;
+
+        return (static_cast<uint64_t>(std::min(pass, MAX_PASS)) << LOW_BITS) | (sequence & ((uint64_t{1} << LOW_BITS) - 1));
+    }
+
+    void RadixSortByKey(const std::span<const uint64_t> keys, std::vector<uint32_t>& order, std::vector<uint32_t>& scratch)
+    {
+        const auto count = static_cast<uint32_t>(keys.size());
+
+        order.resize(count);
+        scratch.resize(count);
+
+        for (uint32_t i = 0; i < count; ++i)
+            order[i] = i;
+
+        if (count < 2)
+            return;
+
+        uint64_t differing = 0;
+
+        for (const uint64_t key : keys)
+            differing |= key ^ keys[0];
+
+        for (uint32_t shift = 0; shift < 64; shift += 8)
+        {
+            if (((differing >> shift) & 0xFF) == 0)
+                continue;
+
+            std::array<uint32_t, 256> offsets{};
+
+            for (const uint32_t index : order)
+                ++offsets[(keys[index] >> shift) & 0xFF];
+
+            uint32_t total = 0;
+
+            for (auto& offset : offsets)
+            {
+                const uint32_t bucket = offset;
+                offset = total;
+                total += bucket;
+            }
+
+            for (const uint32_t index : order)
+                scratch[offsets[(keys[index] >> shift) & 0xFF]++] = index;
+
+            order.swap(scratch);
+        }
+    }
+}
@@ -0,0 +1,91 @@
+#include "RenderStar/Client/Render/Backend/IndirectDraw.hpp"
+#include <algorithm>
+
+namespace RenderStar::Client::Render
+{
+    uint32_t IndirectDrawBuilder::AddDraw(const uint32_t batch, const uint32_t firstIndex, const uint32_t indexCount, const int32_t vertexOffset)
+    {
+        draws.push_back({ batch, firstIndex, indexCount, vertexOffset });
+        batchCount = std::max(batchCount, batch + 1);
+
+        return static_cast<uint32_t>(draws.size() - 1);
+    }
+
+    void IndirectDrawBuilder::Clear()
+    {
+        draws.clear();
+        batchCount = 0;
+        batchStarts.clear();
+        grouped.clear();
+        commands.clear();
+        batches.clear();
+    }
+
+    void IndirectDrawBuilder::Build(const std::span<const uint32_t> visibleDraws)
+    {
+        commands.clear();
+        batches.clear();
+
+        // Counting sort by batch; stable, so each batch keeps the order the ids came in
+        batchStarts.assign(batchCount + 1, 0);
+
+        for (const uint32_t id : visibleDraws)
+        {
+            if (id < draws.size() && draws[id].indexCount > 0)
+                ++batchStarts[draws[id].batch + 1];
+        }
+
+        for (uint32_t batch = 0; batch < batchCount; ++batch)
+            batchStarts[batch + 1] += batchStarts[batch];
+
+        grouped.resize(batchStarts[batchCount]);
+
+        for (const uint32_t id : visibleDraws)
+        {
+            if (id < draws.size() && draws[id].indexCount > 0)
+                grouped[batchStarts[draws[id].batch]++] = id;
+        }
+
+        // Every start has been advanced to the end of its batch, which is where the next one begins
+        uint32_t begin = 0;
+
+        for (uint32_t batch = 0; batch < batchCount; ++batch)
+        {
+            const uint32_t end = batchStarts[batch];
+
+            if (begin == end)
+                continue;
+
+            IndirectDrawBatch run;
+            run.batch = batch;
+            run.firstCommand = static_cast<uint32_t>(commands.size());
+
+            for (uint32_t position = begin; position < end; ++position)
+            {
+                const StaticDraw& draw = draws[grouped[position]];
+
+                if (commands.size() > run.firstCommand)
+                {
+                    DrawIndexedIndirectCommand& last = commands.back();
+
+                    if (last.vertexOffset == draw.vertexOffset && last.firstIndex + last.indexCount == draw.firstIndex)
+                    {
+                        last.indexCount += draw.indexCount;
+                        continue;
+                    }
+                }
+
+                DrawIndexedIndirectCommand command;
+                command.indexCount = draw.indexCount;
+                command.instanceCount = 1;
+                command.firstIndex = draw.firstIndex;
+                command.vertexOffset = draw.vertexOffset;
+                commands.push_back(command);
+            }
+
+            run.commandCount = static_cast<uint32_t>(commands.size()) - run.firstCommand;
+            batches.push_back(run);
+            begin = end;
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#include "RenderStar/Client/Render/Backend/ParallelCommandRecorder.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace RenderStar::Client::Render
+{
+    ParallelCommandRecorder::ParallelCommandRecorder(const size_t workerCount, const uint32_t minimumChunkSize)
+        : workers(workerCount)
+        , workerCount(static_cast<uint32_t>(workers.GetWorkerCount()))
+        , minimumChunkSize(std::max(minimumChunkSize, 1u))
+        , statistics(this->workerCount)
+    {
+    }
+
+    std::vector<CommandChunk> ParallelCommandRecorder::Partition(const uint32_t commandCount, const uint32_t workerCount, const uint32_t minimumChunkSize)
+    {
+        if (commandCount == 0)
+            return {};
+
+        const uint32_t chunkCount = std::clamp(commandCount / std::max(minimumChunkSize, 1u), 1u, std::max(workerCount, 1u));
+
+        std::vector<CommandChunk> chunks(chunkCount);
+
+        // Spread the remainder so chunk sizes differ by at most one command
+        for (uint32_t chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            const auto first = static_cast<uint32_t>(static_cast<uint64_t>(commandCount) * chunk / chunkCount);
+            const auto end = static_cast<uint32_t>(static_cast<uint64_t>(commandCount) * (chunk + 1) / chunkCount);
+
+            chunks[chunk] = { first, end - first, chunk };
+        }
+
+        return chunks;
+    }
+
+    std::vector<CommandChunk> ParallelCommandRecorder::Partition(const uint32_t commandCount) const
+    {
+        return Partition(commandCount, workerCount, minimumChunkSize);
+    }
+
+    void ParallelCommandRecorder::Record(const std::span<const CommandChunk> chunks, const std::span<const uint32_t> order, ICommandChunkRecorder& recorder)
+    {
+        if (chunks.empty())
+            return;
+
+        auto recordChunk = [&](const uint32_t chunkIndex)
+        {
+            const CommandChunk& chunk = chunks[chunkIndex];
+            const auto start = std::chrono::steady_clock::now();
+
+            recorder.RecordChunk(chunk, chunkIndex, order.subspan(chunk.first, chunk.count));
+
+            if (chunk.worker >= statistics.size())
+                return;
+
+            // Each worker owns one chunk, so its statistics entry is never shared
+            auto& workerStatistics = statistics[chunk.worker];
+            workerStatistics.chunks++;
+            workerStatistics.commands += chunk.count;
+            workerStatistics.recordMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        };
+
+        const auto chunkCount = static_cast<uint32_t>(chunks.size());
+        const uint32_t participants = std::min(chunkCount, workerCount);
+
+        // Chunk i goes to worker i; only hand-built lists longer than the pool wrap around
+        workers.RunOnWorkers(participants, [&](const size_t worker)
+        {
+            for (auto chunkIndex = static_cast<uint32_t>(worker); chunkIndex < chunkCount; chunkIndex += participants)
+                recordChunk(chunkIndex);
+        });
+
+        recorder.ExecuteChunks(chunks);
+    }
+
+    void ParallelCommandRecorder::ResetStatistics()
+    {
+        std::ranges::fill(statistics, RecordingWorkerStatistics{});
+    }
+}
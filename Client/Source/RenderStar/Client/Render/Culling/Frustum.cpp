@@ -0,0 +1,62 @@
+#include "RenderStar/Client/Render/Culling/Frustum.hpp"
+
+namespace RenderStar::Client::Render::Culling
+{
+    Frustum Frustum::FromViewProjection(const glm::mat4& viewProjection)
+    {
+        const auto row = [&viewProjection](const int index)
+        {
+            return glm::vec4(viewProjection[0][index], viewProjection[1][index], viewProjection[2][index], viewProjection[3][index]);
+        };
+
+        const glm::vec4 x = row(0);
+        const glm::vec4 y = row(1);
+        const glm::vec4 z = row(2);
+        const glm::vec4 w = row(3);
+
+        Frustum frustum;
+        frustum.planes[LEFT_PLANE] = w + x;
+        frustum.planes[RIGHT_PLANE] = w - x;
+        frustum.planes[BOTTOM_PLANE] = w + y;
+        frustum.planes[TOP_PLANE] = w - y;
+        frustum.planes[NEAR_PLANE] = z;
+        frustum.planes[FAR_PLANE] = w - z;
+
+        for (auto& plane : frustum.planes)
+        {
+            const float length = glm::length(glm::vec3(plane));
+
+            if (length > 0.0f)
+                plane /= length;
+        }
+
+        return frustum;
+    }
+
+    bool Frustum::Intersects(const BoundingBox& box) const
+    {
+        const glm::vec3 center = box.GetCenter();
+        const glm::vec3 extents = box.GetExtents();
+
+        for (const auto& plane : planes)
+        {
+            const glm::vec3 normal(plane);
+
+            if (glm::dot(normal, center) + plane.w + glm::dot(glm::abs(normal), extents) < 0.0f)
+                return false;
+        }
+
+        return true;
+    }
+
+    bool Frustum::Intersects(const BoundingSphere& sphere) const
+    {
+        for (const auto& plane : planes)
+        {
+            if (glm::dot(glm::vec3(plane), sphere.center) + plane.w < -sphere.radius)
+                return false;
+        }
+
+        return true;
+    }
+}
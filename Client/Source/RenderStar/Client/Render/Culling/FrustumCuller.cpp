@@ -0,0 +1,167 @@
+#include "RenderStar/Client/Render/Culling/FrustumCuller.hpp"
+#include <array>
+#include <bit>
+#include <cmath>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace RenderStar::Client::Render::Culling
+{
+    namespace
+    {
+        struct PlaneBroadcast
+        {
+            float normalX;
+            float normalY;
+            float normalZ;
+            float absNormalX;
+            float absNormalY;
+            float absNormalZ;
+            float distance;
+        };
+
+        std::array<PlaneBroadcast, Frustum::PLANE_COUNT> PreparePlanes(const Frustum& frustum)
+        {
+            std::array<PlaneBroadcast, Frustum::PLANE_COUNT> prepared{};
+
+            for (size_t i = 0; i < Frustum::PLANE_COUNT; ++i)
+            {
+                const glm::vec4& plane = frustum.planes[i];
+                prepared[i] = { plane.x, plane.y, plane.z, std::abs(plane.x), std::abs(plane.y), std::abs(plane.z), plane.w };
+            }
+
+            return prepared;
+        }
+    }
+
+    uint32_t FrustumCuller::Add(const BoundingBox& box)
+    {
+        const auto index = static_cast<uint32_t>(count++);
+
+        if (centerX.size() < count)
+        {
+            const size_t padded = centerX.size() + BATCH_SIZE;
+
+            for (auto* lane : { &centerX, &centerY, &centerZ, &extentX, &extentY, &extentZ })
+                lane->resize(padded, 0.0f);
+        }
+
+        Set(index, box);
+
+        return index;
+    }
+
+    void FrustumCuller::Set(const uint32_t index, const BoundingBox& box)
+    {
+        const glm::vec3 center = box.GetCenter();
+        const glm::vec3 extents = box.GetExtents();
+
+        centerX[index] = center.x;
+        centerY[index] = center.y;
+        centerZ[index] = center.z;
+        extentX[index] = extents.x;
+        extentY[index] = extents.y;
+        extentZ[index] = extents.z;
+    }
+
+    void FrustumCuller::Clear()
+    {
+        for (auto* lane : { &centerX, &centerY, &centerZ, &extentX, &extentY, &extentZ })
+            lane->clear();
+
+        count = 0;
+    }
+
+    void FrustumCuller::Cull(const Frustum& frustum, std::vector<uint32_t>& visible) const
+    {
+        visible.clear();
+
+        const auto planes = PreparePlanes(frustum);
+
+        // A box is outside a plane when even its most positive corner, center + |n| * extents, lies behind it
+        for (size_t base = 0; base < count; base += BATCH_SIZE)
+        {
+            uint32_t insideMask = (1u << BATCH_SIZE) - 1;
+
+#if defined(__AVX__)
+            const __m256 cx = _mm256_loadu_ps(centerX.data() + base);
+            const __m256 cy = _mm256_loadu_ps(centerY.data() + base);
+            const __m256 cz = _mm256_loadu_ps(centerZ.data() + base);
+            const __m256 ex = _mm256_loadu_ps(extentX.data() + base);
+            const __m256 ey = _mm256_loadu_ps(extentY.data() + base);
+            const __m256 ez = _mm256_loadu_ps(extentZ.data() + base);
+
+            for (const auto& plane : planes)
+            {
+                __m256 distance = _mm256_add_ps(_mm256_mul_ps(cx, _mm256_set1_ps(plane.normalX)), _mm256_set1_ps(plane.distance));
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(cy, _mm256_set1_ps(plane.normalY)));
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(cz, _mm256_set1_ps(plane.normalZ)));
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(ex, _mm256_set1_ps(plane.absNormalX)));
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(ey, _mm256_set1_ps(plane.absNormalY)));
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(ez, _mm256_set1_ps(plane.absNormalZ)));
+
+                insideMask &= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(distance, _mm256_setzero_ps(), _CMP_GE_OQ)));
+            }
+#elif defined(__SSE2__) || defined(_M_X64)
+            for (size_t half = 0; half < BATCH_SIZE; half += 4)
+            {
+                const __m128 cx = _mm_loadu_ps(centerX.data() + base + half);
+                const __m128 cy = _mm_loadu_ps(centerY.data() + base + half);
+                const __m128 cz = _mm_loadu_ps(centerZ.data() + base + half);
+                const __m128 ex = _mm_loadu_ps(extentX.data() + base + half);
+                const __m128 ey = _mm_loadu_ps(extentY.data() + base + half);
+                const __m128 ez = _mm_loadu_ps(extentZ.data() + base + half);
+
+                uint32_t halfMask = 0xF;
+
+                for (const auto& plane : planes)
+                {
+                    __m128 distance = _mm_add_ps(_mm_mul_ps(cx, _mm_set1_ps(plane.normalX)), _mm_set1_ps(plane.distance));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(cy, _mm_set1_ps(plane.normalY)));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(cz, _mm_set1_ps(plane.normalZ)));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(ex, _mm_set1_ps(plane.absNormalX)));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(ey, _mm_set1_ps(plane.absNormalY)));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(ez, _mm_set1_ps(plane.absNormalZ)));
+
+                    halfMask &= static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpge_ps(distance, _mm_setzero_ps())));
+                }
+
+                if (half == 0)
+                    insideMask = halfMask;
+                else
+                    insideMask |= halfMask << 4;
+            }
+#else
+            for (size_t lane = 0; lane < BATCH_SIZE; ++lane)
+            {
+                const size_t i = base + lane;
+
+                for (const auto& plane : planes)
+                {
+                    const float distance = centerX[i] * plane.normalX + centerY[i] * plane.normalY + centerZ[i] * plane.normalZ + plane.distance
+                        + extentX[i] * plane.absNormalX + extentY[i] * plane.absNormalY + extentZ[i] * plane.absNormalZ;
+
+                    if (!(distance >= 0.0f))
+                    {
+                        insideMask &= ~(1u << lane);
+                        break;
+                    }
+                }
+            }
+#endif
+
+            if (count - base < BATCH_SIZE)
+                insideMask &= (1u << (count - base)) - 1;
+
+            while (insideMask != 0)
+            {
+                visible.push_back(static_cast<uint32_t>(base) + static_cast<uint32_t>(std::countr_zero(insideMask)));
+                insideMask &= insideMask - 1;
+            }
+        }
+    }
+}
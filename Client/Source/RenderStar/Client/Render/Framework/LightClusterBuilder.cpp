@@ -0,0 +1,244 @@
+#include "RenderStar/Client/Render/Framework/LightClusterBuilder.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace RenderStar::Client::Render::Framework
+{
+    namespace
+    {
+        // Widens every light a little so float differences between this and the shader never drop a fragment
+        constexpr float RANGE_SLACK = 1.01f;
+        constexpr float MIN_CLIP_W = 1e-4f;
+
+        struct DepthInterval
+        {
+            float nearest = 0.0f;
+            float farthest = 0.0f;
+        };
+
+        // Clip-space w is affine in world position, so a sphere spans center w +- radius * |w gradient|
+        DepthInterval ComputeDepthInterval(const glm::vec3& position, const float radius, const glm::mat4& viewProjection)
+        {
+            const glm::vec3 gradient(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3]);
+            const float center = glm::dot(gradient, position) + viewProjection[3][3];
+            const float extent = radius * glm::length(gradient);
+
+            return { center - extent, center + extent };
+        }
+
+        uint32_t DepthToSlice(const float depth, const LightClusterView& view)
+        {
+            if (depth <= view.nearDepth)
+                return 0;
+
+            const float scale = static_cast<float>(CLUSTER_GRID_Z) / std::log(view.farDepth / view.nearDepth);
+            const float slice = std::log(depth) * scale - std::log(view.nearDepth) * scale;
+
+            return std::min(static_cast<uint32_t>(slice), CLUSTER_GRID_Z - 1);
+        }
+
+        uint32_t NdcToTile(const float ndc, const uint32_t tiles)
+        {
+            const float tile = std::floor((ndc * 0.5f + 0.5f) * static_cast<float>(tiles));
+
+            return static_cast<uint32_t>(std::clamp(tile, 0.0f, static_cast<float>(tiles - 1)));
+        }
+    }
+
+    LightClusterBuilder::LightClusterBuilder(const size_t workerCount)
+        : workers(workerCount)
+    {
+        counts.resize(CLUSTER_COUNT);
+        cursors.resize(CLUSTER_COUNT);
+    }
+
+    std::optional<LightClusterBuilder::ClusterRange> LightClusterBuilder::ComputeClusterRange(const glm::vec4& positionAndRange, const LightClusterView& view)
+    {
+        const glm::vec3 position(positionAndRange);
+        const float radius = positionAndRange.w * RANGE_SLACK;
+
+        if (radius <= 0.0f)
+            return std::nullopt;
+
+        const auto [nearest, farthest] = ComputeDepthInterval(position, radius, view.viewProjection);
+
+        if (farthest <= 0.0f || nearest > view.farDepth)
+            return std::nullopt;
+
+        ClusterRange range;
+        range.minZ = DepthToSlice(nearest, view);
+        range.maxZ = DepthToSlice(farthest, view);
+        range.maxX = CLUSTER_GRID_X - 1;
+        range.maxY = CLUSTER_GRID_Y - 1;
+
+        // Project the corners of the sphere's box; a corner at or behind the eye leaves the whole screen covered
+        glm::vec3 minNdc(1e30f);
+        glm::vec3 maxNdc(-1e30f);
+
+        for (uint32_t corner = 0; corner < 8; ++corner)
+        {
+            const glm::vec3 offset((corner & 1) ? radius : -radius, (corner & 2) ? radius : -radius, (corner & 4) ? radius : -radius);
+            const glm::vec4 clip = view.viewProjection * glm::vec4(position + offset, 1.0f);
+
+            if (clip.w <= MIN_CLIP_W)
+                return range;
+
+            const glm::vec3 ndc(clip.x / clip.w, clip.y / clip.w, 0.0f);
+            minNdc = glm::min(minNdc, ndc);
+            maxNdc = glm::max(maxNdc, ndc);
+        }
+
+        if (maxNdc.x < -1.0f || minNdc.x > 1.0f || maxNdc.y < -1.0f || minNdc.y > 1.0f)
+            return std::nullopt;
+
+        range.minX = NdcToTile(minNdc.x, CLUSTER_GRID_X);
+        range.maxX = NdcToTile(maxNdc.x, CLUSTER_GRID_X);
+        range.minY = NdcToTile(minNdc.y, CLUSTER_GRID_Y);
+        range.maxY = NdcToTile(maxNdc.y, CLUSTER_GRID_Y);
+
+        return range;
+    }
+
+    void LightClusterBuilder::Build(const std::span<const ClusteredLightGPU> candidates, const LightClusterView& view)
+    {
+        statistics = {};
+        statistics.candidateLights = candidates.size();
+        visible.clear();
+
+        for (uint32_t source = 0; source < candidates.size(); ++source)
+        {
+            const auto& light = candidates[source];
+            const auto range = ComputeClusterRange(light.positionAndRange, view);
+
+            if (!range.has_value())
+                continue;
+
+            // Bright, large and near lights first; those are the ones a truncated cluster keeps
+            const auto [nearest, farthest] = ComputeDepthInterval(glm::vec3(light.positionAndRange), light.positionAndRange.w, view.viewProjection);
+            const float relevance = light.colorAndIntensity.w * light.positionAndRange.w / std::max(nearest, view.nearDepth);
+
+            visible.push_back({ source, relevance, *range });
+        }
+
+        statistics.visibleLights = visible.size();
+
+        std::ranges::stable_sort(visible, std::greater{}, &Candidate::relevance);
+
+        const size_t packed = std::min<size_t>(visible.size(), MAX_CLUSTERED_LIGHTS);
+
+        lightData.depthParams = glm::vec4(view.nearDepth, view.farDepth, 0.0f, 0.0f);
+        lightData.depthParams.z = static_cast<float>(CLUSTER_GRID_Z) / std::log(view.farDepth / view.nearDepth);
+        lightData.depthParams.w = -std::log(view.nearDepth) * lightData.depthParams.z;
+        lightData.lightCount = static_cast<int32_t>(packed);
+        ranges.resize(packed);
+
+        for (size_t index = 0; index < packed; ++index)
+        {
+            lightData.lights[index] = candidates[visible[index].source];
+            ranges[index] = visible[index].range;
+        }
+
+        statistics.packedLights = packed;
+
+        const bool parallel = packed >= PARALLEL_LIGHT_THRESHOLD;
+
+        std::ranges::fill(counts, 0u);
+        BinSlices(parallel, false);
+
+        // Lists are binned in relevance order, so capping every cluster alike drops only the least relevant tails
+        const uint32_t cap = ComputeClusterCap(counts);
+        uint32_t offset = 0;
+
+        for (uint32_t cluster = 0; cluster < CLUSTER_COUNT; ++cluster)
+        {
+            const uint32_t count = std::min(counts[cluster], cap);
+
+            statistics.droppedIndices += counts[cluster] - count;
+            gridData.cells[cluster] = offset << 8 | count;
+            cursors[cluster] = offset;
+            offset += count;
+        }
+
+        statistics.indexCount = offset;
+
+        BinSlices(parallel, true);
+    }
+
+    std::span<const uint8_t> LightClusterBuilder::GetClusterLights(const uint32_t cluster) const
+    {
+        if (cluster >= CLUSTER_COUNT)
+            return {};
+
+        const uint32_t cell = gridData.cells[cluster];
+
+        return { indexData.indices + (cell >> 8), cell & 0xFFu };
+    }
+
+    uint32_t LightClusterBuilder::ComputeClusterCap(const std::span<const uint32_t> counts)
+    {
+        const auto fits = [counts](const uint32_t cap)
+        {
+            size_t total = 0;
+
+            for (const uint32_t count : counts)
+                total += std::min(count, cap);
+
+            return total <= MAX_CLUSTER_LIGHT_INDICES;
+        };
+
+        uint32_t low = 0;
+        uint32_t high = counts.empty() ? 0 : std::ranges::max(counts);
+
+        if (fits(high))
+            return high;
+
+        // fits(low) always holds and fits(high) never does
+        while (high - low > 1)
+        {
+            const uint32_t middle = low + (high - low) / 2;
+
+            if (fits(middle))
+                low = middle;
+            else
+                high = middle;
+        }
+
+        return low;
+    }
+
+    // Each job owns one depth slice, so counts and cursors are never shared between threads
+    void LightClusterBuilder::BinSlices(const bool parallel, const bool fill)
+    {
+        workers.Run(CLUSTER_GRID_Z, [&](const size_t slice)
+        {
+            const auto z = static_cast<uint32_t>(slice);
+
+            for (size_t light = 0; light < ranges.size(); ++light)
+            {
+                const ClusterRange& range = ranges[light];
+
+                if (z < range.minZ || z > range.maxZ)
+                    continue;
+
+                for (uint32_t y = range.minY; y <= range.maxY; ++y)
+                {
+                    for (uint32_t x = range.minX; x <= range.maxX; ++x)
+                    {
+                        const uint32_t cluster = GetClusterIndex(x, y, z);
+
+                        if (!fill)
+                        {
+                            ++counts[cluster];
+                            continue;
+                        }
+
+                        const uint32_t cell = gridData.cells[cluster];
+
+                        if (cursors[cluster] < (cell >> 8) + (cell & 0xFFu))
+                            indexData.indices[cursors[cluster]++] = static_cast<uint8_t>(light);
+                    }
+                }
+            }
+        }, parallel ? 0 : 1);
+    }
+}
@@ -4,6 +4,7 @@
 #include "RenderStar/Common/Component/ComponentModule.hpp"
 #include "RenderStar/Common/Component/Components/Transform.hpp"
 #include <cmath>
+#include <cstddef>
 #include <glm/gtc/matrix_transform.hpp>
 
 namespace RenderStar::Client::Render::Framework
@@ -19,6 +20,9 @@ namespace RenderStar::Client::Render::Framework
         if (bufferManager)
         {
             sceneLightingBuffer = bufferManager->CreateUniformBuffer(SceneLightingData::Size());
+            clusterLightBuffer = bufferManager->CreateUniformBuffer(ClusteredLightData::Size());
+            clusterGridBuffer = bufferManager->CreateUniformBuffer(ClusterGridData::Size());
+            clusterIndexBuffer = bufferManager->CreateUniformBuffer(ClusterIndexData::Size());
             postProcessBuffer = bufferManager->CreateUniformBuffer(PostProcessData::Size());
 
             postProcessData = PostProcessData::Defaults();
@@ -27,16 +31,18 @@ namespace RenderStar::Client::Render::Framework
     }
 
     void RenderingFrameworkModule::CollectSceneData(Common::Component::ComponentModule& componentModule,
-                                                     const glm::vec3& cameraPosition)
+                                                     const glm::vec3& cameraPosition, const LightClusterView& view)
     {
         sceneLightingData = SceneLightingData{};
         sceneLightingData.cameraPosition = glm::vec4(cameraPosition, 1.0f);
+        sceneLightingData.viewProjection = view.viewProjection;
         sceneLightingData.ambientColor = glm::vec4(ambientColor, ambientIntensity);
 
         auto& lightPool = componentModule.GetPool<Components::Light>();
         bool directionalFound = false;
-        int32_t pointCount = 0;
-        int32_t spotCount = 0;
+
+        clusterCandidates.clear();
+        shadowCascades.Clear();
 
         for (auto [entity, light] : lightPool)
         {
@@ -47,43 +53,27 @@ namespace RenderStar::Client::Render::Framework
                 sceneLightingData.directionalDirection = glm::vec4(lightDir, 0.0f);
                 sceneLightingData.directionalColor = glm::vec4(light.color, light.intensity);
 
-                constexpr float shadowRadius = 30.0f;
-                constexpr float shadowNear = 0.1f;
-                constexpr float shadowFar = 150.0f;
-                constexpr float shadowMapSize = 2048.0f;
-                constexpr float texelSize = (shadowRadius * 2.0f) / shadowMapSize;
-
-                glm::vec3 up = std::abs(glm::dot(lightDir, glm::vec3(0.0f, 1.0f, 0.0f))) > 0.99f
-                    ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
-
-                glm::mat4 lightView = glm::lookAt(glm::vec3(0.0f) - lightDir, glm::vec3(0.0f), up);
-                glm::vec3 shadowOrigin = glm::vec3(lightView * glm::vec4(cameraPosition, 1.0f));
-                shadowOrigin.x = std::floor(shadowOrigin.x / texelSize) * texelSize;
-                shadowOrigin.y = std::floor(shadowOrigin.y / texelSize) * texelSize;
-                glm::vec3 snappedCenter = glm::vec3(glm::inverse(lightView) * glm::vec4(shadowOrigin, 1.0f));
-
-                lightView = glm::lookAt(snappedCenter - lightDir * (shadowFar * 0.5f), snappedCenter, up);
-                glm::mat4 lightProj = glm::ortho(-shadowRadius, shadowRadius, -shadowRadius, shadowRadius, shadowNear, shadowFar);
-                sceneLightingData.directionalLightVP = lightProj * lightView;
-                constexpr float pcssLightSize = 60.0f;
-                sceneLightingData.shadowParams = glm::vec4(1.0f, 0.0008f, shadowMapSize, pcssLightSize);
-            }
-            else if (light.type == Components::LightType::POINT && pointCount < MAX_POINT_LIGHTS)
-            {
-                auto transformOpt = componentModule.GetComponent<Common::Component::Transform>(entity);
+                shadowCascades.Build(view.viewProjection, view.nearDepth, view.farDepth, lightDir);
 
-                if (!transformOpt.has_value())
-                    continue;
+                const auto cascades = shadowCascades.GetCascades();
+                const ShadowCascadeSettings& shadowSettings = shadowCascades.GetSettings();
 
-                auto& transform = transformOpt->get();
+                for (uint32_t index = 0; index < cascades.size(); ++index)
+                {
+                    const ShadowCascade& cascade = cascades[index];
 
-                sceneLightingData.pointLights[pointCount].positionAndRange =
-                    glm::vec4(transform.worldPosition, light.range);
-                sceneLightingData.pointLights[pointCount].colorAndIntensity =
-                    glm::vec4(light.color, light.intensity);
-                pointCount++;
+                    sceneLightingData.cascadeViewProjections[index] = cascade.viewProjection;
+                    sceneLightingData.cascadeParams[index] =
+                        glm::vec4(cascade.farDepth, cascade.texelSize, cascade.depthBias, cascade.depthRange);
+                }
+
+                // w: penumbra width per metre between blocker and receiver
+                constexpr float pcssPenumbraScale = 0.025f;
+                sceneLightingData.shadowCascadeCount = static_cast<int32_t>(cascades.size());
+                sceneLightingData.shadowParams =
+                    glm::vec4(1.0f, shadowSettings.depthBiasTexels, shadowSettings.mapResolution, pcssPenumbraScale);
             }
-            else if (light.type == Components::LightType::SPOT && spotCount < MAX_SPOT_LIGHTS)
+            else if (light.type == Components::LightType::POINT || light.type == Components::LightType::SPOT)
             {
                 auto transformOpt = componentModule.GetComponent<Common::Component::Transform>(entity);
 
@@ -92,23 +82,45 @@ namespace RenderStar::Client::Render::Framework
 
                 auto& transform = transformOpt->get();
 
-                sceneLightingData.spotLights[spotCount].positionAndRange =
-                    glm::vec4(transform.worldPosition, light.range);
-                sceneLightingData.spotLights[spotCount].directionAndAngle =
-                    glm::vec4(glm::normalize(light.direction), std::cos(glm::radians(light.spotAngle)));
-                sceneLightingData.spotLights[spotCount].colorAndIntensity =
-                    glm::vec4(light.color, light.intensity);
+                ClusteredLightGPU& gpuLight = clusterCandidates.emplace_back();
+                gpuLight.positionAndRange = glm::vec4(transform.worldPosition, light.range);
+                gpuLight.colorAndIntensity = glm::vec4(light.color, light.intensity);
 
-                float innerAngle = light.spotAngle * (1.0f - light.spotSoftness);
-                sceneLightingData.spotLights[spotCount].spotParams =
-                    glm::vec4(std::cos(glm::radians(innerAngle)), 0.0f, 0.0f, 0.0f);
+                if (light.type == Components::LightType::SPOT)
+                {
+                    float innerAngle = light.spotAngle * (1.0f - light.spotSoftness);
 
-                spotCount++;
+                    gpuLight.directionAndAngle =
+                        glm::vec4(glm::normalize(light.direction), std::cos(glm::radians(light.spotAngle)));
+                    gpuLight.spotParams = glm::vec4(std::cos(glm::radians(innerAngle)), 1.0f, 0.0f, 0.0f);
+                }
             }
         }
 
-        sceneLightingData.pointLightCount = pointCount;
-        sceneLightingData.spotLightCount = spotCount;
+        clusterBuilder.Build(clusterCandidates, view);
+
+        const ClusteredLightData& clusterLights = clusterBuilder.GetLightData();
+
+        for (int32_t index = 0; index < clusterLights.lightCount; ++index)
+        {
+            if (clusterLights.lights[index].spotParams.y > 0.5f)
+                sceneLightingData.spotLightCount++;
+            else
+                sceneLightingData.pointLightCount++;
+        }
+
+        // Only the packed lights and the used part of the index list change size, so upload just those
+        if (clusterLightBuffer)
+        {
+            const size_t lightBytes = offsetof(ClusteredLightData, lights) + sizeof(ClusteredLightGPU) * clusterLights.lightCount;
+            const size_t indexBytes = (clusterBuilder.GetStatistics().indexCount + 15) & ~size_t{15};
+
+            clusterLightBuffer->SetSubData(&clusterLights, lightBytes, 0);
+            clusterGridBuffer->SetSubData(&clusterBuilder.GetGridData(), ClusterGridData::Size(), 0);
+
+            if (indexBytes > 0)
+                clusterIndexBuffer->SetSubData(&clusterBuilder.GetIndexData(), indexBytes, 0);
+        }
 
         if (sceneLightingBuffer)
             sceneLightingBuffer->SetSubData(&sceneLightingData, SceneLightingData::Size(), 0);
@@ -119,14 +131,29 @@ namespace RenderStar::Client::Render::Framework
         return sceneLightingBuffer.get();
     }
 
+    LightClusterBuffers RenderingFrameworkModule::GetLightClusterBuffers() const
+    {
+        return { clusterLightBuffer.get(), clusterGridBuffer.get(), clusterIndexBuffer.get() };
+    }
+
+    const LightClusterStatistics& RenderingFrameworkModule::GetLightClusterStatistics() const
+    {
+        return clusterBuilder.GetStatistics();
+    }
+
     const SceneLightingData& RenderingFrameworkModule::GetSceneLightingData() const
     {
         return sceneLightingData;
     }
 
-    glm::mat4 RenderingFrameworkModule::GetLightViewProjection() const
+    std::span<const ShadowCascade> RenderingFrameworkModule::GetShadowCascades() const
+    {
+        return shadowCascades.GetCascades();
+    }
+
+    void RenderingFrameworkModule::SetShadowCascadeSettings(const ShadowCascadeSettings& settings)
     {
-        return sceneLightingData.directionalLightVP;
+        shadowCascades.SetSettings(settings);
     }
 
     void RenderingFrameworkModule::UploadPostProcessData(const PostProcessData& data)
@@ -157,6 +184,11 @@ namespace RenderStar::Client::Render::Framework
     {
         sceneLightingBuffer.reset();
         sceneLightingData = SceneLightingData{};
+        clusterLightBuffer.reset();
+        clusterGridBuffer.reset();
+        clusterIndexBuffer.reset();
+        clusterCandidates.clear();
+        shadowCascades.Clear();
         postProcessBuffer.reset();
         postProcessData = PostProcessData::Defaults();
         bufferManager = nullptr;
@@ -0,0 +1,126 @@
+#include "RenderStar/Client/Render/Framework/ShadowCascadeBuilder.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace RenderStar::Client::Render::Framework
+{
+    namespace
+    {
+        // Radii are rounded up to this step so rotating the camera never rescales a cascade
+        constexpr float RADIUS_QUANTUM = 1.0f / 16.0f;
+
+        glm::vec3 Unproject(const glm::mat4& inverseViewProjection, const float x, const float y, const float z)
+        {
+            const glm::vec4 world = inverseViewProjection * glm::vec4(x, y, z, 1.0f);
+            return glm::vec3(world) / world.w;
+        }
+
+        glm::vec3 ChooseLightUp(const glm::vec3& lightDirection)
+        {
+            return std::abs(glm::dot(lightDirection, glm::vec3(0.0f, 1.0f, 0.0f))) > 0.99f
+                ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+        }
+    }
+
+    void ShadowCascadeBuilder::SetSettings(const ShadowCascadeSettings& newSettings)
+    {
+        settings = newSettings;
+        settings.cascadeCount = std::clamp<uint32_t>(settings.cascadeCount, 1, MAX_SHADOW_CASCADES);
+    }
+
+    void ShadowCascadeBuilder::Build(const glm::mat4& viewProjection, const float nearDepth, const float farDepth, const glm::vec3& lightDirection)
+    {
+        const auto splits = ComputeSplitDepths(nearDepth, std::min(farDepth, settings.shadowDistance), settings.cascadeCount, settings.splitLambda);
+        const glm::vec3 direction = glm::normalize(lightDirection);
+
+        cascadeCount = settings.cascadeCount;
+
+        for (uint32_t cascade = 0; cascade < cascadeCount; ++cascade)
+            cascades[cascade] = FitCascade(viewProjection, splits[cascade], splits[cascade + 1], direction, settings);
+    }
+
+    std::array<float, MAX_SHADOW_CASCADES + 1> ShadowCascadeBuilder::ComputeSplitDepths(const float nearDepth, const float farDepth, const uint32_t count, const float lambda)
+    {
+        const uint32_t cascadeCount = std::clamp<uint32_t>(count, 1, MAX_SHADOW_CASCADES);
+        const float shadowFar = std::max(farDepth, nearDepth);
+
+        std::array<float, MAX_SHADOW_CASCADES + 1> splits{};
+        splits.fill(shadowFar);
+        splits[0] = nearDepth;
+
+        // Practical split scheme: a blend of logarithmic and uniform spacing
+        for (uint32_t index = 1; index < cascadeCount; ++index)
+        {
+            const float fraction = static_cast<float>(index) / static_cast<float>(cascadeCount);
+            const float logarithmic = nearDepth * std::pow(shadowFar / nearDepth, fraction);
+            const float uniform = nearDepth + (shadowFar - nearDepth) * fraction;
+
+            splits[index] = lambda * logarithmic + (1.0f - lambda) * uniform;
+        }
+
+        return splits;
+    }
+
+    ShadowCascade ShadowCascadeBuilder::FitCascade(const glm::mat4& viewProjection, const float nearDepth, const float farDepth,
+                                                   const glm::vec3& lightDirection, const ShadowCascadeSettings& settings)
+    {
+        const glm::mat4 inverseViewProjection = glm::inverse(viewProjection);
+        const glm::vec3 depthGradient(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3]);
+
+        // Clip-space w is affine along each corner ray, so two unprojected points locate any depth on it
+        std::array<glm::vec3, 8> corners;
+
+        for (uint32_t corner = 0; corner < 4; ++corner)
+        {
+            const float x = (corner & 1) ? 1.0f : -1.0f;
+            const float y = (corner & 2) ? 1.0f : -1.0f;
+            const glm::vec3 first = Unproject(inverseViewProjection, x, y, 0.0f);
+            const glm::vec3 second = Unproject(inverseViewProjection, x, y, 0.5f);
+            const float firstDepth = glm::dot(depthGradient, first) + viewProjection[3][3];
+            const float secondDepth = glm::dot(depthGradient, second) + viewProjection[3][3];
+            const glm::vec3 step = (second - first) / (secondDepth - firstDepth);
+
+            corners[corner] = first + step * (nearDepth - firstDepth);
+            corners[corner + 4] = first + step * (farDepth - firstDepth);
+        }
+
+        // A sphere keeps the cascade's size independent of the camera's orientation
+        glm::vec3 center(0.0f);
+
+        for (const glm::vec3& corner : corners)
+            center += corner;
+
+        center = center / 8.0f;
+
+        float radius = 0.0f;
+
+        for (const glm::vec3& corner : corners)
+            radius = std::max(radius, glm::length(corner - center));
+
+        radius = std::ceil(radius / RADIUS_QUANTUM) * RADIUS_QUANTUM;
+
+        ShadowCascade cascade;
+        cascade.nearDepth = nearDepth;
+        cascade.farDepth = farDepth;
+        cascade.texelSize = radius * 2.0f / settings.mapResolution;
+        cascade.depthRange = radius * 2.0f + settings.casterDistance;
+        cascade.depthBias = settings.depthBiasTexels * cascade.texelSize / cascade.depthRange;
+
+        // Moving the center in whole texels keeps shadow edges from shimmering as the camera moves
+        const glm::vec3 up = ChooseLightUp(lightDirection);
+        const glm::mat4 lightRotation = glm::lookAt(glm::vec3(0.0f), lightDirection, up);
+        glm::vec3 lightSpaceCenter = glm::vec3(lightRotation * glm::vec4(center, 1.0f));
+        lightSpaceCenter.x = std::floor(lightSpaceCenter.x / cascade.texelSize) * cascade.texelSize;
+        lightSpaceCenter.y = std::floor(lightSpaceCenter.y / cascade.texelSize) * cascade.texelSize;
+        const glm::vec3 snappedCenter = glm::vec3(glm::inverse(lightRotation) * glm::vec4(lightSpaceCenter, 1.0f));
+
+        const glm::vec3 eye = snappedCenter - lightDirection * (radius + settings.casterDistance);
+        const glm::mat4 lightView = glm::lookAt(eye, snappedCenter, up);
+        const glm::mat4 lightProjection = glm::ortho(-radius, radius, -radius, radius, 0.0f, cascade.depthRange);
+
+        cascade.viewProjection = lightProjection * lightView;
+
+        return cascade;
+    }
+}
@@ -0,0 +1,166 @@
+#include "RenderStar/Client/Render/Headless/HeadlessCommandQueue.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessResources.hpp"
+#include "RenderStar/Client/Render/Resource/IMesh.hpp"
+#include "RenderStar/Client/Render/Resource/IUniformBindingHandle.hpp"
+
+namespace RenderStar::Client::Render::Headless
+{
+    void HeadlessCommandBuffer::Begin()
+    {
+        recording = true;
+    }
+
+    void HeadlessCommandBuffer::End()
+    {
+        recording = false;
+    }
+
+    void HeadlessCommandBuffer::BindPipeline(IShaderProgram* program)
+    {
+        shader = GetHeadlessResourceId(program);
+        state.SetPipeline(program);
+    }
+
+    void HeadlessCommandBuffer::BindVertexBuffer(IBufferHandle* buffer, uint32_t)
+    {
+        geometry = GetHeadlessResourceId(buffer);
+        state.SetGeometry(buffer);
+    }
+
+    void HeadlessCommandBuffer::BindIndexBuffer(IBufferHandle*, IndexType)
+    {
+    }
+
+    void HeadlessCommandBuffer::BindUniformSet(IUniformBindingHandle* uniforms, uint32_t)
+    {
+        binding = GetHeadlessResourceId(uniforms);
+        state.SetBinding(uniforms, 0);
+    }
+
+    void HeadlessCommandBuffer::Draw(const uint32_t vertexCount, const uint32_t firstVertex)
+    {
+        RecordDraw(firstVertex, vertexCount);
+    }
+
+    void HeadlessCommandBuffer::DrawIndexed(const uint32_t indexCount, const uint32_t firstIndex)
+    {
+        RecordDraw(firstIndex, indexCount);
+    }
+
+    void HeadlessCommandBuffer::DrawMesh(IMesh* mesh)
+    {
+        if (mesh == nullptr || !mesh->IsValid())
+            return;
+
+        geometry = GetHeadlessResourceId(mesh);
+        state.SetGeometry(mesh);
+        RecordDraw(0, static_cast<uint32_t>(mesh->HasIndices() ? mesh->GetIndexCount() : mesh->GetVertexCount()));
+    }
+
+    void HeadlessCommandBuffer::SetViewport(float, float, float, float)
+    {
+    }
+
+    void HeadlessCommandBuffer::SetScissor(const int32_t x, const int32_t y, const uint32_t width, const uint32_t height)
+    {
+        HeadlessCommand command;
+        command.type = HeadlessCommandType::SET_SCISSOR;
+        command.x = x;
+        command.y = y;
+        command.width = width;
+        command.height = height;
+        commands.push_back(command);
+    }
+
+    void HeadlessCommandBuffer::Reset()
+    {
+        commands.clear();
+        state = {};
+        shader = 0;
+        binding = 0;
+        geometry = 0;
+        recording = false;
+    }
+
+    bool HeadlessCommandBuffer::IsRecording() const
+    {
+        return recording;
+    }
+
+    void HeadlessCommandBuffer::RecordDraw(const uint32_t firstIndex, const uint32_t elementCount)
+    {
+        HeadlessCommand command;
+        command.type = HeadlessCommandType::DRAW;
+        command.shader = shader;
+        command.binding = binding;
+        command.mesh = geometry;
+        command.firstIndex = firstIndex;
+        command.elementCount = elementCount;
+        commands.push_back(command);
+    }
+
+    HeadlessCommandQueue::HeadlessCommandQueue(HeadlessFrameLog* frameLog) : frameLog(frameLog) { }
+
+    IRenderCommandBuffer* HeadlessCommandQueue::AcquireCommandBuffer()
+    {
+        if (!availableBuffers.empty())
+        {
+            HeadlessCommandBuffer* buffer = availableBuffers.back();
+            availableBuffers.pop_back();
+            buffer->Reset();
+            return buffer;
+        }
+
+        commandBufferPool.push_back(std::make_unique<HeadlessCommandBuffer>());
+        return commandBufferPool.back().get();
+    }
+
+    void HeadlessCommandQueue::ReleaseCommandBuffer(IRenderCommandBuffer* buffer)
+    {
+        auto* headlessBuffer = static_cast<HeadlessCommandBuffer*>(buffer);
+
+        if (headlessBuffer != nullptr)
+        {
+            headlessBuffer->Reset();
+            availableBuffers.push_back(headlessBuffer);
+        }
+    }
+
+    void HeadlessCommandQueue::Submit(IRenderCommandBuffer* buffer)
+    {
+        const auto* headlessBuffer = static_cast<HeadlessCommandBuffer*>(buffer);
+
+        if (headlessBuffer == nullptr)
+            return;
+
+        HeadlessFrameStatistics& statistics = frameLog->GetCurrentStatistics();
+
+        for (HeadlessCommand command : headlessBuffer->GetCommands())
+        {
+            command.frameIndex = frameIndex;
+
+            if (command.type == HeadlessCommandType::DRAW)
+            {
+                ++statistics.drawCalls;
+                statistics.elementsDrawn += command.elementCount;
+            }
+            else if (command.type == HeadlessCommandType::SET_SCISSOR)
+            {
+                ++statistics.scissorChanges;
+            }
+
+            frameLog->Record(command);
+        }
+
+        statistics.pipelineChanges += headlessBuffer->GetState().GetPipelineChanges();
+        statistics.bindingChanges += headlessBuffer->GetState().GetBindingChanges();
+        statistics.geometryChanges += headlessBuffer->GetState().GetGeometryChanges();
+
+        ReleaseCommandBuffer(buffer);
+    }
+
+    int32_t HeadlessCommandQueue::GetCurrentFrameIndex() const
+    {
+        return frameIndex;
+    }
+}
@@ -0,0 +1,78 @@
+#include "RenderStar/Client/Render/Headless/HeadlessFrameLog.hpp"
+#include <algorithm>
+
+namespace RenderStar::Client::Render::Headless
+{
+    HeadlessFrameStatistics& HeadlessFrameStatistics::operator+=(const HeadlessFrameStatistics& other)
+    {
+        drawCalls += other.drawCalls;
+        indirectCommands += other.indirectCommands;
+        elementsDrawn += other.elementsDrawn;
+        pipelineChanges += other.pipelineChanges;
+        bindingChanges += other.bindingChanges;
+        geometryChanges += other.geometryChanges;
+        scissorChanges += other.scissorChanges;
+        renderTargetChanges += other.renderTargetChanges;
+        barriers += other.barriers;
+        bufferUploads += other.bufferUploads;
+        textureUploads += other.textureUploads;
+        bytesUploaded += other.bytesUploaded;
+        cpuMilliseconds += other.cpuMilliseconds;
+        return *this;
+    }
+
+    HeadlessFrameLog::HeadlessFrameLog(const size_t retainedFrames) : retainedFrames(std::max<size_t>(1, retainedFrames)) { }
+
+    void HeadlessFrameLog::BeginFrame()
+    {
+        frameStart = std::chrono::steady_clock::now();
+        frameStarted = true;
+    }
+
+    void HeadlessFrameLog::EndFrame()
+    {
+        if (frameStarted)
+        {
+            const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - frameStart;
+            current.statistics.cpuMilliseconds = elapsed.count();
+        }
+
+        frameStarted = false;
+        totals += current.statistics;
+
+        const uint64_t nextIndex = current.index + 1;
+
+        if (completed.size() == retainedFrames)
+            completed.pop_front();
+
+        completed.push_back(std::move(current));
+
+        current = {};
+        current.index = nextIndex;
+    }
+
+    void HeadlessFrameLog::Record(const HeadlessCommand& command)
+    {
+        current.commands.push_back(command);
+    }
+
+    void HeadlessFrameLog::RecordBufferUpload(const size_t bytes)
+    {
+        ++current.statistics.bufferUploads;
+        current.statistics.bytesUploaded += bytes;
+    }
+
+    void HeadlessFrameLog::RecordTextureUpload(const size_t bytes)
+    {
+        ++current.statistics.textureUploads;
+        current.statistics.bytesUploaded += bytes;
+    }
+
+    void HeadlessFrameLog::Clear()
+    {
+        current = {};
+        completed.clear();
+        totals = {};
+        frameStarted = false;
+    }
+}
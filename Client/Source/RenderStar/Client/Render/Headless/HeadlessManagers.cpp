@@ -0,0 +1,214 @@
+#include "RenderStar/Client/Render/Headless/HeadlessManagers.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessFrameLog.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessResources.hpp"
+#include "RenderStar/Common/Asset/ITextAsset.hpp"
+#include "RenderStar/Common/Asset/IBinaryAsset.hpp"
+
+namespace RenderStar::Client::Render::Headless
+{
+    HeadlessBufferManager::HeadlessBufferManager(HeadlessFrameLog* frameLog) : frameLog(frameLog) { }
+
+    std::unique_ptr<IBufferHandle> HeadlessBufferManager::CreateBuffer(const BufferType type, const BufferUsage usage, const size_t size, const void* initialData)
+    {
+        return std::make_unique<HeadlessBufferHandle>(frameLog, type, usage, size, initialData);
+    }
+
+    std::unique_ptr<IBufferHandle> HeadlessBufferManager::CreateVertexBuffer(const size_t size, const void* data, const BufferUsage usage)
+    {
+        return CreateBuffer(BufferType::VERTEX, usage, size, data);
+    }
+
+    std::unique_ptr<IBufferHandle> HeadlessBufferManager::CreateIndexBuffer(const size_t size, const void* data, const BufferUsage usage)
+    {
+        return CreateBuffer(BufferType::INDEX, usage, size, data);
+    }
+
+    std::unique_ptr<IBufferHandle> HeadlessBufferManager::CreateUniformBuffer(const size_t size, const BufferUsage usage)
+    {
+        return CreateBuffer(BufferType::UNIFORM, usage, size, nullptr);
+    }
+
+    std::unique_ptr<IMesh> HeadlessBufferManager::CreateMesh(const VertexLayout& layout, const PrimitiveType primitive)
+    {
+        return std::make_unique<HeadlessMesh>(frameLog, layout, primitive);
+    }
+
+    void HeadlessBufferManager::DestroyBuffer(IBufferHandle* buffer)
+    {
+        if (buffer != nullptr)
+            buffer->Release();
+    }
+
+    HeadlessShaderManager::HeadlessShaderManager(HeadlessFrameLog* frameLog) : logger(spdlog::default_logger()), frameLog(frameLog) { }
+
+    std::unique_ptr<IShaderProgram> HeadlessShaderManager::CreateFromSource(const ShaderSource& source)
+    {
+        const bool compute = !source.computeSource.empty();
+
+        if (!compute && (source.vertexSource.empty() || source.fragmentSource.empty()))
+        {
+            logger->error("Failed to create headless shader: missing vertex or fragment source");
+            return nullptr;
+        }
+
+        return std::make_unique<HeadlessShaderProgram>(frameLog, source, compute, true);
+    }
+
+    std::unique_ptr<IShaderProgram> HeadlessShaderManager::CreateFromBinary(const ShaderBinary& binary)
+    {
+        const bool compute = !binary.computeSpirv.empty();
+
+        if (!compute && (binary.vertexSpirv.empty() || binary.fragmentSpirv.empty()))
+        {
+            logger->error("Failed to create headless shader: missing vertex or fragment SPIR-V");
+            return nullptr;
+        }
+
+        return std::make_unique<HeadlessShaderProgram>(frameLog, ShaderSource{}, compute, true);
+    }
+
+    std::unique_ptr<IShaderProgram> HeadlessShaderManager::CreateFromTextAssets(const Common::Asset::ITextAsset& vertexAsset, const Common::Asset::ITextAsset& fragmentAsset)
+    {
+        ShaderSource source;
+        source.vertexSource = vertexAsset.GetContent();
+        source.fragmentSource = fragmentAsset.GetContent();
+
+        return CreateFromSource(source);
+    }
+
+    std::unique_ptr<IShaderProgram> HeadlessShaderManager::CreateFromBinaryAssets(const Common::Asset::IBinaryAsset& vertexAsset, const Common::Asset::IBinaryAsset& fragmentAsset)
+    {
+        if (vertexAsset.GetData().empty() || fragmentAsset.GetData().empty())
+        {
+            logger->error("Failed to create headless shader: empty binary asset");
+            return nullptr;
+        }
+
+        return std::make_unique<HeadlessShaderProgram>(frameLog, ShaderSource{}, false, true);
+    }
+
+    std::unique_ptr<IShaderProgram> HeadlessShaderManager::CreateComputeFromTextAsset(const Common::Asset::ITextAsset& computeAsset)
+    {
+        ShaderSource source;
+        source.computeSource = computeAsset.GetContent();
+
+        if (source.computeSource.empty())
+        {
+            logger->error("Failed to create headless compute shader: empty source");
+            return nullptr;
+        }
+
+        return CreateFromSource(source);
+    }
+
+    std::unique_ptr<IShaderProgram> HeadlessShaderManager::CreateComputeFromBinaryAsset(const Common::Asset::IBinaryAsset& computeAsset)
+    {
+        if (computeAsset.GetData().empty())
+        {
+            logger->error("Failed to create headless compute shader: empty binary asset");
+            return nullptr;
+        }
+
+        return std::make_unique<HeadlessShaderProgram>(frameLog, ShaderSource{}, true, true);
+    }
+
+    void HeadlessShaderManager::DestroyShader(IShaderProgram* shader)
+    {
+        if (shader != nullptr)
+            shader->Release();
+    }
+
+    HeadlessUniformManager::HeadlessUniformManager(HeadlessFrameLog* frameLog) : logger(spdlog::default_logger()), frameLog(frameLog) { }
+
+    void HeadlessUniformManager::CreateUniformBuffer(const std::string& name, const UniformBinding& binding)
+    {
+        bufferBindings[name] = binding.binding;
+        uniformBuffers[name] = std::make_unique<HeadlessBufferHandle>(frameLog, BufferType::UNIFORM, BufferUsage::DYNAMIC, binding.size, nullptr);
+        logger->debug("Created uniform buffer '{}' with binding {} and size {}", name, binding.binding, binding.size);
+    }
+
+    void HeadlessUniformManager::UpdateUniformBuffer(const std::string& name, const void* data, const size_t size, const size_t offset)
+    {
+        const auto iterator = uniformBuffers.find(name);
+
+        if (iterator == uniformBuffers.end())
+        {
+            logger->warn("Uniform buffer '{}' not found for update", name);
+            return;
+        }
+
+        iterator->second->SetSubData(data, size, offset);
+    }
+
+    void HeadlessUniformManager::BindUniformBuffer(const std::string& name, const uint32_t bindingPoint)
+    {
+        if (!uniformBuffers.contains(name))
+        {
+            logger->warn("Uniform buffer '{}' not found for binding", name);
+            return;
+        }
+
+        bufferBindings[name] = bindingPoint;
+    }
+
+    IBufferHandle* HeadlessUniformManager::GetUniformBuffer(const std::string& name)
+    {
+        const auto iterator = uniformBuffers.find(name);
+        return iterator != uniformBuffers.end() ? iterator->second.get() : nullptr;
+    }
+
+    void HeadlessUniformManager::DestroyUniformBuffer(const std::string& name)
+    {
+        uniformBuffers.erase(name);
+        bufferBindings.erase(name);
+    }
+
+    std::unique_ptr<IUniformBindingHandle> HeadlessUniformManager::CreateBindingForShader(IShaderProgram*)
+    {
+        return std::make_unique<HeadlessUniformBinding>(frameLog);
+    }
+
+    HeadlessTextureManager::HeadlessTextureManager(HeadlessFrameLog* frameLog)
+        : logger(spdlog::default_logger())
+        , frameLog(frameLog)
+    {
+        constexpr uint8_t white[] = { 255, 255, 255, 255 };
+
+        TextureDescription description;
+        description.generateMipmaps = false;
+        defaultTexture = std::make_unique<HeadlessTextureHandle>(frameLog, description, white);
+    }
+
+    std::unique_ptr<ITextureHandle> HeadlessTextureManager::CreateFromMemory(const TextureDescription& description, const void* pixels)
+    {
+        if (description.width == 0 || description.height == 0)
+        {
+            logger->error("Failed to create headless texture: zero extent");
+            return nullptr;
+        }
+
+        return std::make_unique<HeadlessTextureHandle>(frameLog, description, pixels);
+    }
+
+    bool HeadlessTextureManager::UpdateRegion(ITextureHandle& texture, const uint32_t x, const uint32_t y, const uint32_t width, const uint32_t height, const void* pixels)
+    {
+        auto* headlessTexture = static_cast<HeadlessTextureHandle*>(&texture);
+
+        if (!headlessTexture->IsValid() || headlessTexture->GetDescription().IsCompressed() || width == 0 || height == 0 ||
+            x + width > headlessTexture->GetWidth() || y + height > headlessTexture->GetHeight())
+            return false;
+
+        headlessTexture->WriteRegion(x, y, width, height, pixels);
+        return true;
+    }
+
+    bool HeadlessTextureManager::SupportsFormat(TextureFormat) const
+    {
+        return true;
+    }
+
+    ITextureHandle* HeadlessTextureManager::GetDefaultTexture()
+    {
+        return defaultTexture.get();
+    }
+}
@@ -0,0 +1,307 @@
+#include "RenderStar/Client/Render/Headless/HeadlessPlatformBackend.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessRenderBackend.hpp"
+#include <algorithm>
+
+namespace RenderStar::Client::Render::Headless
+{
+    HeadlessRenderTarget::HeadlessRenderTarget(HeadlessFrameLog* frameLog, const Platform::RenderTargetDescription& description)
+        : frameLog(frameLog)
+        , description(description)
+    {
+        Create();
+    }
+
+    const std::string& HeadlessRenderTarget::GetName() const
+    {
+        return description.name;
+    }
+
+    ITextureHandle* HeadlessRenderTarget::GetColorAttachment(const uint32_t index) const
+    {
+        return index == 0 ? colorAttachment.get() : nullptr;
+    }
+
+    ITextureHandle* HeadlessRenderTarget::GetDepthAttachment() const
+    {
+        return depthAttachment.get();
+    }
+
+    uint32_t HeadlessRenderTarget::GetWidth() const
+    {
+        return description.width;
+    }
+
+    uint32_t HeadlessRenderTarget::GetHeight() const
+    {
+        return description.height;
+    }
+
+    void HeadlessRenderTarget::Resize(const uint32_t width, const uint32_t height)
+    {
+        if (width == description.width && height == description.height)
+            return;
+
+        description.width = width;
+        description.height = height;
+
+        Create();
+    }
+
+    Platform::RenderTargetType HeadlessRenderTarget::GetType() const
+    {
+        if (description.hasDepth)
+            return Platform::RenderTargetType::COLOR_DEPTH;
+
+        return Platform::RenderTargetType::COLOR_ONLY;
+    }
+
+    bool HeadlessRenderTarget::IsSwapchain() const
+    {
+        return false;
+    }
+
+    uint32_t HeadlessRenderTarget::GetSampleCount() const
+    {
+        return description.sampleCount;
+    }
+
+    void HeadlessRenderTarget::Create()
+    {
+        TextureDescription color;
+        color.width = std::max(1u, description.width);
+        color.height = std::max(1u, description.height);
+        color.format = description.colorFormat;
+        color.generateMipmaps = false;
+        colorAttachment = std::make_unique<HeadlessTextureHandle>(frameLog, color, nullptr);
+
+        if (description.hasDepth)
+        {
+            TextureDescription depth = color;
+            depth.format = TextureFormat::DEPTH24_STENCIL8;
+            depthAttachment = std::make_unique<HeadlessTextureHandle>(frameLog, depth, nullptr);
+        }
+    }
+
+    HeadlessSwapchainTarget::HeadlessSwapchainTarget(const uint32_t width, const uint32_t height)
+        : name("SWAPCHAIN")
+        , width(width)
+        , height(height)
+    {
+    }
+
+    const std::string& HeadlessSwapchainTarget::GetName() const
+    {
+        return name;
+    }
+
+    ITextureHandle* HeadlessSwapchainTarget::GetColorAttachment(uint32_t) const
+    {
+        return nullptr;
+    }
+
+    ITextureHandle* HeadlessSwapchainTarget::GetDepthAttachment() const
+    {
+        return nullptr;
+    }
+
+    uint32_t HeadlessSwapchainTarget::GetWidth() const
+    {
+        return width;
+    }
+
+    uint32_t HeadlessSwapchainTarget::GetHeight() const
+    {
+        return height;
+    }
+
+    void HeadlessSwapchainTarget::Resize(const uint32_t newWidth, const uint32_t newHeight)
+    {
+        width = newWidth;
+        height = newHeight;
+    }
+
+    Platform::RenderTargetType HeadlessSwapchainTarget::GetType() const
+    {
+        return Platform::RenderTargetType::SWAPCHAIN;
+    }
+
+    bool HeadlessSwapchainTarget::IsSwapchain() const
+    {
+        return true;
+    }
+
+    HeadlessPlatformBackend::HeadlessPlatformBackend(HeadlessRenderBackend* backend)
+        : logger(spdlog::default_logger()->clone("HeadlessPlatformBackend"))
+        , backend(backend)
+    {
+        logger->info("Headless platform backend created");
+    }
+
+    std::unique_ptr<Platform::IRenderTarget> HeadlessPlatformBackend::CreateRenderTarget(
+        const Platform::RenderTargetDescription& description)
+    {
+        auto desc = description;
+
+        if (desc.matchSwapchainSize)
+        {
+            desc.width = static_cast<uint32_t>(backend->GetWidth() * desc.scale);
+            desc.height = static_cast<uint32_t>(backend->GetHeight() * desc.scale);
+        }
+
+        return std::make_unique<HeadlessRenderTarget>(&backend->GetFrameLog(), desc);
+    }
+
+    std::unique_ptr<Platform::IRenderTarget> HeadlessPlatformBackend::CreateSwapchainTarget()
+    {
+        return std::make_unique<HeadlessSwapchainTarget>(backend->GetWidth(), backend->GetHeight());
+    }
+
+    std::unique_ptr<IShaderProgram> HeadlessPlatformBackend::CompileShader(
+        const std::string& vertexGlsl,
+        const std::string& fragmentGlsl)
+    {
+        ShaderSource source;
+        source.vertexSource = vertexGlsl;
+        source.fragmentSource = fragmentGlsl;
+
+        return backend->GetShaderManager()->CreateFromSource(source);
+    }
+
+    std::unique_ptr<IShaderProgram> HeadlessPlatformBackend::CompileComputeShader(
+        const std::string& computeGlsl)
+    {
+        ShaderSource source;
+        source.computeSource = computeGlsl;
+
+        return backend->GetShaderManager()->CreateFromSource(source);
+    }
+
+    void HeadlessPlatformBackend::BindInputTextures(
+        const std::vector<Platform::IRenderTarget*>& inputs,
+        IShaderProgram* shader,
+        const int32_t frameIndex)
+    {
+        HeadlessCommand command;
+        command.type = HeadlessCommandType::BIND_INPUTS;
+        command.shader = GetHeadlessResourceId(shader);
+        command.frameIndex = frameIndex;
+        command.count = static_cast<uint32_t>(inputs.size());
+        backend->GetFrameLog().Record(command);
+    }
+
+    void HeadlessPlatformBackend::InsertBarriers(const std::span<const Platform::RenderGraphBarrier> barriers)
+    {
+        if (barriers.empty())
+            return;
+
+        HeadlessFrameLog& frameLog = backend->GetFrameLog();
+
+        HeadlessCommand command;
+        command.type = HeadlessCommandType::BARRIER;
+        command.frameIndex = backend->GetCurrentFrame();
+        command.count = static_cast<uint32_t>(barriers.size());
+        frameLog.Record(command);
+
+        frameLog.GetCurrentStatistics().barriers += command.count;
+    }
+
+    void HeadlessPlatformBackend::BeginRenderTarget(Platform::IRenderTarget* target, const bool clear)
+    {
+        HeadlessFrameLog& frameLog = backend->GetFrameLog();
+
+        HeadlessCommand command;
+        command.type = HeadlessCommandType::BEGIN_TARGET;
+        command.frameIndex = backend->GetCurrentFrame();
+        command.width = target->GetWidth();
+        command.height = target->GetHeight();
+        command.target = target->GetName();
+        command.clear = clear;
+        frameLog.Record(command);
+
+        ++frameLog.GetCurrentStatistics().renderTargetChanges;
+    }
+
+    void HeadlessPlatformBackend::EndRenderTarget(Platform::IRenderTarget* target)
+    {
+        HeadlessCommand command;
+        command.type = HeadlessCommandType::END_TARGET;
+        command.frameIndex = backend->GetCurrentFrame();
+
+        if (target)
+            command.target = target->GetName();
+
+        backend->GetFrameLog().Record(command);
+    }
+
+    void HeadlessPlatformBackend::BlitToScreen(Platform::IRenderTarget* source)
+    {
+        if (source->IsSwapchain())
+            return;
+
+        HeadlessCommand command;
+        command.type = HeadlessCommandType::BLIT;
+        command.frameIndex = backend->GetCurrentFrame();
+        command.width = source->GetWidth();
+        command.height = source->GetHeight();
+        command.target = source->GetName();
+        backend->GetFrameLog().Record(command);
+    }
+
+    IBufferManager* HeadlessPlatformBackend::GetBufferManager()
+    {
+        return backend->GetBufferManager();
+    }
+
+    IUniformManager* HeadlessPlatformBackend::GetUniformManager()
+    {
+        return backend->GetUniformManager();
+    }
+
+    ITextureManager* HeadlessPlatformBackend::GetTextureManager()
+    {
+        return backend->GetTextureManager();
+    }
+
+    IRenderCommandQueue* HeadlessPlatformBackend::GetCommandQueue()
+    {
+        return backend->GetCommandQueue();
+    }
+
+    void HeadlessPlatformBackend::SubmitDrawCommand(
+        IShaderProgram* shader,
+        IUniformBindingHandle* uniformBinding,
+        const int32_t frameIndex,
+        IMesh* mesh)
+    {
+        backend->SubmitDrawCommand(shader, uniformBinding, frameIndex, mesh);
+    }
+
+    void HeadlessPlatformBackend::ExecuteDrawCommands()
+    {
+        backend->ExecuteDrawCommands();
+    }
+
+    void HeadlessPlatformBackend::OnResize(uint32_t, uint32_t)
+    {
+    }
+
+    uint32_t HeadlessPlatformBackend::GetWidth() const
+    {
+        return backend->GetWidth();
+    }
+
+    uint32_t HeadlessPlatformBackend::GetHeight() const
+    {
+        return backend->GetHeight();
+    }
+
+    int32_t HeadlessPlatformBackend::GetCurrentFrame() const
+    {
+        return backend->GetCurrentFrame();
+    }
+
+    int32_t HeadlessPlatformBackend::GetMaxFramesInFlight() const
+    {
+        return backend->GetMaxFramesInFlight();
+    }
+}
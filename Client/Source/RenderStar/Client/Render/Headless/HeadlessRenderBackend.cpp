@@ -0,0 +1,360 @@
+#include "RenderStar/Client/Render/Headless/HeadlessRenderBackend.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessCommandQueue.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessManagers.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessResources.hpp"
+#include <cstring>
+
+namespace RenderStar::Client::Render::Headless
+{
+    // Advertises Vulkan capabilities so benchmarks take the same feature paths as the default backend
+    HeadlessRenderBackend::HeadlessRenderBackend(const size_t retainedFrames) : logger(spdlog::default_logger()), width(0), height(0), currentFrame(0), initialized(false), capabilities(BackendCapabilities::ForVulkan()), frameLog(retainedFrames) { }
+
+    HeadlessRenderBackend::~HeadlessRenderBackend()
+    {
+        if (initialized)
+            HeadlessRenderBackend::Destroy();
+    }
+
+    RenderBackend HeadlessRenderBackend::GetType() const
+    {
+        return RenderBackend::HEADLESS;
+    }
+
+    const BackendCapabilities& HeadlessRenderBackend::GetCapabilities() const
+    {
+        return capabilities;
+    }
+
+    void HeadlessRenderBackend::Initialize(GLFWwindow*, const uint32_t initialWidth, const uint32_t initialHeight)
+    {
+        width = initialWidth;
+        height = initialHeight;
+
+        bufferManager = std::make_unique<HeadlessBufferManager>(&frameLog);
+        uniformManager = std::make_unique<HeadlessUniformManager>(&frameLog);
+        shaderManager = std::make_unique<HeadlessShaderManager>(&frameLog);
+        textureManager = std::make_unique<HeadlessTextureManager>(&frameLog);
+        commandQueue = std::make_unique<HeadlessCommandQueue>(&frameLog);
+
+        initialized = true;
+        logger->info("Headless render backend initialized ({}x{})", width, height);
+    }
+
+    void HeadlessRenderBackend::Destroy()
+    {
+        commandQueue.reset();
+        shaderManager.reset();
+        textureManager.reset();
+        uniformManager.reset();
+        bufferManager.reset();
+        drawCommands.Clear();
+
+        const HeadlessFrameStatistics& totals = frameLog.GetTotals();
+        const uint64_t frames = frameLog.GetCompletedFrameCount();
+
+        if (frames > 0)
+        {
+            logger->info("Headless render backend: {} frames, {:.3f} ms CPU/frame, {} draws, {} pipeline, {} binding and {} geometry changes, {} bytes uploaded",
+                frames, totals.cpuMilliseconds / static_cast<double>(frames), totals.drawCalls,
+                totals.pipelineChanges, totals.bindingChanges, totals.geometryChanges, totals.bytesUploaded);
+        }
+
+        initialized = false;
+        logger->info("Headless render backend destroyed");
+    }
+
+    void HeadlessRenderBackend::BeginFrame()
+    {
+        frameLog.BeginFrame();
+    }
+
+    void HeadlessRenderBackend::EndFrame()
+    {
+        frameLog.EndFrame();
+        currentFrame = (currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+
+        if (commandQueue)
+            commandQueue->SetCurrentFrameIndex(currentFrame);
+    }
+
+    void HeadlessRenderBackend::WaitIdle()
+    {
+    }
+
+    void HeadlessRenderBackend::OnResize(const uint32_t width, const uint32_t height)
+    {
+        this->width = width;
+        this->height = height;
+    }
+
+    uint32_t HeadlessRenderBackend::GetWidth() const
+    {
+        return width;
+    }
+
+    uint32_t HeadlessRenderBackend::GetHeight() const
+    {
+        return height;
+    }
+
+    int32_t HeadlessRenderBackend::GetCurrentFrame() const
+    {
+        return currentFrame;
+    }
+
+    int32_t HeadlessRenderBackend::GetMaxFramesInFlight() const
+    {
+        return MAX_FRAMES_IN_FLIGHT;
+    }
+
+    bool HeadlessRenderBackend::IsInitialized() const
+    {
+        return initialized;
+    }
+
+    IBufferManager* HeadlessRenderBackend::GetBufferManager()
+    {
+        return bufferManager.get();
+    }
+
+    IShaderManager* HeadlessRenderBackend::GetShaderManager()
+    {
+        return shaderManager.get();
+    }
+
+    IUniformManager* HeadlessRenderBackend::GetUniformManager()
+    {
+        return uniformManager.get();
+    }
+
+    ITextureManager* HeadlessRenderBackend::GetTextureManager()
+    {
+        return textureManager.get();
+    }
+
+    IGraphicsResourceManager* HeadlessRenderBackend::GetResourceManager()
+    {
+        return nullptr;
+    }
+
+    IRenderCommandQueue* HeadlessRenderBackend::GetCommandQueue()
+    {
+        return commandQueue.get();
+    }
+
+    HeadlessDrawCommand HeadlessRenderBackend::ResolveDrawCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, const int32_t frameIndex, IMesh* mesh, const uint32_t firstIndex, const uint32_t indexCount)
+    {
+        HeadlessDrawCommand cmd;
+        cmd.type = HeadlessDrawCommand::Type::Draw;
+        cmd.shader = dynamic_cast<HeadlessShaderProgram*>(shader);
+        cmd.uniformBinding = uniformBinding;
+        cmd.frameIndex = frameIndex;
+        cmd.mesh = dynamic_cast<HeadlessMesh*>(mesh);
+        cmd.firstIndex = firstIndex;
+        cmd.indexCount = indexCount;
+        return cmd;
+    }
+
+    void HeadlessRenderBackend::SubmitDrawCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, const int32_t frameIndex, IMesh* mesh)
+    {
+        drawCommands.AddOrdered(ResolveDrawCommand(shader, uniformBinding, frameIndex, mesh, 0, 0));
+    }
+
+    void HeadlessRenderBackend::SubmitDrawRangeCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, const int32_t frameIndex, IMesh* mesh, const uint32_t firstIndex, const uint32_t indexCount)
+    {
+        drawCommands.AddOrdered(ResolveDrawCommand(shader, uniformBinding, frameIndex, mesh, firstIndex, indexCount));
+    }
+
+    void HeadlessRenderBackend::SubmitSortedDrawCommand(const SortedDrawSubmission& submission)
+    {
+        const HeadlessDrawCommand cmd = ResolveDrawCommand(submission.shader, submission.uniformBinding, submission.frameIndex,
+            submission.mesh, submission.firstIndex, submission.indexCount);
+
+        drawCommands.AddSorted(cmd, cmd.shader, submission.materialKey, submission.depth);
+    }
+
+    void HeadlessRenderBackend::SubmitIndirectDrawCommand(const IndirectDrawSubmission& submission)
+    {
+        const auto* argumentBuffer = dynamic_cast<HeadlessBufferHandle*>(submission.argumentBuffer);
+
+        if (!argumentBuffer || submission.commandCount == 0)
+            return;
+
+        HeadlessDrawCommand cmd = ResolveDrawCommand(submission.shader, submission.uniformBinding, submission.frameIndex, submission.mesh, 0, 0);
+
+        // Without a mesh the executor would take this for a fullscreen pass
+        if (!cmd.mesh)
+            return;
+
+        cmd.type = HeadlessDrawCommand::Type::DrawIndirect;
+        cmd.argumentBuffer = argumentBuffer;
+        cmd.firstCommand = submission.firstCommand;
+        cmd.commandCount = submission.commandCount;
+
+        drawCommands.AddSorted(cmd, cmd.shader, submission.materialKey, 0.0f);
+    }
+
+    void HeadlessRenderBackend::BeginOverlayPass()
+    {
+        RecordMarker(HeadlessCommandType::BEGIN_OVERLAY);
+    }
+
+    void HeadlessRenderBackend::EndOverlayPass()
+    {
+        RecordMarker(HeadlessCommandType::END_OVERLAY);
+    }
+
+    void HeadlessRenderBackend::SetScissorRect(const int32_t x, const int32_t y, const uint32_t w, const uint32_t h)
+    {
+        RecordScissor(x, y, w, h);
+    }
+
+    void HeadlessRenderBackend::ClearScissorRect()
+    {
+        RecordClearScissor();
+    }
+
+    void HeadlessRenderBackend::SubmitSetScissor(const int32_t x, const int32_t y, const uint32_t w, const uint32_t h)
+    {
+        HeadlessDrawCommand cmd;
+        cmd.type = HeadlessDrawCommand::Type::SetScissor;
+        cmd.scissorX = x;
+        cmd.scissorY = y;
+        cmd.scissorW = w;
+        cmd.scissorH = h;
+        drawCommands.AddOrdered(cmd);
+    }
+
+    void HeadlessRenderBackend::SubmitClearScissor()
+    {
+        HeadlessDrawCommand cmd;
+        cmd.type = HeadlessDrawCommand::Type::ClearScissor;
+        drawCommands.AddOrdered(cmd);
+    }
+
+    uint32_t HeadlessRenderBackend::CountIndirectElements(const HeadlessBufferHandle& argumentBuffer, const uint32_t firstCommand, const uint32_t commandCount)
+    {
+        const auto& contents = argumentBuffer.GetContents();
+        uint32_t elements = 0;
+
+        // Commands past the end of the buffer are skipped rather than read out of bounds
+        for (uint32_t command = firstCommand; command < firstCommand + commandCount; ++command)
+        {
+            const size_t offset = static_cast<size_t>(command) * sizeof(DrawIndexedIndirectCommand);
+
+            if (offset + sizeof(DrawIndexedIndirectCommand) > contents.size())
+                break;
+
+            DrawIndexedIndirectCommand arguments;
+            std::memcpy(&arguments, contents.data() + offset, sizeof(arguments));
+            elements += arguments.indexCount * arguments.instanceCount;
+        }
+
+        return elements;
+    }
+
+    void HeadlessRenderBackend::RecordMarker(const HeadlessCommandType type)
+    {
+        HeadlessCommand command;
+        command.type = type;
+        command.frameIndex = currentFrame;
+        frameLog.Record(command);
+    }
+
+    void HeadlessRenderBackend::RecordScissor(const int32_t x, const int32_t y, const uint32_t w, const uint32_t h)
+    {
+        HeadlessCommand command;
+        command.type = HeadlessCommandType::SET_SCISSOR;
+        command.frameIndex = currentFrame;
+        command.x = x;
+        command.y = y;
+        command.width = w;
+        command.height = h;
+        frameLog.Record(command);
+
+        ++frameLog.GetCurrentStatistics().scissorChanges;
+    }
+
+    void HeadlessRenderBackend::RecordClearScissor()
+    {
+        RecordMarker(HeadlessCommandType::CLEAR_SCISSOR);
+        ++frameLog.GetCurrentStatistics().scissorChanges;
+    }
+
+    void HeadlessRenderBackend::ExecuteDrawCommands()
+    {
+        const auto commands = drawCommands.GetCommands();
+        DrawStateTracker state;
+        HeadlessFrameStatistics& statistics = frameLog.GetCurrentStatistics();
+
+        for (const uint32_t index : drawCommands.Sort())
+        {
+            const HeadlessDrawCommand& cmd = commands[index];
+
+            if (cmd.type == HeadlessDrawCommand::Type::SetScissor)
+            {
+                RecordScissor(cmd.scissorX, cmd.scissorY, cmd.scissorW, cmd.scissorH);
+                continue;
+            }
+
+            if (cmd.type == HeadlessDrawCommand::Type::ClearScissor)
+            {
+                RecordClearScissor();
+                continue;
+            }
+
+            if (cmd.shader)
+                state.SetPipeline(cmd.shader);
+
+            if (cmd.uniformBinding)
+                state.SetBinding(cmd.uniformBinding, cmd.frameIndex);
+
+            HeadlessCommand recorded;
+            recorded.shader = GetHeadlessResourceId(cmd.shader);
+            recorded.binding = GetHeadlessResourceId(cmd.uniformBinding);
+            recorded.frameIndex = cmd.frameIndex;
+
+            if (cmd.mesh && cmd.mesh->IsValid())
+            {
+                state.SetGeometry(cmd.mesh);
+
+                recorded.type = HeadlessCommandType::DRAW;
+                recorded.mesh = cmd.mesh->GetId();
+                recorded.firstIndex = cmd.firstIndex;
+
+                if (cmd.type == HeadlessDrawCommand::Type::DrawIndirect)
+                {
+                    recorded.type = HeadlessCommandType::DRAW_INDIRECT;
+                    recorded.count = cmd.commandCount;
+                    recorded.elementCount = CountIndirectElements(*cmd.argumentBuffer, cmd.firstCommand, cmd.commandCount);
+                    statistics.indirectCommands += cmd.commandCount;
+                }
+                else if (cmd.indexCount > 0)
+                    recorded.elementCount = cmd.indexCount;
+                else
+                    recorded.elementCount = static_cast<uint32_t>(cmd.mesh->HasIndices() ? cmd.mesh->GetIndexCount() : cmd.mesh->GetVertexCount());
+            }
+            else if (!cmd.mesh && cmd.shader)
+            {
+                state.SetGeometry(nullptr);
+
+                recorded.type = HeadlessCommandType::DRAW_FULLSCREEN;
+                recorded.elementCount = 3;
+            }
+            else
+            {
+                continue;
+            }
+
+            ++statistics.drawCalls;
+            statistics.elementsDrawn += recorded.elementCount;
+            frameLog.Record(recorded);
+        }
+
+        statistics.pipelineChanges += state.GetPipelineChanges();
+        statistics.bindingChanges += state.GetBindingChanges();
+        statistics.geometryChanges += state.GetGeometryChanges();
+
+        drawCommands.Clear();
+    }
+}
@@ -0,0 +1,368 @@
+#include "RenderStar/Client/Render/Headless/HeadlessResources.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessFrameLog.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace RenderStar::Client::Render::Headless
+{
+    namespace
+    {
+        // Matches what the GPU backends stage: the whole supplied chain for compressed formats, level 0 otherwise
+        size_t GetUploadSize(const TextureDescription& description)
+        {
+            if (!description.IsCompressed())
+                return description.GetLevelSize(0);
+
+            size_t size = 0;
+
+            for (uint32_t level = 0; level < std::max(1u, description.mipLevels); ++level)
+                size += description.GetLevelSize(level);
+
+            return size;
+        }
+    }
+
+    HeadlessBufferHandle::HeadlessBufferHandle(HeadlessFrameLog* frameLog, const BufferType type, const BufferUsage usage, const size_t size, const void* initialData)
+        : frameLog(frameLog)
+        , id(frameLog->NextResourceId())
+        , type(type)
+        , usage(usage)
+        , contents(size)
+    {
+        if (initialData != nullptr && size > 0)
+        {
+            std::memcpy(contents.data(), initialData, size);
+            frameLog->RecordBufferUpload(size);
+        }
+    }
+
+    HeadlessBufferHandle::~HeadlessBufferHandle()
+    {
+        if (!released)
+            Release();
+    }
+
+    void HeadlessBufferHandle::Release()
+    {
+        if (released)
+            return;
+
+        contents.clear();
+        contents.shrink_to_fit();
+        released = true;
+    }
+
+    GraphicsResourceType HeadlessBufferHandle::GetResourceType() const
+    {
+        return GraphicsResourceType::BUFFER;
+    }
+
+    void HeadlessBufferHandle::SetData(const void* data, const size_t size)
+    {
+        if (released)
+            return;
+
+        contents.resize(size);
+
+        if (data != nullptr && size > 0)
+            std::memcpy(contents.data(), data, size);
+
+        frameLog->RecordBufferUpload(size);
+    }
+
+    void HeadlessBufferHandle::SetSubData(const void* data, const size_t size, const size_t offset)
+    {
+        if (released || data == nullptr || offset > contents.size() || size > contents.size() - offset)
+            return;
+
+        std::memcpy(contents.data() + offset, data, size);
+        frameLog->RecordBufferUpload(size);
+    }
+
+    size_t HeadlessBufferHandle::GetSize() const
+    {
+        return contents.size();
+    }
+
+    BufferType HeadlessBufferHandle::GetType() const
+    {
+        return type;
+    }
+
+    BufferUsage HeadlessBufferHandle::GetUsage() const
+    {
+        return usage;
+    }
+
+    bool HeadlessBufferHandle::IsValid() const
+    {
+        return !released;
+    }
+
+    HeadlessMesh::HeadlessMesh(HeadlessFrameLog* frameLog, const VertexLayout& layout, const PrimitiveType primitive)
+        : frameLog(frameLog)
+        , id(frameLog->NextResourceId())
+        , layout(layout)
+        , primitive(primitive)
+    {
+    }
+
+    HeadlessMesh::~HeadlessMesh()
+    {
+        if (!released)
+            Release();
+    }
+
+    void HeadlessMesh::Release()
+    {
+        if (released)
+            return;
+
+        vertexData.clear();
+        indexData.clear();
+        vertexCount = 0;
+        indexCount = 0;
+        released = true;
+    }
+
+    GraphicsResourceType HeadlessMesh::GetResourceType() const
+    {
+        return GraphicsResourceType::MESH;
+    }
+
+    void HeadlessMesh::SetVertexData(const void* data, const size_t size)
+    {
+        if (released)
+            return;
+
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        vertexData.assign(bytes, bytes + (data != nullptr ? size : 0));
+        vertexCount = layout.stride > 0 ? static_cast<int32_t>(vertexData.size() / static_cast<size_t>(layout.stride)) : 0;
+        frameLog->RecordBufferUpload(vertexData.size());
+    }
+
+    void HeadlessMesh::SetIndexData(const void* data, const size_t size, const IndexType type)
+    {
+        if (released)
+            return;
+
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        indexData.assign(bytes, bytes + (data != nullptr ? size : 0));
+        indexType = type;
+        indexCount = static_cast<int32_t>(indexData.size() / (type == IndexType::UINT16 ? sizeof(uint16_t) : sizeof(uint32_t)));
+        frameLog->RecordBufferUpload(indexData.size());
+    }
+
+    int32_t HeadlessMesh::GetVertexCount() const
+    {
+        return vertexCount;
+    }
+
+    int32_t HeadlessMesh::GetIndexCount() const
+    {
+        return indexCount;
+    }
+
+    const VertexLayout& HeadlessMesh::GetVertexLayout() const
+    {
+        return layout;
+    }
+
+    PrimitiveType HeadlessMesh::GetPrimitiveType() const
+    {
+        return primitive;
+    }
+
+    bool HeadlessMesh::HasIndices() const
+    {
+        return indexCount > 0;
+    }
+
+    bool HeadlessMesh::IsValid() const
+    {
+        return !released && vertexCount > 0;
+    }
+
+    HeadlessShaderProgram::HeadlessShaderProgram(HeadlessFrameLog* frameLog, ShaderSource source, const bool compute, const bool valid)
+        : id(frameLog->NextResourceId())
+        , source(std::move(source))
+        , compute(compute)
+        , valid(valid)
+    {
+    }
+
+    HeadlessShaderProgram::~HeadlessShaderProgram()
+    {
+        if (!released)
+            Release();
+    }
+
+    void HeadlessShaderProgram::Release()
+    {
+        released = true;
+    }
+
+    GraphicsResourceType HeadlessShaderProgram::GetResourceType() const
+    {
+        return GraphicsResourceType::SHADER_PROGRAM;
+    }
+
+    bool HeadlessShaderProgram::IsValid() const
+    {
+        return valid && !released;
+    }
+
+    HeadlessTextureHandle::HeadlessTextureHandle(HeadlessFrameLog* frameLog, const TextureDescription& description, const void* pixelData)
+        : frameLog(frameLog)
+        , id(frameLog->NextResourceId())
+        , description(description)
+    {
+        if (pixelData == nullptr)
+            return;
+
+        const size_t size = GetUploadSize(description);
+        const auto* bytes = static_cast<const uint8_t*>(pixelData);
+        pixels.assign(bytes, bytes + size);
+        frameLog->RecordTextureUpload(size);
+    }
+
+    HeadlessTextureHandle::~HeadlessTextureHandle()
+    {
+        if (!released)
+            Release();
+    }
+
+    void HeadlessTextureHandle::Release()
+    {
+        if (released)
+            return;
+
+        pixels.clear();
+        pixels.shrink_to_fit();
+        released = true;
+    }
+
+    GraphicsResourceType HeadlessTextureHandle::GetResourceType() const
+    {
+        return GraphicsResourceType::TEXTURE;
+    }
+
+    uint32_t HeadlessTextureHandle::GetWidth() const
+    {
+        return description.width;
+    }
+
+    uint32_t HeadlessTextureHandle::GetHeight() const
+    {
+        return description.height;
+    }
+
+    bool HeadlessTextureHandle::IsValid() const
+    {
+        return !released;
+    }
+
+    void HeadlessTextureHandle::WriteRegion(const uint32_t x, const uint32_t y, const uint32_t width, const uint32_t height, const void* pixelData)
+    {
+        const auto* source = static_cast<const uint8_t*>(pixelData);
+        const size_t rowBytes = static_cast<size_t>(width) * 4;
+
+        if (pixels.empty())
+            pixels.resize(description.GetLevelSize(0));
+
+        for (uint32_t row = 0; row < height; ++row)
+        {
+            const size_t destination = (static_cast<size_t>(y + row) * description.width + x) * 4;
+            std::memcpy(pixels.data() + destination, source + row * rowBytes, rowBytes);
+        }
+
+        frameLog->RecordTextureUpload(rowBytes * height);
+    }
+
+    HeadlessUniformBinding::HeadlessUniformBinding(HeadlessFrameLog* frameLog) : id(frameLog->NextResourceId()) { }
+
+    HeadlessUniformBinding::~HeadlessUniformBinding()
+    {
+        if (!released)
+            Release();
+    }
+
+    void HeadlessUniformBinding::Release()
+    {
+        buffers.clear();
+        textures.clear();
+        released = true;
+    }
+
+    GraphicsResourceType HeadlessUniformBinding::GetResourceType() const
+    {
+        return GraphicsResourceType::UNIFORM_BINDING;
+    }
+
+    void HeadlessUniformBinding::Bind(int32_t)
+    {
+    }
+
+    void HeadlessUniformBinding::UpdateBuffer(const int32_t binding, IBufferHandle* buffer, size_t, int32_t)
+    {
+        buffers[binding] = buffer;
+    }
+
+    void HeadlessUniformBinding::UpdateTexture(const int32_t binding, ITextureHandle* texture, int32_t)
+    {
+        textures[binding] = texture;
+    }
+
+    uint64_t HeadlessUniformBinding::GetNativeHandle(int32_t) const
+    {
+        return id;
+    }
+
+    void HeadlessUniformBinding::Destroy()
+    {
+        Release();
+    }
+
+    bool HeadlessUniformBinding::IsDestroyed() const
+    {
+        return released;
+    }
+
+    ITextureHandle* HeadlessUniformBinding::GetTexture(const int32_t binding) const
+    {
+        const auto iterator = textures.find(binding);
+        return iterator != textures.end() ? iterator->second : nullptr;
+    }
+
+    uint64_t GetHeadlessResourceId(const IGraphicsResource* resource)
+    {
+        if (resource == nullptr)
+            return 0;
+
+        switch (resource->GetResourceType())
+        {
+            case GraphicsResourceType::BUFFER:
+                if (const auto* buffer = dynamic_cast<const HeadlessBufferHandle*>(resource))
+                    return buffer->GetId();
+                break;
+            case GraphicsResourceType::MESH:
+                if (const auto* mesh = dynamic_cast<const HeadlessMesh*>(resource))
+                    return mesh->GetId();
+                break;
+            case GraphicsResourceType::SHADER_PROGRAM:
+                if (const auto* shader = dynamic_cast<const HeadlessShaderProgram*>(resource))
+                    return shader->GetId();
+                break;
+            case GraphicsResourceType::TEXTURE:
+                if (const auto* texture = dynamic_cast<const HeadlessTextureHandle*>(resource))
+                    return texture->GetId();
+                break;
+            case GraphicsResourceType::UNIFORM_BINDING:
+                if (const auto* binding = dynamic_cast<const HeadlessUniformBinding*>(resource))
+                    return binding->GetId();
+                break;
+        }
+
+        return 0;
+    }
+}
@@ -13,6 +13,7 @@ namespace RenderStar::Client::Render::OpenGL
                 case BufferType::INDEX:   return GL_ELEMENT_ARRAY_BUFFER;
                 case BufferType::UNIFORM: return GL_UNIFORM_BUFFER;
                 case BufferType::STORAGE: return GL_SHADER_STORAGE_BUFFER;
+                case BufferType::INDIRECT: return GL_DRAW_INDIRECT_BUFFER;
             }
             return GL_ARRAY_BUFFER;
         }
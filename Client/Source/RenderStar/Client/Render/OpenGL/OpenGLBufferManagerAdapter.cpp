@@ -30,6 +30,7 @@ namespace RenderStar::Client::Render::OpenGL
             case BufferType::INDEX:   target = GL_ELEMENT_ARRAY_BUFFER; break;
             case BufferType::UNIFORM: target = GL_UNIFORM_BUFFER; break;
             case BufferType::STORAGE: target = GL_SHADER_STORAGE_BUFFER; break;
+            case BufferType::INDIRECT: target = GL_DRAW_INDIRECT_BUFFER; break;
         }
 
         glBindBuffer(target, bufferId);
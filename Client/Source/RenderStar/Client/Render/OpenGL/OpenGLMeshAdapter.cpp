@@ -1,4 +1,5 @@
 #include "RenderStar/Client/Render/OpenGL/OpenGLMeshAdapter.hpp"
+#include "RenderStar/Client/Render/Backend/IndirectDraw.hpp"
 #include <glad/gl.h>
 
 namespace RenderStar::Client::Render::OpenGL
@@ -90,6 +91,38 @@ namespace RenderStar::Client::Render::OpenGL
         Unbind();
     }
 
+    void OpenGLMeshAdapter::DrawRange(uint32_t firstIndex, uint32_t count)
+    {
+        if (!valid || !hasIndices || count == 0 || firstIndex + count > static_cast<uint32_t>(indexCount))
+            return;
+
+        Bind();
+
+        const size_t indexSize = (currentIndexType == IndexType::UINT16) ? sizeof(uint16_t) : sizeof(uint32_t);
+        const GLenum indexTypeGL = (currentIndexType == IndexType::UINT16) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        glDrawElements(ToGLPrimitive(primitive), static_cast<GLsizei>(count), indexTypeGL, reinterpret_cast<const void*>(firstIndex * indexSize));
+
+        Unbind();
+    }
+
+    void OpenGLMeshAdapter::DrawIndirect(const uint32_t argumentBuffer, const uint32_t firstCommand, const uint32_t commandCount)
+    {
+        if (!valid || !hasIndices || argumentBuffer == 0 || commandCount == 0)
+            return;
+
+        Bind();
+
+        const GLenum indexTypeGL = (currentIndexType == IndexType::UINT16) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        const size_t offset = firstCommand * sizeof(DrawIndexedIndirectCommand);
+
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, argumentBuffer);
+        glMultiDrawElementsIndirect(ToGLPrimitive(primitive), indexTypeGL, reinterpret_cast<const void*>(offset),
+            static_cast<GLsizei>(commandCount), sizeof(DrawIndexedIndirectCommand));
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+        Unbind();
+    }
+
     void OpenGLMeshAdapter::DrawInstanced(int32_t instanceCount)
     {
         if (!valid || instanceCount <= 0)
@@ -6,6 +6,7 @@
 #include "RenderStar/Client/Render/OpenGL/OpenGLCommandQueue.hpp"
 #include "RenderStar/Client/Render/OpenGL/OpenGLShaderProgram.hpp"
 #include "RenderStar/Client/Render/OpenGL/OpenGLMeshAdapter.hpp"
+#include "RenderStar/Client/Render/OpenGL/OpenGLBufferHandle.hpp"
 #include "RenderStar/Client/Render/Resource/IShaderProgram.hpp"
 #include "RenderStar/Client/Render/Resource/IUniformBindingHandle.hpp"
 #include "RenderStar/Client/Render/Resource/IMesh.hpp"
@@ -197,15 +198,56 @@ namespace RenderStar::Client::Render::OpenGL
         return commandQueue.get();
     }
 
-    void OpenGLRenderBackend::SubmitDrawCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, const int32_t frameIndex, IMesh* mesh)
+    OpenGLDrawCommand OpenGLRenderBackend::ResolveDrawCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, const int32_t frameIndex, IMesh* mesh, const uint32_t firstIndex, const uint32_t indexCount)
     {
         OpenGLDrawCommand cmd;
         cmd.type = OpenGLDrawCommand::Type::Draw;
-        cmd.shader = shader;
+        cmd.shader = dynamic_cast<OpenGLShaderProgram*>(shader);
         cmd.uniformBinding = uniformBinding;
         cmd.frameIndex = frameIndex;
-        cmd.mesh = mesh;
-        drawCommands.push_back(cmd);
+        cmd.mesh = dynamic_cast<OpenGLMeshAdapter*>(mesh);
+        cmd.firstIndex = firstIndex;
+        cmd.indexCount = indexCount;
+        return cmd;
+    }
+
+    void OpenGLRenderBackend::SubmitDrawCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, const int32_t frameIndex, IMesh* mesh)
+    {
+        drawCommands.AddOrdered(ResolveDrawCommand(shader, uniformBinding, frameIndex, mesh, 0, 0));
+    }
+
+    void OpenGLRenderBackend::SubmitDrawRangeCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, const int32_t frameIndex, IMesh* mesh, const uint32_t firstIndex, const uint32_t indexCount)
+    {
+        drawCommands.AddOrdered(ResolveDrawCommand(shader, uniformBinding, frameIndex, mesh, firstIndex, indexCount));
+    }
+
+    void OpenGLRenderBackend::SubmitSortedDrawCommand(const SortedDrawSubmission& submission)
+    {
+        const OpenGLDrawCommand cmd = ResolveDrawCommand(submission.shader, submission.uniformBinding, submission.frameIndex,
+            submission.mesh, submission.firstIndex, submission.indexCount);
+
+        drawCommands.AddSorted(cmd, cmd.shader, submission.materialKey, submission.depth);
+    }
+
+    void OpenGLRenderBackend::SubmitIndirectDrawCommand(const IndirectDrawSubmission& submission)
+    {
+        const auto* argumentBuffer = dynamic_cast<OpenGLBufferHandle*>(submission.argumentBuffer);
+
+        if (!argumentBuffer || submission.commandCount == 0)
+            return;
+
+        OpenGLDrawCommand cmd = ResolveDrawCommand(submission.shader, submission.uniformBinding, submission.frameIndex, submission.mesh, 0, 0);
+
+        // Without a mesh the executor would take this for a fullscreen pass
+        if (!cmd.mesh)
+            return;
+
+        cmd.type = OpenGLDrawCommand::Type::DrawIndirect;
+        cmd.argumentBuffer = argumentBuffer->GetBufferId();
+        cmd.firstCommand = submission.firstCommand;
+        cmd.commandCount = submission.commandCount;
+
+        drawCommands.AddSorted(cmd, cmd.shader, submission.materialKey, 0.0f);
     }
 
     void OpenGLRenderBackend::BeginOverlayPass()
@@ -242,20 +284,27 @@ namespace RenderStar::Client::Render::OpenGL
         cmd.scissorY = y;
         cmd.scissorW = w;
         cmd.scissorH = h;
-        drawCommands.push_back(cmd);
+        drawCommands.AddOrdered(cmd);
     }
 
     void OpenGLRenderBackend::SubmitClearScissor()
     {
         OpenGLDrawCommand cmd;
         cmd.type = OpenGLDrawCommand::Type::ClearScissor;
-        drawCommands.push_back(cmd);
+        drawCommands.AddOrdered(cmd);
     }
 
     void OpenGLRenderBackend::ExecuteDrawCommands()
     {
-        for (const auto& cmd : drawCommands)
+        const auto commands = drawCommands.GetCommands();
+        DrawStateTracker state;
+        OpenGLShaderProgram* boundShader = nullptr;
+        OpenGLMeshAdapter* boundMesh = nullptr;
+
+        for (const uint32_t index : drawCommands.Sort())
         {
+            const OpenGLDrawCommand& cmd = commands[index];
+
             if (cmd.type == OpenGLDrawCommand::Type::SetScissor)
             {
                 glEnable(GL_SCISSOR_TEST);
@@ -271,20 +320,32 @@ namespace RenderStar::Client::Render::OpenGL
                 continue;
             }
 
-            auto* glShader = dynamic_cast<OpenGLShaderProgram*>(cmd.shader);
-            auto* glMesh = dynamic_cast<OpenGLMeshAdapter*>(cmd.mesh);
+            OpenGLShaderProgram* glShader = cmd.shader;
+            OpenGLMeshAdapter* glMesh = cmd.mesh;
 
-            if (glShader)
+            if (glShader && state.SetPipeline(glShader))
+            {
                 glShader->Bind();
+                boundShader = glShader;
+            }
 
-            if (cmd.uniformBinding)
+            if (cmd.uniformBinding && state.SetBinding(cmd.uniformBinding, cmd.frameIndex))
                 cmd.uniformBinding->Bind(cmd.frameIndex);
 
             if (glMesh && glMesh->IsValid())
             {
-                glMesh->Bind();
-                glMesh->Draw();
-                glMesh->Unbind();
+                if (state.SetGeometry(glMesh))
+                {
+                    glMesh->Bind();
+                    boundMesh = glMesh;
+                }
+
+                if (cmd.type == OpenGLDrawCommand::Type::DrawIndirect)
+                    glMesh->DrawIndirect(cmd.argumentBuffer, cmd.firstCommand, cmd.commandCount);
+                else if (cmd.indexCount > 0)
+                    glMesh->DrawRange(cmd.firstIndex, cmd.indexCount);
+                else
+                    glMesh->Draw();
             }
             else if (!glMesh && glShader)
             {
@@ -295,12 +356,18 @@ namespace RenderStar::Client::Render::OpenGL
                 glBindVertexArray(0);
                 glEnable(GL_DEPTH_TEST);
                 glEnable(GL_CULL_FACE);
-            }
 
-            if (glShader)
-                glShader->Unbind();
+                state.SetGeometry(nullptr);
+                boundMesh = nullptr;
+            }
         }
 
-        drawCommands.clear();
+        if (boundMesh)
+            boundMesh->Unbind();
+
+        if (boundShader)
+            boundShader->Unbind();
+
+        drawCommands.Clear();
     }
 }
@@ -1,11 +1,27 @@
 #include "RenderStar/Client/Render/OpenGL/OpenGLTextureManager.hpp"
 #include "RenderStar/Client/Render/OpenGL/OpenGLTextureHandle.hpp"
 #include <glad/gl.h>
+#include <cstring>
 
 namespace RenderStar::Client::Render::OpenGL
 {
     namespace
     {
+        constexpr GLenum COMPRESSED_RGBA_S3TC_DXT1 = 0x83F1;
+        constexpr GLenum COMPRESSED_RGBA_S3TC_DXT5 = 0x83F3;
+
+        GLenum ToGLCompressedFormat(TextureFormat format)
+        {
+            switch (format)
+            {
+                case TextureFormat::BC1_RGBA: return COMPRESSED_RGBA_S3TC_DXT1;
+                case TextureFormat::BC3_RGBA: return COMPRESSED_RGBA_S3TC_DXT5;
+                case TextureFormat::BC4_R: return GL_COMPRESSED_RED_RGTC1;
+                case TextureFormat::BC5_RG: return GL_COMPRESSED_RG_RGTC2;
+                default: return 0;
+            }
+        }
+
         GLenum ToGLWrapMode(TextureWrapMode mode)
         {
             switch (mode)
@@ -39,6 +55,20 @@ namespace RenderStar::Client::Render::OpenGL
 
     void OpenGLTextureManager::Initialize()
     {
+        GLint extensionCount = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+
+        for (GLint i = 0; i < extensionCount; ++i)
+        {
+            const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+
+            if (extension != nullptr && std::strcmp(extension, "GL_EXT_texture_compression_s3tc") == 0)
+            {
+                supportsS3TC = true;
+                break;
+            }
+        }
+
         CreateDefaultTexture();
         logger->info("OpenGLTextureManager initialized");
     }
@@ -51,6 +81,12 @@ namespace RenderStar::Client::Render::OpenGL
     std::unique_ptr<ITextureHandle> OpenGLTextureManager::CreateFromMemory(
         const TextureDescription& description, const void* pixels)
     {
+        if (description.IsCompressed() && !SupportsFormat(description.format))
+        {
+            logger->error("Compressed texture format {} is not supported", static_cast<int>(description.format));
+            return nullptr;
+        }
+
         GLuint textureId = 0;
         glGenTextures(1, &textureId);
 
@@ -66,8 +102,10 @@ namespace RenderStar::Client::Render::OpenGL
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, ToGLWrapMode(description.wrapT));
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, ToGLFilter(description.magFilter));
 
+        bool hasMipChain = description.generateMipmaps || (description.IsCompressed() && description.mipLevels > 1);
+
         GLenum minFilter = ToGLFilter(description.minFilter);
-        if (description.generateMipmaps)
+        if (hasMipChain)
         {
             if (minFilter == GL_LINEAR)
                 minFilter = GL_LINEAR_MIPMAP_LINEAR;
@@ -76,12 +114,22 @@ namespace RenderStar::Client::Render::OpenGL
         }
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
 
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8,
-            static_cast<GLsizei>(description.width),
-            static_cast<GLsizei>(description.height),
-            0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        if (description.IsCompressed())
+        {
+            UploadCompressedLevels(description, pixels);
+
+            if (hasMipChain)
+                glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY, 16.0f);
+        }
+        else
+        {
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8,
+                static_cast<GLsizei>(description.width),
+                static_cast<GLsizei>(description.height),
+                0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        }
 
-        if (description.generateMipmaps)
+        if (description.generateMipmaps && !description.IsCompressed())
         {
             glGenerateMipmap(GL_TEXTURE_2D);
             glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY, 16.0f);
@@ -94,6 +142,59 @@ namespace RenderStar::Client::Render::OpenGL
         return std::make_unique<OpenGLTextureHandle>(textureId, description.width, description.height);
     }
 
+    bool OpenGLTextureManager::UpdateRegion(ITextureHandle& texture, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* pixels)
+    {
+        auto* glTexture = static_cast<OpenGLTextureHandle*>(&texture);
+
+        if (!glTexture->IsValid() || width == 0 || height == 0 ||
+            x + width > glTexture->GetWidth() || y + height > glTexture->GetHeight())
+            return false;
+
+        glBindTexture(GL_TEXTURE_2D, glTexture->GetTextureId());
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glTexSubImage2D(GL_TEXTURE_2D, 0,
+            static_cast<GLint>(x), static_cast<GLint>(y),
+            static_cast<GLsizei>(width), static_cast<GLsizei>(height),
+            GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        return true;
+    }
+
+    bool OpenGLTextureManager::SupportsFormat(TextureFormat format) const
+    {
+        switch (format)
+        {
+            case TextureFormat::BC1_RGBA:
+            case TextureFormat::BC3_RGBA:
+                return supportsS3TC;
+            default:
+                return true;
+        }
+    }
+
+    void OpenGLTextureManager::UploadCompressedLevels(const TextureDescription& description, const void* pixels) const
+    {
+        GLenum internalFormat = ToGLCompressedFormat(description.format);
+        uint32_t levelCount = std::max(1u, description.mipLevels);
+        const auto* levelData = static_cast<const uint8_t*>(pixels);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(levelCount - 1));
+
+        for (uint32_t level = 0; level < levelCount; ++level)
+        {
+            size_t levelSize = description.GetLevelSize(level);
+
+            glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), internalFormat,
+                static_cast<GLsizei>(description.GetLevelWidth(level)),
+                static_cast<GLsizei>(description.GetLevelHeight(level)),
+                0, static_cast<GLsizei>(levelSize), levelData);
+
+            levelData += levelSize;
+        }
+    }
+
     ITextureHandle* OpenGLTextureManager::GetDefaultTexture()
     {
         return defaultTexture.get();
@@ -1,6 +1,8 @@
 #include "RenderStar/Client/Render/Platform/PlatformBackendFactory.hpp"
 #include "RenderStar/Client/Render/Backend/IRenderBackend.hpp"
 #include "RenderStar/Client/Render/Backend/RenderBackend.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessPlatformBackend.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessRenderBackend.hpp"
 #include "RenderStar/Client/Render/OpenGL/OpenGLPlatformBackend.hpp"
 #include "RenderStar/Client/Render/Vulkan/VulkanPlatformBackend.hpp"
 #include "RenderStar/Client/Render/Vulkan/VulkanRenderBackend.hpp"
@@ -17,6 +19,9 @@ namespace RenderStar::Client::Render::Platform
         case RenderBackend::VULKAN:
             return std::make_unique<Vulkan::VulkanPlatformBackend>(
                 static_cast<Vulkan::VulkanRenderBackend*>(backend));
+        case RenderBackend::HEADLESS:
+            return std::make_unique<Headless::HeadlessPlatformBackend>(
+                static_cast<Headless::HeadlessRenderBackend*>(backend));
         }
 
         return nullptr;
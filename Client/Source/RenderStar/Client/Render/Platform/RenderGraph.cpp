@@ -0,0 +1,336 @@
+#include "RenderStar/Client/Render/Platform/RenderGraph.hpp"
+#include "RenderStar/Common/Configuration/IConfiguration.hpp"
+#include <algorithm>
+#include <unordered_set>
+
+namespace RenderStar::Client::Render::Platform
+{
+    namespace
+    {
+        TextureFormat ParseTextureFormat(const std::string& str)
+        {
+            if (str == "RGBA16F") return TextureFormat::RGBA16F;
+            if (str == "RGBA32F") return TextureFormat::RGBA32F;
+            return TextureFormat::RGBA8;
+        }
+
+        // Colour formats a wider physical target can stand in for, narrowest first; -1 for everything else
+        int32_t ColorPrecision(const TextureFormat format)
+        {
+            switch (format)
+            {
+            case TextureFormat::RGBA8: return 0;
+            case TextureFormat::RGBA16F: return 1;
+            case TextureFormat::RGBA32F: return 2;
+            default: return -1;
+            }
+        }
+
+        bool SharesStorageShape(const RenderGraphTargetConfig& physical, const RenderGraphTargetConfig& logical)
+        {
+            if (physical.hasDepth != logical.hasDepth || physical.sampleCount != logical.sampleCount || physical.matchSwapchain != logical.matchSwapchain)
+                return false;
+
+            if (physical.matchSwapchain ? physical.scale != logical.scale : (physical.width != logical.width || physical.height != logical.height))
+                return false;
+
+            return physical.format == logical.format || (ColorPrecision(physical.format) >= 0 && ColorPrecision(logical.format) >= 0);
+        }
+
+        // A geometry stage that does not clear draws over what is already there
+        bool PreservesOutput(const RenderGraphStageConfig& stage)
+        {
+            return stage.type == "geometry" && !stage.clear;
+        }
+
+        // Geometry stages flush the draws queued for the frame, so they run even when nothing reads their output
+        bool HasSideEffects(const RenderGraphStageConfig& stage)
+        {
+            return stage.type == "geometry";
+        }
+
+        struct TargetAccess
+        {
+            uint32_t step = 0;
+            RenderGraphAccess access = RenderGraphAccess::NONE;
+        };
+    }
+
+    RenderGraphConfig RenderGraphConfig::Load(const Common::Configuration::IConfiguration& configuration)
+    {
+        RenderGraphConfig config;
+
+        for (const auto& name : configuration.GetStringList("target_names"))
+        {
+            RenderGraphTargetConfig target;
+            target.name = name;
+            target.format = ParseTextureFormat(configuration.GetString("targets." + name + ".format").value_or("RGBA8"));
+            target.hasDepth = configuration.GetBoolean("targets." + name + ".depth").value_or(false);
+            target.matchSwapchain = configuration.GetBoolean("targets." + name + ".match_swapchain").value_or(true);
+            target.width = static_cast<uint32_t>(configuration.GetInteger("targets." + name + ".width").value_or(0));
+            target.height = static_cast<uint32_t>(configuration.GetInteger("targets." + name + ".height").value_or(0));
+            target.sampleCount = static_cast<uint32_t>(configuration.GetInteger("targets." + name + ".msaa").value_or(1));
+            target.scale = configuration.GetFloat("targets." + name + ".scale").value_or(1.0f);
+            target.persistent = configuration.GetBoolean("targets." + name + ".persistent").value_or(false);
+
+            config.targets.push_back(std::move(target));
+        }
+
+        for (const auto& name : configuration.GetStringList("stage_order"))
+        {
+            RenderGraphStageConfig stage;
+            stage.name = name;
+            stage.type = configuration.GetString("stages." + name + ".type").value_or("geometry");
+            stage.shader = configuration.GetString("stages." + name + ".shader").value_or("");
+            stage.output = configuration.GetString("stages." + name + ".output").value_or(std::string(SWAPCHAIN_TARGET));
+            stage.vertexFormat = configuration.GetString("stages." + name + ".vertex_format").value_or("standard");
+            stage.clear = configuration.GetBoolean("stages." + name + ".clear").value_or(true);
+            stage.inputs = configuration.GetStringList("stages." + name + ".inputs");
+
+            config.stages.push_back(std::move(stage));
+        }
+
+        return config;
+    }
+
+    RenderGraph RenderGraph::Compile(const RenderGraphConfig& config)
+    {
+        RenderGraph graph;
+        std::unordered_map<std::string, uint32_t> targetIndices;
+
+        for (uint32_t index = 0; index < config.targets.size(); ++index)
+        {
+            if (!targetIndices.emplace(config.targets[index].name, index).second)
+                graph.warnings.push_back("Target '" + config.targets[index].name + "' is declared twice; using the first");
+        }
+
+        const auto findTarget = [&](const std::string& name) -> std::optional<uint32_t>
+        {
+            const auto iterator = targetIndices.find(name);
+            return iterator != targetIndices.end() ? std::optional(iterator->second) : std::nullopt;
+        };
+
+        std::vector<bool> referenced(config.targets.size(), false);
+
+        for (const auto& stage : config.stages)
+        {
+            if (const auto index = findTarget(stage.output))
+                referenced[*index] = true;
+            else if (stage.output != SWAPCHAIN_TARGET)
+                graph.warnings.push_back("Stage '" + stage.name + "' writes unknown target '" + stage.output + "'");
+
+            for (const auto& input : stage.inputs)
+            {
+                if (const auto index = findTarget(input))
+                    referenced[*index] = true;
+                else
+                    graph.warnings.push_back("Stage '" + stage.name + "' reads unknown target '" + input + "'");
+            }
+
+            if (std::ranges::find(stage.inputs, stage.output) != stage.inputs.end())
+                graph.warnings.push_back("Stage '" + stage.name + "' reads the target it writes, '" + stage.output + "'");
+        }
+
+        // Walk backwards from the stages whose results leave the graph, collecting what they read
+        std::vector<bool> live(config.stages.size(), false);
+        std::unordered_set<std::string> needed;
+
+        for (size_t index = config.stages.size(); index-- > 0;)
+        {
+            const auto& stage = config.stages[index];
+            const auto output = findTarget(stage.output);
+            const bool root = stage.output == SWAPCHAIN_TARGET || HasSideEffects(stage) || (output && config.targets[*output].persistent);
+
+            if (!root && !needed.contains(stage.output))
+                continue;
+
+            live[index] = true;
+
+            if (PreservesOutput(stage))
+                needed.insert(stage.output);
+            else
+                needed.erase(stage.output);
+
+            needed.insert(stage.inputs.begin(), stage.inputs.end());
+        }
+
+        std::vector<std::vector<TargetAccess>> accesses(config.targets.size());
+
+        for (uint32_t index = 0; index < config.stages.size(); ++index)
+        {
+            const auto& stage = config.stages[index];
+
+            if (!live[index])
+            {
+                graph.culledStages.push_back(stage.name);
+                continue;
+            }
+
+            const auto step = static_cast<uint32_t>(graph.steps.size());
+            graph.steps.push_back({ index, {} });
+
+            for (const auto& input : stage.inputs)
+            {
+                if (const auto target = findTarget(input))
+                    accesses[*target].push_back({ step, RenderGraphAccess::READ });
+            }
+
+            if (const auto target = findTarget(stage.output))
+            {
+                if (PreservesOutput(stage))
+                    accesses[*target].push_back({ step, RenderGraphAccess::READ });
+
+                accesses[*target].push_back({ step, RenderGraphAccess::WRITE });
+            }
+        }
+
+        // Targets no stage mentions belong to code outside the graph; targets only culled stages use are never created
+        std::vector<uint32_t> transients;
+
+        for (uint32_t index = 0; index < config.targets.size(); ++index)
+        {
+            const auto& target = config.targets[index];
+            const auto& targetAccesses = accesses[index];
+
+            if (referenced[index] && targetAccesses.empty())
+                continue;
+
+            if (!targetAccesses.empty())
+                graph.lifetimes[target.name] = { targetAccesses.front().step, targetAccesses.back().step };
+
+            const bool readFirst = !targetAccesses.empty() && targetAccesses.front().access == RenderGraphAccess::READ;
+
+            if (readFirst && !target.persistent)
+                graph.warnings.push_back("Target '" + target.name + "' is read before any stage writes it; keeping it persistent");
+
+            if (referenced[index] && !target.persistent && !readFirst)
+            {
+                transients.push_back(index);
+                continue;
+            }
+
+            graph.physicalByName[target.name] = static_cast<uint32_t>(graph.physicalTargets.size());
+            graph.physicalTargets.push_back({ target, { target.name }, false });
+        }
+
+        std::ranges::stable_sort(transients, {}, [&](const uint32_t index) { return accesses[index].front().step; });
+
+        // Greedy interval packing: reuse the first physical target that is free again and has the same shape
+        std::vector<uint32_t> slotLastSteps(config.targets.size(), 0);
+
+        for (const uint32_t index : transients)
+        {
+            const auto& target = config.targets[index];
+            const auto& lifetime = graph.lifetimes[target.name];
+            std::optional<uint32_t> chosen;
+
+            for (uint32_t physical = 0; physical < graph.physicalTargets.size(); ++physical)
+            {
+                const auto& candidate = graph.physicalTargets[physical];
+
+                if (!candidate.transient || slotLastSteps[physical] >= lifetime.firstStep || !SharesStorageShape(candidate.description, target))
+                    continue;
+
+                // An exact format match wastes nothing, so it beats a wider target found earlier
+                if (!chosen || (candidate.description.format == target.format && graph.physicalTargets[*chosen].description.format != target.format))
+                    chosen = physical;
+            }
+
+            if (!chosen)
+            {
+                chosen = static_cast<uint32_t>(graph.physicalTargets.size());
+                graph.physicalTargets.push_back({ target, {}, true });
+            }
+
+            auto& physical = graph.physicalTargets[*chosen];
+
+            if (ColorPrecision(target.format) > ColorPrecision(physical.description.format))
+                physical.description.format = target.format;
+
+            physical.aliases.push_back(target.name);
+            slotLastSteps[*chosen] = lifetime.lastStep;
+            graph.physicalByName[target.name] = *chosen;
+        }
+
+        // Targets outside the graph may have been drawn into before it runs; transient ones start the frame
+        // in whatever state the previous frame left them, so run the frame once to find that state
+        std::vector<RenderGraphAccess> states(graph.physicalTargets.size(), RenderGraphAccess::NONE);
+
+        for (uint32_t physical = 0; physical < graph.physicalTargets.size(); ++physical)
+        {
+            if (!graph.physicalTargets[physical].transient)
+                states[physical] = RenderGraphAccess::WRITE;
+        }
+
+        for (const bool emit : { false, true })
+        {
+            std::vector<RenderGraphAccess> current = states;
+
+            for (auto& step : graph.steps)
+            {
+                const auto& stage = config.stages[step.stage];
+                std::vector<uint32_t> reads;
+
+                for (const auto& input : stage.inputs)
+                {
+                    if (const auto physical = graph.FindPhysicalTarget(input); physical && std::ranges::find(reads, *physical) == reads.end())
+                        reads.push_back(*physical);
+                }
+
+                for (const uint32_t physical : reads)
+                {
+                    if (emit && current[physical] == RenderGraphAccess::WRITE)
+                        step.barriers.push_back({ physical, RenderGraphAccess::WRITE, RenderGraphAccess::READ });
+
+                    current[physical] = RenderGraphAccess::READ;
+                }
+
+                if (const auto physical = graph.FindPhysicalTarget(stage.output))
+                {
+                    if (emit && current[*physical] != RenderGraphAccess::NONE)
+                        step.barriers.push_back({ *physical, current[*physical], RenderGraphAccess::WRITE });
+
+                    current[*physical] = RenderGraphAccess::WRITE;
+                }
+            }
+
+            for (uint32_t physical = 0; physical < graph.physicalTargets.size(); ++physical)
+            {
+                if (graph.physicalTargets[physical].transient)
+                    states[physical] = current[physical];
+            }
+        }
+
+        return graph;
+    }
+
+    std::optional<uint32_t> RenderGraph::FindPhysicalTarget(const std::string& logicalName) const
+    {
+        const auto iterator = physicalByName.find(logicalName);
+
+        if (iterator == physicalByName.end())
+            return std::nullopt;
+
+        return iterator->second;
+    }
+
+    std::optional<RenderGraphLifetime> RenderGraph::GetLifetime(const std::string& logicalName) const
+    {
+        const auto iterator = lifetimes.find(logicalName);
+
+        if (iterator == lifetimes.end())
+            return std::nullopt;
+
+        return iterator->second;
+    }
+
+    size_t RenderGraph::GetBarrierCount() const
+    {
+        size_t count = 0;
+
+        for (const auto& step : steps)
+            count += step.barriers.size();
+
+        return count;
+    }
+}
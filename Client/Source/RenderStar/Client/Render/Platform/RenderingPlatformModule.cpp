@@ -17,13 +17,6 @@ namespace RenderStar::Client::Render::Platform
 {
     namespace
     {
-        TextureFormat ParseTextureFormat(const std::string& str)
-        {
-            if (str == "RGBA16F") return TextureFormat::RGBA16F;
-            if (str == "RGBA32F") return TextureFormat::RGBA32F;
-            return TextureFormat::RGBA8;
-        }
-
         VertexLayout ResolveVertexFormat(const std::string& format)
         {
             if (format == "lit") return Framework::LitVertex::LAYOUT;
@@ -65,6 +58,7 @@ namespace RenderStar::Client::Render::Platform
             return;
         }
 
+        CompileGraph();
         CreateRenderTargets();
         CreateStages(context);
         Freeze();
@@ -72,7 +66,9 @@ namespace RenderStar::Client::Render::Platform
 
     void RenderingPlatformModule::OnCleanup()
     {
+        stepStages.clear();
         stages.clear();
+        stageShaders = {};
         renderTargets.clear();
         targetLookup.clear();
         platformBackend.reset();
@@ -96,52 +92,41 @@ namespace RenderStar::Client::Render::Platform
         if (!enabled)
             return;
 
-        auto targetNames = config->GetStringList("target_names");
+        graphConfig = RenderGraphConfig::Load(*config);
 
-        for (const auto& name : targetNames)
-        {
-            TargetConfig tc;
-            tc.name = name;
-
-            auto formatStr = config->GetString("targets." + name + ".format").value_or("RGBA8");
-            tc.format = ParseTextureFormat(formatStr);
-            tc.hasDepth = config->GetBoolean("targets." + name + ".depth").value_or(false);
-            tc.matchSwapchain = config->GetBoolean("targets." + name + ".match_swapchain").value_or(true);
-            tc.width = static_cast<uint32_t>(config->GetInteger("targets." + name + ".width").value_or(0));
-            tc.height = static_cast<uint32_t>(config->GetInteger("targets." + name + ".height").value_or(0));
-            tc.sampleCount = static_cast<uint32_t>(config->GetInteger("targets." + name + ".msaa").value_or(1));
-            tc.scale = config->GetFloat("targets." + name + ".scale").value_or(1.0f);
-
-            targetConfigs.push_back(std::move(tc));
-        }
+        logger->info("Loaded config: {} targets, {} stages", graphConfig.targets.size(), graphConfig.stages.size());
+    }
 
-        auto stageOrder = config->GetStringList("stage_order");
+    void RenderingPlatformModule::CompileGraph()
+    {
+        graph = RenderGraph::Compile(graphConfig);
+
+        for (const auto& warning : graph.GetWarnings())
+            logger->warn("Render graph: {}", warning);
+
+        for (const auto& culled : graph.GetCulledStages())
+            logger->info("Render graph culled stage '{}': nothing reads its output", culled);
 
-        for (const auto& name : stageOrder)
+        for (const auto& physical : graph.GetPhysicalTargets())
         {
-            StageConfig sc;
-            sc.name = name;
-            sc.type = config->GetString("stages." + name + ".type").value_or("geometry");
-            sc.shader = config->GetString("stages." + name + ".shader").value_or("");
-            sc.output = config->GetString("stages." + name + ".output").value_or("SWAPCHAIN");
-            sc.vertexFormat = config->GetString("stages." + name + ".vertex_format").value_or("standard");
-            sc.clear = config->GetBoolean("stages." + name + ".clear").value_or(true);
-            sc.inputs = config->GetStringList("stages." + name + ".inputs");
-
-            stageConfigs.push_back(std::move(sc));
+            if (physical.aliases.size() > 1)
+                logger->info("Render graph aliased {} targets onto '{}'", physical.aliases.size(), physical.description.name);
         }
 
-        logger->info("Loaded config: {} targets, {} stages", targetConfigs.size(), stageConfigs.size());
+        logger->info("Render graph: {} steps, {} physical targets for {} declared, {} barriers",
+            graph.GetSteps().size(), graph.GetPhysicalTargets().size(), graphConfig.targets.size(), graph.GetBarrierCount());
     }
 
     void RenderingPlatformModule::CreateRenderTargets()
     {
         auto swapchain = platformBackend->CreateSwapchainTarget();
-        targetLookup["SWAPCHAIN"] = swapchain.get();
-        renderTargets["SWAPCHAIN"] = std::move(swapchain);
+        targetLookup[std::string(SWAPCHAIN_TARGET)] = swapchain.get();
+        renderTargets[std::string(SWAPCHAIN_TARGET)] = std::move(swapchain);
 
-        for (const auto& tc : targetConfigs)
+        for (const auto& physical : graph.GetPhysicalTargets())
         {
+            const auto& tc = physical.description;
+
             RenderTargetDescription desc;
             desc.name = tc.name;
             desc.colorFormat = tc.format;
@@ -161,7 +146,10 @@ namespace RenderStar::Client::Render::Platform
             if (target)
             {
                 logger->info("Created render target '{}' {}x{}", tc.name, target->GetWidth(), target->GetHeight());
-                targetLookup[tc.name] = target.get();
+
+                for (const auto& alias : physical.aliases)
+                    targetLookup[alias] = target.get();
+
                 renderTargets[tc.name] = std::move(target);
             }
         }
@@ -171,24 +159,74 @@ namespace RenderStar::Client::Render::Platform
     {
         auto& assetModule = context.GetDependency<Common::Asset::AssetModule>();
 
-        for (const auto& sc : stageConfigs)
+        std::vector<Shader::RsslBatchSource> sources;
+
+        for (const auto& step : graph.GetSteps())
+        {
+            const auto& sc = graphConfig.stages[step.stage];
+
+            if (sc.shader.empty() || std::ranges::find(sources, sc.shader, &Shader::RsslBatchSource::name) != sources.end())
+                continue;
+
+            auto asset = assetModule.LoadText(Common::Asset::AssetLocation::Parse(sc.shader));
+
+            if (!asset)
+                continue;
+
+            sources.push_back({sc.shader, asset->GetContent()});
+        }
+
+        const auto includeLocation = [](const std::string& requestingFile, const std::string& path)
         {
+            return Common::Asset::AssetLocation::Of(Common::Asset::AssetLocation::Parse(requestingFile).GetNamespace(), "shader/" + path);
+        };
+
+        const Shader::IncludeResolver resolver = [&assetModule, &includeLocation](const std::string& path, const std::string& requestingFile)
+        {
+            const auto location = includeLocation(requestingFile, path);
+            const auto include = assetModule.LoadText(location);
+
+            if (!include)
+                throw std::runtime_error("Include not found: " + location.ToString());
+
+            return include->GetContent();
+        };
+
+        stageShaders = Shader::RsslCompiler::CompileBatch(sources, resolver, {platformBackend->GetRsslTarget()});
+
+        for (const auto& [program, includes] : stageShaders.dependencies.includesByProgram)
+        {
+            const auto location = Common::Asset::AssetLocation::Parse(program);
+
+            assetModule.ClearDependencies(location);
+
+            for (const auto& include : includes)
+                assetModule.RecordDependency(location, includeLocation(program, include));
+        }
+
+        logger->info("Compiled {} stage shaders ({} shared includes)", stageShaders.programs.size(), stageShaders.parsedIncludeCount);
+
+        stepStages.assign(graph.GetSteps().size(), nullptr);
+
+        for (size_t stepIndex = 0; stepIndex < graph.GetSteps().size(); ++stepIndex)
+        {
+            const auto& sc = graphConfig.stages[graph.GetSteps()[stepIndex].stage];
+
             if (sc.shader.empty())
             {
                 logger->error("Stage '{}' has no shader path", sc.name);
                 continue;
             }
 
-            auto location = Common::Asset::AssetLocation::Parse(sc.shader);
-            auto asset = assetModule.LoadText(location);
+            const auto* program = stageShaders.Find(sc.shader);
 
-            if (!asset)
+            if (!program)
             {
                 logger->error("Stage '{}': failed to load RSSL from '{}'", sc.name, sc.shader);
                 continue;
             }
 
-            auto compileResult = Shader::RsslCompiler::Compile(asset->GetContent(), platformBackend->GetRsslTarget());
+            const auto& compileResult = *program->GetCompiled(platformBackend->GetRsslTarget());
 
             if (!compileResult.IsValid())
             {
@@ -225,6 +263,7 @@ namespace RenderStar::Client::Render::Platform
             }
 
             stage->Initialize(platformBackend.get(), targetLookup);
+            stepStages[stepIndex] = stage.get();
             stages.push_back(std::move(stage));
         }
     }
@@ -246,33 +285,39 @@ namespace RenderStar::Client::Render::Platform
         uint32_t currentWidth = platformBackend->GetWidth();
         uint32_t currentHeight = platformBackend->GetHeight();
 
-        auto* swapchainTarget = GetTarget("SWAPCHAIN");
+        auto* swapchainTarget = GetTarget(std::string(SWAPCHAIN_TARGET));
 
         if (swapchainTarget && (swapchainTarget->GetWidth() != currentWidth || swapchainTarget->GetHeight() != currentHeight))
         {
             swapchainTarget->Resize(currentWidth, currentHeight);
 
-            for (size_t i = 0; i < targetConfigs.size(); i++)
+            for (const auto& physical : graph.GetPhysicalTargets())
             {
-                if (targetConfigs[i].matchSwapchain)
+                if (!physical.description.matchSwapchain)
+                    continue;
+
+                auto* target = GetTarget(physical.description.name);
+
+                if (target)
                 {
-                    auto* target = GetTarget(targetConfigs[i].name);
-
-                    if (target)
-                    {
-                        uint32_t scaledWidth = static_cast<uint32_t>(currentWidth * targetConfigs[i].scale);
-                        uint32_t scaledHeight = static_cast<uint32_t>(currentHeight * targetConfigs[i].scale);
-                        target->Resize(scaledWidth, scaledHeight);
-                    }
+                    uint32_t scaledWidth = static_cast<uint32_t>(currentWidth * physical.description.scale);
+                    uint32_t scaledHeight = static_cast<uint32_t>(currentHeight * physical.description.scale);
+                    target->Resize(scaledWidth, scaledHeight);
                 }
             }
         }
 
         StageExecutionContext context(platformBackend.get(), targetLookup, backend->GetCurrentFrame());
 
-        for (auto& stage : stages)
+        const auto steps = graph.GetSteps();
+
+        for (size_t stepIndex = 0; stepIndex < steps.size(); ++stepIndex)
         {
-            if (stage->IsEnabled())
+            platformBackend->InsertBarriers(steps[stepIndex].barriers);
+
+            auto* stage = stepStages[stepIndex];
+
+            if (stage && stage->IsEnabled())
                 stage->Execute(context);
         }
     }
@@ -358,6 +403,11 @@ namespace RenderStar::Client::Render::Platform
         return nullptr;
     }
 
+    const Shader::RsslBatchProgram* RenderingPlatformModule::FindStageShader(const std::string& name) const
+    {
+        return stageShaders.Find(name);
+    }
+
     std::unique_ptr<IShaderProgram> RenderingPlatformModule::CompileShaderForTarget(
         const std::string& vertexGlsl,
         const std::string& fragmentGlsl,
@@ -68,7 +68,7 @@ namespace RenderStar::Client::Render
         logger->info("Publishing ClientRendererInitializedEvent with backend={}", static_cast<void*>(backend.get()));
         eventBus.value().get().Publish(Event::Events::ClientRendererInitializedEvent(backend.get()));
 
-        logger->info("RendererModule initialized with {} backend", backendType == RenderBackend::OPENGL ? "OpenGL" : "Vulkan");
+        logger->info("RendererModule initialized with {} backend", GetRenderBackendName(backendType));
     }
 
     void RendererModule::OnPreCleanup()
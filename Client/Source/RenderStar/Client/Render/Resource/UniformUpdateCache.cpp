@@ -0,0 +1,86 @@
+#include "RenderStar/Client/Render/Resource/UniformUpdateCache.hpp"
+#include <algorithm>
+
+namespace RenderStar::Client::Render
+{
+    void UniformUpdateCache::Reset(const uint32_t objects, const uint32_t frames)
+    {
+        objectCount = objects;
+        frameCount = std::max(frames, 1u);
+
+        uploadedVersions.assign(objectCount, NEVER_UPLOADED);
+        boundResources.assign(static_cast<size_t>(objectCount) * frameCount * MAX_BINDINGS, nullptr);
+    }
+
+    void UniformUpdateCache::Clear()
+    {
+        Reset(0, 0);
+        statistics = {};
+    }
+
+    bool UniformUpdateCache::ClaimUpload(const uint32_t object, const uint32_t version, const size_t bytes)
+    {
+        if (object >= objectCount)
+            return false;
+
+        if (uploadedVersions[object] == version)
+        {
+            ++statistics.skippedUploads;
+            return false;
+        }
+
+        uploadedVersions[object] = version;
+        ++statistics.bufferUploads;
+        statistics.uploadBytes += bytes;
+
+        return true;
+    }
+
+    void UniformUpdateCache::RecordUpload(const size_t bytes)
+    {
+        ++statistics.bufferUploads;
+        statistics.uploadBytes += bytes;
+    }
+
+    void UniformUpdateCache::Invalidate(const uint32_t object)
+    {
+        if (object < objectCount)
+            uploadedVersions[object] = NEVER_UPLOADED;
+    }
+
+    bool UniformUpdateCache::ClaimBinding(const uint32_t object, const int32_t frame, const uint32_t binding, const void* resource)
+    {
+        if (object >= objectCount || binding >= MAX_BINDINGS || frame >= static_cast<int32_t>(frameCount))
+            return false;
+
+        bool changed = false;
+        const uint32_t first = frame < 0 ? 0 : static_cast<uint32_t>(frame);
+        const uint32_t last = frame < 0 ? frameCount : first + 1;
+
+        for (uint32_t current = first; current < last; ++current)
+        {
+            const void*& bound = BoundResource(object, current, binding);
+
+            if (bound != resource)
+            {
+                bound = resource;
+                changed = true;
+            }
+        }
+
+        if (changed)
+            ++statistics.descriptorUpdates;
+
+        return changed;
+    }
+
+    void UniformUpdateCache::BeginFrame()
+    {
+        statistics = {};
+    }
+
+    const void*& UniformUpdateCache::BoundResource(const uint32_t object, const uint32_t frame, const uint32_t binding)
+    {
+        return boundResources[(static_cast<size_t>(object) * frameCount + frame) * MAX_BINDINGS + binding];
+    }
+}
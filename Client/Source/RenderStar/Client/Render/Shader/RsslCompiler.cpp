@@ -1,8 +1,10 @@
 #include "RenderStar/Client/Render/Shader/RsslCompiler.hpp"
+#include "RenderStar/Common/Utility/WorkerPool.hpp"
 #include <algorithm>
-#include <regex>
+#include <charconv>
+#include <optional>
 #include <set>
-#include <sstream>
+#include <string_view>
 
 namespace RenderStar::Client::Render::Shader
 {
@@ -29,11 +31,68 @@ namespace RenderStar::Client::Render::Shader
         return errors.empty() && version > 0 && !stages.empty();
     }
 
+    RsslPermutationMask RsslParseResult::GetPermutationBit(const std::string_view key) const
+    {
+        for (size_t i = 0; i < permutationKeys.size() && i < RSSL_MAX_PERMUTATION_KEYS; i++)
+        {
+            if (permutationKeys[i] == key)
+                return RsslPermutationMask(1) << i;
+        }
+
+        return 0;
+    }
+
+    RsslPermutationMask RsslParseResult::GetFullPermutationMask() const
+    {
+        if (permutationKeys.size() >= RSSL_MAX_PERMUTATION_KEYS)
+            return ~RsslPermutationMask(0);
+
+        return (RsslPermutationMask(1) << permutationKeys.size()) - 1;
+    }
+
     bool RsslCompileResult::IsValid() const
     {
         return errors.empty();
     }
 
+    const RsslCompileResult* RsslBatchProgram::GetCompiled(const RsslTarget target) const
+    {
+        for (size_t i = 0; i < targets.size() && i < compiled.size(); i++)
+        {
+            if (targets[i] == target)
+                return &compiled[i];
+        }
+
+        return nullptr;
+    }
+
+    bool RsslBatchProgram::IsValid() const
+    {
+        return parsed.IsValid() && std::ranges::all_of(compiled, &RsslCompileResult::IsValid);
+    }
+
+    std::vector<std::string> RsslDependencyManifest::GetAffectedPrograms(const std::string& includePath) const
+    {
+        const auto iterator = programsByInclude.find(includePath);
+
+        if (iterator == programsByInclude.end())
+            return {};
+
+        return iterator->second;
+    }
+
+    const RsslBatchProgram* RsslBatchResult::Find(const std::string& name) const
+    {
+        const auto iterator = std::ranges::find(programs, name, &RsslBatchProgram::name);
+
+        return iterator == programs.end() ? nullptr : &*iterator;
+    }
+
+    bool RsslBatchResult::IsValid() const
+    {
+        return std::ranges::all_of(programs, &RsslBatchProgram::IsValid);
+    }
+
     // ── Diagnostic formatting ──────────────────────────────────────────
 
     std::string RsslDiagnostic::Format() const
@@ -65,19 +124,39 @@ namespace RenderStar::Client::Render::Shader
     {
         // ── Helpers ────────────────────────────────────────────────────
 
-        std::string Trim(const std::string& str)
+        bool IsSpace(const char c)
         {
-            auto start = str.find_first_not_of(" \t\r\n");
+            return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v';
+        }
 
-            if (start == std::string::npos)
-                return "";
+        bool IsDigit(const char c)
+        {
+            return c >= '0' && c <= '9';
+        }
 
-            auto end = str.find_last_not_of(" \t\r\n");
+        bool IsWordCharacter(const char c)
+        {
+            return IsDigit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+        }
+
+        std::string_view TrimView(std::string_view str)
+        {
+            const auto start = str.find_first_not_of(" \t\r\n");
+
+            if (start == std::string_view::npos)
+                return {};
+
+            const auto end = str.find_last_not_of(" \t\r\n");
 
             return str.substr(start, end - start + 1);
         }
 
-        RsslStageType ParseStageType(const std::string& name)
+        std::string Trim(const std::string& str)
+        {
+            return std::string(TrimView(str));
+        }
+
+        RsslStageType ParseStageType(std::string_view name)
         {
             if (name == "vertex")
                 return RsslStageType::VERTEX;
@@ -89,60 +168,334 @@ namespace RenderStar::Client::Render::Shader
             return RsslStageType::VERTEX;
         }
 
-        // ── Compiled regex patterns ────────────────────────────────────
+        // ── Tokenizer ──────────────────────────────────────────────────
+
+        class RsslScanner
+        {
+        public:
+
+            explicit RsslScanner(const std::string_view text) : text(text) { }
+
+            bool SkipSpace()
+            {
+                const size_t start = position;
+
+                while (position < text.size() && IsSpace(text[position]))
+                    position++;
+
+                return position > start;
+            }
+
+            bool Consume(const char expected)
+            {
+                if (position >= text.size() || text[position] != expected)
+                    return false;
+
+                position++;
+                return true;
+            }
+
+            bool Consume(const std::string_view literal)
+            {
+                if (text.substr(position, literal.size()) != literal)
+                    return false;
+
+                position += literal.size();
+                return true;
+            }
+
+            bool ConsumeKeyword(const std::string_view keyword)
+            {
+                return Consume(keyword) && SkipSpace();
+            }
+
+            bool ConsumePunctuation(const char expected)
+            {
+                SkipSpace();
+
+                if (!Consume(expected))
+                    return false;
+
+                SkipSpace();
+                return true;
+            }
+
+            std::string_view Word()
+            {
+                const size_t start = position;
+
+                while (position < text.size() && IsWordCharacter(text[position]))
+                    position++;
+
+                return text.substr(start, position - start);
+            }
+
+            std::optional<int32_t> Number()
+            {
+                const size_t start = position;
+
+                while (position < text.size() && IsDigit(text[position]))
+                    position++;
+
+                int32_t value = 0;
+                const auto [end, error] = std::from_chars(text.data() + start, text.data() + position, value);
+
+                if (start == position || error != std::errc() || end != text.data() + position)
+                    return std::nullopt;
+
+                return value;
+            }
+
+            std::string_view Until(const char terminator)
+            {
+                const size_t start = position;
+                const size_t end = text.find(terminator, position);
+
+                position = end == std::string_view::npos ? text.size() : end;
+
+                return text.substr(start, position - start);
+            }
+
+            bool AtEnd()
+            {
+                SkipSpace();
+                return position == text.size();
+            }
+
+            [[nodiscard]]
+            size_t GetPosition() const
+            {
+                return position;
+            }
+
+            [[nodiscard]]
+            std::string_view Rest() const
+            {
+                return text.substr(position);
+            }
+
+        private:
+
+            std::string_view text;
+            size_t position = 0;
+        };
 
-        const std::regex& VersionPattern()
+        // ── Directive parsers ──────────────────────────────────────────
+
+        struct BindingDirective
+        {
+            std::string_view annotation;
+            std::string_view name;
+            int32_t binding = 0;
+        };
+
+        struct StageIoDirective
         {
-            static const std::regex p(R"(^\s*#rssl\s+(\d+)\s*$)");
-            return p;
+            std::string_view name;
+            int32_t location = 0;
+            std::string_view glslType;
+        };
+
+        struct DefineDirective
+        {
+            std::string_view name;
+            std::string_view value;
+        };
+
+        std::optional<int32_t> ParseVersionDirective(const std::string_view line)
+        {
+            RsslScanner scanner(line);
+            scanner.SkipSpace();
+
+            if (!scanner.Consume("#rssl") || !scanner.SkipSpace())
+                return std::nullopt;
+
+            const auto version = scanner.Number();
+
+            if (!version || !scanner.AtEnd())
+                return std::nullopt;
+
+            return version;
         }
 
-        const std::regex& StagePattern()
+        std::optional<std::string_view> ParseNamedDirective(const std::string_view line, const std::string_view keyword)
         {
-            static const std::regex p(R"(^\s*@stage\s+(\w+)\s*$)");
-            return p;
+            RsslScanner scanner(line);
+            scanner.SkipSpace();
+
+            if (!scanner.ConsumeKeyword(keyword))
+                return std::nullopt;
+
+            const auto name = scanner.Word();
+
+            if (name.empty() || !scanner.AtEnd())
+                return std::nullopt;
+
+            return name;
         }
 
-        const std::regex& UniformPattern()
+        bool ParseBindingSuffix(RsslScanner& scanner, BindingDirective& directive)
         {
-            static const std::regex p(R"(^\s*@uniform\s+(\w+)\s*:\s*binding\s*\(\s*(\d+)\s*\)\s*$)");
-            return p;
+            directive.name = scanner.Word();
+
+            if (directive.name.empty() || !scanner.ConsumePunctuation(':') || !scanner.Consume("binding") || !scanner.ConsumePunctuation('('))
+                return false;
+
+            const auto binding = scanner.Number();
+
+            if (!binding || !scanner.ConsumePunctuation(')') || !scanner.AtEnd())
+                return false;
+
+            directive.binding = *binding;
+            return true;
         }
 
-        const std::regex& SamplerPattern()
+        std::optional<BindingDirective> ParseUniformDirective(const std::string_view line)
         {
-            static const std::regex p(R"(^\s*@(sampler\w*)\s+(\w+)\s*:\s*binding\s*\(\s*(\d+)\s*\)\s*$)");
-            return p;
+            RsslScanner scanner(line);
+            scanner.SkipSpace();
+
+            BindingDirective directive;
+
+            if (!scanner.ConsumeKeyword("@uniform") || !ParseBindingSuffix(scanner, directive))
+                return std::nullopt;
+
+            return directive;
         }
 
-        const std::regex& InputPattern()
+        std::optional<BindingDirective> ParseSamplerDirective(const std::string_view line)
         {
-            static const std::regex p(R"(^\s*@input\s+(\w+)\s*:\s*location\s*\(\s*(\d+)\s*\)\s*,\s*(\w+)\s*$)");
-            return p;
+            RsslScanner scanner(line);
+            scanner.SkipSpace();
+
+            if (!scanner.Consume('@'))
+                return std::nullopt;
+
+            const size_t annotationStart = scanner.GetPosition();
+
+            if (!scanner.Consume("sampler"))
+                return std::nullopt;
+
+            scanner.Word();
+
+            BindingDirective directive;
+            directive.annotation = line.substr(annotationStart, scanner.GetPosition() - annotationStart);
+
+            if (!scanner.SkipSpace() || !ParseBindingSuffix(scanner, directive))
+                return std::nullopt;
+
+            return directive;
         }
 
-        const std::regex& OutputPattern()
+        std::optional<StageIoDirective> ParseStageIoDirective(const std::string_view line, const std::string_view keyword)
         {
-            static const std::regex p(R"(^\s*@output\s+(\w+)\s*:\s*location\s*\(\s*(\d+)\s*\)\s*,\s*(\w+)\s*$)");
-            return p;
+            RsslScanner scanner(line);
+            scanner.SkipSpace();
+
+            StageIoDirective directive;
+
+            if (!scanner.ConsumeKeyword(keyword))
+                return std::nullopt;
+
+            directive.name = scanner.Word();
+
+            if (directive.name.empty() || !scanner.ConsumePunctuation(':') || !scanner.Consume("location") || !scanner.ConsumePunctuation('('))
+                return std::nullopt;
+
+            const auto location = scanner.Number();
+
+            if (!location || !scanner.ConsumePunctuation(')') || !scanner.Consume(','))
+                return std::nullopt;
+
+            scanner.SkipSpace();
+            directive.location = *location;
+            directive.glslType = scanner.Word();
+
+            if (directive.glslType.empty() || !scanner.AtEnd())
+                return std::nullopt;
+
+            return directive;
         }
 
-        const std::regex& IncludePattern()
+        std::optional<std::string_view> ParseIncludeDirective(const std::string_view line)
         {
-            static const std::regex p("^\\s*#include\\s+\"([^\"]+)\"\\s*$");
-            return p;
+            RsslScanner scanner(line);
+            scanner.SkipSpace();
+
+            if (!scanner.ConsumeKeyword("#include") || !scanner.Consume('"'))
+                return std::nullopt;
+
+            const auto path = scanner.Until('"');
+
+            if (path.empty() || !scanner.Consume('"') || !scanner.AtEnd())
+                return std::nullopt;
+
+            return path;
         }
 
-        const std::regex& DefinePattern()
+        std::optional<DefineDirective> ParseDefineDirective(const std::string_view line)
         {
-            static const std::regex p(R"(^\s*#define\s+(\w+)\s+(.*?)\s*$)");
-            return p;
+            RsslScanner scanner(line);
+            scanner.SkipSpace();
+
+            DefineDirective directive;
+
+            if (!scanner.ConsumeKeyword("#define"))
+                return std::nullopt;
+
+            directive.name = scanner.Word();
+
+            if (directive.name.empty() || !scanner.SkipSpace())
+                return std::nullopt;
+
+            auto value = scanner.Rest();
+
+            while (!value.empty() && IsSpace(value.back()))
+                value.remove_suffix(1);
+
+            if (value.find_first_of("\r\n") != std::string_view::npos)
+                return std::nullopt;
+
+            directive.value = value;
+            return directive;
         }
 
-        // ── Line scanner → AST builder ─────────────────────────────────
+        std::string ReplaceWord(const std::string& text, const std::string_view word, const std::string_view replacement)
+        {
+            size_t match = text.find(word);
+
+            if (match == std::string::npos)
+                return text;
+
+            std::string output;
+            output.reserve(text.size());
+
+            size_t copied = 0;
+
+            for (; match != std::string::npos; match = text.find(word, match + 1))
+            {
+                if (match < copied)
+                    continue;
+
+                const size_t end = match + word.size();
+
+                if ((match > 0 && IsWordCharacter(text[match - 1])) || (end < text.size() && IsWordCharacter(text[end])))
+                    continue;
+
+                output.append(text, copied, match - copied);
+                output.append(replacement);
+                copied = end;
+            }
+
+            output.append(text, copied);
+
+            return output;
+        }
+
+        // ── Single-pass scanner → AST builder ─────────────────────────
 
         std::unique_ptr<RsslProgram> ScanAndBuildAst(
-            const std::string& source,
+            const std::string_view source,
             const std::string& fileName,
             const IncludeResolver* resolver,
             std::vector<RsslDiagnostic>& diagnostics,
@@ -151,8 +504,6 @@ namespace RenderStar::Client::Render::Shader
             auto program = std::make_unique<RsslProgram>();
             program->location = {fileName, 1, 1};
 
-            std::istringstream stream(source);
-            std::string line;
             int32_t lineNum = 0;
 
             bool foundVersion = !requireVersion;
@@ -171,10 +522,13 @@ namespace RenderStar::Client::Render::Shader
                 diagnostics.push_back({RsslDiagnostic::Severity::SEV_ERROR, msg, {fileName, ln, 1}});
             };
 
-            while (std::getline(stream, line))
+            for (size_t lineStart = 0; lineStart < source.size();)
             {
+                const size_t lineEnd = std::min(source.find('\n', lineStart), source.size());
+                const std::string_view line = source.substr(lineStart, lineEnd - lineStart);
+
+                lineStart = lineEnd + 1;
                 lineNum++;
-                std::smatch match;
 
                 // ── Uniform body accumulation ──
 
@@ -192,8 +546,8 @@ namespace RenderStar::Client::Render::Shader
                     {
                         size_t closingBrace = line.find('}');
 
-                        if (closingBrace != std::string::npos && closingBrace > 0)
-                            currentUniformBody += line.substr(0, closingBrace) + "\n";
+                        if (closingBrace != std::string_view::npos && closingBrace > 0)
+                            currentUniformBody.append(line.substr(0, closingBrace)).push_back('\n');
 
                         auto node = std::make_unique<RsslUniformBlockNode>();
                         node->location = {fileName, currentUniformLine, 1};
@@ -208,22 +562,22 @@ namespace RenderStar::Client::Render::Shader
                         continue;
                     }
 
-                    currentUniformBody += line + "\n";
+                    currentUniformBody.append(line).push_back('\n');
                     continue;
                 }
 
+                const std::string_view trimmedLine = TrimView(line);
+
                 // ── Version directive (must be first non-empty line) ──
 
                 if (!foundVersion)
                 {
-                    std::string trimmed = Trim(line);
-
-                    if (trimmed.empty())
+                    if (trimmedLine.empty())
                         continue;
 
-                    if (std::regex_match(trimmed, match, VersionPattern()))
+                    if (const auto version = ParseVersionDirective(trimmedLine))
                     {
-                        program->version = std::stoi(match[1].str());
+                        program->version = *version;
 
                         auto node = std::make_unique<RsslVersionDirective>();
                         node->location = {fileName, lineNum, 1};
@@ -234,48 +588,61 @@ namespace RenderStar::Client::Render::Shader
                         continue;
                     }
 
-                    addError(lineNum, "Expected #rssl version directive, got: " + trimmed);
+                    addError(lineNum, "Expected #rssl version directive, got: " + std::string(trimmedLine));
                     return program;
                 }
 
-                // ── @stage ──
+                const auto firstCharacter = std::ranges::find_if_not(line, IsSpace);
+                const char leading = firstCharacter == line.end() ? '\0' : *firstCharacter;
 
-                if (std::regex_match(line, match, StagePattern()))
+                if (leading == '@')
                 {
-                    std::string typeName = match[1].str();
+                    // ── @stage ──
 
-                    if (typeName != "vertex" && typeName != "fragment" && typeName != "compute")
+                    if (const auto typeName = ParseNamedDirective(line, "@stage"))
                     {
-                        addError(lineNum, "Unknown stage type: " + typeName);
+                        if (*typeName != "vertex" && *typeName != "fragment" && *typeName != "compute")
+                        {
+                            addError(lineNum, "Unknown stage type: " + std::string(*typeName));
+                            continue;
+                        }
+
+                        auto node = std::make_unique<RsslStageSectionNode>();
+                        node->location = {fileName, lineNum, 1};
+                        node->stageType = ParseStageType(*typeName);
+                        currentStage = node.get();
+                        currentSharedGlsl = nullptr;
+                        program->declarations.push_back(std::move(node));
                         continue;
                     }
 
-                    auto node = std::make_unique<RsslStageSectionNode>();
-                    node->location = {fileName, lineNum, 1};
-                    node->stageType = ParseStageType(typeName);
-                    currentStage = node.get();
-                    currentSharedGlsl = nullptr;
-                    program->declarations.push_back(std::move(node));
-                    continue;
-                }
+                    // ── @permutation ──
 
-                // ── @uniform header ──
+                    if (const auto key = ParseNamedDirective(line, "@permutation"))
+                    {
+                        auto node = std::make_unique<RsslPermutationDecl>();
+                        node->location = {fileName, lineNum, 1};
+                        node->name = *key;
+                        program->declarations.push_back(std::move(node));
+                        continue;
+                    }
 
-                if (std::regex_match(line, match, UniformPattern()))
-                {
-                    currentUniformName = match[1].str();
-                    currentUniformBinding = std::stoi(match[2].str());
-                    currentUniformLine = lineNum;
-                    inUniformBody = false;
-                    currentUniformBody.clear();
-                    braceDepth = 0;
-                    continue;
+                    // ── @uniform header ──
+
+                    if (const auto uniform = ParseUniformDirective(line))
+                    {
+                        currentUniformName = uniform->name;
+                        currentUniformBinding = uniform->binding;
+                        currentUniformLine = lineNum;
+                        inUniformBody = false;
+                        currentUniformBody.clear();
+                        braceDepth = 0;
+                        continue;
+                    }
                 }
 
                 // ── { after uniform header ──
 
-                std::string trimmedLine = Trim(line);
-
                 if (!currentUniformName.empty() && !inUniformBody && trimmedLine == "{")
                 {
                     inUniformBody = true;
@@ -283,82 +650,78 @@ namespace RenderStar::Client::Render::Shader
                     continue;
                 }
 
-                // ── @sampler ──
-
-                if (std::regex_match(line, match, SamplerPattern()))
+                if (leading == '@')
                 {
-                    std::string annotation = match[1].str();
-                    std::string samplerType = "sampler2D";
-
-                    if (annotation == "sampler3D")
-                        samplerType = "sampler3D";
-                    else if (annotation == "samplerCube")
-                        samplerType = "samplerCube";
-
-                    auto node = std::make_unique<RsslSamplerDeclNode>();
-                    node->location = {fileName, lineNum, 1};
-                    node->name = match[2].str();
-                    node->binding = std::stoi(match[3].str());
-                    node->samplerType = samplerType;
-                    program->declarations.push_back(std::move(node));
-                    continue;
-                }
+                    // ── @sampler ──
 
-                // ── @input (inside stage only) ──
+                    if (const auto sampler = ParseSamplerDirective(line))
+                    {
+                        std::string samplerType = "sampler2D";
 
-                if (currentStage && std::regex_match(line, match, InputPattern()))
-                {
-                    RsslStageIODecl io;
-                    io.name = match[1].str();
-                    io.location = std::stoi(match[2].str());
-                    io.glslType = match[3].str();
-                    io.isInput = true;
-                    currentStage->inputs.push_back(std::move(io));
-                    continue;
-                }
+                        if (sampler->annotation == "sampler3D")
+                            samplerType = "sampler3D";
+                        else if (sampler->annotation == "samplerCube")
+                            samplerType = "samplerCube";
 
-                // ── @output (inside stage only) ──
+                        auto node = std::make_unique<RsslSamplerDeclNode>();
+                        node->location = {fileName, lineNum, 1};
+                        node->name = sampler->name;
+                        node->binding = sampler->binding;
+                        node->samplerType = std::move(samplerType);
+                        program->declarations.push_back(std::move(node));
+                        continue;
+                    }
 
-                if (currentStage && std::regex_match(line, match, OutputPattern()))
-                {
-                    RsslStageIODecl io;
-                    io.name = match[1].str();
-                    io.location = std::stoi(match[2].str());
-                    io.glslType = match[3].str();
-                    io.isInput = false;
-                    currentStage->outputs.push_back(std::move(io));
-                    continue;
-                }
+                    // ── @input / @output (inside stage only) ──
 
-                // ── #include (new feature, requires resolver) ──
+                    if (currentStage)
+                    {
+                        if (const auto input = ParseStageIoDirective(line, "@input"))
+                        {
+                            currentStage->inputs.push_back({std::string(input->name), input->location, std::string(input->glslType), true});
+                            continue;
+                        }
 
-                if (resolver && std::regex_match(line, match, IncludePattern()))
-                {
-                    auto node = std::make_unique<RsslIncludeDirective>();
-                    node->location = {fileName, lineNum, 1};
-                    node->path = match[1].str();
-                    currentSharedGlsl = nullptr;
-                    program->declarations.push_back(std::move(node));
-                    continue;
+                        if (const auto output = ParseStageIoDirective(line, "@output"))
+                        {
+                            currentStage->outputs.push_back({std::string(output->name), output->location, std::string(output->glslType), false});
+                            continue;
+                        }
+                    }
                 }
 
-                // ── #define (new feature, requires resolver) ──
-
-                if (resolver && std::regex_match(line, match, DefinePattern()))
+                if (leading == '#' && resolver)
                 {
-                    auto node = std::make_unique<RsslDefineDirective>();
-                    node->location = {fileName, lineNum, 1};
-                    node->name = match[1].str();
-                    node->value = match[2].str();
-                    program->declarations.push_back(std::move(node));
-                    continue;
+                    // ── #include (requires resolver) ──
+
+                    if (const auto path = ParseIncludeDirective(line))
+                    {
+                        auto node = std::make_unique<RsslIncludeDirective>();
+                        node->location = {fileName, lineNum, 1};
+                        node->path = *path;
+                        currentSharedGlsl = nullptr;
+                        program->declarations.push_back(std::move(node));
+                        continue;
+                    }
+
+                    // ── #define (requires resolver) ──
+
+                    if (const auto define = ParseDefineDirective(line))
+                    {
+                        auto node = std::make_unique<RsslDefineDirective>();
+                        node->location = {fileName, lineNum, 1};
+                        node->name = define->name;
+                        node->value = define->value;
+                        program->declarations.push_back(std::move(node));
+                        continue;
+                    }
                 }
 
                 // ── Default: GLSL text ──
 
                 if (currentStage)
                 {
-                    currentStage->glslBody += line + "\n";
+                    currentStage->glslBody.append(line).push_back('\n');
                 }
                 else
                 {
@@ -370,7 +733,7 @@ namespace RenderStar::Client::Render::Shader
                         program->declarations.push_back(std::move(node));
                     }
 
-                    currentSharedGlsl->code += line + "\n";
+                    currentSharedGlsl->code.append(line).push_back('\n');
                 }
             }
 
@@ -400,11 +763,15 @@ namespace RenderStar::Client::Render::Shader
             std::vector<const RsslUniformBlockNode*> uniformBlocks;
             std::vector<const RsslSamplerDeclNode*> samplers;
             std::vector<const RsslStageSectionNode*> stages;
+            std::vector<const RsslPermutationDecl*> permutations;
 
             for (const auto& decl : program.declarations)
             {
                 switch (decl->kind)
                 {
+                case RsslNodeKind::PERMUTATION_DECL:
+                    permutations.push_back(static_cast<const RsslPermutationDecl*>(decl.get()));
+                    break;
                 case RsslNodeKind::UNIFORM_BLOCK:
                     uniformBlocks.push_back(static_cast<const RsslUniformBlockNode*>(decl.get()));
                     break;
@@ -422,6 +789,23 @@ namespace RenderStar::Client::Render::Shader
             if (stages.empty() && diagnostics.empty())
                 addError(program.location, "No @stage sections found");
 
+            // Permutation keys
+            for (size_t i = 0; i < permutations.size(); i++)
+            {
+                for (size_t j = 0; j < i; j++)
+                {
+                    if (permutations[i]->name == permutations[j]->name)
+                    {
+                        addError(permutations[i]->location, "Duplicate @permutation key '" + permutations[i]->name + "'");
+                        break;
+                    }
+                }
+            }
+
+            if (permutations.size() > RSSL_MAX_PERMUTATION_KEYS)
+                addError(permutations[RSSL_MAX_PERMUTATION_KEYS]->location,
+                    "Too many @permutation keys (maximum " + std::to_string(RSSL_MAX_PERMUTATION_KEYS) + ")");
+
             // Duplicate bindings among uniform blocks
             for (size_t i = 0; i < uniformBlocks.size(); i++)
             {
@@ -517,44 +901,106 @@ namespace RenderStar::Client::Render::Shader
 
         // ── Include resolution ─────────────────────────────────────────
 
-        void ResolveIncludes(
-            RsslProgram& program,
-            const IncludeResolver& resolver,
+        struct IncludeUnit
+        {
+            std::unique_ptr<RsslProgram> program;
+            std::string failure;
+            std::vector<RsslDiagnostic> diagnostics;
+        };
+
+        class IncludeCache
+        {
+        public:
+
+            explicit IncludeCache(const IncludeResolver& resolver) : resolver(resolver) { }
+
+            const IncludeUnit& Load(const std::string& path, const std::string& requestingFile)
+            {
+                auto [iterator, inserted] = units.try_emplace(path);
+                auto& unit = iterator->second;
+
+                if (!inserted)
+                    return unit;
+
+                std::string source;
+
+                try
+                {
+                    source = resolver(path, requestingFile);
+                }
+                catch (const std::exception& e)
+                {
+                    unit.failure = e.what();
+                    return unit;
+                }
+
+                unit.program = ScanAndBuildAst(source, path, &resolver, unit.diagnostics, false);
+
+                return unit;
+            }
+
+            [[nodiscard]]
+            size_t GetParsedCount() const
+            {
+                return std::ranges::count_if(units, [](const auto& entry) { return entry.second.program != nullptr; });
+            }
+
+        private:
+
+            const IncludeResolver& resolver;
+            std::map<std::string, IncludeUnit> units;
+        };
+
+        struct IncludeExpansion
+        {
+            std::vector<const RsslAstNode*> declarations;
+            std::set<std::string> resolvedFiles;
+            std::set<std::string> requestedFiles;
+        };
+
+        void ExpandDeclarations(const RsslProgram& program, IncludeExpansion& expansion)
+        {
+            for (const auto& decl : program.declarations)
+                expansion.declarations.push_back(decl.get());
+        }
+
+        void ExpandIncludes(
+            const RsslProgram& program,
+            IncludeCache& cache,
             const std::string& currentFile,
             std::vector<RsslDiagnostic>& diagnostics,
-            std::set<std::string>& resolvedFiles)
+            IncludeExpansion& expansion)
         {
-            for (size_t i = 0; i < program.declarations.size(); i++)
+            for (const auto& decl : program.declarations)
             {
-                if (program.declarations[i]->kind != RsslNodeKind::INCLUDE_DIRECTIVE)
+                if (decl->kind != RsslNodeKind::INCLUDE_DIRECTIVE)
+                {
+                    expansion.declarations.push_back(decl.get());
                     continue;
+                }
 
-                auto* include = static_cast<RsslIncludeDirective*>(program.declarations[i].get());
+                auto* include = static_cast<const RsslIncludeDirective*>(decl.get());
 
-                if (resolvedFiles.count(include->path))
+                if (expansion.resolvedFiles.contains(include->path))
                     continue;
 
-                std::string resolvedSource;
+                expansion.requestedFiles.insert(include->path);
 
-                try
-                {
-                    resolvedSource = resolver(include->path, currentFile);
-                }
-                catch (const std::exception& e)
+                const auto& unit = cache.Load(include->path, currentFile);
+
+                if (!unit.program)
                 {
                     diagnostics.push_back({
                         RsslDiagnostic::Severity::SEV_ERROR,
-                        "Failed to resolve #include \"" + include->path + "\": " + e.what(),
+                        "Failed to resolve #include \"" + include->path + "\": " + unit.failure,
                         include->location});
                     continue;
                 }
 
-                resolvedFiles.insert(include->path);
-
-                auto subProgram = ScanAndBuildAst(resolvedSource, include->path, &resolver, diagnostics, false);
-                ResolveIncludes(*subProgram, resolver, include->path, diagnostics, resolvedFiles);
+                expansion.resolvedFiles.insert(include->path);
+                diagnostics.insert(diagnostics.end(), unit.diagnostics.begin(), unit.diagnostics.end());
 
-                include->resolvedNodes = std::move(subProgram->declarations);
+                ExpandIncludes(*unit.program, cache, include->path, diagnostics, expansion);
             }
         }
 
@@ -593,10 +1039,7 @@ namespace RenderStar::Client::Render::Shader
             auto substitute = [&](std::string& text)
             {
                 for (const auto& [name, value] : defines)
-                {
-                    std::regex pattern("\\b" + name + "\\b");
-                    text = std::regex_replace(text, pattern, value);
-                }
+                    text = ReplaceWord(text, name, value);
             };
 
             for (auto& decl : program.declarations)
@@ -622,28 +1065,28 @@ namespace RenderStar::Client::Render::Shader
         // ── AST → RsslParseResult conversion ──────────────────────────
 
         void CollectFromDeclarations(
-            const std::vector<std::unique_ptr<RsslAstNode>>& declarations,
+            const std::vector<const RsslAstNode*>& declarations,
             RsslParseResult& result)
         {
-            for (const auto& decl : declarations)
+            for (const auto* decl : declarations)
             {
                 switch (decl->kind)
                 {
                 case RsslNodeKind::UNIFORM_BLOCK:
                 {
-                    auto* node = static_cast<const RsslUniformBlockNode*>(decl.get());
+                    auto* node = static_cast<const RsslUniformBlockNode*>(decl);
                     result.uniformBlocks.push_back({node->name, node->binding, node->rawBody});
                     break;
                 }
                 case RsslNodeKind::SAMPLER_DECL:
                 {
-                    auto* node = static_cast<const RsslSamplerDeclNode*>(decl.get());
+                    auto* node = static_cast<const RsslSamplerDeclNode*>(decl);
                     result.samplers.push_back({node->name, node->binding, node->samplerType});
                     break;
                 }
                 case RsslNodeKind::STAGE_SECTION:
                 {
-                    auto* node = static_cast<const RsslStageSectionNode*>(decl.get());
+                    auto* node = static_cast<const RsslStageSectionNode*>(decl);
                     RsslStageSection section;
                     section.type = node->stageType;
                     section.glslBody = node->glslBody;
@@ -657,16 +1100,19 @@ namespace RenderStar::Client::Render::Shader
                     result.stages.push_back(std::move(section));
                     break;
                 }
-                case RsslNodeKind::SHARED_GLSL:
+                case RsslNodeKind::PERMUTATION_DECL:
                 {
-                    auto* node = static_cast<const RsslSharedGlsl*>(decl.get());
-                    result.sharedGlsl += node->code;
+                    auto* node = static_cast<const RsslPermutationDecl*>(decl);
+
+                    if (std::ranges::find(result.permutationKeys, node->name) == result.permutationKeys.end())
+                        result.permutationKeys.push_back(node->name);
+
                     break;
                 }
-                case RsslNodeKind::INCLUDE_DIRECTIVE:
+                case RsslNodeKind::SHARED_GLSL:
                 {
-                    auto* node = static_cast<const RsslIncludeDirective*>(decl.get());
-                    CollectFromDeclarations(node->resolvedNodes, result);
+                    auto* node = static_cast<const RsslSharedGlsl*>(decl);
+                    result.sharedGlsl += node->code;
                     break;
                 }
                 default:
@@ -677,12 +1123,13 @@ namespace RenderStar::Client::Render::Shader
 
         RsslParseResult BuildParseResult(
             const RsslProgram& program,
+            const IncludeExpansion& expansion,
             const std::vector<RsslDiagnostic>& diagnostics)
         {
             RsslParseResult result;
             result.version = program.version;
 
-            CollectFromDeclarations(program.declarations, result);
+            CollectFromDeclarations(expansion.declarations, result);
 
             for (const auto& diag : diagnostics)
             {
@@ -695,18 +1142,51 @@ namespace RenderStar::Client::Render::Shader
 
         // ── Target-specific post-processing ──────────────────────────
 
-        std::string PostProcessForTarget(std::string glsl, RsslTarget target)
+        std::string ReplaceYFlip(const std::string& glsl)
         {
-            if (target == RsslTarget::OPENGL_GLSL)
+            constexpr std::string_view FLIPPED = "vec2";
+            constexpr std::string_view UNFLIPPED = "vec2(0.5, 0.5)";
+
+            std::string output;
+            size_t copied = 0;
+
+            for (size_t match = glsl.find(FLIPPED); match != std::string::npos; match = glsl.find(FLIPPED, match + 1))
             {
-                std::regex vertexIndexPattern(R"(\bgl_VertexIndex\b)");
-                glsl = std::regex_replace(glsl, vertexIndexPattern, "gl_VertexID");
+                if (match < copied)
+                    continue;
+
+                RsslScanner scanner(std::string_view(glsl).substr(match + FLIPPED.size()));
+
+                if (!scanner.ConsumePunctuation('(') || !scanner.Consume("0.5") || !scanner.ConsumePunctuation(',') || !scanner.Consume("-0.5"))
+                    continue;
+
+                scanner.SkipSpace();
+
+                if (!scanner.Consume(')'))
+                    continue;
+
+                const size_t end = match + FLIPPED.size() + scanner.GetPosition();
 
-                std::regex instanceIndexPattern(R"(\bgl_InstanceIndex\b)");
-                glsl = std::regex_replace(glsl, instanceIndexPattern, "gl_InstanceID");
+                output.append(glsl, copied, match - copied);
+                output.append(UNFLIPPED);
+                copied = end;
+            }
+
+            if (copied == 0)
+                return glsl;
+
+            output.append(glsl, copied);
 
-                std::regex yFlipPattern(R"(vec2\s*\(\s*0\.5\s*,\s*-0\.5\s*\))");
-                glsl = std::regex_replace(glsl, yFlipPattern, "vec2(0.5, 0.5)");
+            return output;
+        }
+
+        std::string PostProcessForTarget(std::string glsl, RsslTarget target)
+        {
+            if (target == RsslTarget::OPENGL_GLSL)
+            {
+                glsl = ReplaceWord(glsl, "gl_VertexIndex", "gl_VertexID");
+                glsl = ReplaceWord(glsl, "gl_InstanceIndex", "gl_InstanceID");
+                glsl = ReplaceYFlip(glsl);
             }
 
             return glsl;
@@ -731,11 +1211,13 @@ namespace RenderStar::Client::Render::Shader
     std::string RsslCompiler::EmitStageGlsl(
         const RsslParseResult& parsed,
         const RsslStageSection& stage,
-        RsslTarget target)
+        RsslTarget target,
+        RsslPermutationMask permutation)
     {
         std::string output;
 
         output += GetVersionDirective(target);
+        output += EmitPermutationConstants(parsed, target, permutation);
         output += EmitSharedDeclarations(parsed);
 
         std::string trimmedShared = Trim(parsed.sharedGlsl);
@@ -754,6 +1236,28 @@ namespace RenderStar::Client::Render::Shader
         return PostProcessForTarget(std::move(output), target);
     }
 
+    std::string RsslCompiler::EmitPermutationConstants(const RsslParseResult& parsed, RsslTarget target, RsslPermutationMask permutation)
+    {
+        std::string output;
+
+        for (size_t i = 0; i < parsed.permutationKeys.size(); i++)
+        {
+            const auto& key = parsed.permutationKeys[i];
+            const bool enabled = (permutation & parsed.GetPermutationBit(key)) != 0;
+            const std::string value = enabled ? "true" : "false";
+
+            if (target == RsslTarget::OPENGL_GLSL)
+                output += "#define " + key + " " + value + "\n";
+            else
+                output += "layout(constant_id = " + std::to_string(i) + ") const bool " + key + " = " + value + ";\n";
+        }
+
+        if (!parsed.permutationKeys.empty())
+            output += "\n";
+
+        return output;
+    }
+
     std::string RsslCompiler::EmitSharedDeclarations(const RsslParseResult& parsed)
     {
         std::string output;
@@ -820,7 +1324,10 @@ namespace RenderStar::Client::Render::Shader
         auto program = ScanAndBuildAst(source, "<source>", nullptr, diagnostics);
         ValidateProgram(*program, diagnostics);
 
-        return BuildParseResult(*program, diagnostics);
+        IncludeExpansion expansion;
+        ExpandDeclarations(*program, expansion);
+
+        return BuildParseResult(*program, expansion, diagnostics);
     }
 
     RsslParseResult RsslCompiler::Parse(
@@ -831,14 +1338,15 @@ namespace RenderStar::Client::Render::Shader
         std::vector<RsslDiagnostic> diagnostics;
         auto program = ScanAndBuildAst(source, fileName, &resolver, diagnostics);
 
-        std::set<std::string> resolvedFiles;
-        resolvedFiles.insert(fileName);
-        ResolveIncludes(*program, resolver, fileName, diagnostics, resolvedFiles);
+        IncludeCache cache(resolver);
+        IncludeExpansion expansion;
+        expansion.resolvedFiles.insert(fileName);
+        ExpandIncludes(*program, cache, fileName, diagnostics, expansion);
 
         ApplyDefines(*program);
         ValidateProgram(*program, diagnostics);
 
-        return BuildParseResult(*program, diagnostics);
+        return BuildParseResult(*program, expansion, diagnostics);
     }
 
     RsslCompileResult RsslCompiler::Compile(const std::string& source, RsslTarget target)
@@ -858,6 +1366,11 @@ namespace RenderStar::Client::Render::Shader
     }
 
     RsslCompileResult RsslCompiler::Compile(const RsslParseResult& parsed, RsslTarget target)
+    {
+        return Compile(parsed, target, parsed.GetFullPermutationMask());
+    }
+
+    RsslCompileResult RsslCompiler::Compile(const RsslParseResult& parsed, RsslTarget target, RsslPermutationMask permutation)
     {
         RsslCompileResult result;
 
@@ -869,7 +1382,7 @@ namespace RenderStar::Client::Render::Shader
 
         for (const auto& stage : parsed.stages)
         {
-            std::string glsl = EmitStageGlsl(parsed, stage, target);
+            std::string glsl = EmitStageGlsl(parsed, stage, target, permutation);
 
             switch (stage.type)
             {
@@ -887,4 +1400,72 @@ namespace RenderStar::Client::Render::Shader
 
         return result;
     }
+
+    RsslBatchResult RsslCompiler::CompileBatch(
+        const std::vector<RsslBatchSource>& sources,
+        const IncludeResolver& resolver,
+        const std::vector<RsslTarget>& targets,
+        size_t workerCount)
+    {
+        struct ProgramState
+        {
+            std::unique_ptr<RsslProgram> program;
+            std::vector<RsslDiagnostic> diagnostics;
+            IncludeExpansion expansion;
+        };
+
+        if (workerCount == 0)
+            workerCount = Common::Utility::WorkerPool::GetDefaultWorkerCount();
+
+        std::vector<ProgramState> states(sources.size());
+
+        Common::Utility::WorkerPool::RunTransient(sources.size(), workerCount, [&](const size_t index)
+        {
+            states[index].program = ScanAndBuildAst(sources[index].source, sources[index].name, &resolver, states[index].diagnostics);
+        });
+
+        IncludeCache cache(resolver);
+
+        for (size_t index = 0; index < sources.size(); index++)
+        {
+            auto& state = states[index];
+            state.expansion.resolvedFiles.insert(sources[index].name);
+            ExpandIncludes(*state.program, cache, sources[index].name, state.diagnostics, state.expansion);
+        }
+
+        RsslBatchResult result;
+        result.parsedIncludeCount = cache.GetParsedCount();
+        result.programs.resize(sources.size());
+
+        Common::Utility::WorkerPool::RunTransient(sources.size(), workerCount, [&](const size_t index)
+        {
+            auto& state = states[index];
+            auto& program = result.programs[index];
+
+            ApplyDefines(*state.program);
+            ValidateProgram(*state.program, state.diagnostics);
+
+            program.name = sources[index].name;
+            program.parsed = BuildParseResult(*state.program, state.expansion, state.diagnostics);
+            program.targets = targets;
+            program.compiled.resize(targets.size());
+            program.includes.assign(state.expansion.requestedFiles.begin(), state.expansion.requestedFiles.end());
+        });
+
+        Common::Utility::WorkerPool::RunTransient(sources.size() * targets.size(), workerCount, [&](const size_t index)
+        {
+            auto& program = result.programs[index / targets.size()];
+            program.compiled[index % targets.size()] = Compile(program.parsed, targets[index % targets.size()]);
+        });
+
+        for (const auto& program : result.programs)
+        {
+            result.dependencies.includesByProgram[program.name] = program.includes;
+
+            for (const auto& include : program.includes)
+                result.dependencies.programsByInclude[include].push_back(program.name);
+        }
+
+        return result;
+    }
 }
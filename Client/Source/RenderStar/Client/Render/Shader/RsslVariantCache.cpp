@@ -0,0 +1,107 @@
+#include "RenderStar/Client/Render/Shader/RsslVariantCache.hpp"
+#include "RenderStar/Client/Render/Shader/RsslCompiler.hpp"
+
+namespace RenderStar::Client::Render::Shader
+{
+    void RsslVariantCache::Register(const std::string& program, RsslParseResult parsed)
+    {
+        std::scoped_lock lock(mutex);
+
+        std::erase_if(variants, [&program](const auto& entry) { return entry.first.program == program; });
+        programs[program] = std::make_shared<const RsslParseResult>(std::move(parsed));
+    }
+
+    void RsslVariantCache::Register(const RsslBatchProgram& program)
+    {
+        std::scoped_lock lock(mutex);
+
+        std::erase_if(variants, [&program](const auto& entry) { return entry.first.program == program.name; });
+
+        const auto& parsed = programs[program.name] = std::make_shared<const RsslParseResult>(program.parsed);
+
+        for (size_t index = 0; index < program.targets.size() && index < program.compiled.size(); ++index)
+            variants.emplace(RsslVariantKey{program.name, program.targets[index], parsed->GetFullPermutationMask()}, std::make_shared<const RsslCompileResult>(program.compiled[index]));
+    }
+
+    void RsslVariantCache::Invalidate(const std::string& program)
+    {
+        std::scoped_lock lock(mutex);
+
+        std::erase_if(variants, [&program](const auto& entry) { return entry.first.program == program; });
+        programs.erase(program);
+    }
+
+    void RsslVariantCache::Clear()
+    {
+        std::scoped_lock lock(mutex);
+
+        variants.clear();
+        programs.clear();
+    }
+
+    bool RsslVariantCache::Contains(const std::string& program) const
+    {
+        std::scoped_lock lock(mutex);
+
+        return programs.contains(program);
+    }
+
+    std::shared_ptr<const RsslParseResult> RsslVariantCache::GetParsed(const std::string& program) const
+    {
+        std::scoped_lock lock(mutex);
+
+        const auto iterator = programs.find(program);
+
+        return iterator == programs.end() ? nullptr : iterator->second;
+    }
+
+    RsslVariantKey RsslVariantCache::MakeKey(const std::string& program, const RsslTarget target, const RsslPermutationMask permutation) const
+    {
+        std::scoped_lock lock(mutex);
+
+        return MakeKeyLocked(program, target, permutation);
+    }
+
+    std::shared_ptr<const RsslCompileResult> RsslVariantCache::GetOrCompile(const std::string& program, const RsslTarget target, const RsslPermutationMask permutation)
+    {
+        std::scoped_lock lock(mutex);
+
+        const auto parsed = programs.find(program);
+
+        if (parsed == programs.end())
+            return nullptr;
+
+        auto key = MakeKeyLocked(program, target, permutation);
+
+        if (const auto iterator = variants.find(key); iterator != variants.end())
+        {
+            statistics.hits++;
+            return iterator->second;
+        }
+
+        statistics.misses++;
+
+        auto compiled = std::make_shared<const RsslCompileResult>(RsslCompiler::Compile(*parsed->second, target, key.permutation));
+        variants.emplace(std::move(key), compiled);
+
+        return compiled;
+    }
+
+    RsslVariantCacheStatistics RsslVariantCache::GetStatistics() const
+    {
+        std::scoped_lock lock(mutex);
+
+        auto result = statistics;
+        result.variantCount = variants.size();
+
+        return result;
+    }
+
+    RsslVariantKey RsslVariantCache::MakeKeyLocked(const std::string& program, const RsslTarget target, const RsslPermutationMask permutation) const
+    {
+        const auto iterator = programs.find(program);
+        const RsslPermutationMask declared = iterator == programs.end() ? 0 : iterator->second->GetFullPermutationMask();
+
+        return {program, target, permutation & declared};
+    }
+}
@@ -95,6 +95,7 @@ namespace RenderStar::Client::Render::Shader
         {
             case RenderBackend::OPENGL: return "opengl";
             case RenderBackend::VULKAN: return "vulkan";
+            case RenderBackend::HEADLESS: return "vulkan";
         }
         return "opengl";
     }
@@ -0,0 +1,178 @@
+#include "RenderStar/Client/Render/Vulkan/GlslcSpirvCompiler.hpp"
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace RenderStar::Client::Render::Vulkan
+{
+    namespace
+    {
+        int ExecuteCommandWithStatus(const std::string& command, std::string& output)
+        {
+#ifdef _WIN32
+            std::array<char, 4096> buffer;
+            output.clear();
+
+            FILE* pipe = _popen((command + " 2>&1").c_str(), "r");
+            if (!pipe)
+                return -1;
+
+            while (fgets(buffer.data(), static_cast<int>(buffer.size()), pipe) != nullptr)
+                output += buffer.data();
+
+            return _pclose(pipe);
+#else
+            std::array<char, 4096> buffer;
+            output.clear();
+
+            FILE* pipe = popen((command + " 2>&1").c_str(), "r");
+            if (!pipe)
+                return -1;
+
+            while (fgets(buffer.data(), static_cast<int>(buffer.size()), pipe) != nullptr)
+                output += buffer.data();
+
+            int status = pclose(pipe);
+            return WEXITSTATUS(status);
+#endif
+        }
+    }
+
+    GlslcSpirvCompiler::GlslcSpirvCompiler() : executable(FindExecutable()), invocationCounter(0), logger(spdlog::default_logger()->clone("GlslcSpirvCompiler")) { }
+
+    std::string GlslcSpirvCompiler::GetVersion() const
+    {
+        if (!executable.has_value())
+            return "glslc";
+
+        std::error_code error;
+
+        const auto size = std::filesystem::file_size(*executable, error);
+        const auto modified = std::filesystem::last_write_time(*executable, error).time_since_epoch().count();
+
+        return "glslc:" + executable->string() + ":" + std::to_string(size) + ":" + std::to_string(modified);
+    }
+
+    std::string GlslcSpirvCompiler::GetTargetEnvironment() const
+    {
+        return std::string(TARGET_ENVIRONMENT);
+    }
+
+    std::vector<uint32_t> GlslcSpirvCompiler::Compile(const SpirvCompileJob& job)
+    {
+        const auto invocation = std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + "_" + std::to_string(invocationCounter++);
+
+        std::filesystem::path tempDir = std::filesystem::temp_directory_path();
+        std::filesystem::path inputPath = tempDir / ("shader_input_" + invocation + ".glsl");
+        std::filesystem::path outputPath = tempDir / ("shader_output_" + invocation + ".spv");
+
+        {
+            std::ofstream inputFile(inputPath);
+
+            if (!inputFile.is_open())
+            {
+                logger->error("Failed to create temporary shader file: {}", inputPath.string());
+                throw std::runtime_error("Failed to create temporary shader file");
+            }
+
+            inputFile << job.source;
+        }
+
+        std::string stageFlag;
+
+        switch (job.stage)
+        {
+            case VulkanShaderStage::VERTEX:
+                stageFlag = "-fshader-stage=vertex";
+                break;
+            case VulkanShaderStage::FRAGMENT:
+                stageFlag = "-fshader-stage=fragment";
+                break;
+            case VulkanShaderStage::COMPUTE:
+                stageFlag = "-fshader-stage=compute";
+                break;
+        }
+
+        const std::string program = executable.has_value() ? "\"" + executable->string() + "\"" : "glslc";
+        std::string command = program + " " + stageFlag + " --target-env=" + std::string(TARGET_ENVIRONMENT) + " -O \"" + inputPath.string() + "\" -o \"" + outputPath.string() + "\"";
+
+        std::string compileOutput;
+        int result = ExecuteCommandWithStatus(command, compileOutput);
+
+        std::filesystem::remove(inputPath);
+
+        if (result != 0)
+        {
+            std::filesystem::remove(outputPath);
+
+            logger->error("Shader compilation failed for {}: {}", job.name, compileOutput);
+
+            throw std::runtime_error("Shader compilation failed: " + compileOutput);
+        }
+
+        std::ifstream spirvFile(outputPath, std::ios::ate | std::ios::binary);
+
+        if (!spirvFile.is_open())
+        {
+            logger->error("Failed to read compiled shader: {}", outputPath.string());
+            throw std::runtime_error("Failed to read compiled shader");
+        }
+
+        size_t fileSize = spirvFile.tellg();
+        std::vector<uint32_t> spirvCode(fileSize / sizeof(uint32_t));
+
+        spirvFile.seekg(0);
+        spirvFile.read(reinterpret_cast<char*>(spirvCode.data()), static_cast<long long>(fileSize));
+        spirvFile.close();
+
+        std::filesystem::remove(outputPath);
+
+        logger->info("Compiled GLSL to SPIR-V using glslc: {}", job.name);
+
+        return spirvCode;
+    }
+
+    std::optional<std::filesystem::path> GlslcSpirvCompiler::FindExecutable()
+    {
+        const char* pathVariable = std::getenv("PATH");
+
+        if (!pathVariable)
+            return std::nullopt;
+
+#ifdef _WIN32
+        constexpr char PATH_SEPARATOR = ';';
+        constexpr std::string_view EXECUTABLE_NAME = "glslc.exe";
+#else
+        constexpr char PATH_SEPARATOR = ':';
+        constexpr std::string_view EXECUTABLE_NAME = "glslc";
+#endif
+
+        const std::string_view paths(pathVariable);
+
+        for (size_t start = 0; start <= paths.size();)
+        {
+            const size_t end = std::min(paths.find(PATH_SEPARATOR, start), paths.size());
+            const auto directory = paths.substr(start, end - start);
+
+            start = end + 1;
+
+            if (directory.empty())
+                continue;
+
+            std::error_code error;
+            const auto candidate = std::filesystem::path(directory) / EXECUTABLE_NAME;
+
+            if (std::filesystem::is_regular_file(candidate, error))
+                return std::filesystem::canonical(candidate, error);
+        }
+
+        return std::nullopt;
+    }
+}
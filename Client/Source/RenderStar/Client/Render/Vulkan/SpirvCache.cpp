@@ -0,0 +1,354 @@
+#include "RenderStar/Client/Render/Vulkan/SpirvCache.hpp"
+#include "RenderStar/Common/Utility/WorkerPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <unordered_map>
+
+namespace RenderStar::Client::Render::Vulkan
+{
+    namespace
+    {
+        constexpr uint64_t FNV_PRIME = 0x100000001B3ull;
+
+        void HashBytes(uint64_t& hash, const std::string_view bytes)
+        {
+            for (const char byte : bytes)
+            {
+                hash ^= static_cast<uint8_t>(byte);
+                hash *= FNV_PRIME;
+            }
+
+            hash ^= 0xFF;
+            hash *= FNV_PRIME;
+        }
+
+        std::string ToHex(uint64_t value)
+        {
+            constexpr std::string_view DIGITS = "0123456789abcdef";
+
+            std::string hex(16, '0');
+
+            for (auto iterator = hex.rbegin(); iterator != hex.rend(); ++iterator, value >>= 4)
+                *iterator = DIGITS[value & 0xF];
+
+            return hex;
+        }
+
+        std::string_view GetStageName(const VulkanShaderStage stage)
+        {
+            switch (stage)
+            {
+                case VulkanShaderStage::VERTEX:
+                    return "vertex";
+                case VulkanShaderStage::FRAGMENT:
+                    return "fragment";
+                case VulkanShaderStage::COMPUTE:
+                    return "compute";
+            }
+
+            return "unknown";
+        }
+    }
+
+    SpirvCache::SpirvCache(std::filesystem::path directory, std::unique_ptr<ISpirvCompiler> compiler, const size_t byteBudget)
+        : directory(std::move(directory)), compiler(std::move(compiler)), logger(spdlog::default_logger()->clone("SpirvCache"))
+    {
+        compilerVersion = this->compiler->GetVersion();
+        targetEnvironment = this->compiler->GetTargetEnvironment();
+        statistics.byteBudget = byteBudget;
+
+        std::error_code error;
+        std::filesystem::create_directories(this->directory, error);
+
+        if (error)
+            logger->warn("Failed to create SPIR-V cache directory {}: {}", this->directory.string(), error.message());
+
+        std::scoped_lock lock(mutex);
+        TrimLocked();
+    }
+
+    std::vector<uint32_t> SpirvCache::GetOrCompile(const SpirvCompileJob& job)
+    {
+        return std::move(GetOrCompileBatch(std::span(&job, 1)).front());
+    }
+
+    std::vector<std::vector<uint32_t>> SpirvCache::GetOrCompileBatch(const std::span<const SpirvCompileJob> jobs)
+    {
+        std::vector<std::vector<uint32_t>> results(jobs.size());
+        std::vector<std::string> keys(jobs.size());
+        std::unordered_map<std::string, size_t> firstMiss;
+        std::vector<size_t> misses;
+
+        for (size_t index = 0; index < jobs.size(); ++index)
+        {
+            keys[index] = ComputeKey(jobs[index]);
+
+            if (firstMiss.contains(keys[index]))
+                continue;
+
+            if (auto cached = Read(keys[index]); cached.has_value())
+            {
+                results[index] = std::move(*cached);
+                continue;
+            }
+
+            firstMiss.emplace(keys[index], index);
+            misses.push_back(index);
+        }
+
+        if (!misses.empty())
+        {
+            std::vector<std::exception_ptr> errors(misses.size());
+
+            Common::Utility::WorkerPool::RunTransient(misses.size(), GetDefaultWorkerCount(), [&](const size_t slot)
+            {
+                const size_t index = misses[slot];
+
+                try
+                {
+                    results[index] = compiler->Compile(jobs[index]);
+                    Store(keys[index], results[index]);
+                }
+                catch (...)
+                {
+                    errors[slot] = std::current_exception();
+                }
+            });
+
+            for (const auto& error : errors)
+            {
+                if (error)
+                    std::rethrow_exception(error);
+            }
+        }
+
+        for (size_t index = 0; index < jobs.size(); ++index)
+        {
+            if (const auto iterator = firstMiss.find(keys[index]); iterator != firstMiss.end() && iterator->second != index)
+                results[index] = results[iterator->second];
+        }
+
+        return results;
+    }
+
+    std::string SpirvCache::ComputeKey(const SpirvCompileJob& job) const
+    {
+        uint64_t primary = 0xCBF29CE484222325ull;
+        uint64_t secondary = 0x84222325CBF29CE4ull;
+
+        for (auto* hash : { &primary, &secondary })
+        {
+            HashBytes(*hash, job.source);
+            HashBytes(*hash, GetStageName(job.stage));
+            HashBytes(*hash, targetEnvironment);
+            HashBytes(*hash, compilerVersion);
+        }
+
+        return ToHex(primary) + ToHex(secondary);
+    }
+
+    void SpirvCache::Trim()
+    {
+        std::scoped_lock lock(mutex);
+        TrimLocked();
+    }
+
+    void SpirvCache::Clear()
+    {
+        std::scoped_lock lock(mutex);
+
+        std::error_code error;
+
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+        {
+            if (entry.path().extension() == FILE_EXTENSION || entry.path().extension() == TEMPORARY_EXTENSION)
+                std::filesystem::remove(entry.path(), error);
+        }
+
+        statistics.residentBytes = 0;
+    }
+
+    SpirvCacheStatistics SpirvCache::GetStatistics() const
+    {
+        std::scoped_lock lock(mutex);
+        return statistics;
+    }
+
+    const std::filesystem::path& SpirvCache::GetDirectory() const
+    {
+        return directory;
+    }
+
+    std::filesystem::path SpirvCache::GetDefaultDirectory()
+    {
+        if (const char* override = std::getenv("RENDERSTAR_SHADER_CACHE"); override && *override)
+            return override;
+
+#ifdef _WIN32
+        if (const char* localAppData = std::getenv("LOCALAPPDATA"); localAppData && *localAppData)
+            return std::filesystem::path(localAppData) / "RenderStar" / "ShaderCache";
+#else
+        if (const char* cacheHome = std::getenv("XDG_CACHE_HOME"); cacheHome && *cacheHome)
+            return std::filesystem::path(cacheHome) / "renderstar" / "spirv";
+
+        if (const char* home = std::getenv("HOME"); home && *home)
+            return std::filesystem::path(home) / ".cache" / "renderstar" / "spirv";
+#endif
+
+        return std::filesystem::temp_directory_path() / "renderstar" / "spirv";
+    }
+
+    size_t SpirvCache::GetDefaultWorkerCount()
+    {
+        return Common::Utility::WorkerPool::GetDefaultWorkerCount();
+    }
+
+    std::optional<std::vector<uint32_t>> SpirvCache::Read(const std::string& key)
+    {
+        const auto path = GetEntryPath(key);
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+        if (!file.is_open())
+        {
+            std::scoped_lock lock(mutex);
+            ++statistics.misses;
+            return std::nullopt;
+        }
+
+        const auto fileSize = static_cast<size_t>(file.tellg());
+        std::vector<uint32_t> spirv(fileSize / sizeof(uint32_t));
+
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(spirv.data()), static_cast<std::streamsize>(spirv.size() * sizeof(uint32_t)));
+
+        std::error_code error;
+
+        if (!file || fileSize % sizeof(uint32_t) != 0 || spirv.empty() || spirv.front() != SPIRV_MAGIC)
+        {
+            logger->warn("Discarding corrupt SPIR-V cache entry {}", path.string());
+
+            file.close();
+            std::filesystem::remove(path, error);
+
+            std::scoped_lock lock(mutex);
+            ++statistics.misses;
+            statistics.residentBytes -= std::min(statistics.residentBytes, fileSize);
+            return std::nullopt;
+        }
+
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+
+        std::scoped_lock lock(mutex);
+        ++statistics.hits;
+
+        return spirv;
+    }
+
+    void SpirvCache::Store(const std::string& key, const std::vector<uint32_t>& spirv)
+    {
+        static std::atomic<uint64_t> temporaryCounter = 0;
+
+        const auto path = GetEntryPath(key);
+        auto temporaryPath = path;
+        temporaryPath += "." + std::to_string(temporaryCounter++) + std::string(TEMPORARY_EXTENSION);
+
+        const size_t byteCount = spirv.size() * sizeof(uint32_t);
+
+        {
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(spirv.data()), static_cast<std::streamsize>(byteCount));
+
+            if (!file)
+            {
+                std::error_code error;
+                std::filesystem::remove(temporaryPath, error);
+
+                logger->warn("Failed to write SPIR-V cache entry {}", path.string());
+
+                std::scoped_lock lock(mutex);
+                ++statistics.storeFailures;
+                return;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporaryPath, path, error);
+
+        std::scoped_lock lock(mutex);
+
+        if (error)
+        {
+            std::filesystem::remove(temporaryPath, error);
+            ++statistics.storeFailures;
+            return;
+        }
+
+        statistics.residentBytes += byteCount;
+
+        if (statistics.residentBytes > statistics.byteBudget)
+            TrimLocked();
+    }
+
+    void SpirvCache::TrimLocked()
+    {
+        struct CacheFile
+        {
+            std::filesystem::path path;
+            std::filesystem::file_time_type modified;
+            size_t size;
+        };
+
+        std::vector<CacheFile> files;
+        size_t residentBytes = 0;
+        std::error_code error;
+
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+        {
+            if (!entry.is_regular_file(error))
+                continue;
+
+            if (entry.path().extension() == TEMPORARY_EXTENSION)
+            {
+                if (std::filesystem::file_time_type::clock::now() - entry.last_write_time(error) > std::chrono::minutes(10))
+                    std::filesystem::remove(entry.path(), error);
+
+                continue;
+            }
+
+            if (entry.path().extension() != FILE_EXTENSION)
+                continue;
+
+            const auto size = static_cast<size_t>(entry.file_size(error));
+            files.push_back(CacheFile { entry.path(), entry.last_write_time(error), size });
+            residentBytes += size;
+        }
+
+        if (residentBytes > statistics.byteBudget)
+        {
+            std::ranges::sort(files, {}, &CacheFile::modified);
+
+            for (const auto& file : files)
+            {
+                if (residentBytes <= statistics.byteBudget)
+                    break;
+
+                if (!std::filesystem::remove(file.path, error))
+                    continue;
+
+                residentBytes -= file.size;
+                ++statistics.evictions;
+            }
+        }
+
+        statistics.residentBytes = residentBytes;
+    }
+
+    std::filesystem::path SpirvCache::GetEntryPath(const std::string& key) const
+    {
+        return directory / (key + std::string(FILE_EXTENSION));
+    }
+}
@@ -89,6 +89,8 @@ namespace RenderStar::Client::Render::Vulkan
                 return VulkanBufferType::UNIFORM;
             case BufferType::STORAGE:
                 return VulkanBufferType::STORAGE;
+            case BufferType::INDIRECT:
+                return VulkanBufferType::INDIRECT;
         }
 
         return VulkanBufferType::VERTEX;
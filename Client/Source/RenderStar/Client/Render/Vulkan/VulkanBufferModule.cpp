@@ -162,6 +162,8 @@ namespace RenderStar::Client::Render::Vulkan
                 return VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
             case VulkanBufferType::STORAGE:
                 return VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            case VulkanBufferType::INDIRECT:
+                return VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
         }
 
         return 0;
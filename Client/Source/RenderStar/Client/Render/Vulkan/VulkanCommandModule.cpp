@@ -1,10 +1,10 @@
 #include "RenderStar/Client/Render/Vulkan/VulkanCommandModule.hpp"
-#include <array>
 
 namespace RenderStar::Client::Render::Vulkan
 {
     VulkanCommandModule::VulkanCommandModule()
         : logger(spdlog::default_logger())
+        , workerDevice(VK_NULL_HANDLE)
         , commandPool(VK_NULL_HANDLE)
         , currentCommandBuffer(VK_NULL_HANDLE)
     {
@@ -53,9 +53,83 @@ namespace RenderStar::Client::Render::Vulkan
         logger->info("Allocated {} command buffers", count);
     }
 
+    void VulkanCommandModule::CreateWorkerCommandPools(VkDevice device, uint32_t graphicsQueueFamily, uint32_t workers, uint32_t frameCount)
+    {
+        workerDevice = device;
+        workerCount = workers;
+        workerPools.resize(static_cast<size_t>(workers) * frameCount);
+
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        poolInfo.queueFamilyIndex = graphicsQueueFamily;
+
+        for (auto& workerPool : workerPools)
+        {
+            VkResult result = vkCreateCommandPool(device, &poolInfo, nullptr, &workerPool.pool);
+
+            if (result != VK_SUCCESS)
+            {
+                logger->error("Failed to create worker command pool: {}", static_cast<int>(result));
+                workerPool.pool = VK_NULL_HANDLE;
+            }
+        }
+
+        logger->info("Created {} worker command pools for {} frames", workers, frameCount);
+    }
+
+    void VulkanCommandModule::ResetWorkerCommandPools(uint32_t frame)
+    {
+        for (uint32_t worker = 0; worker < workerCount; ++worker)
+        {
+            auto& workerPool = workerPools[static_cast<size_t>(frame) * workerCount + worker];
+
+            if (workerPool.pool == VK_NULL_HANDLE || workerPool.used == 0)
+                continue;
+
+            vkResetCommandPool(workerDevice, workerPool.pool, 0);
+            workerPool.used = 0;
+        }
+    }
+
+    VkCommandBuffer VulkanCommandModule::AcquireSecondaryCommandBuffer(uint32_t frame, uint32_t worker)
+    {
+        if (worker >= workerCount)
+            return VK_NULL_HANDLE;
+
+        auto& workerPool = workerPools[static_cast<size_t>(frame) * workerCount + worker];
+
+        if (workerPool.pool == VK_NULL_HANDLE)
+            return VK_NULL_HANDLE;
+
+        if (workerPool.used == workerPool.buffers.size())
+        {
+            VkCommandBufferAllocateInfo allocInfo{};
+            allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.commandPool = workerPool.pool;
+            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            allocInfo.commandBufferCount = 1;
+
+            VkCommandBuffer buffer = VK_NULL_HANDLE;
+            VkResult result = vkAllocateCommandBuffers(workerDevice, &allocInfo, &buffer);
+
+            if (result != VK_SUCCESS)
+            {
+                logger->error("Failed to allocate secondary command buffer: {}", static_cast<int>(result));
+                return VK_NULL_HANDLE;
+            }
+
+            workerPool.buffers.push_back(buffer);
+        }
+
+        return workerPool.buffers[workerPool.used++];
+    }
+
     void VulkanCommandModule::BeginRecording(VkCommandBuffer commandBuffer)
     {
         currentCommandBuffer = commandBuffer;
+        renderPassActive = false;
+        renderPassRecorded = false;
 
         VkCommandBufferBeginInfo beginInfo{};
         beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -74,12 +148,11 @@ namespace RenderStar::Client::Render::Vulkan
         VkClearColorValue clearColor
     )
     {
-        std::array<VkClearValue, 3> clearValues{};
         clearValues[0].color = clearColor;
         clearValues[1].depthStencil = { 1.0f, 0 };
         clearValues[2].color = { { 0.0f, 0.0f, 0.0f, 1.0f } };
 
-        VkRenderPassBeginInfo renderPassInfo{};
+        renderPassInfo = {};
         renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
         renderPassInfo.renderPass = renderPass;
         renderPassInfo.framebuffer = framebuffer;
@@ -88,31 +161,81 @@ namespace RenderStar::Client::Render::Vulkan
         renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
         renderPassInfo.pClearValues = clearValues.data();
 
-        vkCmdBeginRenderPass(currentCommandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
-        renderPassActive = true;
-
-        VkViewport viewport{};
         viewport.x = 0.0f;
         viewport.y = static_cast<float>(height);
         viewport.width = static_cast<float>(width);
         viewport.height = -static_cast<float>(height);
         viewport.minDepth = 0.0f;
         viewport.maxDepth = 1.0f;
-        vkCmdSetViewport(currentCommandBuffer, 0, 1, &viewport);
 
-        VkRect2D scissor{};
         scissor.offset = { 0, 0 };
         scissor.extent = { static_cast<uint32_t>(width), static_cast<uint32_t>(height) };
+
+        renderPassActive = true;
+        renderPassRecorded = false;
+    }
+
+    void VulkanCommandModule::RecordRenderPassBegin(VkSubpassContents contents)
+    {
+        vkCmdBeginRenderPass(currentCommandBuffer, &renderPassInfo, contents);
+        renderPassContents = contents;
+        renderPassRecorded = true;
+
+        // Secondary buffers set their own dynamic state
+        if (contents != VK_SUBPASS_CONTENTS_INLINE)
+            return;
+
+        vkCmdSetViewport(currentCommandBuffer, 0, 1, &viewport);
         vkCmdSetScissor(currentCommandBuffer, 0, 1, &scissor);
     }
 
+    VkSubpassContents VulkanCommandModule::ResolveRenderPassContents(VkSubpassContents preferred)
+    {
+        if (!renderPassActive)
+            return VK_SUBPASS_CONTENTS_INLINE;
+
+        if (!renderPassRecorded)
+            RecordRenderPassBegin(preferred);
+
+        return renderPassContents;
+    }
+
+    VkCommandBuffer VulkanCommandModule::GetInlineCommandBuffer()
+    {
+        if (ResolveRenderPassContents(VK_SUBPASS_CONTENTS_INLINE) != VK_SUBPASS_CONTENTS_INLINE)
+            logger->error("Inline command recorded into a render pass that expects secondary command buffers");
+
+        return currentCommandBuffer;
+    }
+
+    void VulkanCommandModule::SetViewport(const VkViewport& newViewport)
+    {
+        viewport = newViewport;
+
+        if (renderPassActive && renderPassRecorded && renderPassContents == VK_SUBPASS_CONTENTS_INLINE)
+            vkCmdSetViewport(currentCommandBuffer, 0, 1, &viewport);
+    }
+
+    void VulkanCommandModule::SetScissor(const VkRect2D& newScissor)
+    {
+        scissor = newScissor;
+
+        if (renderPassActive && renderPassRecorded && renderPassContents == VK_SUBPASS_CONTENTS_INLINE)
+            vkCmdSetScissor(currentCommandBuffer, 0, 1, &scissor);
+    }
+
     void VulkanCommandModule::EndRenderPass()
     {
         if (!renderPassActive)
             return;
 
+        // A pass nothing drew into still has to run for its clears
+        if (!renderPassRecorded)
+            RecordRenderPassBegin(VK_SUBPASS_CONTENTS_INLINE);
+
         vkCmdEndRenderPass(currentCommandBuffer);
         renderPassActive = false;
+        renderPassRecorded = false;
     }
 
     bool VulkanCommandModule::IsRenderPassActive() const
@@ -120,6 +243,26 @@ namespace RenderStar::Client::Render::Vulkan
         return renderPassActive;
     }
 
+    VkRenderPass VulkanCommandModule::GetActiveRenderPass() const
+    {
+        return renderPassActive ? renderPassInfo.renderPass : VK_NULL_HANDLE;
+    }
+
+    VkFramebuffer VulkanCommandModule::GetActiveFramebuffer() const
+    {
+        return renderPassActive ? renderPassInfo.framebuffer : VK_NULL_HANDLE;
+    }
+
+    const VkViewport& VulkanCommandModule::GetActiveViewport() const
+    {
+        return viewport;
+    }
+
+    const VkRect2D& VulkanCommandModule::GetActiveScissor() const
+    {
+        return scissor;
+    }
+
     void VulkanCommandModule::EndRecording()
     {
         VkResult result = vkEndCommandBuffer(currentCommandBuffer);
@@ -134,6 +277,16 @@ namespace RenderStar::Client::Render::Vulkan
     {
         commandBuffers.clear();
 
+        for (auto& workerPool : workerPools)
+        {
+            if (workerPool.pool != VK_NULL_HANDLE)
+                vkDestroyCommandPool(device, workerPool.pool, nullptr);
+        }
+
+        workerPools.clear();
+        workerCount = 0;
+        workerDevice = VK_NULL_HANDLE;
+
         if (commandPool != VK_NULL_HANDLE)
         {
             vkDestroyCommandPool(device, commandPool, nullptr);
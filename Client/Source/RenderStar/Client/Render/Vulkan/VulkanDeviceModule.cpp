@@ -14,6 +14,7 @@ namespace RenderStar::Client::Render::Vulkan
         , graphicsQueueFamily(0)
         , presentQueueFamily(0)
         , surface(VK_NULL_HANDLE)
+        , multiDrawIndirect(false)
     {
     }
 
@@ -149,8 +150,13 @@ namespace RenderStar::Client::Render::Vulkan
             queueCreateInfos.push_back(queueCreateInfo);
         }
 
+        VkPhysicalDeviceFeatures supportedFeatures{};
+        vkGetPhysicalDeviceFeatures(physicalDevice, &supportedFeatures);
+
         VkPhysicalDeviceFeatures deviceFeatures{};
         deviceFeatures.samplerAnisotropy = VK_TRUE;
+        deviceFeatures.textureCompressionBC = supportedFeatures.textureCompressionBC;
+        deviceFeatures.multiDrawIndirect = supportedFeatures.multiDrawIndirect;
 
         VkDeviceCreateInfo createInfo{};
         createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -178,6 +184,8 @@ namespace RenderStar::Client::Render::Vulkan
             return;
         }
 
+        multiDrawIndirect = supportedFeatures.multiDrawIndirect == VK_TRUE;
+
         vkGetDeviceQueue(device, graphicsQueueFamily, 0, &graphicsQueue);
         vkGetDeviceQueue(device, presentQueueFamily, 0, &presentQueue);
 
@@ -213,4 +221,9 @@ namespace RenderStar::Client::Render::Vulkan
     {
         return presentQueueFamily;
     }
+
+    bool VulkanDeviceModule::SupportsMultiDrawIndirect() const
+    {
+        return multiDrawIndirect;
+    }
 }
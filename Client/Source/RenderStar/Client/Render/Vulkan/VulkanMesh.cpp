@@ -139,6 +139,21 @@ namespace RenderStar::Client::Render::Vulkan
     }
 
     void VulkanMesh::RecordDrawCommands(VkCommandBuffer commandBuffer)
+    {
+        BindBuffers(commandBuffer);
+        RecordBoundDrawCommands(commandBuffer);
+    }
+
+    void VulkanMesh::RecordDrawRangeCommands(VkCommandBuffer commandBuffer, uint32_t firstIndex, uint32_t count)
+    {
+        if (released || !hasIndices || count == 0 || firstIndex + count > static_cast<uint32_t>(indexCount))
+            return;
+
+        BindBuffers(commandBuffer);
+        RecordBoundDrawRangeCommands(commandBuffer, firstIndex, count);
+    }
+
+    void VulkanMesh::BindBuffers(VkCommandBuffer commandBuffer)
     {
         if (released)
             return;
@@ -149,13 +164,25 @@ namespace RenderStar::Client::Render::Vulkan
         vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
 
         if (hasIndices)
-        {
             vkCmdBindIndexBuffer(commandBuffer, indexBuffer.buffer, 0, GetVulkanIndexType());
+    }
+
+    void VulkanMesh::RecordBoundDrawCommands(VkCommandBuffer commandBuffer)
+    {
+        if (released)
+            return;
+
+        if (hasIndices)
             vkCmdDrawIndexed(commandBuffer, static_cast<uint32_t>(indexCount), 1, 0, 0, 0);
-        }
         else
-        {
             vkCmdDraw(commandBuffer, static_cast<uint32_t>(vertexCount), 1, 0, 0);
-        }
+    }
+
+    void VulkanMesh::RecordBoundDrawRangeCommands(VkCommandBuffer commandBuffer, uint32_t firstIndex, uint32_t count)
+    {
+        if (released || !hasIndices || count == 0 || firstIndex + count > static_cast<uint32_t>(indexCount))
+            return;
+
+        vkCmdDrawIndexed(commandBuffer, count, 1, firstIndex, 0, 0);
     }
 }
@@ -174,10 +174,7 @@ namespace RenderStar::Client::Render::Vulkan
     {
         VkRenderPass renderPass = target ? GetRenderPassForTarget(target) : backend->GetSwapchainRenderPass();
 
-        VulkanShader vertexShader = shaderModule->LoadShaderFromGlsl(
-            vertexGlsl, VulkanShaderStage::VERTEX, "platform_vertex");
-        VulkanShader fragmentShader = shaderModule->LoadShaderFromGlsl(
-            fragmentGlsl, VulkanShaderStage::FRAGMENT, "platform_fragment");
+        auto [vertexShader, fragmentShader] = shaderModule->LoadShaderPairFromGlsl(vertexGlsl, fragmentGlsl, "platform");
 
         if (vertexShader.module == VK_NULL_HANDLE || fragmentShader.module == VK_NULL_HANDLE)
         {
@@ -330,11 +327,57 @@ namespace RenderStar::Client::Render::Vulkan
                 attachment->GetSampler());
         }
 
+        // The stage begins its own target next anyway; binding outside the previous pass stays valid
+        // even when that pass recorded secondary command buffers
+        commandModule->EndRenderPass();
+
         auto* vulkanShader = static_cast<VulkanShaderProgram*>(shader);
-        VkCommandBuffer cmd = commandModule->GetCurrentCommandBuffer();
+        VkCommandBuffer cmd = commandModule->GetInlineCommandBuffer();
         vulkanShader->BindDescriptorSet(cmd, descriptorSet);
     }
 
+    void VulkanPlatformBackend::InsertBarriers(const std::span<const Platform::RenderGraphBarrier> barriers)
+    {
+        if (barriers.empty())
+            return;
+
+        VkPipelineStageFlags sourceStages = 0;
+        VkPipelineStageFlags destinationStages = 0;
+        VkMemoryBarrier memoryBarrier{};
+        memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+
+        // Render passes move the images between layouts themselves, so one global memory barrier covering
+        // every hazard of the step is enough
+        for (const auto& barrier : barriers)
+        {
+            if (barrier.before == Platform::RenderGraphAccess::WRITE)
+            {
+                sourceStages |= VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+                memoryBarrier.srcAccessMask |= VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+            }
+            else if (barrier.before == Platform::RenderGraphAccess::READ)
+                sourceStages |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+
+            if (barrier.after == Platform::RenderGraphAccess::READ)
+            {
+                destinationStages |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+                memoryBarrier.dstAccessMask |= VK_ACCESS_SHADER_READ_BIT;
+            }
+            else if (barrier.after == Platform::RenderGraphAccess::WRITE)
+            {
+                destinationStages |= VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+                memoryBarrier.dstAccessMask |= VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+            }
+        }
+
+        if (sourceStages == 0 || destinationStages == 0)
+            return;
+
+        commandModule->EndRenderPass();
+
+        vkCmdPipelineBarrier(commandModule->GetInlineCommandBuffer(), sourceStages, destinationStages, 0, 1, &memoryBarrier, 0, nullptr, 0, nullptr);
+    }
+
     void VulkanPlatformBackend::BeginRenderTarget(Platform::IRenderTarget* target, bool clear)
     {
         commandModule->EndRenderPass();
@@ -363,8 +406,7 @@ namespace RenderStar::Client::Render::Vulkan
             viewport.minDepth = 0.0f;
             viewport.maxDepth = 1.0f;
 
-            VkCommandBuffer cmd = commandModule->GetCurrentCommandBuffer();
-            vkCmdSetViewport(cmd, 0, 1, &viewport);
+            commandModule->SetViewport(viewport);
         }
     }
 
@@ -1,6 +1,7 @@
 #include "RenderStar/Client/Render/Vulkan/VulkanRenderBackend.hpp"
 #include "RenderStar/Client/Render/Vulkan/VulkanShaderProgram.hpp"
 #include "RenderStar/Client/Render/Vulkan/VulkanMesh.hpp"
+#include "RenderStar/Client/Render/Vulkan/VulkanBufferHandle.hpp"
 #include "RenderStar/Client/Render/Vulkan/VulkanUniformBinding.hpp"
 #include "RenderStar/Client/Render/Resource/IShaderProgram.hpp"
 #include "RenderStar/Client/Render/Resource/IUniformBindingHandle.hpp"
@@ -13,6 +14,139 @@
 
 namespace RenderStar::Client::Render::Vulkan
 {
+    namespace
+    {
+        void RecordDrawCommand(VkCommandBuffer commandBuffer, const VulkanDrawCommand& cmd, DrawStateTracker& state, const VkRect2D& fullScissor)
+        {
+            if (cmd.type == VulkanDrawCommand::Type::SetScissor)
+            {
+                VkRect2D scissor{};
+                scissor.offset = { cmd.scissorX, cmd.scissorY };
+                scissor.extent = { cmd.scissorW, cmd.scissorH };
+                vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+                return;
+            }
+
+            if (cmd.type == VulkanDrawCommand::Type::ClearScissor)
+            {
+                vkCmdSetScissor(commandBuffer, 0, 1, &fullScissor);
+                return;
+            }
+
+            VulkanShaderProgram* vulkanShader = cmd.shader;
+            VulkanMesh* vulkanMesh = cmd.mesh;
+            const VulkanUniformBinding* vulkanBinding = cmd.uniformBinding;
+
+            if (vulkanShader && state.SetPipeline(vulkanShader))
+                vulkanShader->BindPipeline(commandBuffer);
+
+            if (vulkanShader && vulkanBinding && cmd.frameIndex >= 0 && cmd.frameIndex < vulkanBinding->GetFrameCount()
+                && state.SetBinding(vulkanBinding, cmd.frameIndex))
+            {
+                VkDescriptorSet descriptorSet = vulkanBinding->GetDescriptorSets()[cmd.frameIndex];
+                vulkanShader->BindDescriptorSet(commandBuffer, descriptorSet);
+            }
+
+            if (vulkanMesh && vulkanMesh->IsValid())
+            {
+                if (state.SetGeometry(vulkanMesh))
+                    vulkanMesh->BindBuffers(commandBuffer);
+
+                if (cmd.type == VulkanDrawCommand::Type::DrawIndirect)
+                    vkCmdDrawIndexedIndirect(commandBuffer, cmd.argumentBuffer, cmd.argumentOffset, cmd.commandCount, sizeof(DrawIndexedIndirectCommand));
+                else if (cmd.indexCount > 0)
+                    vulkanMesh->RecordBoundDrawRangeCommands(commandBuffer, cmd.firstIndex, cmd.indexCount);
+                else
+                    vulkanMesh->RecordBoundDrawCommands(commandBuffer);
+            }
+            else if (!vulkanMesh && vulkanShader)
+            {
+                vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+            }
+        }
+
+        // Records each chunk into a secondary buffer from its worker's pool, then executes them from the primary
+        class SecondaryDrawRecorder final : public ICommandChunkRecorder
+        {
+        public:
+
+            SecondaryDrawRecorder(VulkanCommandModule& commandModule, const std::span<const VulkanDrawCommand> commands,
+                                  const std::span<const VkRect2D> chunkScissors, const uint32_t frame, const VkRect2D& fullScissor)
+                : commandModule(commandModule)
+                , commands(commands)
+                , chunkScissors(chunkScissors)
+                , frame(frame)
+                , fullScissor(fullScissor)
+                , renderPass(commandModule.GetActiveRenderPass())
+                , framebuffer(commandModule.GetActiveFramebuffer())
+                , viewport(commandModule.GetActiveViewport())
+                , chunkBuffers(chunkScissors.size(), VK_NULL_HANDLE)
+            {
+            }
+
+            void RecordChunk(const CommandChunk& chunk, const uint32_t chunkIndex, const std::span<const uint32_t> order) override
+            {
+                VkCommandBuffer commandBuffer = commandModule.AcquireSecondaryCommandBuffer(frame, chunk.worker);
+
+                if (commandBuffer == VK_NULL_HANDLE)
+                    return;
+
+                VkCommandBufferInheritanceInfo inheritanceInfo{};
+                inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+                inheritanceInfo.renderPass = renderPass;
+                inheritanceInfo.subpass = 0;
+                inheritanceInfo.framebuffer = framebuffer;
+
+                VkCommandBufferBeginInfo beginInfo{};
+                beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+                beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+                beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+                if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS)
+                    return;
+
+                // Dynamic state is not inherited, so every chunk starts from the scissor its predecessor left
+                vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+                vkCmdSetScissor(commandBuffer, 0, 1, &chunkScissors[chunkIndex]);
+
+                DrawStateTracker state;
+
+                for (const uint32_t index : order)
+                    RecordDrawCommand(commandBuffer, commands[index], state, fullScissor);
+
+                if (vkEndCommandBuffer(commandBuffer) == VK_SUCCESS)
+                    chunkBuffers[chunkIndex] = commandBuffer;
+            }
+
+            void ExecuteChunks(const std::span<const CommandChunk> chunks) override
+            {
+                std::vector<VkCommandBuffer> recorded;
+                recorded.reserve(chunks.size());
+
+                for (uint32_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex)
+                {
+                    if (chunkBuffers[chunkIndex] != VK_NULL_HANDLE)
+                        recorded.push_back(chunkBuffers[chunkIndex]);
+                }
+
+                if (!recorded.empty())
+                    vkCmdExecuteCommands(commandModule.GetCurrentCommandBuffer(), static_cast<uint32_t>(recorded.size()), recorded.data());
+            }
+
+        private:
+
+            VulkanCommandModule& commandModule;
+            std::span<const VulkanDrawCommand> commands;
+            std::span<const VkRect2D> chunkScissors;
+            uint32_t frame;
+            VkRect2D fullScissor;
+            VkRenderPass renderPass;
+            VkFramebuffer framebuffer;
+            VkViewport viewport;
+            std::vector<VkCommandBuffer> chunkBuffers;
+        };
+    }
+
     VulkanRenderBackend::VulkanRenderBackend() : logger(spdlog::default_logger()), window(nullptr), width(0), height(0), currentFrame(0), currentImageIndex(0), initialized(false), framebufferResized(false), capabilities(BackendCapabilities::ForVulkan()), depthImage(VK_NULL_HANDLE), depthImageMemory(VK_NULL_HANDLE), depthImageView(VK_NULL_HANDLE) { }
 
     VulkanRenderBackend::~VulkanRenderBackend()
@@ -46,6 +180,7 @@ namespace RenderStar::Client::Render::Vulkan
         instanceModule.Create(enableValidation);
         surfaceModule.Create(instanceModule.GetInstance(), window);
         deviceModule.Create(instanceModule.GetInstance(), surfaceModule.GetSurface(), enableValidation);
+        capabilities.supportsMultiDrawIndirect = deviceModule.SupportsMultiDrawIndirect();
 
         memoryModule.Create(
             instanceModule.GetInstance(),
@@ -70,6 +205,7 @@ namespace RenderStar::Client::Render::Vulkan
 
         commandModule.CreateCommandPool(deviceModule.GetDevice(), deviceModule.GetGraphicsQueueFamily());
         commandModule.AllocateCommandBuffers(deviceModule.GetDevice(), MAX_FRAMES_IN_FLIGHT);
+        commandModule.CreateWorkerCommandPools(deviceModule.GetDevice(), deviceModule.GetGraphicsQueueFamily(), commandRecorder.GetWorkerCount(), MAX_FRAMES_IN_FLIGHT);
 
         syncModule.Create(deviceModule.GetDevice());
 
@@ -180,6 +316,8 @@ namespace RenderStar::Client::Render::Vulkan
 
         VkCommandBuffer commandBuffer = commandModule.GetCommandBuffer(currentFrame);
         vkResetCommandBuffer(commandBuffer, 0);
+        commandModule.ResetWorkerCommandPools(static_cast<uint32_t>(currentFrame));
+        commandRecorder.ResetStatistics();
 
         commandModule.BeginRecording(commandBuffer);
         commandModule.BeginRenderPass(
@@ -358,15 +496,56 @@ namespace RenderStar::Client::Render::Vulkan
         return commandQueue.get();
     }
 
-    void VulkanRenderBackend::SubmitDrawCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, int32_t frameIndex, IMesh* mesh)
+    VulkanDrawCommand VulkanRenderBackend::ResolveDrawCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, int32_t frameIndex, IMesh* mesh, uint32_t firstIndex, uint32_t indexCount)
     {
         VulkanDrawCommand cmd;
         cmd.type = VulkanDrawCommand::Type::Draw;
-        cmd.shader = shader;
-        cmd.uniformBinding = uniformBinding;
+        cmd.shader = dynamic_cast<VulkanShaderProgram*>(shader);
+        cmd.uniformBinding = dynamic_cast<const VulkanUniformBinding*>(uniformBinding);
         cmd.frameIndex = frameIndex;
-        cmd.mesh = mesh;
-        drawCommands.push_back(cmd);
+        cmd.mesh = dynamic_cast<VulkanMesh*>(mesh);
+        cmd.firstIndex = firstIndex;
+        cmd.indexCount = indexCount;
+        return cmd;
+    }
+
+    void VulkanRenderBackend::SubmitDrawCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, int32_t frameIndex, IMesh* mesh)
+    {
+        drawCommands.AddOrdered(ResolveDrawCommand(shader, uniformBinding, frameIndex, mesh, 0, 0));
+    }
+
+    void VulkanRenderBackend::SubmitDrawRangeCommand(IShaderProgram* shader, IUniformBindingHandle* uniformBinding, int32_t frameIndex, IMesh* mesh, uint32_t firstIndex, uint32_t indexCount)
+    {
+        drawCommands.AddOrdered(ResolveDrawCommand(shader, uniformBinding, frameIndex, mesh, firstIndex, indexCount));
+    }
+
+    void VulkanRenderBackend::SubmitSortedDrawCommand(const SortedDrawSubmission& submission)
+    {
+        const VulkanDrawCommand cmd = ResolveDrawCommand(submission.shader, submission.uniformBinding, submission.frameIndex,
+            submission.mesh, submission.firstIndex, submission.indexCount);
+
+        drawCommands.AddSorted(cmd, cmd.shader, submission.materialKey, submission.depth);
+    }
+
+    void VulkanRenderBackend::SubmitIndirectDrawCommand(const IndirectDrawSubmission& submission)
+    {
+        const auto* argumentBuffer = dynamic_cast<VulkanBufferHandle*>(submission.argumentBuffer);
+
+        if (!argumentBuffer || submission.commandCount == 0)
+            return;
+
+        VulkanDrawCommand cmd = ResolveDrawCommand(submission.shader, submission.uniformBinding, submission.frameIndex, submission.mesh, 0, 0);
+
+        // Without a mesh the recorder would take this for a fullscreen pass
+        if (!cmd.mesh || !cmd.mesh->HasIndices())
+            return;
+
+        cmd.type = VulkanDrawCommand::Type::DrawIndirect;
+        cmd.argumentBuffer = argumentBuffer->GetBuffer().buffer;
+        cmd.argumentOffset = static_cast<VkDeviceSize>(submission.firstCommand) * sizeof(DrawIndexedIndirectCommand);
+        cmd.commandCount = submission.commandCount;
+
+        drawCommands.AddSorted(cmd, cmd.shader, submission.materialKey, 0.0f);
     }
 
     void VulkanRenderBackend::BeginOverlayPass()
@@ -388,20 +567,18 @@ namespace RenderStar::Client::Render::Vulkan
 
     void VulkanRenderBackend::SetScissorRect(int32_t x, int32_t y, uint32_t w, uint32_t h)
     {
-        VkCommandBuffer commandBuffer = commandModule.GetCommandBuffer(currentFrame);
         VkRect2D scissor{};
         scissor.offset = { x, y };
         scissor.extent = { w, h };
-        vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+        commandModule.SetScissor(scissor);
     }
 
     void VulkanRenderBackend::ClearScissorRect()
     {
-        VkCommandBuffer commandBuffer = commandModule.GetCommandBuffer(currentFrame);
         VkRect2D scissor{};
         scissor.offset = { 0, 0 };
         scissor.extent = { width, height };
-        vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+        commandModule.SetScissor(scissor);
     }
 
     void VulkanRenderBackend::SubmitSetScissor(int32_t x, int32_t y, uint32_t w, uint32_t h)
@@ -412,60 +589,78 @@ namespace RenderStar::Client::Render::Vulkan
         cmd.scissorY = y;
         cmd.scissorW = w;
         cmd.scissorH = h;
-        drawCommands.push_back(cmd);
+        drawCommands.AddOrdered(cmd);
     }
 
     void VulkanRenderBackend::SubmitClearScissor()
     {
         VulkanDrawCommand cmd;
         cmd.type = VulkanDrawCommand::Type::ClearScissor;
-        drawCommands.push_back(cmd);
+        drawCommands.AddOrdered(cmd);
     }
 
     void VulkanRenderBackend::ExecuteDrawCommands()
     {
-        VkCommandBuffer commandBuffer = commandModule.GetCommandBuffer(currentFrame);
+        if (drawCommands.IsEmpty())
+            return;
 
-        for (const auto& cmd : drawCommands)
+        const auto commands = drawCommands.GetCommands();
+        const auto order = drawCommands.Sort();
+
+        // A render pass that has not started yet can still take secondary buffers; one that has keeps its mode
+        const VkSubpassContents preferred = order.size() >= PARALLEL_RECORDING_THRESHOLD && commandRecorder.GetWorkerCount() > 1
+            ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE;
+
+        if (commandModule.ResolveRenderPassContents(preferred) == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS)
         {
-            if (cmd.type == VulkanDrawCommand::Type::SetScissor)
-            {
-                VkRect2D scissor{};
-                scissor.offset = { cmd.scissorX, cmd.scissorY };
-                scissor.extent = { cmd.scissorW, cmd.scissorH };
-                vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
-                continue;
-            }
+            ExecuteDrawCommandsInSecondaries(commands, order);
+            drawCommands.Clear();
+            return;
+        }
 
-            if (cmd.type == VulkanDrawCommand::Type::ClearScissor)
-            {
-                VkRect2D scissor{};
-                scissor.offset = { 0, 0 };
-                scissor.extent = { width, height };
-                vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
-                continue;
-            }
+        VkCommandBuffer commandBuffer = commandModule.GetInlineCommandBuffer();
+        const VkRect2D fullScissor{ { 0, 0 }, { width, height } };
+        DrawStateTracker state;
 
-            auto* vulkanShader = dynamic_cast<VulkanShaderProgram*>(cmd.shader);
-            auto* vulkanMesh = dynamic_cast<VulkanMesh*>(cmd.mesh);
-            const auto* vulkanBinding = dynamic_cast<VulkanUniformBinding*>(cmd.uniformBinding);
+        for (const uint32_t index : order)
+            RecordDrawCommand(commandBuffer, commands[index], state, fullScissor);
 
-            if (vulkanShader)
-                vulkanShader->BindPipeline(commandBuffer);
+        drawCommands.Clear();
+    }
 
-            if (vulkanShader && vulkanBinding && cmd.frameIndex >= 0 && cmd.frameIndex < vulkanBinding->GetFrameCount())
-            {
-                VkDescriptorSet descriptorSet = vulkanBinding->GetDescriptorSets()[cmd.frameIndex];
-                vulkanShader->BindDescriptorSet(commandBuffer, descriptorSet);
-            }
+    void VulkanRenderBackend::ExecuteDrawCommandsInSecondaries(const std::span<const VulkanDrawCommand> commands, const std::span<const uint32_t> order)
+    {
+        const auto chunks = commandRecorder.Partition(static_cast<uint32_t>(order.size()));
+        const VkRect2D fullScissor{ { 0, 0 }, { width, height } };
 
-            if (vulkanMesh && vulkanMesh->IsValid())
-                vulkanMesh->RecordDrawCommands(commandBuffer);
-            else if (!vulkanMesh && vulkanShader)
-                vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+        // Scissor commands are the only state that crosses chunk boundaries; find each chunk's starting value
+        std::vector<VkRect2D> chunkScissors(chunks.size());
+        VkRect2D scissor = commandModule.GetActiveScissor();
+        size_t nextChunk = 0;
+
+        for (uint32_t position = 0; position < order.size(); ++position)
+        {
+            if (nextChunk < chunks.size() && position == chunks[nextChunk].first)
+                chunkScissors[nextChunk++] = scissor;
+
+            const VulkanDrawCommand& cmd = commands[order[position]];
+
+            if (cmd.type == VulkanDrawCommand::Type::SetScissor)
+                scissor = { { cmd.scissorX, cmd.scissorY }, { cmd.scissorW, cmd.scissorH } };
+            else if (cmd.type == VulkanDrawCommand::Type::ClearScissor)
+                scissor = fullScissor;
         }
 
-        drawCommands.clear();
+        SecondaryDrawRecorder recorder(commandModule, commands, chunkScissors, static_cast<uint32_t>(currentFrame), fullScissor);
+        commandRecorder.Record(chunks, order, recorder);
+
+        // Later batches in this pass start from wherever the last chunk left the scissor
+        commandModule.SetScissor(scissor);
+    }
+
+    std::span<const RecordingWorkerStatistics> VulkanRenderBackend::GetRecordingStatistics() const
+    {
+        return commandRecorder.GetStatistics();
     }
 
     VkDevice VulkanRenderBackend::GetDevice() const
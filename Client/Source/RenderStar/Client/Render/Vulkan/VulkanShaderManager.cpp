@@ -64,8 +64,7 @@ namespace RenderStar::Client::Render::Vulkan
     {
         auto program = std::make_unique<VulkanShaderProgram>();
 
-        VulkanShader vertexShader = shaderModule->LoadShaderFromGlsl(source.vertexSource, VulkanShaderStage::VERTEX, "vertex");
-        VulkanShader fragmentShader = shaderModule->LoadShaderFromGlsl(source.fragmentSource, VulkanShaderStage::FRAGMENT, "fragment");
+        auto [vertexShader, fragmentShader] = shaderModule->LoadShaderPairFromGlsl(source.vertexSource, source.fragmentSource, "source");
 
         VkDescriptorSetLayout layout = CreateDescriptorLayoutFromGlsl(source.vertexSource, source.fragmentSource);
 
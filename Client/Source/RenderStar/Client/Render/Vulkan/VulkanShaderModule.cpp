@@ -1,51 +1,14 @@
 #include "RenderStar/Client/Render/Vulkan/VulkanShaderModule.hpp"
+#include "RenderStar/Client/Render/Vulkan/GlslcSpirvCompiler.hpp"
+#include <array>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
-#include <cstdlib>
-#include <filesystem>
-#include <array>
-
-#ifdef _WIN32
-#include <windows.h>
-#endif
 
 namespace RenderStar::Client::Render::Vulkan
 {
-    namespace
-    {
-        int ExecuteCommandWithStatus(const std::string& command, std::string& output)
-        {
-#ifdef _WIN32
-            std::array<char, 4096> buffer;
-            output.clear();
-
-            FILE* pipe = _popen((command + " 2>&1").c_str(), "r");
-            if (!pipe)
-                return -1;
-
-            while (fgets(buffer.data(), static_cast<int>(buffer.size()), pipe) != nullptr)
-                output += buffer.data();
-
-            return _pclose(pipe);
-#else
-            std::array<char, 4096> buffer;
-            output.clear();
-
-            FILE* pipe = popen((command + " 2>&1").c_str(), "r");
-            if (!pipe)
-                return -1;
-
-            while (fgets(buffer.data(), static_cast<int>(buffer.size()), pipe) != nullptr)
-                output += buffer.data();
-
-            int status = pclose(pipe);
-            return WEXITSTATUS(status);
-#endif
-        }
-    }
-
-    VulkanShaderModule::VulkanShaderModule() : logger(spdlog::default_logger()->clone("VulkanShaderModule")), device(VK_NULL_HANDLE) { }
+    VulkanShaderModule::VulkanShaderModule() : logger(spdlog::default_logger()->clone("VulkanShaderModule")), device(VK_NULL_HANDLE),
+        spirvCache(std::make_unique<SpirvCache>(SpirvCache::GetDefaultDirectory(), std::make_unique<GlslcSpirvCompiler>())) { }
 
     VulkanShaderModule::~VulkanShaderModule()
     {
@@ -64,6 +27,12 @@ namespace RenderStar::Client::Render::Vulkan
             return;
 
         device = VK_NULL_HANDLE;
+
+        const auto statistics = spirvCache->GetStatistics();
+
+        logger->info("SPIR-V cache: {} hits, {} misses, {} evictions, {}/{} bytes in {}",
+            statistics.hits, statistics.misses, statistics.evictions, statistics.residentBytes, statistics.byteBudget, spirvCache->GetDirectory().string());
+
         logger->info("Vulkan shader module destroyed");
     }
 
@@ -92,6 +61,19 @@ namespace RenderStar::Client::Render::Vulkan
         return LoadShaderFromSpirv(spirv, stage);
     }
 
+    std::pair<VulkanShader, VulkanShader> VulkanShaderModule::LoadShaderPairFromGlsl(const std::string& vertexGlsl, const std::string& fragmentGlsl, const std::string& name)
+    {
+        const std::array jobs
+        {
+            SpirvCompileJob { vertexGlsl, VulkanShaderStage::VERTEX, name + ".vert" },
+            SpirvCompileJob { fragmentGlsl, VulkanShaderStage::FRAGMENT, name + ".frag" }
+        };
+
+        const auto spirv = spirvCache->GetOrCompileBatch(jobs);
+
+        return { LoadShaderFromSpirv(spirv[0], VulkanShaderStage::VERTEX), LoadShaderFromSpirv(spirv[1], VulkanShaderStage::FRAGMENT) };
+    }
+
     VulkanShader VulkanShaderModule::LoadShaderFromFile(const std::string& filePath, VulkanShaderStage stage)
     {
         std::ifstream file(filePath);
@@ -115,75 +97,9 @@ namespace RenderStar::Client::Render::Vulkan
         return LoadShaderFromGlsl(glslSource, stage, filePath);
     }
 
-    std::vector<uint32_t> VulkanShaderModule::CompileGlslToSpirv(const std::string& glslSource, VulkanShaderStage stage, const std::string& filename) const
+    std::vector<uint32_t> VulkanShaderModule::CompileGlslToSpirv(const std::string& glslSource, const VulkanShaderStage stage, const std::string& filename) const
     {
-        std::filesystem::path tempDir = std::filesystem::temp_directory_path();
-        std::filesystem::path inputPath = tempDir / ("shader_input_" + std::to_string(std::hash<std::string>{}(filename)) + ".glsl");
-        std::filesystem::path outputPath = tempDir / ("shader_output_" + std::to_string(std::hash<std::string>{}(filename)) + ".spv");
-
-        {
-            std::ofstream inputFile(inputPath);
-
-            if (!inputFile.is_open())
-            {
-                logger->error("Failed to create temporary shader file: {}", inputPath.string());
-                throw std::runtime_error("Failed to create temporary shader file");
-            }
-
-            inputFile << glslSource;
-        }
-
-        std::string stageFlag;
-
-        switch (stage)
-        {
-            case VulkanShaderStage::VERTEX:
-                stageFlag = "-fshader-stage=vertex";
-                break;
-            case VulkanShaderStage::FRAGMENT:
-                stageFlag = "-fshader-stage=fragment";
-                break;
-            case VulkanShaderStage::COMPUTE:
-                stageFlag = "-fshader-stage=compute";
-                break;
-        }
-
-        std::string command = "glslc " + stageFlag + " --target-env=vulkan1.3 -O \"" + inputPath.string() + "\" -o \"" + outputPath.string() + "\"";
-
-        std::string compileOutput;
-        int result = ExecuteCommandWithStatus(command, compileOutput);
-
-        std::filesystem::remove(inputPath);
-
-        if (result != 0)
-        {
-            std::filesystem::remove(outputPath);
-
-            logger->error("Shader compilation failed for {}: {}", filename, compileOutput);
-
-            throw std::runtime_error("Shader compilation failed: " + compileOutput);
-        }
-
-        std::ifstream spirvFile(outputPath, std::ios::ate | std::ios::binary);
-
-        if (!spirvFile.is_open())
-        {
-            logger->error("Failed to read compiled shader: {}", outputPath.string());
-            throw std::runtime_error("Failed to read compiled shader");
-        }
-
-        size_t fileSize = spirvFile.tellg();
-        std::vector<uint32_t> spirvCode(fileSize / sizeof(uint32_t));
-
-        spirvFile.seekg(0);
-        spirvFile.read(reinterpret_cast<char*>(spirvCode.data()), static_cast<long long>(fileSize));
-        spirvFile.close();
-
-        std::filesystem::remove(outputPath);
-
-        logger->info("Compiled GLSL to SPIR-V using glslc: {}", filename);
-
-        return spirvCode;
+        return spirvCache->GetOrCompile(SpirvCompileJob { glslSource, stage, filename });
     }
 
     void VulkanShaderModule::DestroyShader(VulkanShader& shader) const
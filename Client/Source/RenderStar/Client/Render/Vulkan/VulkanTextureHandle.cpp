@@ -77,6 +77,11 @@ namespace RenderStar::Client::Render::Vulkan
         return !released && image != VK_NULL_HANDLE && imageView != VK_NULL_HANDLE && sampler != VK_NULL_HANDLE;
     }
 
+    VkImage VulkanTextureHandle::GetImage() const
+    {
+        return image;
+    }
+
     VkImageView VulkanTextureHandle::GetImageView() const
     {
         return imageView;
@@ -5,6 +5,7 @@
 #include <cmath>
 #include <cstring>
 #include <stdexcept>
+#include <vector>
 
 namespace RenderStar::Client::Render::Vulkan
 {
@@ -63,11 +64,32 @@ namespace RenderStar::Client::Render::Vulkan
     {
         uint32_t w = description.width;
         uint32_t h = description.height;
-        VkDeviceSize imageSize = static_cast<VkDeviceSize>(w) * h * 4;
+        bool compressed = description.IsCompressed();
 
-        uint32_t mipLevels = description.generateMipmaps
-            ? static_cast<uint32_t>(std::floor(std::log2(std::max(w, h)))) + 1
-            : 1;
+        if (compressed && !SupportsFormat(description.format))
+        {
+            logger->error("Compressed texture format {} is not supported", static_cast<int>(description.format));
+            return nullptr;
+        }
+
+        uint32_t mipLevels = 1;
+
+        if (compressed)
+            mipLevels = std::max(1u, description.mipLevels);
+        else if (description.generateMipmaps)
+            mipLevels = static_cast<uint32_t>(std::floor(std::log2(std::max(w, h)))) + 1;
+
+        VkDeviceSize imageSize = 0;
+
+        if (compressed)
+        {
+            for (uint32_t level = 0; level < mipLevels; ++level)
+                imageSize += description.GetLevelSize(level);
+        }
+        else
+            imageSize = static_cast<VkDeviceSize>(w) * h * 4;
+
+        VkFormat format = ToVulkanFormat(description.format);
 
         VkBufferCreateInfo bufferInfo{};
         bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -101,7 +123,7 @@ namespace RenderStar::Client::Render::Vulkan
         imageInfo.extent.depth = 1;
         imageInfo.mipLevels = mipLevels;
         imageInfo.arrayLayers = 1;
-        imageInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+        imageInfo.format = format;
         imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
         imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
         imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
@@ -122,12 +144,21 @@ namespace RenderStar::Client::Render::Vulkan
         }
 
         TransitionImageLayout(image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipLevels);
-        CopyBufferToImage(stagingBuffer, image, w, h);
 
-        if (mipLevels > 1)
-            GenerateMipmaps(image, w, h, mipLevels);
+        if (compressed)
+        {
+            CopyLevelsToImage(stagingBuffer, image, description, mipLevels);
+            TransitionImageLayout(image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, mipLevels);
+        }
         else
-            TransitionImageLayout(image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 1);
+        {
+            CopyBufferToImage(stagingBuffer, image, w, h);
+
+            if (mipLevels > 1)
+                GenerateMipmaps(image, w, h, mipLevels);
+            else
+                TransitionImageLayout(image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 1);
+        }
 
         vmaDestroyBuffer(allocator, stagingBuffer, stagingAllocation);
 
@@ -135,7 +166,7 @@ namespace RenderStar::Client::Render::Vulkan
         viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
         viewInfo.image = image;
         viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
-        viewInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+        viewInfo.format = format;
         viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         viewInfo.subresourceRange.baseMipLevel = 0;
         viewInfo.subresourceRange.levelCount = mipLevels;
@@ -185,6 +216,58 @@ namespace RenderStar::Client::Render::Vulkan
         return std::make_unique<VulkanTextureHandle>(device, allocator, image, imageAllocation, imageView, sampler, w, h, *resourceManager);
     }
 
+    bool VulkanTextureManager::UpdateRegion(ITextureHandle& texture, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* pixels)
+    {
+        auto* vulkanTexture = dynamic_cast<VulkanTextureHandle*>(&texture);
+
+        if (!vulkanTexture || !vulkanTexture->IsValid() || width == 0 || height == 0 ||
+            x + width > vulkanTexture->GetWidth() || y + height > vulkanTexture->GetHeight())
+            return false;
+
+        VkDeviceSize regionSize = static_cast<VkDeviceSize>(width) * height * 4;
+
+        VkBufferCreateInfo bufferInfo{};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = regionSize;
+        bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        VmaAllocationCreateInfo stagingAllocInfo{};
+        stagingAllocInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_HOST;
+        stagingAllocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT;
+
+        VkBuffer stagingBuffer;
+        VmaAllocation stagingAllocation;
+
+        if (vmaCreateBuffer(allocator, &bufferInfo, &stagingAllocInfo, &stagingBuffer, &stagingAllocation, nullptr) != VK_SUCCESS)
+        {
+            logger->error("Failed to create staging buffer for texture region update");
+            return false;
+        }
+
+        void* mapped;
+        vmaMapMemory(allocator, stagingAllocation, &mapped);
+        std::memcpy(mapped, pixels, regionSize);
+        vmaUnmapMemory(allocator, stagingAllocation);
+
+        // The single-time submits wait for the queue, so frames still sampling the image have finished
+        VkImage image = vulkanTexture->GetImage();
+        TransitionImageLayout(image, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1);
+        CopyBufferToImage(stagingBuffer, image, width, height, static_cast<int32_t>(x), static_cast<int32_t>(y));
+        TransitionImageLayout(image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 1);
+
+        vmaDestroyBuffer(allocator, stagingBuffer, stagingAllocation);
+        return true;
+    }
+
+    bool VulkanTextureManager::SupportsFormat(TextureFormat format) const
+    {
+        VkFormatProperties properties{};
+        vkGetPhysicalDeviceFormatProperties(physicalDevice, ToVulkanFormat(format), &properties);
+
+        return (properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) != 0;
+    }
+
     ITextureHandle* VulkanTextureManager::GetDefaultTexture()
     {
         return defaultTexture.get();
@@ -322,7 +405,7 @@ namespace RenderStar::Client::Render::Vulkan
         EndSingleTimeCommands(cmd);
     }
 
-    void VulkanTextureManager::CopyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height)
+    void VulkanTextureManager::CopyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height, int32_t offsetX, int32_t offsetY)
     {
         VkCommandBuffer cmd = BeginSingleTimeCommands();
 
@@ -334,7 +417,7 @@ namespace RenderStar::Client::Render::Vulkan
         region.imageSubresource.mipLevel = 0;
         region.imageSubresource.baseArrayLayer = 0;
         region.imageSubresource.layerCount = 1;
-        region.imageOffset = {0, 0, 0};
+        region.imageOffset = {offsetX, offsetY, 0};
         region.imageExtent = {width, height, 1};
 
         vkCmdCopyBufferToImage(cmd, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
@@ -342,6 +425,34 @@ namespace RenderStar::Client::Render::Vulkan
         EndSingleTimeCommands(cmd);
     }
 
+    void VulkanTextureManager::CopyLevelsToImage(VkBuffer buffer, VkImage image, const TextureDescription& description, uint32_t mipLevels)
+    {
+        std::vector<VkBufferImageCopy> regions(mipLevels);
+        VkDeviceSize offset = 0;
+
+        for (uint32_t level = 0; level < mipLevels; ++level)
+        {
+            VkBufferImageCopy& region = regions[level];
+            region.bufferOffset = offset;
+            region.bufferRowLength = 0;
+            region.bufferImageHeight = 0;
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.mipLevel = level;
+            region.imageSubresource.baseArrayLayer = 0;
+            region.imageSubresource.layerCount = 1;
+            region.imageOffset = {0, 0, 0};
+            region.imageExtent = {description.GetLevelWidth(level), description.GetLevelHeight(level), 1};
+
+            offset += description.GetLevelSize(level);
+        }
+
+        VkCommandBuffer cmd = BeginSingleTimeCommands();
+
+        vkCmdCopyBufferToImage(cmd, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(regions.size()), regions.data());
+
+        EndSingleTimeCommands(cmd);
+    }
+
     VkCommandBuffer VulkanTextureManager::BeginSingleTimeCommands()
     {
         VkCommandBufferAllocateInfo allocInfo{};
@@ -398,4 +509,16 @@ namespace RenderStar::Client::Render::Vulkan
 
         return VK_FILTER_LINEAR;
     }
+
+    VkFormat VulkanTextureManager::ToVulkanFormat(TextureFormat format) const
+    {
+        switch (format)
+        {
+            case TextureFormat::BC1_RGBA: return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+            case TextureFormat::BC3_RGBA: return VK_FORMAT_BC3_UNORM_BLOCK;
+            case TextureFormat::BC4_R: return VK_FORMAT_BC4_UNORM_BLOCK;
+            case TextureFormat::BC5_RG: return VK_FORMAT_BC5_UNORM_BLOCK;
+            default: return VK_FORMAT_R8G8B8A8_UNORM;
+        }
+    }
 }
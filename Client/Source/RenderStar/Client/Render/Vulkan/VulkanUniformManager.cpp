@@ -155,7 +155,7 @@ namespace RenderStar::Client::Render::Vulkan
         VkDescriptorSetLayout layout = vulkanShader->GetDescriptorSetLayout();
 
         std::vector<VkDescriptorPoolSize> poolSizes = {
-            { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, maxFramesInFlight * 3 },
+            { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, maxFramesInFlight * 8 },
             { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, maxFramesInFlight * 16 }
         };
 
@@ -1,110 +1,597 @@
 #include "RenderStar/Client/UI/FontAtlas.hpp"
+#include "RenderStar/Client/UI/SignedDistanceField.hpp"
+#include "RenderStar/Client/UI/Utf8.hpp"
 #include "RenderStar/Client/Render/Resource/ITextureManager.hpp"
+#include "RenderStar/Common/Utility/WorkerPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
 #define STB_TRUETYPE_IMPLEMENTATION
 #include <stb_truetype.h>
 
 namespace RenderStar::Client::UI
 {
-    bool FontAtlas::Build(const std::vector<uint8_t>& ttfData, float pixelSize, Render::ITextureManager* textureManager)
+    struct FontAtlas::FontFace
     {
-        if (ttfData.empty() || !textureManager)
-            return false;
+        std::vector<uint8_t> data;
+        stbtt_fontinfo info{};
+    };
+
+    FontAtlas::FontAtlas() = default;
+    FontAtlas::~FontAtlas() = default;
 
-        stbtt_fontinfo fontInfo;
-        if (!stbtt_InitFont(&fontInfo, ttfData.data(), stbtt_GetFontOffsetForIndex(ttfData.data(), 0)))
+    bool FontAtlas::Initialize(Render::ITextureManager* manager, uint32_t size)
+    {
+        if (!manager || size == 0)
             return false;
 
-        float scale = stbtt_ScaleForPixelHeight(&fontInfo, pixelSize);
+        textureManager = manager;
+        pageSize = size;
+
+        Clear();
+
+        Render::TextureDescription desc;
+        desc.width = pageSize;
+        desc.height = pageSize;
+        desc.format = Render::TextureFormat::RGBA8;
+        desc.wrapS = Render::TextureWrapMode::CLAMP_TO_EDGE;
+        desc.wrapT = Render::TextureWrapMode::CLAMP_TO_EDGE;
+        desc.minFilter = Render::TextureFilterMode::LINEAR;
+        desc.magFilter = Render::TextureFilterMode::LINEAR;
+        desc.generateMipmaps = false;
+
+        texture = textureManager->CreateFromMemory(desc, pagePixels.data());
+
+        return texture && texture->IsValid();
+    }
+
+    void FontAtlas::Release()
+    {
+        Clear();
+        texture.reset();
+        textureManager = nullptr;
+        pagePixels.clear();
+        pagePixels.shrink_to_fit();
+    }
+
+    void FontAtlas::Clear()
+    {
+        faces.clear();
+        faceKeys.clear();
+        instances.clear();
+        slots.clear();
+        runCache.clear();
+
+        ResetPage();
+        ++layoutGeneration;
+    }
+
+    void FontAtlas::SetRenderMode(GlyphRenderMode mode)
+    {
+        if (mode == renderMode)
+            return;
+
+        renderMode = mode;
+        Clear();
+    }
+
+    int32_t FontAtlas::FindFace(const std::string& key) const
+    {
+        auto it = faceKeys.find(key);
+        return it != faceKeys.end() ? it->second : -1;
+    }
+
+    int32_t FontAtlas::AddFace(const std::string& key, const std::vector<uint8_t>& ttfData)
+    {
+        if (const int32_t existing = FindFace(key); existing >= 0)
+            return existing;
+
+        if (ttfData.empty())
+            return -1;
+
+        auto face = std::make_unique<FontFace>();
+        face->data = ttfData;
+
+        const int offset = stbtt_GetFontOffsetForIndex(face->data.data(), 0);
+
+        if (offset < 0 || !stbtt_InitFont(&face->info, face->data.data(), offset))
+            return -1;
+
+        const auto index = static_cast<int32_t>(faces.size());
+        faces.push_back(std::move(face));
+        faceKeys.emplace(key, index);
+
+        return index;
+    }
+
+    void FontAtlas::BeginBuild()
+    {
+        ++currentBuild;
+
+        // Runs are cheap to rebuild; only keep the ones the previous build still drew
+        if (runCache.size() > MAX_CACHED_RUNS)
+            std::erase_if(runCache, [this](const auto& entry) { return entry.second.lastUsedBuild + 1 < currentBuild; });
+    }
+
+    const ShapedRun* FontAtlas::Shape(int32_t face, float pixelSize, std::string_view text)
+    {
+        if (face < 0 || face >= static_cast<int32_t>(faces.size()) || pageSize == 0)
+            return nullptr;
+
+        uint64_t instanceKey = 0;
+        FontInstance* instance = GetInstance(face, pixelSize, instanceKey);
+
+        // Distance-field glyphs are stored once per face and scaled to the requested size here
+        const float drawScale = renderMode == GlyphRenderMode::SignedDistance ? std::max(1.0f, pixelSize) / instance->pixelSize : 1.0f;
+
+        runKeyScratch.assign(reinterpret_cast<const char*>(&instanceKey), sizeof(instanceKey));
+        runKeyScratch.append(reinterpret_cast<const char*>(&drawScale), sizeof(drawScale));
+        runKeyScratch.append(text);
+
+        if (auto it = runCache.find(runKeyScratch); it != runCache.end())
+        {
+            ++runCacheHits;
+
+            ShapedRun& cached = it->second;
+            cached.lastUsedBuild = currentBuild;
+
+            for (const ShapedGlyph& glyph : cached.glyphs)
+                slots[glyph.slot].lastUsedBuild = currentBuild;
+
+            return &cached;
+        }
+
+        ++runCacheMisses;
+
+        // Every new glyph is placed before any offset is read, so a repack cannot move them mid-run
+        CollectUnresolved(*instance, text);
+        ResolveGlyphs(*instance, instanceKey);
+
+        ShapedRun run;
+        run.lineHeight = instance->lineHeight * drawScale;
+        run.visibleHeight = instance->visibleHeight * drawScale;
+        run.lastUsedBuild = currentBuild;
+
+        float pen = 0.0f;
+
+        for (const uint32_t codepoint : codepointScratch)
+        {
+            const int32_t slotIndex = SlotEntry(*instance, codepoint);
+
+            if (slotIndex < 0)
+            {
+                pen += instance->pixelSize * 0.5f * drawScale;
+                continue;
+            }
+
+            const GlyphSlot& slot = slots[static_cast<size_t>(slotIndex)];
+
+            if (slot.width > 0 && slot.height > 0)
+            {
+                GlyphInfo glyph = slot.info;
+                glyph.bearingX *= drawScale;
+                glyph.bearingY *= drawScale;
+                glyph.advance *= drawScale;
+                glyph.width *= drawScale;
+                glyph.height *= drawScale;
+
+                run.glyphs.push_back({glyph, pen, static_cast<uint32_t>(slotIndex)});
+            }
+
+            pen += slot.info.advance * drawScale;
+        }
+
+        run.width = pen;
+
+        auto [it, inserted] = runCache.insert_or_assign(runKeyScratch, std::move(run));
+        return &it->second;
+    }
+
+    void FontAtlas::Prewarm(int32_t face, float pixelSize, std::string_view characters)
+    {
+        if (face < 0 || face >= static_cast<int32_t>(faces.size()) || pageSize == 0)
+            return;
+
+        uint64_t instanceKey = 0;
+        FontInstance* instance = GetInstance(face, pixelSize, instanceKey);
+
+        CollectUnresolved(*instance, characters);
+        ResolveGlyphs(*instance, instanceKey);
+    }
+
+    bool FontAtlas::Flush()
+    {
+        if (!texture || !textureManager || dirtyMaxX <= dirtyMinX || dirtyMaxY <= dirtyMinY)
+            return true;
+
+        const uint32_t width = dirtyMaxX - dirtyMinX;
+        const uint32_t height = dirtyMaxY - dirtyMinY;
+        const size_t rowBytes = static_cast<size_t>(width) * 4;
+
+        bool uploaded;
+
+        if (width == pageSize)
+            uploaded = textureManager->UpdateRegion(*texture, 0, dirtyMinY, width, height, pagePixels.data() + static_cast<size_t>(dirtyMinY) * rowBytes);
+        else
+        {
+            std::vector<uint8_t> region(rowBytes * height);
+
+            for (uint32_t row = 0; row < height; ++row)
+            {
+                const size_t source = (static_cast<size_t>(dirtyMinY + row) * pageSize + dirtyMinX) * 4;
+                std::memcpy(region.data() + row * rowBytes, pagePixels.data() + source, rowBytes);
+            }
+
+            uploaded = textureManager->UpdateRegion(*texture, dirtyMinX, dirtyMinY, width, height, region.data());
+        }
+
+        if (uploaded)
+            uploadedBytes += rowBytes * height;
+
+        dirtyMinX = dirtyMinY = pageSize;
+        dirtyMaxX = dirtyMaxY = 0;
+
+        return uploaded;
+    }
+
+    FontAtlasStatistics FontAtlas::GetStatistics() const
+    {
+        FontAtlasStatistics statistics;
+        statistics.faceCount = faces.size();
+        statistics.glyphCount = slots.size();
+        statistics.rasterizedGlyphs = rasterizedGlyphs;
+        statistics.repacks = repacks;
+        statistics.cachedRuns = runCache.size();
+        statistics.runCacheHits = runCacheHits;
+        statistics.runCacheMisses = runCacheMisses;
+        statistics.uploadedBytes = uploadedBytes;
+
+        if (pageSize > 0)
+            statistics.pageOccupancy = static_cast<double>(packer.GetUsedArea()) / (static_cast<double>(pageSize) * pageSize);
+
+        return statistics;
+    }
+
+    int32_t& FontAtlas::SlotEntry(FontInstance& instance, uint32_t codepoint)
+    {
+        if (codepoint < instance.ascii.size())
+            return instance.ascii[codepoint];
+
+        return instance.extended.try_emplace(codepoint, UNRESOLVED).first->second;
+    }
+
+    FontAtlas::FontInstance* FontAtlas::GetInstance(int32_t face, float pixelSize, uint64_t& outKey)
+    {
+        const float size = renderMode == GlyphRenderMode::SignedDistance ? SDF_BASE_SIZE : std::max(1.0f, pixelSize);
+        const auto quantizedSize = static_cast<uint32_t>(size + 0.5f);
+        outKey = (static_cast<uint64_t>(face) << 32) | quantizedSize;
+
+        auto it = instances.find(outKey);
+
+        if (it != instances.end())
+            return &it->second;
+
+        const stbtt_fontinfo& info = faces[static_cast<size_t>(face)]->info;
+
+        FontInstance instance;
+        instance.face = face;
+        instance.pixelSize = static_cast<float>(quantizedSize);
+        instance.scale = stbtt_ScaleForPixelHeight(&info, instance.pixelSize);
+        instance.ascii.fill(UNRESOLVED);
 
         int ascent, descent, lineGap;
-        stbtt_GetFontVMetrics(&fontInfo, &ascent, &descent, &lineGap);
-        lineHeight = (ascent - descent + lineGap) * scale;
-        visibleHeight = (ascent - descent) * scale;
+        stbtt_GetFontVMetrics(&info, &ascent, &descent, &lineGap);
+        instance.lineHeight = static_cast<float>(ascent - descent + lineGap) * instance.scale;
+        instance.visibleHeight = static_cast<float>(ascent - descent) * instance.scale;
 
-        constexpr int ATLAS_SIZE = 512;
-        std::vector<uint8_t> atlasBitmap(ATLAS_SIZE * ATLAS_SIZE, 0);
+        return &instances.emplace(outKey, std::move(instance)).first->second;
+    }
 
-        stbtt_pack_context packCtx;
-        if (!stbtt_PackBegin(&packCtx, atlasBitmap.data(), ATLAS_SIZE, ATLAS_SIZE, 0, 1, nullptr))
-            return false;
+    void FontAtlas::CollectUnresolved(FontInstance& instance, std::string_view text)
+    {
+        codepointScratch.clear();
+        pendingScratch.clear();
 
-        stbtt_PackSetOversampling(&packCtx, 2, 2);
+        for (size_t offset = 0; offset < text.size();)
+        {
+            const uint32_t codepoint = DecodeUtf8(text, offset);
+            codepointScratch.push_back(codepoint);
 
-        constexpr int FIRST_CHAR = 32;
-        constexpr int NUM_CHARS = 95;
-        std::vector<stbtt_packedchar> charData(NUM_CHARS);
+            const int32_t slotIndex = SlotEntry(instance, codepoint);
 
-        stbtt_PackFontRange(&packCtx, ttfData.data(), 0, pixelSize,
-            FIRST_CHAR, NUM_CHARS, charData.data());
+            // Touch what is already placed so a repack triggered by the new glyphs keeps it
+            if (slotIndex >= 0)
+                slots[static_cast<size_t>(slotIndex)].lastUsedBuild = currentBuild;
+            else if (slotIndex == UNRESOLVED)
+                pendingScratch.push_back(codepoint);
+        }
 
-        stbtt_PackEnd(&packCtx);
+        std::ranges::sort(pendingScratch);
+        pendingScratch.erase(std::ranges::unique(pendingScratch).begin(), pendingScratch.end());
+    }
+
+    void FontAtlas::ResolveGlyphs(FontInstance& instance, uint64_t instanceKey)
+    {
+        if (pendingScratch.empty())
+            return;
 
-        // Build glyph info using screen-space dimensions from stb_truetype
-        for (int i = 0; i < NUM_CHARS; ++i)
+        const stbtt_fontinfo& info = faces[static_cast<size_t>(instance.face)]->info;
+
+        std::vector<GlyphJob> jobs;
+        std::vector<GlyphSlot> pending;
+        jobs.reserve(pendingScratch.size());
+        pending.reserve(pendingScratch.size());
+
+        for (const uint32_t codepoint : pendingScratch)
         {
-            const auto& pc = charData[i];
-            uint32_t codepoint = static_cast<uint32_t>(FIRST_CHAR + i);
-
-            GlyphInfo info;
-            info.uvX0 = static_cast<float>(pc.x0) / ATLAS_SIZE;
-            info.uvY0 = static_cast<float>(pc.y0) / ATLAS_SIZE;
-            info.uvX1 = static_cast<float>(pc.x1) / ATLAS_SIZE;
-            info.uvY1 = static_cast<float>(pc.y1) / ATLAS_SIZE;
-            // Use xoff2-xoff / yoff2-yoff for correct screen-space dimensions
-            // (x1-x0 / y1-y0 are atlas bitmap pixels, inflated by oversampling)
-            info.width = pc.xoff2 - pc.xoff;
-            info.height = pc.yoff2 - pc.yoff;
-            info.bearingX = pc.xoff;
-            info.bearingY = pc.yoff;
-            info.advance = pc.xadvance;
-
-            glyphs[codepoint] = info;
+            const int glyphIndex = stbtt_FindGlyphIndex(&info, static_cast<int>(codepoint));
+
+            if (glyphIndex == 0)
+            {
+                SlotEntry(instance, codepoint) = MISSING;
+                continue;
+            }
+
+            jobs.push_back({&instance, glyphIndex});
+            pending.push_back({instanceKey, codepoint, glyphIndex, {}, 0, 0, 0, 0, currentBuild});
         }
 
-        // Convert single-channel to RGBA
-        std::vector<uint8_t> rgbaData(ATLAS_SIZE * ATLAS_SIZE * 4);
-        for (int i = 0; i < ATLAS_SIZE * ATLAS_SIZE; ++i)
+        const std::vector<GlyphBitmap> bitmaps = RenderGlyphs(jobs);
+        bool repacked = false;
+
+        for (size_t index = 0; index < pending.size(); ++index)
         {
-            rgbaData[i * 4 + 0] = 255;
-            rgbaData[i * 4 + 1] = 255;
-            rgbaData[i * 4 + 2] = 255;
-            rgbaData[i * 4 + 3] = atlasBitmap[i];
+            GlyphSlot& slot = pending[index];
+
+            // Page full: evict what this build has not touched and try once more.
+            // Not cached as missing, so a later build with a smaller working set can still place it.
+            if (!Place(slot, bitmaps[index]))
+            {
+                if (repacked)
+                    continue;
+
+                repacked = true;
+
+                if (!Repack() || !Place(slot, bitmaps[index]))
+                    continue;
+            }
+
+            SlotEntry(instance, slot.codepoint) = static_cast<int32_t>(slots.size());
+            slots.push_back(slot);
         }
+    }
 
-        Render::TextureDescription desc;
-        desc.width = ATLAS_SIZE;
-        desc.height = ATLAS_SIZE;
-        desc.format = Render::TextureFormat::RGBA8;
-        desc.wrapS = Render::TextureWrapMode::CLAMP_TO_EDGE;
-        desc.wrapT = Render::TextureWrapMode::CLAMP_TO_EDGE;
-        desc.minFilter = Render::TextureFilterMode::LINEAR;
-        desc.magFilter = Render::TextureFilterMode::LINEAR;
-        desc.generateMipmaps = false;
+    std::vector<FontAtlas::GlyphBitmap> FontAtlas::RenderGlyphs(std::span<const GlyphJob> jobs) const
+    {
+        std::vector<GlyphBitmap> bitmaps(jobs.size());
+
+        const auto render = [&](size_t index)
+        {
+            const GlyphJob& job = jobs[index];
+
+            bitmaps[index] = renderMode == GlyphRenderMode::SignedDistance
+                ? RenderDistanceField(*job.instance, job.glyphIndex)
+                : RenderCoverage(*job.instance, job.glyphIndex);
+        };
+
+        const size_t workerCount = jobs.size() < PARALLEL_GLYPH_THRESHOLD ? 1 : Common::Utility::WorkerPool::GetDefaultWorkerCount();
 
-        atlasTexture = textureManager->CreateFromMemory(desc, rgbaData.data());
+        Common::Utility::WorkerPool::RunTransient(jobs.size(), workerCount, render);
 
-        return atlasTexture && atlasTexture->IsValid();
+        return bitmaps;
     }
 
-    const GlyphInfo* FontAtlas::GetGlyph(uint32_t codepoint) const
+    FontAtlas::GlyphBitmap FontAtlas::RenderCoverage(const FontInstance& instance, int32_t glyphIndex) const
     {
-        auto it = glyphs.find(codepoint);
-        return it != glyphs.end() ? &it->second : nullptr;
+        const stbtt_fontinfo& info = faces[static_cast<size_t>(instance.face)]->info;
+        const float oversampledScale = instance.scale * static_cast<float>(OVERSAMPLE);
+
+        int advance, leftSideBearing;
+        stbtt_GetGlyphHMetrics(&info, glyphIndex, &advance, &leftSideBearing);
+
+        int x0, y0, x1, y1;
+        stbtt_GetGlyphBitmapBoxSubpixel(&info, glyphIndex, oversampledScale, oversampledScale, 0.0f, 0.0f, &x0, &y0, &x1, &y1);
+
+        GlyphBitmap bitmap;
+        bitmap.info.advance = static_cast<float>(advance) * instance.scale;
+
+        // Whitespace and other blank glyphs only carry an advance
+        if (x1 <= x0 || y1 <= y0)
+            return bitmap;
+
+        bitmap.width = static_cast<uint32_t>(x1 - x0) + OVERSAMPLE - 1;
+        bitmap.height = static_cast<uint32_t>(y1 - y0) + OVERSAMPLE - 1;
+        bitmap.pixels.assign(static_cast<size_t>(bitmap.width) * bitmap.height, 0);
+
+        float subX = 0.0f, subY = 0.0f;
+        stbtt_MakeGlyphBitmapSubpixelPrefilter(&info, bitmap.pixels.data(),
+            static_cast<int>(bitmap.width), static_cast<int>(bitmap.height), static_cast<int>(bitmap.width),
+            oversampledScale, oversampledScale, 0.0f, 0.0f,
+            static_cast<int>(OVERSAMPLE), static_cast<int>(OVERSAMPLE), &subX, &subY, glyphIndex);
+
+        constexpr float INVERSE_OVERSAMPLE = 1.0f / static_cast<float>(OVERSAMPLE);
+
+        // Screen-space extents: the bitmap is oversampled, so divide back down
+        bitmap.info.bearingX = static_cast<float>(x0) * INVERSE_OVERSAMPLE + subX;
+        bitmap.info.bearingY = static_cast<float>(y0) * INVERSE_OVERSAMPLE + subY;
+        bitmap.info.width = static_cast<float>(bitmap.width) * INVERSE_OVERSAMPLE;
+        bitmap.info.height = static_cast<float>(bitmap.height) * INVERSE_OVERSAMPLE;
+
+        return bitmap;
     }
 
-    Render::ITextureHandle* FontAtlas::GetTexture() const
+    FontAtlas::GlyphBitmap FontAtlas::RenderDistanceField(const FontInstance& instance, int32_t glyphIndex) const
     {
-        return atlasTexture.get();
+        const stbtt_fontinfo& info = faces[static_cast<size_t>(instance.face)]->info;
+        const float rasterScale = instance.scale * static_cast<float>(SDF_SUPERSAMPLE);
+
+        int advance, leftSideBearing;
+        stbtt_GetGlyphHMetrics(&info, glyphIndex, &advance, &leftSideBearing);
+
+        int x0, y0, x1, y1;
+        stbtt_GetGlyphBitmapBox(&info, glyphIndex, rasterScale, rasterScale, &x0, &y0, &x1, &y1);
+
+        GlyphBitmap bitmap;
+        bitmap.info.advance = static_cast<float>(advance) * instance.scale;
+
+        if (x1 <= x0 || y1 <= y0)
+            return bitmap;
+
+        // Leave room for the field to fall off outside the outline, and keep whole output texels
+        const auto margin = static_cast<uint32_t>(std::ceil(SDF_SPREAD)) * SDF_SUPERSAMPLE;
+        const auto roundUp = [](uint32_t value) { return (value + SDF_SUPERSAMPLE - 1) / SDF_SUPERSAMPLE * SDF_SUPERSAMPLE; };
+
+        const uint32_t sourceWidth = roundUp(static_cast<uint32_t>(x1 - x0) + 2 * margin);
+        const uint32_t sourceHeight = roundUp(static_cast<uint32_t>(y1 - y0) + 2 * margin);
+
+        std::vector<uint8_t> coverage(static_cast<size_t>(sourceWidth) * sourceHeight, 0);
+
+        stbtt_MakeGlyphBitmap(&info, coverage.data() + static_cast<size_t>(margin) * sourceWidth + margin,
+            x1 - x0, y1 - y0, static_cast<int>(sourceWidth), rasterScale, rasterScale, glyphIndex);
+
+        bitmap.pixels = GenerateSignedDistanceField(coverage, sourceWidth, sourceHeight, SDF_SUPERSAMPLE, SDF_SPREAD);
+        bitmap.width = sourceWidth / SDF_SUPERSAMPLE;
+        bitmap.height = sourceHeight / SDF_SUPERSAMPLE;
+
+        // One field texel per pixel at SDF_BASE_SIZE
+        constexpr float INVERSE_SUPERSAMPLE = 1.0f / static_cast<float>(SDF_SUPERSAMPLE);
+
+        bitmap.info.bearingX = static_cast<float>(x0 - static_cast<int>(margin)) * INVERSE_SUPERSAMPLE;
+        bitmap.info.bearingY = static_cast<float>(y0 - static_cast<int>(margin)) * INVERSE_SUPERSAMPLE;
+        bitmap.info.width = static_cast<float>(bitmap.width);
+        bitmap.info.height = static_cast<float>(bitmap.height);
+
+        return bitmap;
+    }
+
+    bool FontAtlas::Allocate(GlyphSlot& slot, uint32_t width, uint32_t height)
+    {
+        const auto packed = packer.Pack(width + 2 * GLYPH_PADDING, height + 2 * GLYPH_PADDING);
+
+        if (!packed)
+            return false;
+
+        slot.x = packed->x + GLYPH_PADDING;
+        slot.y = packed->y + GLYPH_PADDING;
+        slot.width = width;
+        slot.height = height;
+
+        const float inverseSize = 1.0f / static_cast<float>(pageSize);
+
+        slot.info.uvX0 = static_cast<float>(slot.x) * inverseSize;
+        slot.info.uvY0 = static_cast<float>(slot.y) * inverseSize;
+        slot.info.uvX1 = static_cast<float>(slot.x + width) * inverseSize;
+        slot.info.uvY1 = static_cast<float>(slot.y + height) * inverseSize;
+
+        MarkDirty(slot.x, slot.y, width, height);
+        return true;
+    }
+
+    bool FontAtlas::Place(GlyphSlot& slot, const GlyphBitmap& bitmap)
+    {
+        slot.info = bitmap.info;
+
+        if (bitmap.width == 0 || bitmap.height == 0)
+        {
+            slot.width = slot.height = 0;
+            return true;
+        }
+
+        if (!Allocate(slot, bitmap.width, bitmap.height))
+            return false;
+
+        for (uint32_t row = 0; row < bitmap.height; ++row)
+        {
+            uint8_t* destination = pagePixels.data() + (static_cast<size_t>(slot.y + row) * pageSize + slot.x) * 4;
+            const uint8_t* source = bitmap.pixels.data() + static_cast<size_t>(row) * bitmap.width;
+
+            for (uint32_t column = 0; column < bitmap.width; ++column)
+                destination[column * 4 + 3] = source[column];
+        }
+
+        ++rasterizedGlyphs;
+        return true;
     }
 
-    float FontAtlas::GetLineHeight() const
+    bool FontAtlas::Repack()
     {
-        return lineHeight;
+        std::vector<GlyphSlot> survivors;
+
+        for (const GlyphSlot& slot : slots)
+            if (slot.lastUsedBuild == currentBuild)
+                survivors.push_back(slot);
+
+        // Everything on the page is needed right now; nothing to reclaim
+        if (survivors.size() == slots.size())
+            return false;
+
+        for (auto& [key, instance] : instances)
+        {
+            instance.ascii.fill(UNRESOLVED);
+            instance.extended.clear();
+        }
+
+        // Survivors are copied out of the old page rather than rendered again
+        const std::vector<uint8_t> previousPage = std::move(pagePixels);
+
+        slots.clear();
+        runCache.clear();
+        ResetPage();
+
+        // Tallest first keeps the skyline flat
+        std::ranges::sort(survivors, std::greater{}, &GlyphSlot::height);
+
+        for (GlyphSlot& slot : survivors)
+        {
+            const uint32_t sourceX = slot.x;
+            const uint32_t sourceY = slot.y;
+
+            if (slot.width > 0 && slot.height > 0)
+            {
+                if (!Allocate(slot, slot.width, slot.height))
+                    continue;
+
+                const size_t rowBytes = static_cast<size_t>(slot.width) * 4;
+
+                for (uint32_t row = 0; row < slot.height; ++row)
+                {
+                    std::memcpy(pagePixels.data() + (static_cast<size_t>(slot.y + row) * pageSize + slot.x) * 4,
+                        previousPage.data() + (static_cast<size_t>(sourceY + row) * pageSize + sourceX) * 4, rowBytes);
+                }
+            }
+
+            FontInstance& instance = instances.at(slot.instanceKey);
+            SlotEntry(instance, slot.codepoint) = static_cast<int32_t>(slots.size());
+            slots.push_back(slot);
+        }
+
+        MarkDirty(0, 0, pageSize, pageSize);
+
+        ++repacks;
+        ++layoutGeneration;
+        return true;
+    }
+
+    void FontAtlas::ResetPage()
+    {
+        // White texels with zero coverage; glyphs only ever write alpha
+        pagePixels.assign(static_cast<size_t>(pageSize) * pageSize * 4, 255);
+
+        for (size_t i = 3; i < pagePixels.size(); i += 4)
+            pagePixels[i] = 0;
+
+        packer.Reset(pageSize, pageSize);
+
+        dirtyMinX = dirtyMinY = pageSize;
+        dirtyMaxX = dirtyMaxY = 0;
     }
 
-    float FontAtlas::GetVisibleHeight() const
+    void FontAtlas::MarkDirty(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
     {
-        return visibleHeight;
+        dirtyMinX = std::min(dirtyMinX, x);
+        dirtyMinY = std::min(dirtyMinY, y);
+        dirtyMaxX = std::max(dirtyMaxX, x + width);
+        dirtyMaxY = std::max(dirtyMaxY, y + height);
     }
 }
@@ -0,0 +1,129 @@
+#include "RenderStar/Client/UI/SignedDistanceField.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace RenderStar::Client::UI
+{
+    namespace
+    {
+        constexpr double FAR_AWAY = 1e20;
+
+        // Exact 1D squared Euclidean distance transform (Felzenszwalb & Huttenlocher) over a strided line
+        void TransformLine(double* line, size_t count, size_t stride, std::vector<double>& f, std::vector<size_t>& v, std::vector<double>& z)
+        {
+            for (size_t i = 0; i < count; ++i)
+                f[i] = line[i * stride];
+
+            size_t k = 0;
+            v[0] = 0;
+            z[0] = -FAR_AWAY;
+            z[1] = FAR_AWAY;
+
+            const auto intersect = [&](size_t q, size_t p)
+            {
+                const auto dq = static_cast<double>(q);
+                const auto dp = static_cast<double>(p);
+                return ((f[q] + dq * dq) - (f[p] + dp * dp)) / (2.0 * dq - 2.0 * dp);
+            };
+
+            for (size_t q = 1; q < count; ++q)
+            {
+                double s = intersect(q, v[k]);
+
+                while (s <= z[k])
+                {
+                    --k;
+                    s = intersect(q, v[k]);
+                }
+
+                ++k;
+                v[k] = q;
+                z[k] = s;
+                z[k + 1] = FAR_AWAY;
+            }
+
+            k = 0;
+
+            for (size_t q = 0; q < count; ++q)
+            {
+                while (z[k + 1] < static_cast<double>(q))
+                    ++k;
+
+                const double offset = static_cast<double>(q) - static_cast<double>(v[k]);
+                line[q * stride] = offset * offset + f[v[k]];
+            }
+        }
+
+        // Squared distance from every texel to the nearest texel where `grid` is zero
+        void Transform(std::vector<double>& grid, uint32_t width, uint32_t height)
+        {
+            const size_t longest = std::max(width, height);
+            std::vector<double> f(longest);
+            std::vector<size_t> v(longest);
+            std::vector<double> z(longest + 1);
+
+            for (uint32_t x = 0; x < width; ++x)
+                TransformLine(grid.data() + x, height, width, f, v, z);
+
+            for (uint32_t y = 0; y < height; ++y)
+                TransformLine(grid.data() + static_cast<size_t>(y) * width, width, 1, f, v, z);
+        }
+    }
+
+    std::vector<uint8_t> GenerateSignedDistanceField(std::span<const uint8_t> coverage, uint32_t width, uint32_t height, uint32_t downsample, float spread)
+    {
+        downsample = std::max(downsample, 1u);
+
+        const uint32_t outWidth = width / downsample;
+        const uint32_t outHeight = height / downsample;
+
+        if (outWidth == 0 || outHeight == 0 || coverage.size() < static_cast<size_t>(width) * height)
+            return {};
+
+        const size_t texelCount = static_cast<size_t>(width) * height;
+        std::vector<double> toInside(texelCount);
+        std::vector<double> toOutside(texelCount);
+
+        for (size_t i = 0; i < texelCount; ++i)
+        {
+            const bool inside = coverage[i] >= 128;
+            toInside[i] = inside ? 0.0 : FAR_AWAY;
+            toOutside[i] = inside ? FAR_AWAY : 0.0;
+        }
+
+        Transform(toInside, width, height);
+        Transform(toOutside, width, height);
+
+        // Positive outside, negative inside, measured from the edge half a texel past the last covered center
+        const auto signedDistance = [&](size_t i)
+        {
+            return toInside[i] > 0.0
+                ? std::sqrt(toInside[i]) - 0.5
+                : -(std::sqrt(toOutside[i]) - 0.5);
+        };
+
+        const double blockArea = static_cast<double>(downsample) * downsample;
+        const double range = 2.0 * std::max(spread, 1e-3f);
+
+        std::vector<uint8_t> field(static_cast<size_t>(outWidth) * outHeight);
+
+        for (uint32_t oy = 0; oy < outHeight; ++oy)
+        {
+            for (uint32_t ox = 0; ox < outWidth; ++ox)
+            {
+                double sum = 0.0;
+
+                for (uint32_t sy = 0; sy < downsample; ++sy)
+                    for (uint32_t sx = 0; sx < downsample; ++sx)
+                        sum += signedDistance(static_cast<size_t>(oy * downsample + sy) * width + ox * downsample + sx);
+
+                const double distance = sum / blockArea / downsample;
+                const double encoded = std::clamp(0.5 - distance / range, 0.0, 1.0);
+
+                field[static_cast<size_t>(oy) * outWidth + ox] = static_cast<uint8_t>(std::lround(encoded * 255.0));
+            }
+        }
+
+        return field;
+    }
+}
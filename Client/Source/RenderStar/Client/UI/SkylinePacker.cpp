@@ -0,0 +1,110 @@
+#include "RenderStar/Client/UI/SkylinePacker.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace RenderStar::Client::UI
+{
+    void SkylinePacker::Reset(uint32_t width, uint32_t height)
+    {
+        atlasWidth = width;
+        atlasHeight = height;
+        usedArea = 0;
+
+        skyline.clear();
+        skyline.push_back({0, 0, width});
+    }
+
+    std::optional<PackedRect> SkylinePacker::Pack(uint32_t width, uint32_t height)
+    {
+        if (width == 0 || height == 0 || width > atlasWidth || height > atlasHeight)
+            return std::nullopt;
+
+        size_t bestIndex = skyline.size();
+        uint32_t bestY = std::numeric_limits<uint32_t>::max();
+        uint32_t bestWidth = std::numeric_limits<uint32_t>::max();
+
+        for (size_t i = 0; i < skyline.size(); ++i)
+        {
+            const auto y = FitAt(i, width, height);
+
+            if (!y)
+                continue;
+
+            // Lowest top edge first, then the narrowest segment to limit wasted gaps
+            if (*y < bestY || (*y == bestY && skyline[i].width < bestWidth))
+            {
+                bestIndex = i;
+                bestY = *y;
+                bestWidth = skyline[i].width;
+            }
+        }
+
+        if (bestIndex == skyline.size())
+            return std::nullopt;
+
+        const PackedRect rect{skyline[bestIndex].x, bestY};
+        skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(bestIndex), {rect.x, bestY + height, width});
+
+        // Trim or drop the segments now covered by the new one
+        for (size_t i = bestIndex + 1; i < skyline.size();)
+        {
+            const Node& previous = skyline[i - 1];
+            Node& node = skyline[i];
+            const uint32_t previousEnd = previous.x + previous.width;
+
+            if (node.x >= previousEnd)
+                break;
+
+            const uint32_t shrink = previousEnd - node.x;
+
+            if (node.width <= shrink)
+            {
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+                continue;
+            }
+
+            node.x += shrink;
+            node.width -= shrink;
+            break;
+        }
+
+        // Merge neighbours at the same height
+        for (size_t i = 0; i + 1 < skyline.size();)
+        {
+            if (skyline[i].y == skyline[i + 1].y)
+            {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            }
+            else
+                ++i;
+        }
+
+        usedArea += static_cast<uint64_t>(width) * height;
+        return rect;
+    }
+
+    std::optional<uint32_t> SkylinePacker::FitAt(size_t index, uint32_t width, uint32_t height) const
+    {
+        if (skyline[index].x + width > atlasWidth)
+            return std::nullopt;
+
+        uint32_t remaining = width;
+        uint32_t y = skyline[index].y;
+
+        for (size_t i = index; remaining > 0; ++i)
+        {
+            if (i == skyline.size())
+                return std::nullopt;
+
+            y = std::max(y, skyline[i].y);
+
+            if (y + height > atlasHeight)
+                return std::nullopt;
+
+            remaining -= std::min(remaining, skyline[i].width);
+        }
+
+        return y;
+    }
+}
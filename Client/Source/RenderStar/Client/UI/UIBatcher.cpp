@@ -0,0 +1,239 @@
+#include "RenderStar/Client/UI/UIBatcher.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+namespace RenderStar::Client::UI
+{
+    namespace
+    {
+        constexpr float INF = std::numeric_limits<float>::infinity();
+    }
+
+    void UIBatcher::Begin(float width, float height)
+    {
+        screenWidth = width;
+        screenHeight = height;
+
+        vertices.clear();
+        indices.clear();
+        runs.clear();
+        scissorStack.clear();
+
+        batchCount = 0;
+        primitiveCount = 0;
+        culledCount = 0;
+    }
+
+    void UIBatcher::End()
+    {
+        indices.clear();
+        runs.clear();
+
+        for (size_t i = 0; i < batchCount; ++i)
+        {
+            const Batch& batch = batches[i];
+
+            if (batch.indices.empty())
+                continue;
+
+            runs.push_back({batch.texture, batch.scissor, static_cast<uint32_t>(indices.size()), static_cast<uint32_t>(batch.indices.size())});
+            indices.insert(indices.end(), batch.indices.begin(), batch.indices.end());
+        }
+    }
+
+    void UIBatcher::PushScissor(const UIScissorRect& rect)
+    {
+        if (scissorStack.empty())
+        {
+            scissorStack.push_back(rect);
+            return;
+        }
+
+        const UIScissorRect& parent = scissorStack.back();
+
+        const int64_t minX = std::max<int64_t>(rect.x, parent.x);
+        const int64_t minY = std::max<int64_t>(rect.y, parent.y);
+        const int64_t maxX = std::min<int64_t>(int64_t{rect.x} + rect.width, int64_t{parent.x} + parent.width);
+        const int64_t maxY = std::min<int64_t>(int64_t{rect.y} + rect.height, int64_t{parent.y} + parent.height);
+
+        scissorStack.push_back({
+            static_cast<int32_t>(minX), static_cast<int32_t>(minY),
+            static_cast<uint32_t>(std::max<int64_t>(0, maxX - minX)),
+            static_cast<uint32_t>(std::max<int64_t>(0, maxY - minY))
+        });
+    }
+
+    void UIBatcher::PopScissor()
+    {
+        if (!scissorStack.empty())
+            scissorStack.pop_back();
+    }
+
+    void UIBatcher::AddQuad(Render::ITextureHandle* texture, const UIQuad& quad)
+    {
+        if (!texture || quad.width <= 0.0f || quad.height <= 0.0f)
+            return;
+
+        ++primitiveCount;
+
+        constexpr float CORNERS[4][2] = { {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f} };
+
+        const float centerX = quad.x + quad.width * 0.5f;
+        const float centerY = quad.y + quad.height * 0.5f;
+        const float radians = quad.rotationDegrees * std::numbers::pi_v<float> / 180.0f;
+        const float cosR = std::cos(radians);
+        const float sinR = std::sin(radians);
+
+        UIVertex corners[4];
+        Bounds bounds{ INF, INF, -INF, -INF };
+
+        for (int i = 0; i < 4; ++i)
+        {
+            const float localX = CORNERS[i][0];
+            const float localY = CORNERS[i][1];
+            const float dx = quad.x + localX * quad.width - centerX;
+            const float dy = quad.y + localY * quad.height - centerY;
+
+            UIVertex& vertex = corners[i];
+            vertex.posX = centerX + dx * cosR - dy * sinR;
+            vertex.posY = centerY + dx * sinR + dy * cosR;
+            vertex.texU = quad.u0 + localX * (quad.u1 - quad.u0);
+            vertex.texV = quad.v0 + localY * (quad.v1 - quad.v0);
+            vertex.colorR = quad.tint.r;
+            vertex.colorG = quad.tint.g;
+            vertex.colorB = quad.tint.b;
+            vertex.colorA = quad.tint.a;
+            vertex.localX = localX;
+            vertex.localY = localY;
+            vertex.width = quad.width;
+            vertex.height = quad.height;
+            vertex.cornerRadius = quad.cornerRadius;
+            vertex.distanceField = quad.distanceField ? 1.0f : 0.0f;
+
+            bounds.minX = std::min(bounds.minX, vertex.posX);
+            bounds.minY = std::min(bounds.minY, vertex.posY);
+            bounds.maxX = std::max(bounds.maxX, vertex.posX);
+            bounds.maxY = std::max(bounds.maxY, vertex.posY);
+        }
+
+        const auto clipped = ClipToActiveArea(bounds);
+
+        if (!clipped)
+        {
+            ++culledCount;
+            return;
+        }
+
+        Batch& batch = SelectBatch(texture, *clipped);
+        const auto base = static_cast<uint32_t>(vertices.size());
+
+        vertices.insert(vertices.end(), std::begin(corners), std::end(corners));
+        batch.indices.insert(batch.indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 });
+    }
+
+    void UIBatcher::AddGeometry(Render::ITextureHandle* texture, std::span<const UIVertex> geometry, std::span<const uint32_t> geometryIndices)
+    {
+        if (!texture || geometry.empty() || geometryIndices.empty())
+            return;
+
+        ++primitiveCount;
+
+        Bounds bounds{ INF, INF, -INF, -INF };
+
+        for (const UIVertex& vertex : geometry)
+        {
+            bounds.minX = std::min(bounds.minX, vertex.posX);
+            bounds.minY = std::min(bounds.minY, vertex.posY);
+            bounds.maxX = std::max(bounds.maxX, vertex.posX);
+            bounds.maxY = std::max(bounds.maxY, vertex.posY);
+        }
+
+        const auto clipped = ClipToActiveArea(bounds);
+
+        if (!clipped)
+        {
+            ++culledCount;
+            return;
+        }
+
+        Batch& batch = SelectBatch(texture, *clipped);
+        const auto base = static_cast<uint32_t>(vertices.size());
+
+        vertices.insert(vertices.end(), geometry.begin(), geometry.end());
+
+        for (const uint32_t index : geometryIndices)
+            batch.indices.push_back(base + index);
+    }
+
+    UIBatchStatistics UIBatcher::GetStatistics() const
+    {
+        UIBatchStatistics statistics;
+        statistics.primitiveCount = primitiveCount;
+        statistics.culledCount = culledCount;
+        statistics.drawCount = runs.size();
+        statistics.vertexBytes = vertices.size() * sizeof(UIVertex);
+        statistics.indexBytes = indices.size() * sizeof(uint32_t);
+        return statistics;
+    }
+
+    std::optional<UIBatcher::Bounds> UIBatcher::ClipToActiveArea(const Bounds& bounds) const
+    {
+        Bounds area{ 0.0f, 0.0f, screenWidth, screenHeight };
+
+        if (!scissorStack.empty())
+        {
+            const UIScissorRect& scissor = scissorStack.back();
+            area = {
+                static_cast<float>(scissor.x), static_cast<float>(scissor.y),
+                static_cast<float>(scissor.x) + static_cast<float>(scissor.width),
+                static_cast<float>(scissor.y) + static_cast<float>(scissor.height)
+            };
+        }
+
+        const Bounds clipped{
+            std::max(bounds.minX, area.minX), std::max(bounds.minY, area.minY),
+            std::min(bounds.maxX, area.maxX), std::min(bounds.maxY, area.maxY)
+        };
+
+        if (clipped.minX >= clipped.maxX || clipped.minY >= clipped.maxY)
+            return std::nullopt;
+
+        return clipped;
+    }
+
+    UIBatcher::Batch& UIBatcher::SelectBatch(Render::ITextureHandle* texture, const Bounds& bounds)
+    {
+        const auto scissor = scissorStack.empty() ? std::nullopt : std::optional(scissorStack.back());
+        const size_t stop = batchCount > MERGE_LOOKBACK ? batchCount - MERGE_LOOKBACK : 0;
+
+        for (size_t i = batchCount; i > stop; --i)
+        {
+            Batch& candidate = batches[i - 1];
+
+            if (candidate.texture == texture && candidate.scissor == scissor)
+            {
+                candidate.bounds.minX = std::min(candidate.bounds.minX, bounds.minX);
+                candidate.bounds.minY = std::min(candidate.bounds.minY, bounds.minY);
+                candidate.bounds.maxX = std::max(candidate.bounds.maxX, bounds.maxX);
+                candidate.bounds.maxY = std::max(candidate.bounds.maxY, bounds.maxY);
+                return candidate;
+            }
+
+            if (candidate.bounds.Overlaps(bounds))
+                break;
+        }
+
+        if (batchCount == batches.size())
+            batches.emplace_back();
+
+        Batch& batch = batches[batchCount++];
+        batch.texture = texture;
+        batch.scissor = scissor;
+        batch.bounds = bounds;
+        batch.indices.clear();
+
+        return batch;
+    }
+}
@@ -0,0 +1,79 @@
+#include "RenderStar/Client/UI/UISpatialIndex.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace RenderStar::Client::UI
+{
+    void UISpatialIndex::Reset(float width, float height, float size)
+    {
+        cellSize = std::max(size, 1.0f);
+        columns = std::max(1, static_cast<int32_t>(std::ceil(width / cellSize)));
+        rows = std::max(1, static_cast<int32_t>(std::ceil(height / cellSize)));
+
+        // Keep the per-cell allocations alive across frames
+        cells.resize(static_cast<size_t>(columns) * static_cast<size_t>(rows));
+        Clear();
+    }
+
+    void UISpatialIndex::Clear()
+    {
+        entries.clear();
+
+        for (auto& cell : cells)
+            cell.clear();
+    }
+
+    void UISpatialIndex::Insert(const UIElement* element, float x, float y, float w, float h)
+    {
+        if (!element || w < 0.0f || h < 0.0f || cells.empty())
+            return;
+
+        const auto entryIndex = static_cast<uint32_t>(entries.size());
+        entries.push_back({element, x, y, w, h});
+
+        const int32_t minColumn = CellCoordinate(x, columns);
+        const int32_t maxColumn = CellCoordinate(static_cast<double>(x) + w, columns);
+        const int32_t minRow = CellCoordinate(y, rows);
+        const int32_t maxRow = CellCoordinate(static_cast<double>(y) + h, rows);
+
+        for (int32_t row = minRow; row <= maxRow; ++row)
+            for (int32_t column = minColumn; column <= maxColumn; ++column)
+                cells[static_cast<size_t>(row) * columns + column].push_back(entryIndex);
+    }
+
+    const UIElement* UISpatialIndex::Query(double x, double y) const
+    {
+        if (cells.empty())
+            return nullptr;
+
+        const double gridW = static_cast<double>(columns) * cellSize;
+        const double gridH = static_cast<double>(rows) * cellSize;
+
+        // Rects may extend past the screen; points out there fall back to a scan of every entry
+        if (x < 0.0 || y < 0.0 || x >= gridW || y >= gridH)
+        {
+            for (auto it = entries.rbegin(); it != entries.rend(); ++it)
+                if (it->Contains(x, y))
+                    return it->element;
+
+            return nullptr;
+        }
+
+        const auto& cell = cells[static_cast<size_t>(CellCoordinate(y, rows)) * columns + CellCoordinate(x, columns)];
+
+        for (auto it = cell.rbegin(); it != cell.rend(); ++it)
+        {
+            const Entry& entry = entries[*it];
+
+            if (entry.Contains(x, y))
+                return entry.element;
+        }
+
+        return nullptr;
+    }
+
+    int32_t UISpatialIndex::CellCoordinate(double value, int32_t count) const
+    {
+        return static_cast<int32_t>(std::clamp(std::floor(value / cellSize), 0.0, static_cast<double>(count - 1)));
+    }
+}
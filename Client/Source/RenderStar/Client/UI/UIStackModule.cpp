@@ -1,4 +1,5 @@
 #include "RenderStar/Client/UI/UIStackModule.hpp"
+#include "RenderStar/Client/UI/UibinLoader.hpp"
 #include "RenderStar/Client/UI/UIVertex.hpp"
 #include "RenderStar/Client/UI/UIUniformData.hpp"
 #include "RenderStar/Client/UI/FontAtlas.hpp"
@@ -39,20 +40,6 @@ namespace RenderStar::Client::UI
         uniformManager = um;
         textureManager = tm;
 
-        // Build unit quad mesh: (0,0)-(1,1)
-        std::vector<UIVertex> vertices = {
-            {0.0f, 0.0f, 0.0f, 0.0f},
-            {1.0f, 0.0f, 1.0f, 0.0f},
-            {1.0f, 1.0f, 1.0f, 1.0f},
-            {0.0f, 1.0f, 0.0f, 1.0f}
-        };
-
-        std::vector<uint32_t> indices = {0, 1, 2, 0, 2, 3};
-
-        quadMesh = std::make_unique<Render::Resource::Mesh>(*bufferManager, UIVertex::LAYOUT, Render::PrimitiveType::TRIANGLES);
-        quadMesh->SetVertices(vertices);
-        quadMesh->SetIndices(indices);
-
         // Build 1x1 white texture
         uint8_t whitePixels[] = {255, 255, 255, 255};
         Render::TextureDescription whiteDesc;
@@ -65,6 +52,11 @@ namespace RenderStar::Client::UI
         whiteDesc.magFilter = Render::TextureFilterMode::NEAREST;
         whiteTexture = textureManager->CreateFromMemory(whiteDesc, whitePixels);
 
+        fontAtlas.SetRenderMode(glyphRenderMode);
+
+        if (!fontAtlas.Initialize(textureManager))
+            logger->error("Failed to create the glyph atlas page");
+
         logger->info("UIStackModule render state set up");
     }
 
@@ -76,23 +68,35 @@ namespace RenderStar::Client::UI
     void UIStackModule::SetDefaultFont(std::vector<uint8_t> fontData)
     {
         defaultFontData = std::move(fontData);
+        fontAtlas.Clear();
+        MarkDirty();
         logger->info("Default font set ({} bytes)", defaultFontData.size());
     }
 
+    void UIStackModule::SetGlyphRenderMode(GlyphRenderMode mode)
+    {
+        glyphRenderMode = mode;
+        fontAtlas.SetRenderMode(mode);
+        MarkDirty();
+    }
+
     void UIStackModule::Cleanup()
     {
         uniformPool.clear();
         uniformPoolIndex = 0;
-        quadMesh.reset();
+        batchMeshes.clear();
+        batchMeshGenerations.clear();
         whiteTexture.reset();
         shader.reset();
         layerStack.clear();
-        fontCache.clear();
+        fontAtlas.Release();
+        InvalidateStructure();
         currentRenderLayer = nullptr;
         bufferManager = nullptr;
         uniformManager = nullptr;
         textureManager = nullptr;
         computedRects.clear();
+        scrollbarThumbRects.clear();
         clickHandlers.clear();
         toggleHandlers.clear();
         textChangedHandlers.clear();
@@ -108,14 +112,57 @@ namespace RenderStar::Client::UI
         UILayer layer;
         layer.scene = std::move(scene);
         layerStack.push_back(std::move(layer));
+        InvalidateStructure();
         logger->info("UI layer pushed, stack size={}", layerStack.size());
     }
 
+    void UIStackModule::PushLayer(UibinScene scene, Common::Asset::AssetLocation source)
+    {
+        PushLayer(std::move(scene));
+        layerStack.back().source = std::move(source);
+    }
+
+    size_t UIStackModule::ReloadLayers(const std::vector<Common::Asset::AssetLocation>& affected, Common::Asset::AssetModule& assetModule)
+    {
+        size_t reloaded = 0;
+
+        for (auto& layer : layerStack)
+        {
+            if (!layer.source.has_value() || std::ranges::find(affected, *layer.source) == affected.end())
+                continue;
+
+            auto scene = UibinLoader::Load(*layer.source, assetModule);
+
+            if (!scene.has_value())
+            {
+                logger->error("Failed to reload UI layer {}, keeping previous version", layer.source->ToString());
+                continue;
+            }
+
+            layer.scene = std::move(*scene);
+            layer.textures.clear();
+            ++reloaded;
+
+            logger->info("Reloaded UI layer {}", layer.source->ToString());
+        }
+
+        if (reloaded > 0)
+        {
+            computedRects.clear();
+            scrollOffsets.clear();
+            fontAtlas.Clear();
+            InvalidateStructure();
+        }
+
+        return reloaded;
+    }
+
     void UIStackModule::PopLayer()
     {
         if (!layerStack.empty())
         {
             layerStack.pop_back();
+            InvalidateStructure();
             logger->info("UI layer popped, stack size={}", layerStack.size());
         }
     }
@@ -125,6 +172,15 @@ namespace RenderStar::Client::UI
         layerStack.clear();
         computedRects.clear();
         scrollOffsets.clear();
+        InvalidateStructure();
+    }
+
+    void UIStackModule::InvalidateStructure()
+    {
+        // Element pointers held by the hit index and texture pointers held by the batcher may now dangle
+        hitIndex.Clear();
+        builtGeneration = 0;
+        MarkDirty();
     }
 
     UIElement* UIStackModule::FindById(const std::string& id)
@@ -132,7 +188,10 @@ namespace RenderStar::Client::UI
         for (auto it = layerStack.rbegin(); it != layerStack.rend(); ++it)
         {
             if (auto* found = it->scene.FindById(id))
+            {
+                MarkDirty();
                 return found;
+            }
         }
         return nullptr;
     }
@@ -142,7 +201,10 @@ namespace RenderStar::Client::UI
         for (auto it = layerStack.rbegin(); it != layerStack.rend(); ++it)
         {
             if (auto* found = it->scene.FindByName(name))
+            {
+                MarkDirty();
                 return found;
+            }
         }
         return nullptr;
     }
@@ -173,10 +235,15 @@ namespace RenderStar::Client::UI
 
         inputConsumed = false;
 
+        const std::string previousHovered = hoveredElementId;
+        const std::string previousFocused = focusedElementId;
+        const std::string previousExpanded = expandedDropdownId;
+        const std::string previousDragging = draggingScrollbarId;
+
         glm::dvec2 cursor = input->GetCursorPosition();
         UIElement* hitElement = HitTest(cursor.x, cursor.y);
 
-        hoveredElementId = hitElement && !hitElement->id.empty() ? hitElement->id : "";
+        hoveredElementId = hitElement ? std::string(hitElement->id) : "";
 
         if (hitElement)
             inputConsumed = true;
@@ -220,7 +287,15 @@ namespace RenderStar::Client::UI
                     maxScroll = std::max(0.0f, cIt->second - visibleSize);
                 }
 
-                scrollOffsets[draggingScrollbarId] = std::clamp(dragStartOffset + scrollDelta, 0.0f, maxScroll);
+                const float newOffset = std::clamp(dragStartOffset + scrollDelta, 0.0f, maxScroll);
+                float& offset = scrollOffsets[draggingScrollbarId];
+
+                if (offset != newOffset)
+                {
+                    offset = newOffset;
+                    MarkDirty();
+                }
+
                 inputConsumed = true;
             }
             else
@@ -270,7 +345,7 @@ namespace RenderStar::Client::UI
                 // Find the expanded dropdown element
                 UIElement* ddElement = nullptr;
                 for (auto& layer : layerStack)
-                    if (auto* found = layer.scene.root.FindById(expandedDropdownId))
+                    if (auto* found = layer.scene.FindById(expandedDropdownId))
                     { ddElement = found; break; }
 
                 if (ddElement)
@@ -300,6 +375,7 @@ namespace RenderStar::Client::UI
                             {
                                 dropdown->selectedIndex = clickedIdx;
                                 handledDropdownOption = true;
+                                MarkDirty();
                             }
                         }
                         expandedDropdownId.clear();
@@ -314,7 +390,7 @@ namespace RenderStar::Client::UI
                 // Button click
                 if (hitElement->GetButton())
                 {
-                    auto it = clickHandlers.find(hitElement->id);
+                    auto it = clickHandlers.find(std::string(hitElement->id));
                     if (it != clickHandlers.end())
                         it->second();
                 }
@@ -323,7 +399,8 @@ namespace RenderStar::Client::UI
                 if (auto* toggle = hitElement->GetToggle())
                 {
                     toggle->checked = !toggle->checked;
-                    auto it = toggleHandlers.find(hitElement->id);
+                    MarkDirty();
+                    auto it = toggleHandlers.find(std::string(hitElement->id));
                     if (it != toggleHandlers.end())
                         it->second(toggle->checked);
                 }
@@ -359,36 +436,29 @@ namespace RenderStar::Client::UI
             // Find the nearest ScrollBox ancestor (or self)
             for (auto it = layerStack.rbegin(); it != layerStack.rend(); ++it)
             {
-                // Check if the hovered element or any ancestor has a ScrollBox
+                // Elements are depth-first, so the first hit is the outermost scroll box under the cursor
                 UIElement* scrollElement = nullptr;
-                std::function<bool(UIElement&)> findScrollParent = [&](UIElement& el) -> bool
+                for (auto& el : it->scene.elements)
                 {
-                    if (el.GetScrollBox())
-                    {
-                        // Check if cursor is inside this element's rect
-                        auto rIt = computedRects.find(el.id);
-                        if (rIt != computedRects.end())
-                        {
-                            auto& r = rIt->second;
-                            if (cursor.x >= r.x && cursor.x <= r.x + r.w &&
-                                cursor.y >= r.y && cursor.y <= r.y + r.h)
-                            {
-                                scrollElement = &el;
-                                return true;
-                            }
-                        }
-                    }
-                    for (auto& child : el.children)
+                    if (!el.GetScrollBox() || el.id.empty())
+                        continue;
+
+                    auto rIt = computedRects.find(std::string(el.id));
+                    if (rIt == computedRects.end())
+                        continue;
+
+                    auto& r = rIt->second;
+                    if (cursor.x >= r.x && cursor.x <= r.x + r.w &&
+                        cursor.y >= r.y && cursor.y <= r.y + r.h)
                     {
-                        if (findScrollParent(child))
-                            return true;
+                        scrollElement = &el;
+                        break;
                     }
-                    return false;
-                };
-                findScrollParent(it->scene.root);
+                }
 
-                if (scrollElement && !scrollElement->id.empty())
+                if (scrollElement)
                 {
+                    const std::string scrollId(scrollElement->id);
                     auto* sb = scrollElement->GetScrollBox();
                     bool isHoriz = (sb && sb->direction == 1);
 
@@ -397,17 +467,21 @@ namespace RenderStar::Client::UI
                         ? (scrollDelta.x != 0.0 ? static_cast<float>(scrollDelta.x) : static_cast<float>(scrollDelta.y))
                         : static_cast<float>(scrollDelta.y);
 
-                    scrollOffsets[scrollElement->id] -= wheelDelta * 30.0f;
+                    const float previousOffset = scrollOffsets[scrollId];
+                    scrollOffsets[scrollId] -= wheelDelta * 30.0f;
 
                     float maxScroll = 0.0f;
-                    auto cIt = scrollContentSizes.find(scrollElement->id);
-                    auto rIt = computedRects.find(scrollElement->id);
+                    auto cIt = scrollContentSizes.find(scrollId);
+                    auto rIt = computedRects.find(scrollId);
                     if (cIt != scrollContentSizes.end() && rIt != computedRects.end())
                     {
                         float visibleSize = isHoriz ? rIt->second.w : rIt->second.h;
                         maxScroll = std::max(0.0f, cIt->second - visibleSize);
                     }
-                    scrollOffsets[scrollElement->id] = std::clamp(scrollOffsets[scrollElement->id], 0.0f, maxScroll);
+                    scrollOffsets[scrollId] = std::clamp(scrollOffsets[scrollId], 0.0f, maxScroll);
+
+                    if (scrollOffsets[scrollId] != previousOffset)
+                        MarkDirty();
                     break;
                 }
             }
@@ -416,7 +490,11 @@ namespace RenderStar::Client::UI
         // Keyboard for TextInput
         if (!focusedElementId.empty())
         {
-            UIElement* focusedElement = FindById(focusedElementId);
+            // Looked up directly so a focused but untouched input does not dirty the frame
+            UIElement* focusedElement = nullptr;
+            for (auto it = layerStack.rbegin(); it != layerStack.rend() && !focusedElement; ++it)
+                focusedElement = it->scene.FindById(focusedElementId);
+
             if (focusedElement)
             {
                 auto* textInput = focusedElement->GetTextInput();
@@ -494,6 +572,8 @@ namespace RenderStar::Client::UI
 
                     if (changed)
                     {
+                        MarkDirty();
+
                         auto it = textChangedHandlers.find(focusedElementId);
                         if (it != textChangedHandlers.end())
                             it->second(textInput->text);
@@ -503,52 +583,24 @@ namespace RenderStar::Client::UI
                 }
             }
         }
-    }
 
-    UIElement* UIStackModule::HitTest(double cursorX, double cursorY)
-    {
-        // Traverse layers top-to-bottom (last layer = topmost)
-        for (auto it = layerStack.rbegin(); it != layerStack.rend(); ++it)
-        {
-            UIElement* hit = HitTestElement(it->scene.root, cursorX, cursorY);
-            if (hit) return hit;
-        }
-        return nullptr;
+        if (hoveredElementId != previousHovered || focusedElementId != previousFocused ||
+            expandedDropdownId != previousExpanded || draggingScrollbarId != previousDragging)
+            MarkDirty();
     }
 
-    UIElement* UIStackModule::HitTestElement(UIElement& element, double cursorX, double cursorY)
+    UIElement* UIStackModule::HitTest(double cursorX, double cursorY)
     {
-        // Check children in reverse order (last child = rendered on top)
-        for (auto it = element.children.rbegin(); it != element.children.rend(); ++it)
-        {
-            UIElement* hit = HitTestElement(*it, cursorX, cursorY);
-            if (hit) return hit;
-        }
-
-        // Check this element if it has an interactive component
-        if (!element.id.empty() &&
-            (element.GetButton() || element.GetToggle() || element.GetTextInput() || element.GetDropdown() || element.GetScrollBox()))
-        {
-            auto rIt = computedRects.find(element.id);
-            if (rIt != computedRects.end())
-            {
-                auto& r = rIt->second;
-                if (cursorX >= r.x && cursorX <= r.x + r.w &&
-                    cursorY >= r.y && cursorY <= r.y + r.h)
-                {
-                    return &element;
-                }
-            }
-        }
-
-        return nullptr;
+        // The index is filled in paint order across all layers, so the last rect under the cursor is the topmost.
+        // Elements are only ever const while being drawn; the layer stack owns them mutably.
+        return const_cast<UIElement*>(hitIndex.Query(cursorX, cursorY));
     }
 
     // ─── Rendering ───────────────────────────────────────────────────
 
     void UIStackModule::Render(Render::IRenderBackend* backend)
     {
-        if (!backend || !shader || !shader->IsValid() || !quadMesh || !quadMesh->IsValid())
+        if (!backend || !shader || !shader->IsValid() || !whiteTexture)
             return;
 
         if (layerStack.empty())
@@ -559,8 +611,43 @@ namespace RenderStar::Client::UI
         currentFrameIndex = backend->GetCurrentFrame();
         maxFramesInFlight = backend->GetMaxFramesInFlight();
         uniformPoolIndex = 0;
+
+        if (screenW != builtScreenW || screenH != builtScreenH)
+            MarkDirty();
+
+        // Rebuild only when something changed; otherwise the retained batches are resubmitted as they are
+        if (builtGeneration != contentGeneration)
+        {
+            builtGeneration = contentGeneration;
+            builtScreenW = screenW;
+            builtScreenH = screenH;
+
+            fontAtlas.BeginBuild();
+            const uint64_t atlasGeneration = fontAtlas.GetLayoutGeneration();
+
+            BuildFrame();
+
+            // The glyph page was repacked mid-build, so quads emitted before that carry stale UVs
+            if (fontAtlas.GetLayoutGeneration() != atlasGeneration)
+                BuildFrame();
+        }
+
+        fontAtlas.Flush();
+        SubmitBatches(backend);
+
+        backend->BeginOverlayPass();
+        backend->ExecuteDrawCommands();
+        backend->EndOverlayPass();
+        currentRenderLayer = nullptr;
+    }
+
+    void UIStackModule::BuildFrame()
+    {
         computedRects.clear();
         scrollbarThumbRects.clear();
+        hitIndex.Reset(screenW, screenH);
+
+        batcher.Begin(screenW, screenH);
 
         for (auto& layer : layerStack)
         {
@@ -573,16 +660,14 @@ namespace RenderStar::Client::UI
             scaleX = screenW / designW;
             scaleY = screenH / designH;
 
-            RenderElement(layer.scene.root, backend, 0.0f, 0.0f, screenW, screenH);
+            if (const UIElement* root = layer.scene.GetRoot())
+                RenderElement(*root, 0.0f, 0.0f, screenW, screenH);
         }
 
-        backend->BeginOverlayPass();
-        backend->ExecuteDrawCommands();
-        backend->EndOverlayPass();
-        currentRenderLayer = nullptr;
+        batcher.End();
     }
 
-    void UIStackModule::RenderElement(const UIElement& element, Render::IRenderBackend* backend,
+    void UIStackModule::RenderElement(const UIElement& element,
         float parentX, float parentY, float parentW, float parentH)
     {
         const TransformData* t = element.GetTransform();
@@ -591,7 +676,25 @@ namespace RenderStar::Client::UI
 
         if (t)
         {
-            ComputeRect(*t, parentX, parentY, parentW, parentH, ex, ey, ew, eh);
+            UIElementLayout& layout = element.layout;
+
+            if (!layout.Matches(*t, parentX, parentY, parentW, parentH, scaleX, scaleY))
+            {
+                ComputeRect(*t, parentX, parentY, parentW, parentH, layout.x, layout.y, layout.w, layout.h);
+                layout.transform = *t;
+                layout.parentX = parentX;
+                layout.parentY = parentY;
+                layout.parentW = parentW;
+                layout.parentH = parentH;
+                layout.scaleX = scaleX;
+                layout.scaleY = scaleY;
+                layout.valid = true;
+            }
+
+            ex = layout.x;
+            ey = layout.y;
+            ew = layout.w;
+            eh = layout.h;
         }
         else
         {
@@ -605,7 +708,12 @@ namespace RenderStar::Client::UI
 
         // Cache computed rect for hit-testing
         if (!element.id.empty())
-            computedRects[element.id] = {ex, ey, ew, eh};
+        {
+            computedRects[std::string(element.id)] = {ex, ey, ew, eh};
+
+            if (element.GetButton() || element.GetToggle() || element.GetTextInput() || element.GetDropdown() || element.GetScrollBox())
+                hitIndex.Insert(&element, ex, ey, ew, eh);
+        }
 
         float uniformScale = std::min(scaleX, scaleY);
 
@@ -616,13 +724,13 @@ namespace RenderStar::Client::UI
             if (panel->borderWidth > 0)
             {
                 float bw = static_cast<float>(panel->borderWidth) * uniformScale;
-                DrawQuad(backend, ex, ey, ew, eh, 0, 0, 1, 1, panel->borderColor, whiteTexture.get(), rotation, cr);
-                DrawQuad(backend, ex + bw, ey + bw, ew - 2 * bw, eh - 2 * bw, 0, 0, 1, 1,
+                DrawQuad(ex, ey, ew, eh, 0, 0, 1, 1, panel->borderColor, whiteTexture.get(), rotation, cr);
+                DrawQuad(ex + bw, ey + bw, ew - 2 * bw, eh - 2 * bw, 0, 0, 1, 1,
                     panel->backgroundColor, whiteTexture.get(), rotation, std::max(0.0f, cr - bw));
             }
             else
             {
-                DrawQuad(backend, ex, ey, ew, eh, 0, 0, 1, 1, panel->backgroundColor, whiteTexture.get(), rotation, cr);
+                DrawQuad(ex, ey, ew, eh, 0, 0, 1, 1, panel->backgroundColor, whiteTexture.get(), rotation, cr);
             }
         }
 
@@ -633,7 +741,7 @@ namespace RenderStar::Client::UI
             {
                 auto* tex = GetOrUploadTexture(img->imagePath, *currentRenderLayer);
                 if (tex)
-                    DrawQuad(backend, ex, ey, ew, eh, 0, 0, 1, 1, img->tint, tex, rotation);
+                    DrawQuad(ex, ey, ew, eh, 0, 0, 1, 1, img->tint, tex, rotation);
             }
         }
 
@@ -649,9 +757,9 @@ namespace RenderStar::Client::UI
                 {
                     bool hasSlice = btn->sliceLeft > 0 || btn->sliceTop > 0 || btn->sliceRight > 0 || btn->sliceBottom > 0;
                     if (hasSlice)
-                        DrawNineSlice(backend, ex, ey, ew, eh, btn->sliceLeft, btn->sliceTop, btn->sliceRight, btn->sliceBottom, tex, {1, 1, 1, 1}, btnCR);
+                        DrawNineSlice(ex, ey, ew, eh, btn->sliceLeft, btn->sliceTop, btn->sliceRight, btn->sliceBottom, tex, {1, 1, 1, 1}, btnCR);
                     else
-                        DrawQuad(backend, ex, ey, ew, eh, 0, 0, 1, 1, {1, 1, 1, 1}, tex, rotation, btnCR);
+                        DrawQuad(ex, ey, ew, eh, 0, 0, 1, 1, {1, 1, 1, 1}, tex, rotation, btnCR);
                 }
                 else
                 {
@@ -662,8 +770,8 @@ namespace RenderStar::Client::UI
                         std::min(1.0f, btn->backgroundColor.b * 1.5f + 0.08f),
                         btn->backgroundColor.a };
                     float edgePx = 1.5f * uniformScale;
-                    DrawQuad(backend, ex, ey, ew, eh, 0, 0, 1, 1, highlight, whiteTexture.get(), rotation, btnCR);
-                    DrawQuad(backend, ex + edgePx, ey + edgePx, ew - 2 * edgePx, eh - 2 * edgePx, 0, 0, 1, 1,
+                    DrawQuad(ex, ey, ew, eh, 0, 0, 1, 1, highlight, whiteTexture.get(), rotation, btnCR);
+                    DrawQuad(ex + edgePx, ey + edgePx, ew - 2 * edgePx, eh - 2 * edgePx, 0, 0, 1, 1,
                         btn->backgroundColor, whiteTexture.get(), rotation, std::max(0.0f, btnCR - edgePx));
                 }
             }
@@ -676,8 +784,8 @@ namespace RenderStar::Client::UI
                     std::min(1.0f, btn->backgroundColor.b * 1.5f + 0.08f),
                     btn->backgroundColor.a };
                 float edgePx = 1.5f * uniformScale;
-                DrawQuad(backend, ex, ey, ew, eh, 0, 0, 1, 1, highlight, whiteTexture.get(), rotation, btnCR);
-                DrawQuad(backend, ex + edgePx, ey + edgePx, ew - 2 * edgePx, eh - 2 * edgePx, 0, 0, 1, 1,
+                DrawQuad(ex, ey, ew, eh, 0, 0, 1, 1, highlight, whiteTexture.get(), rotation, btnCR);
+                DrawQuad(ex + edgePx, ey + edgePx, ew - 2 * edgePx, eh - 2 * edgePx, 0, 0, 1, 1,
                     btn->backgroundColor, whiteTexture.get(), rotation, std::max(0.0f, btnCR - edgePx));
             }
         }
@@ -686,13 +794,13 @@ namespace RenderStar::Client::UI
         if (const auto* prog = element.GetProgressBar())
         {
             float cr = static_cast<float>(prog->cornerRadius) * uniformScale;
-            DrawQuad(backend, ex, ey, ew, eh, 0, 0, 1, 1, prog->backgroundColor, whiteTexture.get(), 0.0f, cr);
+            DrawQuad(ex, ey, ew, eh, 0, 0, 1, 1, prog->backgroundColor, whiteTexture.get(), 0.0f, cr);
 
             float value = static_cast<float>(std::clamp(prog->value, 0.0, 1.0));
             if (prog->direction == 0)
-                DrawQuad(backend, ex, ey, ew * value, eh, 0, 0, 1, 1, prog->fillColor, whiteTexture.get(), 0.0f, cr);
+                DrawQuad(ex, ey, ew * value, eh, 0, 0, 1, 1, prog->fillColor, whiteTexture.get(), 0.0f, cr);
             else
-                DrawQuad(backend, ex, ey + eh * (1.0f - value), ew, eh * value, 0, 0, 1, 1, prog->fillColor, whiteTexture.get(), 0.0f, cr);
+                DrawQuad(ex, ey + eh * (1.0f - value), ew, eh * value, 0, 0, 1, 1, prog->fillColor, whiteTexture.get(), 0.0f, cr);
         }
 
         // ── Toggle ──
@@ -700,13 +808,13 @@ namespace RenderStar::Client::UI
         {
             const UibinColor& trackColor = toggle->checked ? toggle->onColor : toggle->offColor;
             float trackCR = eh * 0.5f;
-            DrawQuad(backend, ex, ey, ew, eh, 0, 0, 1, 1, trackColor, whiteTexture.get(), 0.0f, trackCR);
+            DrawQuad(ex, ey, ew, eh, 0, 0, 1, 1, trackColor, whiteTexture.get(), 0.0f, trackCR);
 
             float togglePad = 2.0f * uniformScale;
             float knobSize = eh - 2.0f * togglePad;
             float knobX = toggle->checked ? ex + ew - knobSize - togglePad : ex + togglePad;
             float knobY = ey + togglePad;
-            DrawQuad(backend, knobX, knobY, knobSize, knobSize, 0, 0, 1, 1, toggle->knobColor, whiteTexture.get(), 0.0f, knobSize * 0.5f);
+            DrawQuad(knobX, knobY, knobSize, knobSize, 0, 0, 1, 1, toggle->knobColor, whiteTexture.get(), 0.0f, knobSize * 0.5f);
         }
 
         // ── TextInput ──
@@ -716,8 +824,8 @@ namespace RenderStar::Client::UI
             float borderPx = 1.0f * uniformScale;
             float insetPx = 6.0f * uniformScale;
             // Border
-            DrawQuad(backend, ex, ey, ew, eh, 0, 0, 1, 1, textInput->borderColor, whiteTexture.get(), 0.0f, cr);
-            DrawQuad(backend, ex + borderPx, ey + borderPx, ew - 2 * borderPx, eh - 2 * borderPx, 0, 0, 1, 1, textInput->backgroundColor, whiteTexture.get(), 0.0f, std::max(0.0f, cr - borderPx));
+            DrawQuad(ex, ey, ew, eh, 0, 0, 1, 1, textInput->borderColor, whiteTexture.get(), 0.0f, cr);
+            DrawQuad(ex + borderPx, ey + borderPx, ew - 2 * borderPx, eh - 2 * borderPx, 0, 0, 1, 1, textInput->backgroundColor, whiteTexture.get(), 0.0f, std::max(0.0f, cr - borderPx));
 
             if (currentRenderLayer)
             {
@@ -729,29 +837,21 @@ namespace RenderStar::Client::UI
                 td.fontPath = textInput->fontFamily;
                 td.alignment = AnchorFlags::LEFT | AnchorFlags::CENTER_Y;
                 // Inset text slightly
-                RenderText(backend, td, ex + insetPx, ey, ew - 2 * insetPx, eh, *currentRenderLayer);
+                RenderText(td, ex + insetPx, ey, ew - 2 * insetPx, eh, *currentRenderLayer);
             }
 
             // Cursor when focused
             if (focusedElementId == element.id && currentRenderLayer)
             {
                 // Simple cursor at end of text
-                std::string cacheKey = textInput->fontFamily + ":" + std::to_string(textInput->pixelSize);
-                auto cacheIt = fontCache.find(cacheKey);
                 float cursorX = ex + insetPx;
-                if (cacheIt != fontCache.end())
-                {
-                    FontAtlas* atlas = cacheIt->second.get();
-                    for (char c : textInput->text)
-                    {
-                        const auto* glyph = atlas->GetGlyph(static_cast<uint32_t>(c));
-                        if (glyph) cursorX += glyph->advance;
-                    }
-                }
+                const int32_t face = ResolveFontFace(textInput->fontFamily, *currentRenderLayer);
+                if (const auto* run = fontAtlas.Shape(face, ScaledFontSize(textInput->pixelSize), textInput->text))
+                    cursorX += run->width;
                 float cursorPad = 4.0f * uniformScale;
                 float cursorH = eh - 2 * cursorPad;
                 float cursorY = ey + cursorPad;
-                DrawQuad(backend, cursorX, cursorY, 1.0f * uniformScale, cursorH, 0, 0, 1, 1, textInput->textColor, whiteTexture.get());
+                DrawQuad(cursorX, cursorY, 1.0f * uniformScale, cursorH, 0, 0, 1, 1, textInput->textColor, whiteTexture.get());
             }
         }
 
@@ -764,8 +864,8 @@ namespace RenderStar::Client::UI
             bool isExpanded = (expandedDropdownId == element.id);
 
             // Main dropdown box
-            DrawQuad(backend, ex, ey, ew, eh, 0, 0, 1, 1, dropdown->borderColor, whiteTexture.get(), 0.0f, cr);
-            DrawQuad(backend, ex + borderPx, ey + borderPx, ew - 2 * borderPx, eh - 2 * borderPx, 0, 0, 1, 1, dropdown->backgroundColor, whiteTexture.get(), 0.0f, std::max(0.0f, cr - borderPx));
+            DrawQuad(ex, ey, ew, eh, 0, 0, 1, 1, dropdown->borderColor, whiteTexture.get(), 0.0f, cr);
+            DrawQuad(ex + borderPx, ey + borderPx, ew - 2 * borderPx, eh - 2 * borderPx, 0, 0, 1, 1, dropdown->backgroundColor, whiteTexture.get(), 0.0f, std::max(0.0f, cr - borderPx));
 
             // Parse all options
             std::vector<std::string> opts;
@@ -793,7 +893,7 @@ namespace RenderStar::Client::UI
                     td.color = dropdown->textColor;
                     td.pixelSize = effectivePixelSize;
                     td.alignment = AnchorFlags::CENTER_X | AnchorFlags::CENTER_Y;
-                    RenderText(backend, td, ex + ddInset, ey, ew - 2 * ddInset, eh, *currentRenderLayer);
+                    RenderText(td, ex + ddInset, ey, ew - 2 * ddInset, eh, *currentRenderLayer);
                 }
 
                 // Arrow indicator
@@ -806,7 +906,7 @@ namespace RenderStar::Client::UI
                     arrow.color = dropdown->textColor;
                     arrow.pixelSize = effectivePixelSize;
                     arrow.alignment = AnchorFlags::RIGHT | AnchorFlags::CENTER_Y;
-                    RenderText(backend, arrow, ex, ey, ew - ddInset, eh, *currentRenderLayer);
+                    RenderText(arrow, ex, ey, ew - ddInset, eh, *currentRenderLayer);
                 }
             }
 
@@ -824,8 +924,8 @@ namespace RenderStar::Client::UI
                         : dropdown->backgroundColor;
 
                     // Option background with border
-                    DrawQuad(backend, ex, oy, ew, optionH, 0, 0, 1, 1, dropdown->borderColor, whiteTexture.get());
-                    DrawQuad(backend, ex + borderPx, oy + borderPx, ew - 2 * borderPx, optionH - 2 * borderPx, 0, 0, 1, 1, optBg, whiteTexture.get());
+                    DrawQuad(ex, oy, ew, optionH, 0, 0, 1, 1, dropdown->borderColor, whiteTexture.get());
+                    DrawQuad(ex + borderPx, oy + borderPx, ew - 2 * borderPx, optionH - 2 * borderPx, 0, 0, 1, 1, optBg, whiteTexture.get());
 
                     // Option text (centered)
                     {
@@ -837,7 +937,7 @@ namespace RenderStar::Client::UI
                         optTd.color = dropdown->textColor;
                         optTd.pixelSize = effectivePixelSize;
                         optTd.alignment = AnchorFlags::CENTER_X | AnchorFlags::CENTER_Y;
-                        RenderText(backend, optTd, ex + ddInset, oy, ew - 2 * ddInset, optionH, *currentRenderLayer);
+                        RenderText(optTd, ex + ddInset, oy, ew - 2 * ddInset, optionH, *currentRenderLayer);
                     }
                 }
             }
@@ -853,7 +953,7 @@ namespace RenderStar::Client::UI
                 float ix = ex + (ew - iSize) * 0.5f;
                 float iy = ey + (eh - iSize) * 0.5f;
                 if (tex)
-                    DrawQuad(backend, ix, iy, iSize, iSize, 0, 0, 1, 1, icon->tintColor, tex, rotation);
+                    DrawQuad(ix, iy, iSize, iSize, 0, 0, 1, 1, icon->tintColor, tex, rotation);
             }
         }
 
@@ -875,7 +975,7 @@ namespace RenderStar::Client::UI
                     float v0 = (row * fh) / texH;
                     float u1 = ((col + 1) * fw) / texW;
                     float v1 = ((row + 1) * fh) / texH;
-                    DrawQuad(backend, ex, ey, ew, eh, u0, v0, u1, v1, {1, 1, 1, 1}, tex, rotation);
+                    DrawQuad(ex, ey, ew, eh, u0, v0, u1, v1, {1, 1, 1, 1}, tex, rotation);
                 }
             }
         }
@@ -899,13 +999,13 @@ namespace RenderStar::Client::UI
                 float ih = (repeater->direction == 0) ? itemH : eh;
 
                 const UibinColor& color = (i % 2 == 0) ? repeater->itemColor : repeater->alternateColor;
-                DrawQuad(backend, ix, iy, iw, ih, 0, 0, 1, 1, color, whiteTexture.get(), 0.0f, 0.0f);
+                DrawQuad(ix, iy, iw, ih, 0, 0, 1, 1, color, whiteTexture.get(), 0.0f, 0.0f);
 
                 if (repeater->borderColor.a > 0)
                 {
                     float bw = 1.0f * uniformScale;
-                    DrawQuad(backend, ix, iy, iw, bw, 0, 0, 1, 1, repeater->borderColor, whiteTexture.get());
-                    DrawQuad(backend, ix, iy + ih - bw, iw, bw, 0, 0, 1, 1, repeater->borderColor, whiteTexture.get());
+                    DrawQuad(ix, iy, iw, bw, 0, 0, 1, 1, repeater->borderColor, whiteTexture.get());
+                    DrawQuad(ix, iy + ih - bw, iw, bw, 0, 0, 1, 1, repeater->borderColor, whiteTexture.get());
                 }
             }
         }
@@ -926,7 +1026,7 @@ namespace RenderStar::Client::UI
             {
                 const UibinColor& color = (i == radial->highlightIndex)
                     ? radial->highlightColor : radial->sliceColor;
-                DrawArcSlice(backend, rcx, rcy, outerR, meshes.slices[i].get(), color);
+                DrawArcSlice(rcx, rcy, outerR, meshes.slices[i], color);
             }
 
             // Slice separator lines (thin rotated quads from inner to outer edge)
@@ -946,16 +1046,14 @@ namespace RenderStar::Client::UI
                     float lineCx = rcx + midR * std::cos(a);
                     float lineCy = rcy + midR * std::sin(a);
 
-                    DrawQuad(backend, lineCx - lineW * 0.5f, lineCy - radialThickness * 0.5f,
+                    DrawQuad(lineCx - lineW * 0.5f, lineCy - radialThickness * 0.5f,
                         lineW, radialThickness, 0, 0, 1, 1,
                         radial->borderColor, whiteTexture.get(), rotDeg, 0.0f);
                 }
 
                 // Border rings (custom arc meshes)
-                if (meshes.outerRing)
-                    DrawArcSlice(backend, rcx, rcy, outerR, meshes.outerRing.get(), radial->borderColor);
-                if (meshes.innerRing)
-                    DrawArcSlice(backend, rcx, rcy, outerR, meshes.innerRing.get(), radial->borderColor);
+                DrawArcSlice(rcx, rcy, outerR, meshes.outerRing, radial->borderColor);
+                DrawArcSlice(rcx, rcy, outerR, meshes.innerRing, radial->borderColor);
             }
         }
 
@@ -980,15 +1078,16 @@ namespace RenderStar::Client::UI
             for (int i = 0; i < tabCount; ++i)
             {
                 const UibinColor& color = (i == tabs->activeTab) ? tabs->activeColor : tabs->inactiveColor;
-                DrawQuad(backend, ex + i * tabW, ey, tabW, tabH, 0, 0, 1, 1, color, whiteTexture.get());
+                DrawQuad(ex + i * tabW, ey, tabW, tabH, 0, 0, 1, 1, color, whiteTexture.get());
             }
 
             // Draw content area
-            DrawQuad(backend, ex, ey + tabH, ew, eh - tabH, 0, 0, 1, 1, tabs->backgroundColor, whiteTexture.get());
+            DrawQuad(ex, ey + tabH, ew, eh - tabH, 0, 0, 1, 1, tabs->backgroundColor, whiteTexture.get());
 
             // Render only active tab's child
-            if (tabs->activeTab >= 0 && tabs->activeTab < static_cast<int>(element.children.size()))
-                RenderElement(element.children[tabs->activeTab], backend, ex, ey + tabH, ew, eh - tabH);
+            const auto children = element.Children();
+            if (tabs->activeTab >= 0 && tabs->activeTab < static_cast<int>(children.size()))
+                RenderElement(*std::next(children.begin(), tabs->activeTab), ex, ey + tabH, ew, eh - tabH);
             return;
         }
 
@@ -1001,15 +1100,15 @@ namespace RenderStar::Client::UI
             float cr = static_cast<float>(slot->cornerRadius) * uniformScale;
 
             // Border
-            DrawQuad(backend, slotX, slotY, slotSz, slotSz, 0, 0, 1, 1, slot->borderColor, whiteTexture.get(), 0.0f, cr);
+            DrawQuad(slotX, slotY, slotSz, slotSz, 0, 0, 1, 1, slot->borderColor, whiteTexture.get(), 0.0f, cr);
             float bw = 1.0f * uniformScale;
-            DrawQuad(backend, slotX + bw, slotY + bw, slotSz - 2 * bw, slotSz - 2 * bw, 0, 0, 1, 1,
+            DrawQuad(slotX + bw, slotY + bw, slotSz - 2 * bw, slotSz - 2 * bw, 0, 0, 1, 1,
                 slot->backgroundColor, whiteTexture.get(), 0.0f, std::max(0.0f, cr - bw));
 
             if (slot->isEmpty)
             {
                 float inset = 4.0f * uniformScale;
-                DrawQuad(backend, slotX + inset, slotY + inset, slotSz - 2 * inset, slotSz - 2 * inset, 0, 0, 1, 1,
+                DrawQuad(slotX + inset, slotY + inset, slotSz - 2 * inset, slotSz - 2 * inset, 0, 0, 1, 1,
                     slot->emptyColor, whiteTexture.get(), 0.0f, std::max(0.0f, cr - inset));
             }
             else if (!slot->iconPath.empty() && currentRenderLayer)
@@ -1018,7 +1117,7 @@ namespace RenderStar::Client::UI
                 if (tex)
                 {
                     float inset = 4.0f * uniformScale;
-                    DrawQuad(backend, slotX + inset, slotY + inset, slotSz - 2 * inset, slotSz - 2 * inset, 0, 0, 1, 1,
+                    DrawQuad(slotX + inset, slotY + inset, slotSz - 2 * inset, slotSz - 2 * inset, 0, 0, 1, 1,
                         {1, 1, 1, 1}, tex, 0.0f, 0.0f);
                 }
             }
@@ -1030,8 +1129,8 @@ namespace RenderStar::Client::UI
             float cr = (minimap->shape == 1) ? std::min(ew, eh) * 0.5f : 0.0f;
             float bw = static_cast<float>(minimap->borderWidth) * uniformScale;
 
-            DrawQuad(backend, ex, ey, ew, eh, 0, 0, 1, 1, minimap->borderColor, whiteTexture.get(), 0.0f, cr);
-            DrawQuad(backend, ex + bw, ey + bw, ew - 2 * bw, eh - 2 * bw, 0, 0, 1, 1,
+            DrawQuad(ex, ey, ew, eh, 0, 0, 1, 1, minimap->borderColor, whiteTexture.get(), 0.0f, cr);
+            DrawQuad(ex + bw, ey + bw, ew - 2 * bw, eh - 2 * bw, 0, 0, 1, 1,
                 minimap->backgroundColor, whiteTexture.get(), 0.0f, std::max(0.0f, cr - bw));
 
             // Viewport indicator (centered placeholder)
@@ -1039,7 +1138,7 @@ namespace RenderStar::Client::UI
             float vpH = (eh - 2 * bw) * 0.3f;
             float vpX = ex + (ew - vpW) * 0.5f;
             float vpY = ey + (eh - vpH) * 0.5f;
-            DrawQuad(backend, vpX, vpY, vpW, vpH, 0, 0, 1, 1, minimap->viewportColor, whiteTexture.get(), 0.0f, 0.0f);
+            DrawQuad(vpX, vpY, vpW, vpH, 0, 0, 1, 1, minimap->viewportColor, whiteTexture.get(), 0.0f, 0.0f);
         }
 
         // ── Tooltip ──
@@ -1047,8 +1146,8 @@ namespace RenderStar::Client::UI
         {
             float cr = 4.0f * uniformScale;
             float bw = 1.0f * uniformScale;
-            DrawQuad(backend, ex, ey, ew, eh, 0, 0, 1, 1, tooltip->borderColor, whiteTexture.get(), 0.0f, cr);
-            DrawQuad(backend, ex + bw, ey + bw, ew - 2 * bw, eh - 2 * bw, 0, 0, 1, 1,
+            DrawQuad(ex, ey, ew, eh, 0, 0, 1, 1, tooltip->borderColor, whiteTexture.get(), 0.0f, cr);
+            DrawQuad(ex + bw, ey + bw, ew - 2 * bw, eh - 2 * bw, 0, 0, 1, 1,
                 tooltip->backgroundColor, whiteTexture.get(), 0.0f, std::max(0.0f, cr - bw));
 
             if (!tooltip->tooltipText.empty() && currentRenderLayer)
@@ -1060,7 +1159,7 @@ namespace RenderStar::Client::UI
                 td.pixelSize = tooltip->pixelSize;
                 td.fontPath = tooltip->fontFamily;
                 td.alignment = AnchorFlags::CENTER_X | AnchorFlags::CENTER_Y;
-                RenderText(backend, td, ex + bw, ey + bw, ew - 2 * bw, eh - 2 * bw, *currentRenderLayer);
+                RenderText(td, ex + bw, ey + bw, ew - 2 * bw, eh - 2 * bw, *currentRenderLayer);
             }
         }
 
@@ -1072,7 +1171,7 @@ namespace RenderStar::Client::UI
 
             float cr = static_cast<float>(modal->cornerRadius) * uniformScale;
             float modalBorder = 1.0f * uniformScale;
-            DrawQuad(backend, parentX, parentY, parentW, parentH, 0, 0, 1, 1, modal->overlayColor, whiteTexture.get());
+            DrawQuad(parentX, parentY, parentW, parentH, 0, 0, 1, 1, modal->overlayColor, whiteTexture.get());
 
             float panelW = ew * 0.7f;
             float panelH = eh * 0.7f;
@@ -1081,12 +1180,12 @@ namespace RenderStar::Client::UI
 
             if (modal->borderColor.a > 0)
             {
-                DrawQuad(backend, panelX - modalBorder, panelY - modalBorder, panelW + 2 * modalBorder, panelH + 2 * modalBorder, 0, 0, 1, 1, modal->borderColor, whiteTexture.get(), 0.0f, cr);
+                DrawQuad(panelX - modalBorder, panelY - modalBorder, panelW + 2 * modalBorder, panelH + 2 * modalBorder, 0, 0, 1, 1, modal->borderColor, whiteTexture.get(), 0.0f, cr);
             }
-            DrawQuad(backend, panelX, panelY, panelW, panelH, 0, 0, 1, 1, modal->panelColor, whiteTexture.get(), 0.0f, cr);
+            DrawQuad(panelX, panelY, panelW, panelH, 0, 0, 1, 1, modal->panelColor, whiteTexture.get(), 0.0f, cr);
 
-            for (const auto& child : element.children)
-                RenderElement(child, backend, panelX, panelY, panelW, panelH);
+            for (const auto& child : element.Children())
+                RenderElement(child, panelX, panelY, panelW, panelH);
             return;
         }
 
@@ -1094,7 +1193,7 @@ namespace RenderStar::Client::UI
         if (const auto* text = element.GetText())
         {
             if (!text->text.empty() && currentRenderLayer)
-                RenderText(backend, *text, ex, ey, ew, eh, *currentRenderLayer);
+                RenderText(*text, ex, ey, ew, eh, *currentRenderLayer);
         }
 
         // ── Button text ──
@@ -1109,7 +1208,7 @@ namespace RenderStar::Client::UI
                 textData.color = btn->textColor;
                 textData.fontPath = btn->fontPath;
                 textData.alignment = AnchorFlags::CENTER_X | AnchorFlags::CENTER_Y;
-                RenderText(backend, textData, ex, ey, ew, eh, *currentRenderLayer);
+                RenderText(textData, ex, ey, ew, eh, *currentRenderLayer);
             }
         }
 
@@ -1119,7 +1218,7 @@ namespace RenderStar::Client::UI
         const auto* gridLayout = element.GetGridLayout();
         const auto* scrollBox = element.GetScrollBox();
 
-        if (scrollBox && !element.children.empty())
+        if (scrollBox && element.childCount > 0)
         {
             bool isHorizontal = (scrollBox->direction == 1);
             float padding = static_cast<float>(scrollBox->padding) * uniformScale;
@@ -1127,7 +1226,7 @@ namespace RenderStar::Client::UI
 
             // Compute total content size
             float totalContent = padding;
-            for (const auto& child : element.children)
+            for (const auto& child : element.Children())
             {
                 const TransformData* ct = child.GetTransform();
                 if (!ct) continue;
@@ -1142,27 +1241,28 @@ namespace RenderStar::Client::UI
             float maxScroll = std::max(0.0f, totalContent - visibleSize);
 
             // Get and clamp scroll offset
+            const std::string elementId(elementId);
             float scrollOffset = 0.0f;
-            if (!element.id.empty())
+            if (!elementId.empty())
             {
-                auto sIt = scrollOffsets.find(element.id);
+                auto sIt = scrollOffsets.find(elementId);
                 if (sIt != scrollOffsets.end())
                 {
                     sIt->second = std::clamp(sIt->second, 0.0f, maxScroll);
                     scrollOffset = sIt->second;
                 }
-                scrollContentSizes[element.id] = totalContent;
+                scrollContentSizes[elementId] = totalContent;
             }
 
-            // Queue scissor before children draws
-            backend->SubmitSetScissor(
+            // Clip children to the scroll viewport (nested scroll boxes intersect)
+            batcher.PushScissor({
                 static_cast<int32_t>(ex), static_cast<int32_t>(ey),
-                static_cast<uint32_t>(ew), static_cast<uint32_t>(eh));
+                static_cast<uint32_t>(ew), static_cast<uint32_t>(eh)});
 
-            // Render children (queues draw commands inside the scissor)
+            // Render children (batched inside the scissor)
             // Subtract child's own x/y offset so layout cursor fully controls positioning
             float cursor = padding - scrollOffset;
-            for (const auto& child : element.children)
+            for (const auto& child : element.Children())
             {
                 const TransformData* ct = child.GetTransform();
                 if (!ct) continue;
@@ -1174,26 +1274,26 @@ namespace RenderStar::Client::UI
 
                 if (isHorizontal)
                 {
-                    RenderElement(child, backend, ex + cursor - childOffX, ey + padding - childOffY, cw, eh - 2 * padding);
+                    RenderElement(child, ex + cursor - childOffX, ey + padding - childOffY, cw, eh - 2 * padding);
                     cursor += cw + spacing;
                 }
                 else
                 {
-                    RenderElement(child, backend, ex + padding - childOffX, ey + cursor - childOffY, ew - 2 * padding, ch);
+                    RenderElement(child, ex + padding - childOffX, ey + cursor - childOffY, ew - 2 * padding, ch);
                     cursor += ch + spacing;
                 }
             }
 
-            // Clear scissor after children
-            backend->SubmitClearScissor();
+            // Restore the enclosing scissor after children
+            batcher.PopScissor();
 
             // Render scrollbar
-            if (maxScroll > 0.0f && !element.id.empty())
+            if (maxScroll > 0.0f && !elementId.empty())
             {
-                bool showScrollbar = (draggingScrollbarId == element.id);
+                bool showScrollbar = (draggingScrollbarId == elementId);
                 if (!showScrollbar && !hoveredElementId.empty())
                 {
-                    auto rIt = computedRects.find(element.id);
+                    auto rIt = computedRects.find(elementId);
                     if (rIt != computedRects.end())
                     {
                         auto& r = rIt->second;
@@ -1205,7 +1305,7 @@ namespace RenderStar::Client::UI
                             if (hcx >= r.x && hcx <= r.x + r.w && hcy >= r.y && hcy <= r.y + r.h)
                                 showScrollbar = true;
                         }
-                        if (hoveredElementId == element.id)
+                        if (hoveredElementId == elementId)
                             showScrollbar = true;
                     }
                 }
@@ -1228,10 +1328,10 @@ namespace RenderStar::Client::UI
                         float thumbW = std::max(trackW * thumbRatio, thumbMinSize);
                         float thumbX = trackX + (maxScroll > 0.0f ? (scrollOffset / maxScroll) * (trackW - thumbW) : 0.0f);
 
-                        DrawQuad(backend, trackX, trackY, trackW, trackThickness, 0, 0, 1, 1, trackColor, whiteTexture.get(), 0.0f, trackThickness * 0.5f);
-                        DrawQuad(backend, thumbX, trackY, thumbW, trackThickness, 0, 0, 1, 1, thumbColor, whiteTexture.get(), 0.0f, trackThickness * 0.5f);
+                        DrawQuad(trackX, trackY, trackW, trackThickness, 0, 0, 1, 1, trackColor, whiteTexture.get(), 0.0f, trackThickness * 0.5f);
+                        DrawQuad(thumbX, trackY, thumbW, trackThickness, 0, 0, 1, 1, thumbColor, whiteTexture.get(), 0.0f, trackThickness * 0.5f);
 
-                        scrollbarThumbRects[element.id] = {thumbX, trackY, thumbW, trackThickness};
+                        scrollbarThumbRects[elementId] = {thumbX, trackY, thumbW, trackThickness};
                     }
                     else
                     {
@@ -1241,10 +1341,10 @@ namespace RenderStar::Client::UI
                         float thumbH = std::max(trackH * thumbRatio, thumbMinSize);
                         float thumbY = trackY + (maxScroll > 0.0f ? (scrollOffset / maxScroll) * (trackH - thumbH) : 0.0f);
 
-                        DrawQuad(backend, trackX, trackY, trackThickness, trackH, 0, 0, 1, 1, trackColor, whiteTexture.get(), 0.0f, trackThickness * 0.5f);
-                        DrawQuad(backend, trackX, thumbY, trackThickness, thumbH, 0, 0, 1, 1, thumbColor, whiteTexture.get(), 0.0f, trackThickness * 0.5f);
+                        DrawQuad(trackX, trackY, trackThickness, trackH, 0, 0, 1, 1, trackColor, whiteTexture.get(), 0.0f, trackThickness * 0.5f);
+                        DrawQuad(trackX, thumbY, trackThickness, thumbH, 0, 0, 1, 1, thumbColor, whiteTexture.get(), 0.0f, trackThickness * 0.5f);
 
-                        scrollbarThumbRects[element.id] = {trackX, thumbY, trackThickness, thumbH};
+                        scrollbarThumbRects[elementId] = {trackX, thumbY, trackThickness, thumbH};
                     }
                 }
             }
@@ -1252,13 +1352,13 @@ namespace RenderStar::Client::UI
             return;
         }
 
-        if (stackLayout && !element.children.empty())
+        if (stackLayout && element.childCount > 0)
         {
             float padding = static_cast<float>(stackLayout->padding) * uniformScale;
             float spacing = static_cast<float>(stackLayout->spacing) * (stackLayout->direction == 0 ? scaleX : scaleY);
             float cursor = padding;
 
-            for (const auto& child : element.children)
+            for (const auto& child : element.Children())
             {
                 const TransformData* ct = child.GetTransform();
                 if (!ct) continue;
@@ -1270,19 +1370,19 @@ namespace RenderStar::Client::UI
 
                 if (stackLayout->direction == 0)
                 {
-                    RenderElement(child, backend, ex + cursor - childOffX, ey + padding - childOffY, cw, eh - 2 * padding);
+                    RenderElement(child, ex + cursor - childOffX, ey + padding - childOffY, cw, eh - 2 * padding);
                     cursor += cw + spacing;
                 }
                 else
                 {
-                    RenderElement(child, backend, ex + padding - childOffX, ey + cursor - childOffY, ew - 2 * padding, ch);
+                    RenderElement(child, ex + padding - childOffX, ey + cursor - childOffY, ew - 2 * padding, ch);
                     cursor += ch + spacing;
                 }
             }
             return;
         }
 
-        if (gridLayout && !element.children.empty())
+        if (gridLayout && element.childCount > 0)
         {
             float padding = static_cast<float>(gridLayout->padding) * uniformScale;
             float spacingH = static_cast<float>(gridLayout->spacingH) * scaleX;
@@ -1293,20 +1393,22 @@ namespace RenderStar::Client::UI
 
             // First pass: find tallest child in each row
             std::vector<float> rowHeights;
-            for (size_t i = 0; i < element.children.size(); ++i)
+            size_t i = 0;
+            for (const auto& child : element.Children())
             {
-                size_t row = i / cols;
+                size_t row = i++ / cols;
                 if (row >= rowHeights.size())
                     rowHeights.push_back(0.0f);
 
-                const TransformData* ct = element.children[i].GetTransform();
+                const TransformData* ct = child.GetTransform();
                 float ch = ct ? static_cast<float>(ct->scaleY) * scaleY : 40.0f * scaleY;
                 rowHeights[row] = std::max(rowHeights[row], ch);
             }
 
             // Second pass: render
             float cursorY = padding;
-            for (size_t i = 0; i < element.children.size(); ++i)
+            i = 0;
+            for (const auto& child : element.Children())
             {
                 int col = static_cast<int>(i % cols);
                 size_t row = i / cols;
@@ -1317,14 +1419,15 @@ namespace RenderStar::Client::UI
                 float cx = ex + padding + col * (cellW + spacingH);
                 float cy = ey + cursorY;
 
-                RenderElement(element.children[i], backend, cx, cy, cellW, rowHeights[row]);
+                RenderElement(child, cx, cy, cellW, rowHeights[row]);
+                ++i;
             }
             return;
         }
 
         // Default: recurse into children (children render ON TOP — the UIStack principle)
-        for (const auto& child : element.children)
-            RenderElement(child, backend, ex, ey, ew, eh);
+        for (const auto& child : element.Children())
+            RenderElement(child, ex, ey, ew, eh);
     }
 
     void UIStackModule::ComputeRect(const TransformData& t,
@@ -1354,44 +1457,76 @@ namespace RenderStar::Client::UI
         outY = baseY + static_cast<float>(t.y) * scaleY;
     }
 
-    void UIStackModule::DrawQuad(Render::IRenderBackend* backend,
+    void UIStackModule::DrawQuad(
         float x, float y, float w, float h,
         float u0, float v0, float u1, float v1,
         const UibinColor& tint, Render::ITextureHandle* texture,
-        float rotation, float cornerRadius)
+        float rotation, float cornerRadius, bool distanceField)
     {
         if (!texture || w <= 0 || h <= 0) return;
 
+        batcher.AddQuad(texture, {x, y, w, h, u0, v0, u1, v1, tint, rotation, cornerRadius, distanceField});
+    }
+
+    void UIStackModule::SubmitBatches(Render::IRenderBackend* backend)
+    {
+        if (batcher.IsEmpty())
+            return;
+
         int32_t frameIndex = backend->GetCurrentFrame();
 
+        while (static_cast<int32_t>(batchMeshes.size()) < maxFramesInFlight)
+            batchMeshes.push_back(std::make_unique<Render::Resource::Mesh>(*bufferManager, UIVertex::LAYOUT, Render::PrimitiveType::TRIANGLES));
+
+        batchMeshGenerations.resize(batchMeshes.size(), 0);
+
+        // Each frame-in-flight owns its mesh, so rewriting it never races the GPU.
+        // A static UI is uploaded once per frame slot and then only resubmitted.
+        auto& mesh = *batchMeshes[frameIndex];
+
+        if (batchMeshGenerations[frameIndex] != builtGeneration)
+        {
+            const auto vertices = batcher.GetVertices();
+            mesh.SetVertexData(vertices.data(), vertices.size_bytes());
+            mesh.SetIndices(batcher.GetIndices());
+            batchMeshGenerations[frameIndex] = builtGeneration;
+        }
+
+        if (!mesh.IsValid())
+            return;
+
         UIUniformData uniData{};
-        uniData.posX = x;
-        uniData.posY = y;
-        uniData.width = w;
-        uniData.height = h;
-        uniData.u0 = u0;
-        uniData.v0 = v0;
-        uniData.u1 = u1;
-        uniData.v1 = v1;
-        uniData.tintR = tint.r;
-        uniData.tintG = tint.g;
-        uniData.tintB = tint.b;
-        uniData.tintA = tint.a;
         uniData.screenW = screenW;
         uniData.screenH = screenH;
-        uniData.rotation = rotation;
-        uniData.cornerRadius = cornerRadius;
 
-        auto& slot = AcquireUniformSlot();
-        auto* frameBuffer = slot.buffers[frameIndex].get();
-        frameBuffer->SetSubData(&uniData, UIUniformData::Size(), 0);
-        slot.binding->UpdateBuffer(0, frameBuffer, UIUniformData::Size(), frameIndex);
-        slot.binding->UpdateTexture(1, texture, frameIndex);
+        std::optional<UIScissorRect> activeScissor;
 
-        backend->SubmitDrawCommand(shader.get(), slot.binding.get(), frameIndex, quadMesh->GetUnderlyingMesh());
+        for (const auto& run : batcher.GetRuns())
+        {
+            if (run.scissor != activeScissor)
+            {
+                if (run.scissor)
+                    backend->SubmitSetScissor(run.scissor->x, run.scissor->y, run.scissor->width, run.scissor->height);
+                else
+                    backend->SubmitClearScissor();
+
+                activeScissor = run.scissor;
+            }
+
+            auto& slot = AcquireUniformSlot();
+            auto* frameBuffer = slot.buffers[frameIndex].get();
+            frameBuffer->SetSubData(&uniData, UIUniformData::Size(), 0);
+            slot.binding->UpdateBuffer(0, frameBuffer, UIUniformData::Size(), frameIndex);
+            slot.binding->UpdateTexture(1, run.texture, frameIndex);
+
+            backend->SubmitDrawRangeCommand(shader.get(), slot.binding.get(), frameIndex, mesh.GetUnderlyingMesh(), run.firstIndex, run.indexCount);
+        }
+
+        if (activeScissor)
+            backend->SubmitClearScissor();
     }
 
-    void UIStackModule::DrawNineSlice(Render::IRenderBackend* backend,
+    void UIStackModule::DrawNineSlice(
         float x, float y, float w, float h,
         int32_t sliceL, int32_t sliceT, int32_t sliceR, int32_t sliceB,
         Render::ITextureHandle* texture, const UibinColor& tint, float cornerRadius)
@@ -1437,7 +1572,7 @@ namespace RenderStar::Client::UI
         for (auto& p : patches)
         {
             if (p.pw > 0 && p.ph > 0)
-                DrawQuad(backend, p.px, p.py, p.pw, p.ph, p.u0, p.v0, p.u1, p.v1, tint, texture, 0.0f, cornerRadius);
+                DrawQuad(p.px, p.py, p.pw, p.ph, p.u0, p.v0, p.u1, p.v1, tint, texture, 0.0f, cornerRadius);
         }
     }
 
@@ -1507,7 +1642,7 @@ namespace RenderStar::Client::UI
         meshSet.sliceCount = sliceCount;
         meshSet.radiusRatio = ratio;
 
-        // Create one mesh per slice
+        // Create unit-space geometry per slice
         for (int s = 0; s < sliceCount; ++s)
         {
             float a0 = static_cast<float>(s) * sliceAngle - PI * 0.5f;
@@ -1535,14 +1670,10 @@ namespace RenderStar::Client::UI
                 indices.push_back(i2); indices.push_back(i1); indices.push_back(i3);
             }
 
-            auto mesh = std::make_unique<Render::Resource::Mesh>(
-                *bufferManager, UIVertex::LAYOUT, Render::PrimitiveType::TRIANGLES);
-            mesh->SetVertices(vertices);
-            mesh->SetIndices(indices);
-            meshSet.slices.push_back(std::move(mesh));
+            meshSet.slices.push_back({std::move(vertices), std::move(indices)});
         }
 
-        // Create outer ring border mesh (thin arc around the full circle)
+        // Create outer ring border geometry (thin arc around the full circle)
         {
             int ringSegs = 64;
             float ringAngle = TAU / static_cast<float>(ringSegs);
@@ -1565,13 +1696,10 @@ namespace RenderStar::Client::UI
                 indices.push_back(i0 + 2); indices.push_back(i0 + 1); indices.push_back(i0 + 3);
             }
 
-            meshSet.outerRing = std::make_unique<Render::Resource::Mesh>(
-                *bufferManager, UIVertex::LAYOUT, Render::PrimitiveType::TRIANGLES);
-            meshSet.outerRing->SetVertices(vertices);
-            meshSet.outerRing->SetIndices(indices);
+            meshSet.outerRing = {std::move(vertices), std::move(indices)};
         }
 
-        // Create inner ring border mesh
+        // Create inner ring border geometry
         {
             int ringSegs = 64;
             float ringAngle = TAU / static_cast<float>(ringSegs);
@@ -1594,105 +1722,89 @@ namespace RenderStar::Client::UI
                 indices.push_back(i0 + 2); indices.push_back(i0 + 1); indices.push_back(i0 + 3);
             }
 
-            meshSet.innerRing = std::make_unique<Render::Resource::Mesh>(
-                *bufferManager, UIVertex::LAYOUT, Render::PrimitiveType::TRIANGLES);
-            meshSet.innerRing->SetVertices(vertices);
-            meshSet.innerRing->SetIndices(indices);
+            meshSet.innerRing = {std::move(vertices), std::move(indices)};
         }
 
         return meshSet;
     }
 
-    void UIStackModule::DrawArcSlice(Render::IRenderBackend* backend,
-        float cx, float cy, float outerR, Render::Resource::Mesh* arcMesh,
+    void UIStackModule::DrawArcSlice(
+        float cx, float cy, float outerR, const ArcGeometry& arc,
         const UibinColor& tint)
     {
-        if (!arcMesh || !arcMesh->IsValid()) return;
+        if (arc.vertices.empty()) return;
 
-        int32_t frameIndex = backend->GetCurrentFrame();
         float diameter = outerR * 2.0f;
+        float originX = cx - outerR;
+        float originY = cy - outerR;
 
-        UIUniformData uniData{};
-        uniData.posX = cx - outerR;
-        uniData.posY = cy - outerR;
-        uniData.width = diameter;
-        uniData.height = diameter;
-        uniData.u0 = 0; uniData.v0 = 0; uniData.u1 = 1; uniData.v1 = 1;
-        uniData.tintR = tint.r;
-        uniData.tintG = tint.g;
-        uniData.tintB = tint.b;
-        uniData.tintA = tint.a;
-        uniData.screenW = screenW;
-        uniData.screenH = screenH;
-        uniData.rotation = 0.0f;
-        uniData.cornerRadius = 0.0f;
+        arcScratch.assign(arc.vertices.begin(), arc.vertices.end());
 
-        auto& slot = AcquireUniformSlot();
-        auto* frameBuffer = slot.buffers[frameIndex].get();
-        frameBuffer->SetSubData(&uniData, UIUniformData::Size(), 0);
-        slot.binding->UpdateBuffer(0, frameBuffer, UIUniformData::Size(), frameIndex);
-        slot.binding->UpdateTexture(1, whiteTexture.get(), frameIndex);
+        for (auto& vertex : arcScratch)
+        {
+            vertex.posX = originX + vertex.posX * diameter;
+            vertex.posY = originY + vertex.posY * diameter;
+            vertex.colorR = tint.r;
+            vertex.colorG = tint.g;
+            vertex.colorB = tint.b;
+            vertex.colorA = tint.a;
+        }
 
-        backend->SubmitDrawCommand(shader.get(), slot.binding.get(), frameIndex, arcMesh->GetUnderlyingMesh());
+        batcher.AddGeometry(whiteTexture.get(), arcScratch, arc.indices);
     }
 
-    void UIStackModule::RenderText(Render::IRenderBackend* backend,
-        const TextData& textData, float x, float y, float w, float h,
-        UILayer& layer)
+    float UIStackModule::ScaledFontSize(int32_t pixelSize) const
     {
         // Scale font pixel size from design-space to screen-space
-        float uniformScale = std::min(scaleX, scaleY);
-        float scaledPixelSize = static_cast<float>(textData.pixelSize) * uniformScale;
-        if (scaledPixelSize < 1.0f) scaledPixelSize = 1.0f;
+        return std::max(1.0f, static_cast<float>(pixelSize) * std::min(scaleX, scaleY));
+    }
 
+    int32_t UIStackModule::ResolveFontFace(const std::string& fontPath, UILayer& layer)
+    {
         // Determine font source: embedded asset or default fallback
-        std::string fontKey = textData.fontPath;
-        if (fontKey.empty())
-            fontKey = "__default__";
+        const std::string fontKey = fontPath.empty() ? "__default__" : fontPath;
 
-        // Cache key uses the scaled pixel size so atlas is built at screen resolution
-        int scaledPxInt = static_cast<int>(scaledPixelSize + 0.5f);
-        std::string cacheKey = fontKey + ":" + std::to_string(scaledPxInt);
-        auto cacheIt = fontCache.find(cacheKey);
+        if (const int32_t face = fontAtlas.FindFace(fontKey); face >= 0)
+            return face;
 
-        if (cacheIt == fontCache.end())
+        const std::vector<uint8_t>* fontData = nullptr;
+
+        if (!fontPath.empty())
         {
-            const std::vector<uint8_t>* fontData = nullptr;
+            auto assetIt = layer.scene.assets.find(fontPath);
+            if (assetIt != layer.scene.assets.end())
+                fontData = &assetIt->second;
+        }
 
-            if (!textData.fontPath.empty())
-            {
-                auto assetIt = layer.scene.assets.find(textData.fontPath);
-                if (assetIt != layer.scene.assets.end())
-                    fontData = &assetIt->second;
-            }
+        if (!fontData && !defaultFontData.empty())
+            fontData = &defaultFontData;
 
-            if (!fontData && !defaultFontData.empty())
-                fontData = &defaultFontData;
+        if (!fontData)
+            return -1;
 
-            if (!fontData)
-                return;
+        const int32_t face = fontAtlas.AddFace(fontKey, *fontData);
 
-            auto atlas = std::make_unique<FontAtlas>();
-            if (!atlas->Build(*fontData, scaledPixelSize, textureManager))
-            {
-                logger->warn("Failed to build font atlas for: {}", fontKey);
-                return;
-            }
+        if (face < 0)
+            logger->warn("Failed to load font: {}", fontKey);
+        else if (fontAtlas.GetRenderMode() == GlyphRenderMode::SignedDistance)
+            fontAtlas.Prewarm(face, 0.0f, PREWARM_CHARACTERS);
 
-            cacheIt = fontCache.emplace(cacheKey, std::move(atlas)).first;
-        }
+        return face;
+    }
 
-        FontAtlas* atlas = cacheIt->second.get();
-        Render::ITextureHandle* atlasTex = atlas->GetTexture();
+    void UIStackModule::RenderText(
+        const TextData& textData, float x, float y, float w, float h,
+        UILayer& layer)
+    {
+        Render::ITextureHandle* atlasTex = fontAtlas.GetTexture();
         if (!atlasTex) return;
 
-        // Measure text width for alignment (metrics are already in screen-space)
-        float textWidth = 0.0f;
-        for (char c : textData.text)
-        {
-            const auto* glyph = atlas->GetGlyph(static_cast<uint32_t>(c));
-            if (glyph) textWidth += glyph->advance;
-        }
+        // Laid-out runs are cached by the atlas, so unchanged strings are not measured again
+        const ShapedRun* run = fontAtlas.Shape(ResolveFontFace(textData.fontPath, layer), ScaledFontSize(textData.pixelSize), textData.text);
+        if (!run) return;
+
+        const float textWidth = run->width;
+        const bool distanceField = fontAtlas.GetRenderMode() == GlyphRenderMode::SignedDistance;
 
         // Compute starting position based on alignment
         float startX = x;
@@ -1703,31 +1815,21 @@ namespace RenderStar::Client::UI
         else if (textData.alignment & AnchorFlags::RIGHT)
             startX = x + w - textWidth;
 
-        float lineHeight = atlas->GetLineHeight();
-        float visibleHeight = atlas->GetVisibleHeight();
         if (textData.alignment & AnchorFlags::CENTER_Y)
-            startY = y + (h - visibleHeight) * 0.5f;
+            startY = y + (h - run->visibleHeight) * 0.5f;
         else if (textData.alignment & AnchorFlags::BOTTOM)
-            startY = y + h - visibleHeight;
+            startY = y + h - run->visibleHeight;
 
-        float cursorX = startX;
-        for (char c : textData.text)
+        for (const ShapedGlyph& shaped : run->glyphs)
         {
-            const auto* glyph = atlas->GetGlyph(static_cast<uint32_t>(c));
-            if (!glyph)
-            {
-                cursorX += scaledPixelSize * 0.5f;
-                continue;
-            }
-
-            float gx = cursorX + glyph->bearingX;
-            float gy = startY + glyph->bearingY;
+            const GlyphInfo& glyph = shaped.glyph;
 
-            DrawQuad(backend, gx, gy, glyph->width, glyph->height,
-                glyph->uvX0, glyph->uvY0, glyph->uvX1, glyph->uvY1,
-                textData.color, atlasTex);
+            float gx = startX + shaped.x + glyph.bearingX;
+            float gy = startY + glyph.bearingY;
 
-            cursorX += glyph->advance;
+            DrawQuad(gx, gy, glyph.width, glyph.height,
+                glyph.uvX0, glyph.uvY0, glyph.uvX1, glyph.uvY1,
+                textData.color, atlasTex, 0.0f, 0.0f, distanceField);
         }
     }
 
@@ -1,9 +1,13 @@
 #include "RenderStar/Client/UI/UibinLoader.hpp"
+#include "RenderStar/Client/UI/UibinSceneBuilder.hpp"
+#include "RenderStar/Client/UI/UibinSchema.hpp"
 #include "RenderStar/Common/Asset/AssetModule.hpp"
 #include "RenderStar/Common/Asset/AssetLocation.hpp"
 #include "RenderStar/Common/Asset/IBinaryAsset.hpp"
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include <cstring>
+#include <utility>
 
 namespace RenderStar::Client::UI
 {
@@ -58,18 +62,16 @@ namespace RenderStar::Client::UI
             return defaultVal;
         }
 
-        bool ParseComponent(const nlohmann::json& j, UIComponent& out)
+        bool ParseComponent(const nlohmann::json& j, UibinSceneBuilder& builder, uint32_t element)
         {
             if (!j.contains("kind") || !j["kind"].is_string())
                 return false;
 
-            out.kind = ParseKind(j["kind"].get<std::string>());
-
-            switch (out.kind)
+            switch (ParseKind(j["kind"].get<std::string>()))
             {
                 case UIComponentKind::Transform:
                 {
-                    auto& t = out.transform;
+                    auto& t = builder.AddComponent<TransformData>(element);
                     t.x               = GetOr<double>(j, "x", 0.0);
                     t.y               = GetOr<double>(j, "y", 0.0);
                     t.scaleX          = GetOr<double>(j, "scaleX", 100.0);
@@ -81,7 +83,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::Image:
                 {
-                    auto& d = out.image;
+                    auto& d = builder.AddComponent<ImageData>(element);
                     d.imagePath = GetOr<std::string>(j, "imagePath", "");
                     d.tint      = ParseColor(j, "tint", {1, 1, 1, 1});
                     d.assetPath = GetOr<std::string>(j, "assetPath", "");
@@ -89,7 +91,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::Text:
                 {
-                    auto& d = out.text;
+                    auto& d = builder.AddComponent<TextData>(element);
                     d.text       = GetOr<std::string>(j, "text", "");
                     d.fontFamily = GetOr<std::string>(j, "fontFamily", "Inter");
                     d.pixelSize  = GetOr<int32_t>(j, "pixelSize", 24);
@@ -101,7 +103,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::Panel:
                 {
-                    auto& d = out.panel;
+                    auto& d = builder.AddComponent<PanelData>(element);
                     d.backgroundColor = ParseColor(j, "backgroundColor", d.backgroundColor);
                     d.borderColor     = ParseColor(j, "borderColor", d.borderColor);
                     d.borderWidth     = GetOr<double>(j, "borderWidth", 1.0);
@@ -110,7 +112,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::Button:
                 {
-                    auto& d = out.button;
+                    auto& d = builder.AddComponent<ButtonData>(element);
                     d.text            = GetOr<std::string>(j, "text", "Button");
                     d.backgroundColor = ParseColor(j, "backgroundColor", d.backgroundColor);
                     d.textColor       = ParseColor(j, "textColor", {1, 1, 1, 1});
@@ -127,7 +129,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::ProgressBar:
                 {
-                    auto& d = out.progressBar;
+                    auto& d = builder.AddComponent<ProgressBarData>(element);
                     d.value           = GetOr<double>(j, "value", 0.5);
                     d.fillColor       = ParseColor(j, "fillColor", d.fillColor);
                     d.backgroundColor = ParseColor(j, "backgroundColor", d.backgroundColor);
@@ -138,7 +140,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::Toggle:
                 {
-                    auto& d = out.toggle;
+                    auto& d = builder.AddComponent<ToggleData>(element);
                     d.checked   = GetOr<bool>(j, "checked", false);
                     d.onColor   = ParseColor(j, "onColor", d.onColor);
                     d.offColor  = ParseColor(j, "offColor", d.offColor);
@@ -148,7 +150,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::Dropdown:
                 {
-                    auto& d = out.dropdown;
+                    auto& d = builder.AddComponent<DropdownData>(element);
                     d.options         = GetOr<std::string>(j, "options", "Option A,Option B");
                     d.selectedIndex   = GetOr<int32_t>(j, "selectedIndex", 0);
                     d.backgroundColor = ParseColor(j, "backgroundColor", d.backgroundColor);
@@ -160,7 +162,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::TextInput:
                 {
-                    auto& d = out.textInput;
+                    auto& d = builder.AddComponent<TextInputData>(element);
                     d.placeholder      = GetOr<std::string>(j, "placeholder", "Enter text...");
                     d.text             = GetOr<std::string>(j, "text", "");
                     d.backgroundColor  = ParseColor(j, "backgroundColor", d.backgroundColor);
@@ -173,7 +175,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::Icon:
                 {
-                    auto& d = out.icon;
+                    auto& d = builder.AddComponent<IconData>(element);
                     d.imagePath = GetOr<std::string>(j, "imagePath", "");
                     d.tintColor = ParseColor(j, "tintColor", {1, 1, 1, 1});
                     d.iconSize  = GetOr<int32_t>(j, "iconSize", 32);
@@ -182,7 +184,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::Sprite:
                 {
-                    auto& d = out.sprite;
+                    auto& d = builder.AddComponent<SpriteData>(element);
                     d.imagePath    = GetOr<std::string>(j, "imagePath", "");
                     d.frameWidth   = GetOr<int32_t>(j, "frameWidth", 64);
                     d.frameHeight  = GetOr<int32_t>(j, "frameHeight", 64);
@@ -194,7 +196,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::Tooltip:
                 {
-                    auto& d = out.tooltip;
+                    auto& d = builder.AddComponent<TooltipData>(element);
                     d.tooltipText     = GetOr<std::string>(j, "tooltipText", "Tooltip text here");
                     d.backgroundColor = ParseColor(j, "backgroundColor", d.backgroundColor);
                     d.textColor       = ParseColor(j, "textColor", d.textColor);
@@ -205,7 +207,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::Modal:
                 {
-                    auto& d = out.modal;
+                    auto& d = builder.AddComponent<ModalData>(element);
                     d.overlayColor = ParseColor(j, "overlayColor", d.overlayColor);
                     d.panelColor   = ParseColor(j, "panelColor", d.panelColor);
                     d.borderColor  = ParseColor(j, "borderColor", d.borderColor);
@@ -215,7 +217,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::TabContainer:
                 {
-                    auto& d = out.tabContainer;
+                    auto& d = builder.AddComponent<TabContainerData>(element);
                     d.tabNames        = GetOr<std::string>(j, "tabNames", "Tab 1,Tab 2,Tab 3");
                     d.activeTab       = GetOr<int32_t>(j, "activeTab", 0);
                     d.tabHeight       = GetOr<int32_t>(j, "tabHeight", 32);
@@ -227,7 +229,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::RadialMenu:
                 {
-                    auto& d = out.radialMenu;
+                    auto& d = builder.AddComponent<RadialMenuData>(element);
                     d.sliceCount     = GetOr<int32_t>(j, "sliceCount", 6);
                     d.innerRadius    = GetOr<double>(j, "innerRadius", 40.0);
                     d.outerRadius    = GetOr<double>(j, "outerRadius", 100.0);
@@ -239,7 +241,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::Minimap:
                 {
-                    auto& d = out.minimap;
+                    auto& d = builder.AddComponent<MinimapData>(element);
                     d.backgroundColor = ParseColor(j, "backgroundColor", d.backgroundColor);
                     d.borderColor     = ParseColor(j, "borderColor", d.borderColor);
                     d.viewportColor   = ParseColor(j, "viewportColor", d.viewportColor);
@@ -249,7 +251,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::DragSlot:
                 {
-                    auto& d = out.dragSlot;
+                    auto& d = builder.AddComponent<DragSlotData>(element);
                     d.slotSize        = GetOr<int32_t>(j, "slotSize", 64);
                     d.backgroundColor = ParseColor(j, "backgroundColor", d.backgroundColor);
                     d.borderColor     = ParseColor(j, "borderColor", d.borderColor);
@@ -262,7 +264,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::ListRepeater:
                 {
-                    auto& d = out.listRepeater;
+                    auto& d = builder.AddComponent<ListRepeaterData>(element);
                     d.itemCount      = GetOr<int32_t>(j, "itemCount", 5);
                     d.itemHeight     = GetOr<int32_t>(j, "itemHeight", 40);
                     d.spacing        = GetOr<double>(j, "spacing", 2.0);
@@ -274,7 +276,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::StackLayout:
                 {
-                    auto& d = out.stackLayout;
+                    auto& d = builder.AddComponent<StackLayoutData>(element);
                     d.direction = GetOr<int32_t>(j, "direction", 0);
                     d.spacing   = GetOr<double>(j, "spacing", 8.0);
                     d.padding   = GetOr<double>(j, "padding", 8.0);
@@ -282,7 +284,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::GridLayout:
                 {
-                    auto& d = out.gridLayout;
+                    auto& d = builder.AddComponent<GridLayoutData>(element);
                     d.columns  = GetOr<int32_t>(j, "columns", 2);
                     d.spacingH = GetOr<double>(j, "spacingH", 8.0);
                     d.spacingV = GetOr<double>(j, "spacingV", 8.0);
@@ -291,7 +293,7 @@ namespace RenderStar::Client::UI
                 }
                 case UIComponentKind::ScrollBox:
                 {
-                    auto& d = out.scrollBox;
+                    auto& d = builder.AddComponent<ScrollBoxData>(element);
                     d.direction = GetOr<int32_t>(j, "direction", 0);
                     d.spacing   = GetOr<double>(j, "spacing", 8.0);
                     d.padding   = GetOr<double>(j, "padding", 8.0);
@@ -304,31 +306,151 @@ namespace RenderStar::Client::UI
             return true;
         }
 
-        bool ParseElement(const nlohmann::json& j, UIElement& out)
+        bool ParseElement(const nlohmann::json& j, UibinSceneBuilder& builder, uint32_t parent)
         {
-            out.id   = GetOr<std::string>(j, "id", "");
-            out.name = GetOr<std::string>(j, "name", "");
+            const uint32_t element = builder.AddElement(parent, GetOr<std::string>(j, "id", ""), GetOr<std::string>(j, "name", ""));
+
+            if (element == UIElement::NO_PARENT)
+                return false;
 
             if (j.contains("components") && j["components"].is_array())
             {
                 for (const auto& compJson : j["components"])
-                {
-                    UIComponent comp;
-
-                    if (ParseComponent(compJson, comp))
-                        out.components.push_back(std::move(comp));
-                }
+                    ParseComponent(compJson, builder, element);
             }
 
             if (j.contains("children") && j["children"].is_array())
             {
                 for (const auto& childJson : j["children"])
                 {
-                    UIElement child;
+                    if (!ParseElement(childJson, builder, element))
+                        return false;
+                }
+            }
+
+            return true;
+        }
+
+        uint32_t ReadUint32(const uint8_t* ptr)
+        {
+            uint32_t value;
+            std::memcpy(&value, ptr, sizeof(uint32_t));
+            return value;
+        }
+
+        uint64_t ReadUint64(const uint8_t* ptr)
+        {
+            uint64_t value;
+            std::memcpy(&value, ptr, sizeof(uint64_t));
+            return value;
+        }
+
+        double ReadDouble(const uint8_t* ptr)
+        {
+            double value;
+            std::memcpy(&value, ptr, sizeof(double));
+            return value;
+        }
+
+        bool InRange(uint64_t offset, uint64_t size, size_t dataSize)
+        {
+            return offset <= dataSize && size <= dataSize - offset;
+        }
+
+        // Decodes one row; string fields become copies of the interned string they index
+        class FieldReader
+        {
+        public:
+
+            FieldReader(const uint8_t* ptr, const UibinScene& scene) : ptr(ptr), scene(scene) {}
+
+            void operator()(double& value) { value = ReadDouble(ptr); ptr += 8; }
+            void operator()(int32_t& value) { value = static_cast<int32_t>(ReadUint32(ptr)); ptr += 4; }
+            void operator()(uint32_t& value) { value = ReadUint32(ptr); ptr += 4; }
+            void operator()(bool& value) { value = ReadUint32(ptr) != 0; ptr += 4; }
+
+            void operator()(UibinColor& value)
+            {
+                std::memcpy(&value, ptr, sizeof(UibinColor));
+                ptr += sizeof(UibinColor);
+            }
+
+            void operator()(std::string& value)
+            {
+                const uint32_t index = ReadUint32(ptr);
+                ptr += 4;
+
+                if (index >= scene.GetStringCount())
+                    valid = false;
+                else
+                    value = scene.GetString(index);
+            }
+
+            bool valid = true;
+
+        private:
+
+            const uint8_t* ptr;
+            const UibinScene& scene;
+        };
+
+        static_assert(sizeof(UibinColor) == 16, "Colours are stored as four packed floats");
+
+        template<typename T>
+        bool ReadTable(std::span<const uint8_t> data, const uint8_t* entry, const UibinScene& scene, std::vector<T>& table)
+        {
+            const uint32_t rowCount = ReadUint32(entry);
+            const uint32_t rowSize = ReadUint32(entry + 4);
+            const uint64_t offset = ReadUint64(entry + 8);
+
+            if (rowSize != UibinRowSize<T>() || !InRange(offset, static_cast<uint64_t>(rowCount) * rowSize, data.size()))
+                return false;
+
+            table.resize(rowCount);
+
+            for (uint32_t row = 0; row < rowCount; ++row)
+            {
+                FieldReader reader(data.data() + offset + static_cast<uint64_t>(row) * rowSize, scene);
+                UibinFields<T>::Visit(table[row], reader);
+
+                if (!reader.valid)
+                    return false;
+            }
+
+            return true;
+        }
+
+        // Every element's children must tile its subtree exactly, which keeps Children() in bounds
+        bool ValidateHierarchy(const std::vector<UIElement>& elements)
+        {
+            if (elements.empty() || elements[0].parent != UIElement::NO_PARENT || elements[0].subtreeSize != elements.size())
+                return false;
+
+            for (uint32_t index = 0; index < elements.size(); ++index)
+            {
+                const UIElement& element = elements[index];
+
+                if (element.subtreeSize == 0 || element.subtreeSize > elements.size() - index)
+                    return false;
+
+                if (index > 0 && element.parent >= index)
+                    return false;
+
+                const uint32_t end = index + element.subtreeSize;
+                uint32_t child = index + 1;
+                uint32_t childCount = 0;
+
+                while (child < end)
+                {
+                    if (elements[child].parent != index)
+                        return false;
 
-                    if (ParseElement(childJson, child))
-                        out.children.push_back(std::move(child));
+                    child += elements[child].subtreeSize;
+                    ++childCount;
                 }
+
+                if (child != end || childCount != element.childCount)
+                    return false;
             }
 
             return true;
@@ -347,26 +469,33 @@ namespace RenderStar::Client::UI
 
     std::optional<UibinScene> UibinLoader::Parse(std::span<const uint8_t> data)
     {
-        if (data.size() < HEADER_SIZE)
+        if (data.size() < 8 || ReadUint32BE(data.data()) != MAGIC)
             return std::nullopt;
 
-        const uint8_t* ptr = data.data();
-        const uint8_t* end = ptr + data.size();
+        const uint32_t version = ReadUint32BE(data.data() + 4);
 
-        uint32_t magic = ReadUint32BE(ptr);
+        if (version == VERSION_1)
+            return ParseV1(data);
 
-        if (magic != MAGIC)
-            return std::nullopt;
+        if (version == VERSION_2)
+            return ParseV2(data);
 
-        uint32_t version   = ReadUint32BE(ptr + 4);
-        uint32_t jsonLen   = ReadUint32BE(ptr + 8);
-        uint32_t assetCount = ReadUint32BE(ptr + 12);
-        ptr += HEADER_SIZE;
+        return std::nullopt;
+    }
 
-        if (version != VERSION)
+    std::optional<UibinScene> UibinLoader::ParseV1(std::span<const uint8_t> data)
+    {
+        if (data.size() < V1_HEADER_SIZE)
             return std::nullopt;
 
-        if (ptr + jsonLen > end)
+        const uint8_t* ptr = data.data();
+        const uint8_t* end = ptr + data.size();
+
+        uint32_t jsonLen    = ReadUint32BE(ptr + 8);
+        uint32_t assetCount = ReadUint32BE(ptr + 12);
+        ptr += V1_HEADER_SIZE;
+
+        if (jsonLen > static_cast<size_t>(end - ptr))
             return std::nullopt;
 
         std::string jsonStr(reinterpret_cast<const char*>(ptr), jsonLen);
@@ -383,35 +512,154 @@ namespace RenderStar::Client::UI
             return std::nullopt;
         }
 
-        UibinScene scene;
+        UibinSceneBuilder builder;
 
-        if (!ParseElement(rootJson, scene.root))
+        if (!ParseElement(rootJson, builder, UIElement::NO_PARENT))
             return std::nullopt;
 
-        if (rootJson.contains("designWidth"))
-            scene.designWidth = rootJson["designWidth"].get<double>();
-        if (rootJson.contains("designHeight"))
-            scene.designHeight = rootJson["designHeight"].get<double>();
+        builder.SetDesignSize(GetOr<double>(rootJson, "designWidth", 0.0), GetOr<double>(rootJson, "designHeight", 0.0));
 
         for (uint32_t i = 0; i < assetCount; ++i)
         {
-            if (ptr + 4 > end) return std::nullopt;
+            if (end - ptr < 4) return std::nullopt;
             uint32_t keyLen = ReadUint32BE(ptr);
             ptr += 4;
 
-            if (ptr + keyLen > end) return std::nullopt;
+            if (static_cast<size_t>(end - ptr) < keyLen) return std::nullopt;
             std::string key(reinterpret_cast<const char*>(ptr), keyLen);
             ptr += keyLen;
 
-            if (ptr + 4 > end) return std::nullopt;
+            if (end - ptr < 4) return std::nullopt;
             uint32_t dataLen = ReadUint32BE(ptr);
             ptr += 4;
 
-            if (ptr + dataLen > end) return std::nullopt;
-            scene.assets[key] = std::vector<uint8_t>(ptr, ptr + dataLen);
+            if (static_cast<size_t>(end - ptr) < dataLen) return std::nullopt;
+            builder.AddAsset(std::move(key), std::vector<uint8_t>(ptr, ptr + dataLen));
             ptr += dataLen;
         }
 
+        return builder.Build();
+    }
+
+    std::optional<UibinScene> UibinLoader::ParseV2(std::span<const uint8_t> data)
+    {
+        if (data.size() < V2_HEADER_SIZE)
+            return std::nullopt;
+
+        const uint8_t* header = data.data();
+
+        const uint32_t elementCount  = ReadUint32(header + 8);
+        const uint32_t stringCount   = ReadUint32(header + 12);
+        const uint32_t tableCount    = ReadUint32(header + 16);
+        const uint32_t bucketCount   = ReadUint32(header + 20);
+        const uint32_t assetCount    = ReadUint32(header + 40);
+        const uint64_t stringOffsetsAt = ReadUint64(header + 48);
+        const uint64_t stringDataAt  = ReadUint64(header + 56);
+        const uint64_t elementsAt    = ReadUint64(header + 64);
+        const uint64_t tablesAt      = ReadUint64(header + 72);
+        const uint64_t bucketsAt     = ReadUint64(header + 80);
+        const uint64_t assetsAt      = ReadUint64(header + 88);
+
+        if (stringCount == 0 || tableCount != UIElement::COMPONENT_KIND_COUNT || (bucketCount & (bucketCount - 1)) != 0)
+            return std::nullopt;
+
+        if (!InRange(stringOffsetsAt, (static_cast<uint64_t>(stringCount) + 1) * 4, data.size())
+            || !InRange(elementsAt, static_cast<uint64_t>(elementCount) * V2_ELEMENT_SIZE, data.size())
+            || !InRange(tablesAt, static_cast<uint64_t>(tableCount) * V2_TABLE_ENTRY_SIZE, data.size())
+            || !InRange(bucketsAt, static_cast<uint64_t>(bucketCount) * 4, data.size())
+            || !InRange(assetsAt, static_cast<uint64_t>(assetCount) * V2_ASSET_ENTRY_SIZE, data.size()))
+            return std::nullopt;
+
+        UibinScene scene;
+        scene.designWidth = ReadDouble(header + 24);
+        scene.designHeight = ReadDouble(header + 32);
+
+        // String table: offsets and bytes are taken over as-is
+        scene.stringOffsets.resize(static_cast<size_t>(stringCount) + 1);
+        std::memcpy(scene.stringOffsets.data(), data.data() + stringOffsetsAt, scene.stringOffsets.size() * 4);
+
+        const uint32_t stringDataSize = scene.stringOffsets.back();
+
+        if (scene.stringOffsets.front() != 0 || !InRange(stringDataAt, stringDataSize, data.size())
+            || !std::ranges::is_sorted(scene.stringOffsets))
+            return std::nullopt;
+
+        scene.stringData.assign(data.data() + stringDataAt, data.data() + stringDataAt + stringDataSize);
+
+        // Component tables
+        const bool tablesRead = [&]<size_t... Kinds>(std::index_sequence<Kinds...>)
+        {
+            return (ReadTable(data, data.data() + tablesAt + Kinds * V2_TABLE_ENTRY_SIZE, scene, std::get<Kinds>(*scene.components)) && ...);
+        }(std::make_index_sequence<UIElement::COMPONENT_KIND_COUNT>{});
+
+        if (!tablesRead)
+            return std::nullopt;
+
+        std::array<size_t, UIElement::COMPONENT_KIND_COUNT> rowCounts{};
+        [&]<size_t... Kinds>(std::index_sequence<Kinds...>)
+        {
+            ((rowCounts[Kinds] = std::get<Kinds>(*scene.components).size()), ...);
+        }(std::make_index_sequence<UIElement::COMPONENT_KIND_COUNT>{});
+
+        // Elements
+        scene.elements.resize(elementCount);
+
+        for (uint32_t index = 0; index < elementCount; ++index)
+        {
+            const uint8_t* record = data.data() + elementsAt + static_cast<uint64_t>(index) * V2_ELEMENT_SIZE;
+            UIElement& element = scene.elements[index];
+
+            const uint32_t idString = ReadUint32(record);
+            const uint32_t nameString = ReadUint32(record + 4);
+
+            if (idString >= stringCount || nameString >= stringCount)
+                return std::nullopt;
+
+            element.id = scene.GetString(idString);
+            element.name = scene.GetString(nameString);
+            element.index = index;
+            element.parent = ReadUint32(record + 8);
+            element.subtreeSize = ReadUint32(record + 12);
+            element.childCount = ReadUint32(record + 16);
+            element.components = scene.components.get();
+            std::memcpy(element.componentRows.data(), record + 20, sizeof(element.componentRows));
+
+            for (size_t kind = 0; kind < UIElement::COMPONENT_KIND_COUNT; ++kind)
+            {
+                const int32_t row = element.componentRows[kind];
+
+                if (row != UIElement::NO_COMPONENT && (row < 0 || static_cast<size_t>(row) >= rowCounts[kind]))
+                    return std::nullopt;
+            }
+        }
+
+        if (!ValidateHierarchy(scene.elements))
+            return std::nullopt;
+
+        // Id index: used directly when present, rebuilt for files written without one
+        if (bucketCount == 0)
+            scene.BuildIdIndex();
+        else
+        {
+            scene.idBuckets.resize(bucketCount);
+            std::memcpy(scene.idBuckets.data(), data.data() + bucketsAt, static_cast<size_t>(bucketCount) * 4);
+        }
+
+        // Assets
+        for (uint32_t i = 0; i < assetCount; ++i)
+        {
+            const uint8_t* entry = data.data() + assetsAt + static_cast<uint64_t>(i) * V2_ASSET_ENTRY_SIZE;
+            const uint32_t keyString = ReadUint32(entry);
+            const uint64_t offset = ReadUint64(entry + 8);
+            const uint64_t size = ReadUint64(entry + 16);
+
+            if (keyString >= stringCount || !InRange(offset, size, data.size()))
+                return std::nullopt;
+
+            const uint8_t* begin = data.data() + offset;
+            scene.assets.insert_or_assign(std::string(scene.GetString(keyString)), std::vector<uint8_t>(begin, begin + size));
+        }
+
         return scene;
     }
 }
@@ -0,0 +1,90 @@
+#include "RenderStar/Client/UI/UibinScene.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace RenderStar::Client::UI
+{
+    const UIElement* UibinScene::FindById(std::string_view id) const
+    {
+        if (id.empty() || idBuckets.empty())
+            return nullptr;
+
+        const size_t mask = idBuckets.size() - 1;
+        size_t bucket = HashId(id) & mask;
+
+        for (size_t probe = 0; probe < idBuckets.size(); ++probe, bucket = (bucket + 1) & mask)
+        {
+            const uint32_t index = idBuckets[bucket];
+
+            if (index == EMPTY_BUCKET)
+                return nullptr;
+
+            if (index < elements.size() && elements[index].id == id)
+                return &elements[index];
+        }
+
+        return nullptr;
+    }
+
+    const UIElement* UibinScene::FindByName(std::string_view name) const
+    {
+        for (const auto& element : elements)
+            if (element.name == name)
+                return &element;
+
+        return nullptr;
+    }
+
+    std::string_view UibinScene::GetString(uint32_t index) const
+    {
+        if (static_cast<size_t>(index) + 1 >= stringOffsets.size())
+            return {};
+
+        return {stringData.data() + stringOffsets[index], stringOffsets[index + 1] - stringOffsets[index]};
+    }
+
+    void UibinScene::BuildIdIndex()
+    {
+        size_t idCount = 0;
+
+        for (const auto& element : elements)
+            if (!element.id.empty())
+                ++idCount;
+
+        idBuckets.assign(std::bit_ceil(std::max<size_t>(idCount * 2, 1)), EMPTY_BUCKET);
+
+        const size_t mask = idBuckets.size() - 1;
+
+        for (const auto& element : elements)
+        {
+            if (element.id.empty())
+                continue;
+
+            for (size_t bucket = HashId(element.id) & mask;; bucket = (bucket + 1) & mask)
+            {
+                if (idBuckets[bucket] == EMPTY_BUCKET)
+                {
+                    idBuckets[bucket] = element.index;
+                    break;
+                }
+
+                if (elements[idBuckets[bucket]].id == element.id)
+                    break;
+            }
+        }
+    }
+
+    uint32_t UibinScene::HashId(std::string_view id)
+    {
+        // FNV-1a; stored in uibin v2 files, so it must not change
+        uint32_t hash = 2166136261u;
+
+        for (const char c : id)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+}
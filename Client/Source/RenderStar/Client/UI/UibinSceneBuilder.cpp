@@ -0,0 +1,100 @@
+#include "RenderStar/Client/UI/UibinSceneBuilder.hpp"
+#include <algorithm>
+
+namespace RenderStar::Client::UI
+{
+    UibinSceneBuilder::UibinSceneBuilder()
+    {
+        scene.stringOffsets.push_back(0);
+        Intern("");
+    }
+
+    uint32_t UibinSceneBuilder::AddElement(uint32_t parent, std::string_view id, std::string_view name)
+    {
+        if (parent == UIElement::NO_PARENT)
+        {
+            if (!scene.elements.empty())
+                return UIElement::NO_PARENT;
+        }
+        else
+        {
+            if (std::ranges::find(openElements, parent) == openElements.end())
+                return UIElement::NO_PARENT;
+
+            while (openElements.back() != parent)
+                CloseElement();
+
+            ++scene.elements[parent].childCount;
+        }
+
+        const auto index = static_cast<uint32_t>(scene.elements.size());
+
+        UIElement& element = scene.elements.emplace_back();
+        element.index = index;
+        element.parent = parent;
+        element.components = scene.components.get();
+
+        elementStrings.emplace_back(Intern(id), Intern(name));
+        openElements.push_back(index);
+
+        return index;
+    }
+
+    void UibinSceneBuilder::SetDesignSize(double width, double height)
+    {
+        scene.designWidth = width;
+        scene.designHeight = height;
+    }
+
+    void UibinSceneBuilder::AddAsset(std::string key, std::vector<uint8_t> data)
+    {
+        scene.assets.insert_or_assign(std::move(key), std::move(data));
+    }
+
+    UibinScene UibinSceneBuilder::Build()
+    {
+        while (!openElements.empty())
+            CloseElement();
+
+        // The string table no longer grows, so views into it are stable from here on
+        for (size_t i = 0; i < scene.elements.size(); ++i)
+        {
+            scene.elements[i].id = scene.GetString(elementStrings[i].first);
+            scene.elements[i].name = scene.GetString(elementStrings[i].second);
+        }
+
+        scene.BuildIdIndex();
+
+        UibinScene built = std::move(scene);
+
+        scene = UibinScene{};
+        elementStrings.clear();
+        internedStrings.clear();
+        scene.stringOffsets.push_back(0);
+        Intern("");
+
+        return built;
+    }
+
+    uint32_t UibinSceneBuilder::Intern(std::string_view text)
+    {
+        if (auto it = internedStrings.find(std::string(text)); it != internedStrings.end())
+            return it->second;
+
+        const auto index = static_cast<uint32_t>(scene.stringOffsets.size() - 1);
+
+        scene.stringData.insert(scene.stringData.end(), text.begin(), text.end());
+        scene.stringOffsets.push_back(static_cast<uint32_t>(scene.stringData.size()));
+        internedStrings.emplace(text, index);
+
+        return index;
+    }
+
+    void UibinSceneBuilder::CloseElement()
+    {
+        const uint32_t index = openElements.back();
+        openElements.pop_back();
+
+        scene.elements[index].subtreeSize = static_cast<uint32_t>(scene.elements.size()) - index;
+    }
+}
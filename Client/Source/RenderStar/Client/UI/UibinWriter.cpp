@@ -0,0 +1,253 @@
+#include "RenderStar/Client/UI/UibinWriter.hpp"
+#include "RenderStar/Client/UI/UibinLoader.hpp"
+#include "RenderStar/Client/UI/UibinSchema.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace RenderStar::Client::UI
+{
+    namespace
+    {
+        class ByteWriter
+        {
+        public:
+
+            void WriteUint32BE(uint32_t value)
+            {
+                const uint8_t encoded[4] = {
+                    static_cast<uint8_t>(value >> 24), static_cast<uint8_t>(value >> 16),
+                    static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value)
+                };
+
+                bytes.insert(bytes.end(), std::begin(encoded), std::end(encoded));
+            }
+
+            template<typename T>
+            void Write(const T& value)
+            {
+                const auto* begin = reinterpret_cast<const uint8_t*>(&value);
+                bytes.insert(bytes.end(), begin, begin + sizeof(T));
+            }
+
+            void WriteBytes(const void* data, size_t size)
+            {
+                const auto* begin = static_cast<const uint8_t*>(data);
+                bytes.insert(bytes.end(), begin, begin + size);
+            }
+
+            template<typename T>
+            void Patch(size_t offset, const T& value)
+            {
+                std::memcpy(bytes.data() + offset, &value, sizeof(T));
+            }
+
+            void Align()
+            {
+                bytes.resize((bytes.size() + 7) & ~size_t{7}, 0);
+            }
+
+            [[nodiscard]]
+            size_t Size() const { return bytes.size(); }
+
+            std::vector<uint8_t> Take() { return std::move(bytes); }
+
+        private:
+
+            std::vector<uint8_t> bytes;
+        };
+
+        class StringTable
+        {
+        public:
+
+            StringTable() { Intern(""); }
+
+            uint32_t Intern(std::string_view text)
+            {
+                if (auto it = indices.find(std::string(text)); it != indices.end())
+                    return it->second;
+
+                const auto index = static_cast<uint32_t>(offsets.size());
+
+                offsets.push_back(static_cast<uint32_t>(data.size()));
+                data.insert(data.end(), text.begin(), text.end());
+                indices.emplace(text, index);
+
+                return index;
+            }
+
+            std::vector<char> data;
+            std::vector<uint32_t> offsets;
+
+        private:
+
+            std::unordered_map<std::string, uint32_t> indices;
+        };
+
+        // Encodes one row in UibinFields order, interning string fields as it goes
+        class FieldWriter
+        {
+        public:
+
+            FieldWriter(ByteWriter& out, StringTable& strings) : out(out), strings(strings) {}
+
+            void operator()(const double& value) { out.Write(value); }
+            void operator()(const int32_t& value) { out.Write(value); }
+            void operator()(const uint32_t& value) { out.Write(value); }
+            void operator()(const bool& value) { out.Write<uint32_t>(value ? 1 : 0); }
+            void operator()(const UibinColor& value) { out.Write(value); }
+            void operator()(const std::string& value) { out.Write(strings.Intern(value)); }
+
+        private:
+
+            ByteWriter& out;
+            StringTable& strings;
+        };
+    }
+
+    std::vector<uint8_t> UibinWriter::Write(const UibinScene& scene)
+    {
+        constexpr size_t KIND_COUNT = UIElement::COMPONENT_KIND_COUNT;
+
+        StringTable strings;
+
+        std::vector<std::pair<uint32_t, uint32_t>> elementStrings;
+        elementStrings.reserve(scene.elements.size());
+
+        for (const auto& element : scene.elements)
+            elementStrings.emplace_back(strings.Intern(element.id), strings.Intern(element.name));
+
+        // Rows are encoded up front so every string is interned before the string table is written
+        std::array<ByteWriter, KIND_COUNT> tableBytes;
+        std::array<uint32_t, KIND_COUNT> rowCounts{};
+        std::array<uint32_t, KIND_COUNT> rowSizes{};
+
+        [&]<size_t... Kinds>(std::index_sequence<Kinds...>)
+        {
+            ([&]
+            {
+                using Row = UIComponentData<static_cast<UIComponentKind>(Kinds)>;
+                const auto& table = std::get<Kinds>(*scene.components);
+
+                FieldWriter writer(tableBytes[Kinds], strings);
+
+                for (const Row& row : table)
+                    UibinFields<Row>::Visit(row, writer);
+
+                rowCounts[Kinds] = static_cast<uint32_t>(table.size());
+                rowSizes[Kinds] = UibinRowSize<Row>();
+            }(), ...);
+        }(std::make_index_sequence<KIND_COUNT>{});
+
+        std::vector<const std::pair<const std::string, std::vector<uint8_t>>*> assets;
+        assets.reserve(scene.assets.size());
+
+        for (const auto& asset : scene.assets)
+            assets.push_back(&asset);
+
+        std::ranges::sort(assets, {}, [](const auto* asset) { return std::string_view(asset->first); });
+
+        std::vector<uint32_t> assetKeys;
+        assetKeys.reserve(assets.size());
+
+        for (const auto* asset : assets)
+            assetKeys.push_back(strings.Intern(asset->first));
+
+        strings.offsets.push_back(static_cast<uint32_t>(strings.data.size()));
+
+        ByteWriter out;
+
+        out.WriteUint32BE(UibinLoader::MAGIC);
+        out.WriteUint32BE(UibinLoader::VERSION_2);
+        out.Write(static_cast<uint32_t>(scene.elements.size()));
+        out.Write(static_cast<uint32_t>(strings.offsets.size() - 1));
+        out.Write(static_cast<uint32_t>(KIND_COUNT));
+        out.Write(static_cast<uint32_t>(scene.idBuckets.size()));
+        out.Write(scene.designWidth);
+        out.Write(scene.designHeight);
+        out.Write(static_cast<uint32_t>(assets.size()));
+        out.Write(uint32_t{0});
+
+        const size_t sectionOffsets = out.Size();
+
+        for (size_t i = 0; i < 6; ++i)
+            out.Write(uint64_t{0});
+
+        const auto beginSection = [&](size_t slot)
+        {
+            out.Align();
+            out.Patch(sectionOffsets + slot * sizeof(uint64_t), static_cast<uint64_t>(out.Size()));
+        };
+
+        beginSection(0);
+        out.WriteBytes(strings.offsets.data(), strings.offsets.size() * sizeof(uint32_t));
+
+        beginSection(1);
+        out.WriteBytes(strings.data.data(), strings.data.size());
+
+        beginSection(2);
+
+        for (size_t i = 0; i < scene.elements.size(); ++i)
+        {
+            const UIElement& element = scene.elements[i];
+
+            out.Write(elementStrings[i].first);
+            out.Write(elementStrings[i].second);
+            out.Write(element.parent);
+            out.Write(element.subtreeSize);
+            out.Write(element.childCount);
+            out.WriteBytes(element.componentRows.data(), sizeof(element.componentRows));
+        }
+
+        beginSection(3);
+
+        const size_t directory = out.Size();
+
+        for (size_t kind = 0; kind < KIND_COUNT; ++kind)
+        {
+            out.Write(rowCounts[kind]);
+            out.Write(rowSizes[kind]);
+            out.Write(uint64_t{0});
+        }
+
+        for (size_t kind = 0; kind < KIND_COUNT; ++kind)
+        {
+            out.Align();
+            out.Patch(directory + kind * UibinLoader::V2_TABLE_ENTRY_SIZE + 8, static_cast<uint64_t>(out.Size()));
+
+            const auto bytes = tableBytes[kind].Take();
+            out.WriteBytes(bytes.data(), bytes.size());
+        }
+
+        beginSection(4);
+        out.WriteBytes(scene.idBuckets.data(), scene.idBuckets.size() * sizeof(uint32_t));
+
+        beginSection(5);
+
+        const size_t assetDirectory = out.Size();
+
+        for (const uint32_t key : assetKeys)
+        {
+            out.Write(key);
+            out.Write(uint32_t{0});
+            out.Write(uint64_t{0});
+            out.Write(uint64_t{0});
+        }
+
+        for (size_t i = 0; i < assets.size(); ++i)
+        {
+            const auto& data = assets[i]->second;
+
+            out.Align();
+            out.Patch(assetDirectory + i * UibinLoader::V2_ASSET_ENTRY_SIZE + 8, static_cast<uint64_t>(out.Size()));
+            out.Patch(assetDirectory + i * UibinLoader::V2_ASSET_ENTRY_SIZE + 16, static_cast<uint64_t>(data.size()));
+            out.WriteBytes(data.data(), data.size());
+        }
+
+        return out.Take();
+    }
+}
@@ -2,20 +2,41 @@
 
 #include "RenderStar/Common/Asset/AssetLocation.hpp"
 #include "RenderStar/Common/Asset/IAsset.hpp"
-#include <unordered_map>
+#include <atomic>
+#include <cstdint>
 #include <list>
 #include <memory>
-#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace RenderStar::Common::Asset
 {
+    struct AssetCacheStatistics
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t insertions = 0;
+        uint64_t evictions = 0;
+        uint64_t rejections = 0;
+        size_t entryCount = 0;
+        size_t residentBytes = 0;
+        size_t byteBudget = 0;
+
+        [[nodiscard]]
+        double GetHitRate() const
+        {
+            const uint64_t lookups = hits + misses;
+            return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+        }
+    };
+
     class AssetCache
     {
     public:
-        static constexpr size_t DEFAULT_MAX_SIZE = 256;
+        static constexpr size_t DEFAULT_BYTE_BUDGET = 256ull * 1024 * 1024;
 
         AssetCache();
-        explicit AssetCache(size_t maxSize);
+        explicit AssetCache(size_t byteBudget);
 
         template<typename T>
         std::shared_ptr<T> Get(const AssetLocation& location);
@@ -23,67 +44,55 @@ namespace RenderStar::Common::Asset
         template<typename T>
         void Put(const AssetLocation& location, std::shared_ptr<T> asset);
 
+        bool Contains(const AssetLocation& location) const;
         void Evict(const AssetLocation& location);
         void Clear();
-        void SetMaxSize(size_t size);
+        void SetByteBudget(size_t budget);
         size_t GetSize() const;
-        size_t GetMaxSize() const;
+        size_t GetResidentBytes() const;
+        size_t GetByteBudget() const;
+
+        AssetCacheStatistics GetStatistics() const;
+        void ResetStatistics();
 
     private:
-        void TouchEntry(const AssetLocation& location);
-        void EvictLeastRecentlyUsed();
-
-        std::unordered_map<AssetLocation, std::weak_ptr<IAsset>> cache;
-        std::list<AssetLocation> lruOrder;
-        std::unordered_map<AssetLocation, std::list<AssetLocation>::iterator> lruIterators;
-        size_t maxCacheSize;
-        mutable std::mutex cacheMutex;
+        struct Entry
+        {
+            std::shared_ptr<IAsset> asset;
+            size_t bytes = 0;
+            std::list<AssetLocation>::iterator clockPosition;
+            mutable std::atomic<bool> referenced = false;
+        };
+
+        std::shared_ptr<IAsset> Find(const AssetLocation& location) const;
+        void Insert(const AssetLocation& location, std::shared_ptr<IAsset> asset);
+        void EraseEntry(std::unordered_map<AssetLocation, Entry>::iterator iterator);
+        void EvictToBudget();
+
+        std::unordered_map<AssetLocation, Entry> entries;
+        std::list<AssetLocation> clockOrder;
+        std::list<AssetLocation>::iterator clockHand;
+        size_t residentBytes;
+        size_t byteBudget;
+
+        mutable std::atomic<uint64_t> hits;
+        mutable std::atomic<uint64_t> misses;
+        uint64_t insertions;
+        uint64_t evictions;
+        uint64_t rejections;
+
+        mutable std::shared_mutex cacheMutex;
     };
 
     template<typename T>
     std::shared_ptr<T> AssetCache::Get(const AssetLocation& location)
     {
-        std::lock_guard<std::mutex> lock(cacheMutex);
-
-        auto it = cache.find(location);
-        if (it == cache.end())
-            return nullptr;
-
-        auto sharedAsset = it->second.lock();
-        if (!sharedAsset)
-        {
-            cache.erase(it);
-            auto lruIt = lruIterators.find(location);
-            if (lruIt != lruIterators.end())
-            {
-                lruOrder.erase(lruIt->second);
-                lruIterators.erase(lruIt);
-            }
-            return nullptr;
-        }
-
-        TouchEntry(location);
-        return std::dynamic_pointer_cast<T>(sharedAsset);
+        return std::dynamic_pointer_cast<T>(Find(location));
     }
 
     template<typename T>
     void AssetCache::Put(const AssetLocation& location, std::shared_ptr<T> asset)
     {
-        std::lock_guard<std::mutex> lock(cacheMutex);
-
-        auto existingIt = cache.find(location);
-        if (existingIt != cache.end())
-        {
-            existingIt->second = asset;
-            TouchEntry(location);
-            return;
-        }
-
-        while (cache.size() >= maxCacheSize)
-            EvictLeastRecentlyUsed();
-
-        cache[location] = asset;
-        lruOrder.push_front(location);
-        lruIterators[location] = lruOrder.begin();
+        Insert(location, std::move(asset));
     }
 }
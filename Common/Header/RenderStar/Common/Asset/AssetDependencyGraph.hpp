@@ -0,0 +1,40 @@
+#pragma once
+
+#include "RenderStar/Common/Asset/AssetLocation.hpp"
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace RenderStar::Common::Asset
+{
+    class AssetDependencyGraph
+    {
+    public:
+
+        void AddDependency(const AssetLocation& dependent, const AssetLocation& dependency);
+        void ClearDependencies(const AssetLocation& dependent);
+        void Clear();
+
+        [[nodiscard]]
+        std::vector<AssetLocation> GetDependencies(const AssetLocation& dependent) const;
+
+        [[nodiscard]]
+        std::vector<AssetLocation> GetDependents(const AssetLocation& dependency) const;
+
+        [[nodiscard]]
+        std::vector<AssetLocation> CollectAffected(const AssetLocation& changed) const;
+
+        [[nodiscard]]
+        size_t GetEdgeCount() const;
+
+    private:
+
+        using LocationSet = std::unordered_set<AssetLocation>;
+
+        std::unordered_map<AssetLocation, LocationSet> dependencies;
+        std::unordered_map<AssetLocation, LocationSet> dependents;
+
+        mutable std::shared_mutex mutex;
+    };
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "RenderStar/Common/Asset/AssetHandle.hpp"
+#include "RenderStar/Common/Asset/AssetLoadRequest.hpp"
+#include "RenderStar/Common/Asset/AssetStreamer.hpp"
+#include <memory>
+#include <utility>
+
+namespace RenderStar::Common::Asset
+{
+    template<typename T>
+    class AssetFuture
+    {
+    public:
+        AssetFuture() = default;
+
+        AssetFuture(std::shared_ptr<AssetLoadRequest> request, AssetStreamer* streamer)
+            : request(std::move(request))
+            , streamer(streamer)
+        {
+        }
+
+        AssetFuture(const AssetFuture&) = delete;
+        AssetFuture& operator=(const AssetFuture&) = delete;
+
+        AssetFuture(AssetFuture&& other) noexcept
+            : request(std::move(other.request))
+            , streamer(std::exchange(other.streamer, nullptr))
+        {
+        }
+
+        AssetFuture& operator=(AssetFuture&& other) noexcept
+        {
+            request = std::move(other.request);
+            streamer = std::exchange(other.streamer, nullptr);
+            return *this;
+        }
+
+        bool IsValid() const
+        {
+            return request != nullptr;
+        }
+
+        bool IsReady() const
+        {
+            return request && request->IsDone();
+        }
+
+        AssetLoadStatus GetStatus() const
+        {
+            return request ? request->GetStatus() : AssetLoadStatus::CANCELLED;
+        }
+
+        void Wait() const
+        {
+            if (request)
+                request->Wait();
+        }
+
+        bool WaitFor(std::chrono::milliseconds timeout) const
+        {
+            return request && request->WaitFor(timeout);
+        }
+
+        AssetHandle<T> Get() const
+        {
+            if (!request)
+                return AssetHandle<T>();
+
+            request->Wait();
+
+            return AssetHandle<T>(std::dynamic_pointer_cast<T>(request->GetAsset()));
+        }
+
+        void Cancel()
+        {
+            if (request && streamer)
+                streamer->Cancel(request);
+
+            request.reset();
+            streamer = nullptr;
+        }
+
+    private:
+        std::shared_ptr<AssetLoadRequest> request;
+        AssetStreamer* streamer = nullptr;
+    };
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+namespace RenderStar::Common::Asset
+{
+    enum class AssetLoadPriority : int32_t
+    {
+        HIGHEST = 0,
+        HIGH = 1,
+        NORMAL = 2,
+        LOW = 3,
+        LOWEST = 4
+    };
+
+    enum class AssetLoadStatus : int32_t
+    {
+        PENDING,
+        LOADING,
+        COMPLETED,
+        FAILED,
+        CANCELLED
+    };
+}
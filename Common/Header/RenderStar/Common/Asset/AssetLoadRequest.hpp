@@ -0,0 +1,68 @@
+#pragma once
+
+#include "RenderStar/Common/Asset/AssetLoadPriority.hpp"
+#include "RenderStar/Common/Asset/AssetLocation.hpp"
+#include "RenderStar/Common/Asset/IAsset.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace RenderStar::Common::Asset
+{
+    class AssetStreamer;
+
+    class AssetLoadRequest
+    {
+    public:
+
+        using LoadFunction = std::function<std::shared_ptr<IAsset>()>;
+
+        AssetLoadRequest(AssetLocation location, AssetLoadPriority priority, LoadFunction loadFunction);
+
+        static std::shared_ptr<AssetLoadRequest> Completed(const AssetLocation& location, std::shared_ptr<IAsset> asset);
+
+        [[nodiscard]]
+        const AssetLocation& GetLocation() const;
+
+        [[nodiscard]]
+        AssetLoadPriority GetPriority() const;
+
+        [[nodiscard]]
+        AssetLoadStatus GetStatus() const;
+
+        [[nodiscard]]
+        bool IsDone() const;
+
+        void Wait() const;
+        bool WaitFor(std::chrono::milliseconds timeout) const;
+
+        [[nodiscard]]
+        std::shared_ptr<IAsset> GetAsset() const;
+
+    private:
+
+        friend class AssetStreamer;
+
+        bool RaisePriority(AssetLoadPriority newPriority);
+        bool TryBegin();
+        std::shared_ptr<IAsset> Execute();
+        void Finish(AssetLoadStatus finalStatus, std::shared_ptr<IAsset> result);
+
+        void AddInterest();
+        bool ReleaseInterest();
+
+        AssetLocation location;
+        LoadFunction loadFunction;
+
+        std::atomic<AssetLoadPriority> priority;
+        std::atomic<AssetLoadStatus> status;
+        std::atomic<uint32_t> interestCount;
+
+        std::shared_ptr<IAsset> asset;
+        mutable std::mutex resultMutex;
+        mutable std::condition_variable resultCondition;
+    };
+}
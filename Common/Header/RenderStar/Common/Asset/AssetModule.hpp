@@ -4,21 +4,45 @@
 #include "RenderStar/Common/Asset/AssetLocation.hpp"
 #include "RenderStar/Common/Asset/AssetHandle.hpp"
 #include "RenderStar/Common/Asset/AssetCache.hpp"
+#include "RenderStar/Common/Asset/AssetDependencyGraph.hpp"
+#include "RenderStar/Common/Asset/AssetFuture.hpp"
+#include "RenderStar/Common/Asset/AssetStreamer.hpp"
+#include "RenderStar/Common/Asset/AssetWatcher.hpp"
 #include "RenderStar/Common/Asset/IAssetProvider.hpp"
 #include "RenderStar/Common/Asset/IAssetLoader.hpp"
 #include "RenderStar/Common/Asset/ITextAsset.hpp"
 #include "RenderStar/Common/Asset/IBinaryAsset.hpp"
+#include "RenderStar/Common/Event/Events/AssetReloadEvent.hpp"
+#include "RenderStar/Common/Event/IEventBus.hpp"
+#include <chrono>
 #include <unordered_map>
 #include <memory>
 #include <typeindex>
 #include <filesystem>
 #include <mutex>
+#include <shared_mutex>
 
 namespace RenderStar::Common::Asset
 {
     template <typename T>
     concept IAssetType = std::derived_from<T, IAsset>;
 
+    struct AssetReloadStatistics
+    {
+        uint64_t changes = 0;
+        uint64_t invalidations = 0;
+        uint64_t measuredReloads = 0;
+        std::chrono::nanoseconds lastLatency { 0 };
+        std::chrono::nanoseconds maxLatency { 0 };
+        std::chrono::nanoseconds totalLatency { 0 };
+
+        [[nodiscard]]
+        std::chrono::nanoseconds GetAverageLatency() const
+        {
+            return measuredReloads == 0 ? std::chrono::nanoseconds(0) : totalLatency / static_cast<int64_t>(measuredReloads);
+        }
+    };
+
     class AssetModule final : public Module::AbstractModule
     {
 
@@ -36,6 +60,9 @@ namespace RenderStar::Common::Asset
         template <IAssetType T>
         AssetHandle<T> Load(const AssetLocation& location);
 
+        template <IAssetType T>
+        AssetFuture<T> LoadAsync(const AssetLocation& location, AssetLoadPriority priority = AssetLoadPriority::NORMAL);
+
         AssetHandle<ITextAsset> LoadText(const AssetLocation& location);
         AssetHandle<IBinaryAsset> LoadBinary(const AssetLocation& location);
 
@@ -46,6 +73,21 @@ namespace RenderStar::Common::Asset
 
         void ClearCache();
         AssetCache& GetCache();
+        AssetStreamer& GetStreamer();
+
+        bool EnableHotReload();
+        void DisableHotReload();
+        bool IsHotReloadEnabled() const;
+
+        void RecordDependency(const AssetLocation& dependent, const AssetLocation& dependency);
+        void ClearDependencies(const AssetLocation& dependent);
+        AssetDependencyGraph& GetDependencyGraph();
+
+        std::vector<Event::Events::AssetReloadEvent> PollReloads();
+        size_t PublishReloads(Event::IEventBus& eventBus);
+
+        void RecordReloadLatency(std::chrono::nanoseconds latency);
+        AssetReloadStatistics GetReloadStatistics() const;
 
         const std::filesystem::path& GetBasePath() const;
         void SetBasePath(const std::filesystem::path& path);
@@ -53,6 +95,7 @@ namespace RenderStar::Common::Asset
     protected:
 
         void OnInitialize(Module::ModuleContext& context) override;
+        void OnCleanup() override;
 
     private:
 
@@ -61,6 +104,11 @@ namespace RenderStar::Common::Asset
 
         IAssetProvider* GetProviderForNamespace(std::string_view namespaceId) const;
 
+        void WatchProviderRoots();
+
+        template <IAssetType T>
+        std::shared_ptr<T> LoadUncached(const AssetLocation& location);
+
         std::unordered_map<std::string, std::unique_ptr<IAssetProvider>> providers;
 
         AssetCache cache;
@@ -68,33 +116,61 @@ namespace RenderStar::Common::Asset
         std::unordered_map<std::type_index, std::shared_ptr<void>> loaders;
         std::filesystem::path basePath;
 
-        mutable std::mutex moduleMutex;
+        mutable std::shared_mutex moduleMutex;
+
+        AssetStreamer streamer;
+
+        AssetDependencyGraph dependencyGraph;
+
+        std::unique_ptr<AssetWatcher> watcher;
+        AssetReloadStatistics reloadStatistics;
+        mutable std::mutex reloadMutex;
     };
 
     template <IAssetType T>
     void AssetModule::RegisterLoader(std::unique_ptr<IAssetLoader<T>> loader)
     {
-        std::lock_guard lock(moduleMutex);
+        std::unique_lock lock(moduleMutex);
         loaders[std::type_index(typeid(T))] = std::move(loader);
     }
 
     template <IAssetType T>
     AssetHandle<T> AssetModule::Load(const AssetLocation& location)
     {
-        std::lock_guard lock(moduleMutex);
-
         if (auto cachedAsset = cache.Get<T>(location))
             return AssetHandle<T>(cachedAsset);
 
+        return AssetHandle<T>(LoadUncached<T>(location));
+    }
+
+    template <IAssetType T>
+    AssetFuture<T> AssetModule::LoadAsync(const AssetLocation& location, const AssetLoadPriority priority)
+    {
+        if (auto cachedAsset = cache.Get<T>(location))
+            return AssetFuture<T>(AssetLoadRequest::Completed(location, cachedAsset), nullptr);
+
+        auto request = streamer.Enqueue(location, std::type_index(typeid(T)), priority, [this, location]() -> std::shared_ptr<IAsset>
+        {
+            return LoadUncached<T>(location);
+        });
+
+        return AssetFuture<T>(std::move(request), &streamer);
+    }
+
+    template <IAssetType T>
+    std::shared_ptr<T> AssetModule::LoadUncached(const AssetLocation& location)
+    {
+        std::shared_lock lock(moduleMutex);
+
         auto provider = GetProviderForNamespace(location.GetNamespace());
 
         if (!provider)
-            return AssetHandle<T>();
+            return nullptr;
 
         const auto loaderIterator = loaders.find(std::type_index(typeid(T)));
 
         if (loaderIterator == loaders.end())
-            return AssetHandle<T>();
+            return nullptr;
 
         auto loader = std::static_pointer_cast<IAssetLoader<T>>(loaderIterator->second);
         auto asset = loader->Load(location, *provider);
@@ -102,6 +178,6 @@ namespace RenderStar::Common::Asset
         if (asset)
             cache.Put(location, asset);
 
-        return AssetHandle<T>(asset);
+        return asset;
     }
 }
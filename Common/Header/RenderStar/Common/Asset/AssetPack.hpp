@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace RenderStar::Common::Asset
+{
+    enum class AssetPackCompression : uint32_t
+    {
+        NONE = 0
+    };
+
+    struct AssetPackEntry
+    {
+        std::string path;
+        uint64_t pathHash = 0;
+        uint64_t offset = 0;
+        uint64_t storedSize = 0;
+        uint64_t size = 0;
+        AssetPackCompression compression = AssetPackCompression::NONE;
+    };
+
+    class AssetPack
+    {
+    public:
+
+        static uint64_t HashPath(std::string_view path);
+
+        static constexpr uint32_t MAGIC = 0x4B505352;
+        static constexpr uint32_t VERSION = 1;
+        static constexpr size_t HEADER_SIZE = 32;
+        static constexpr size_t ENTRY_HEADER_SIZE = 40;
+        static constexpr size_t DATA_ALIGNMENT = 16;
+        static constexpr std::string_view FILE_EXTENSION = ".rspak";
+    };
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "RenderStar/Common/Asset/AssetPack.hpp"
+#include <filesystem>
+#include <vector>
+
+namespace RenderStar::Common::Asset
+{
+    class AssetPackWriter
+    {
+    public:
+
+        void Add(std::string path, std::vector<uint8_t> data);
+        size_t AddDirectory(const std::filesystem::path& directory);
+
+        [[nodiscard]]
+        std::vector<uint8_t> Build() const;
+
+        bool WriteToFile(const std::filesystem::path& path) const;
+
+        [[nodiscard]]
+        size_t GetEntryCount() const;
+
+    private:
+
+        struct PendingEntry
+        {
+            std::string path;
+            std::vector<uint8_t> data;
+        };
+
+        std::vector<PendingEntry> pendingEntries;
+    };
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "RenderStar/Common/Asset/AssetLoadRequest.hpp"
+#include <spdlog/spdlog.h>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace RenderStar::Common::Asset
+{
+    class AssetStreamer
+    {
+    public:
+
+        AssetStreamer();
+        ~AssetStreamer();
+
+        AssetStreamer(const AssetStreamer&) = delete;
+        AssetStreamer& operator=(const AssetStreamer&) = delete;
+
+        void Start(uint32_t workerCount);
+        void Stop();
+
+        [[nodiscard]]
+        bool IsRunning() const;
+
+        std::shared_ptr<AssetLoadRequest> Enqueue(const AssetLocation& location, std::type_index assetType, AssetLoadPriority priority, AssetLoadRequest::LoadFunction loadFunction);
+
+        void Cancel(const std::shared_ptr<AssetLoadRequest>& request);
+
+        [[nodiscard]]
+        size_t GetInFlightCount() const;
+
+        static uint32_t GetDefaultWorkerCount();
+
+    private:
+
+        struct RequestKey
+        {
+            AssetLocation location;
+            std::type_index assetType = typeid(void);
+
+            bool operator==(const RequestKey&) const = default;
+        };
+
+        struct RequestKeyHash
+        {
+            size_t operator()(const RequestKey& key) const noexcept
+            {
+                return std::hash<AssetLocation>{}(key.location) ^ (key.assetType.hash_code() << 1);
+            }
+        };
+
+        struct QueuedRequest
+        {
+            std::shared_ptr<AssetLoadRequest> request;
+            RequestKey key;
+            AssetLoadPriority priority = AssetLoadPriority::NORMAL;
+            uint64_t sequence = 0;
+
+            bool operator<(const QueuedRequest& other) const
+            {
+                if (priority != other.priority)
+                    return static_cast<int32_t>(priority) > static_cast<int32_t>(other.priority);
+
+                return sequence > other.sequence;
+            }
+        };
+
+        void WorkerLoop(const std::stop_token& stopToken);
+        void Process(const RequestKey& key, const std::shared_ptr<AssetLoadRequest>& request);
+        void Retire(const RequestKey& key, const std::shared_ptr<AssetLoadRequest>& request);
+
+        std::shared_ptr<spdlog::logger> logger;
+
+        std::unordered_map<RequestKey, std::shared_ptr<AssetLoadRequest>, RequestKeyHash> inFlight;
+        std::priority_queue<QueuedRequest> requestQueue;
+        uint64_t nextSequence;
+
+        mutable std::mutex queueMutex;
+        std::condition_variable_any queueCondition;
+        std::vector<std::jthread> workers;
+    };
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "RenderStar/Common/Asset/AssetLocation.hpp"
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace RenderStar::Common::Asset
+{
+    class AssetWatcher
+    {
+    public:
+
+        static constexpr std::chrono::milliseconds SCAN_INTERVAL { 500 };
+
+        AssetWatcher();
+        ~AssetWatcher();
+
+        AssetWatcher(const AssetWatcher&) = delete;
+        AssetWatcher& operator=(const AssetWatcher&) = delete;
+
+        bool Watch(std::string_view namespaceId, const std::filesystem::path& root);
+        void UnwatchAll();
+
+        [[nodiscard]]
+        bool IsWatching() const;
+
+        [[nodiscard]]
+        bool UsesNativeNotifications() const;
+
+        std::vector<AssetLocation> Poll();
+
+    private:
+
+        struct WatchedRoot
+        {
+            std::string namespaceId;
+            std::filesystem::path root;
+        };
+
+        struct ScannedFile
+        {
+            size_t rootIndex;
+            std::filesystem::file_time_type modified;
+            bool seen;
+        };
+
+        void AddDirectoryWatches(size_t rootIndex, const std::filesystem::path& directory);
+        void ReadNotifications(std::vector<AssetLocation>& changes);
+        void ScanForChanges(std::vector<AssetLocation>* changes);
+
+        [[nodiscard]]
+        AssetLocation ToLocation(const WatchedRoot& watchedRoot, const std::filesystem::path& file) const;
+
+        std::vector<WatchedRoot> roots;
+
+        int notifyDescriptor;
+        std::unordered_map<int, std::pair<size_t, std::filesystem::path>> directoryWatches;
+
+        std::unordered_map<std::string, ScannedFile> scannedFiles;
+        std::chrono::steady_clock::time_point lastScan;
+    };
+}
@@ -17,6 +17,9 @@ namespace RenderStar::Common::Asset
         [[nodiscard]]
         bool IsLoaded() const override;
 
+        [[nodiscard]]
+        size_t GetMemoryFootprint() const override;
+
         [[nodiscard]]
         const std::vector<uint8_t>& GetData() const override;
 
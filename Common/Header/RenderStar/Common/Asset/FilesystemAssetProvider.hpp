@@ -22,6 +22,9 @@ namespace RenderStar::Common::Asset
         [[nodiscard]]
         std::vector<AssetLocation> List(std::string_view pathPrefix) const override;
 
+        [[nodiscard]]
+        std::optional<std::filesystem::path> GetRootPath() const override;
+
     private:
 
         [[nodiscard]]
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "RenderStar/Common/Asset/AssetLocation.hpp"
+#include <cstddef>
 
 namespace RenderStar::Common::Asset
 {
@@ -16,5 +17,8 @@ namespace RenderStar::Common::Asset
 
         [[nodiscard]]
         virtual bool IsLoaded() const = 0;
+
+        [[nodiscard]]
+        virtual size_t GetMemoryFootprint() const = 0;
     };
 }
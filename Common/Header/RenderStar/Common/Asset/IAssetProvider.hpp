@@ -1,6 +1,8 @@
 #pragma once
 
 #include "RenderStar/Common/Asset/AssetLocation.hpp"
+#include <filesystem>
+#include <optional>
 #include <vector>
 #include <string>
 #include <cstdint>
@@ -17,5 +19,7 @@ namespace RenderStar::Common::Asset
         virtual std::vector<uint8_t> LoadBinary(const AssetLocation& location) = 0;
         virtual std::string LoadText(const AssetLocation& location) = 0;
         virtual std::vector<AssetLocation> List(std::string_view pathPrefix) const = 0;
+
+        virtual std::optional<std::filesystem::path> GetRootPath() const { return std::nullopt; }
     };
 }
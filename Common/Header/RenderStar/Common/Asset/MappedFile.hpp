@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace RenderStar::Common::Asset
+{
+    class MappedFile
+    {
+    public:
+
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        bool Open(const std::filesystem::path& path);
+        void Close();
+
+        [[nodiscard]]
+        bool IsOpen() const;
+
+        [[nodiscard]]
+        std::span<const uint8_t> GetData() const;
+
+    private:
+
+        void Swap(MappedFile& other) noexcept;
+
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        bool open = false;
+
+#ifdef _WIN32
+        void* fileHandle = nullptr;
+        void* mappingHandle = nullptr;
+#else
+        int fileDescriptor = -1;
+#endif
+    };
+}
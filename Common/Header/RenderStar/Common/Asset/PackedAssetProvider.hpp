@@ -0,0 +1,49 @@
+#pragma once
+
+#include "RenderStar/Common/Asset/AssetPack.hpp"
+#include "RenderStar/Common/Asset/IAssetProvider.hpp"
+#include "RenderStar/Common/Asset/MappedFile.hpp"
+#include <filesystem>
+#include <span>
+#include <unordered_map>
+
+namespace RenderStar::Common::Asset
+{
+    class PackedAssetProvider : public IAssetProvider
+    {
+    public:
+        PackedAssetProvider(std::string_view namespaceId, const std::filesystem::path& packPath);
+
+        [[nodiscard]]
+        std::string GetNamespace() const override;
+
+        [[nodiscard]]
+        bool Exists(const AssetLocation& location) const override;
+
+        std::vector<uint8_t> LoadBinary(const AssetLocation& location) override;
+        std::string LoadText(const AssetLocation& location) override;
+
+        [[nodiscard]]
+        std::vector<AssetLocation> List(std::string_view pathPrefix) const override;
+
+        [[nodiscard]]
+        size_t GetEntryCount() const;
+
+    private:
+
+        void ReadTableOfContents();
+
+        [[nodiscard]]
+        const AssetPackEntry* FindEntry(const AssetLocation& location) const;
+
+        [[nodiscard]]
+        std::span<const uint8_t> GetEntryData(const AssetLocation& location) const;
+
+        std::string namespaceId;
+        MappedFile packFile;
+
+        std::vector<AssetPackEntry> entries;
+        std::unordered_map<uint64_t, size_t> hashIndex;
+        std::vector<size_t> pathOrder;
+    };
+}
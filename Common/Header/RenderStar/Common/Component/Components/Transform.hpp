@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 
@@ -17,5 +18,8 @@ namespace RenderStar::Common::Component
         glm::vec3 worldPosition{ 0.0f, 0.0f, 0.0f };
         glm::quat worldRotation{ 1.0f, 0.0f, 0.0f, 0.0f };
         glm::vec3 worldScale{ 1.0f, 1.0f, 1.0f };
+
+        // Bumped whenever worldMatrix changes, so consumers can skip work for transforms that stayed put
+        uint32_t version = 0;
     };
 }
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace RenderStar::Common::Configuration
+{
+    // A configuration path resolved once to a slot, so reads from a snapshot are an index rather than a tree walk.
+    // Obtain keys from IConfiguration::Key; a key stays valid across reloads of the configuration that issued it.
+    template <typename T>
+    class ConfigKey
+    {
+        static_assert(std::is_same_v<T, std::string> || std::is_same_v<T, int32_t> || std::is_same_v<T, float> || std::is_same_v<T, bool> || std::is_same_v<T, std::vector<std::string>>,
+            "ConfigKey supports std::string, int32_t, float, bool and std::vector<std::string>");
+
+    public:
+
+        static constexpr uint32_t INVALID_SLOT = std::numeric_limits<uint32_t>::max();
+
+        ConfigKey() = default;
+
+        ConfigKey(std::string path, const uint32_t slot) : path(std::move(path)), slot(slot) { }
+
+        [[nodiscard]]
+        const std::string& GetPath() const { return path; }
+
+        [[nodiscard]]
+        uint32_t GetSlot() const { return slot; }
+
+        [[nodiscard]]
+        bool IsValid() const { return slot != INVALID_SLOT; }
+
+    private:
+
+        std::string path;
+        uint32_t slot = INVALID_SLOT;
+    };
+}
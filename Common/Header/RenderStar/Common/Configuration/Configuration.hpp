@@ -2,8 +2,11 @@
 
 #include "RenderStar/Common/Configuration/IConfiguration.hpp"
 #include <pugixml.hpp>
+#include <atomic>
 #include <filesystem>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <spdlog/spdlog.h>
 
 namespace RenderStar::Common::Configuration
@@ -40,18 +43,36 @@ namespace RenderStar::Common::Configuration
         void Save() override;
         void Reload() override;
 
+        // Holds off this section's writers while ConfigurationModule swaps the shared document underneath it
+        [[nodiscard]]
+        std::unique_lock<std::mutex> LockWrites();
+
+        // Re-reads the section from the shared document after it was reloaded; callers hold LockWrites()
+        void Refresh();
+
+        [[nodiscard]]
+        std::shared_ptr<const ConfigurationSnapshot> GetSnapshot() const override;
+
+        uint32_t ResolveSlot(const std::string& path) override;
+
         [[nodiscard]]
         const std::string& GetNamespace() const;
 
         [[nodiscard]]
         const std::string& GetClassScope() const;
 
+        [[nodiscard]]
+        const std::filesystem::path& GetFilePath() const;
+
+        [[nodiscard]]
+        const std::shared_ptr<pugi::xml_document>& GetDocument() const;
+
     private:
 
         void InitializeScopedElement();
 
-        [[nodiscard]]
-        pugi::xml_node NavigateToNode(const std::string& path) const;
+        // Compiles the document into a new snapshot and swaps it in; callers hold writeMutex
+        void Publish();
 
         pugi::xml_node NavigateOrCreateNode(const std::string& path) const;
 
@@ -64,5 +85,12 @@ namespace RenderStar::Common::Configuration
         std::filesystem::path filePath;
 
         pugi::xml_node scopedElement;
+
+        // Writers (setters, reloads, key registration) serialize here; readers only load the snapshot
+        std::mutex writeMutex;
+        std::vector<std::string> keyPaths;
+        std::unordered_map<std::string, uint32_t> keySlots;
+        std::atomic<std::shared_ptr<const ConfigurationSnapshot>> snapshot;
+        uint64_t generation = 0;
     };
 }
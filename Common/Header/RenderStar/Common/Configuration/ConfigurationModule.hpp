@@ -1,5 +1,6 @@
 #pragma once
 
+#include "RenderStar/Common/Asset/AssetLocation.hpp"
 #include "RenderStar/Common/Configuration/IConfiguration.hpp"
 #include "RenderStar/Common/Configuration/Configuration.hpp"
 #include "RenderStar/Common/Module/AbstractModule.hpp"
@@ -62,6 +63,12 @@ namespace RenderStar::Common::Configuration
 
         void ClearCache();
 
+        // Re-parses a changed configuration file and publishes new snapshots for every section loaded from it.
+        // Readers holding the previous snapshot keep it; a file that fails to parse leaves the old values in place.
+        size_t ReloadFile(const std::filesystem::path& filePath);
+
+        size_t Reload(const Asset::AssetLocation& changed);
+
     protected:
 
         void OnInitialize(Module::ModuleContext& context) override;
@@ -105,7 +112,7 @@ namespace RenderStar::Common::Configuration
         std::shared_ptr<pugi::xml_document> GetOrLoadDocument(const std::string& documentKey, const std::filesystem::path& filePath);
 
         std::filesystem::path resourceBasePath;
-        std::unordered_map<std::string, std::shared_ptr<IConfiguration>> configCache;
+        std::unordered_map<std::string, std::shared_ptr<Configuration>> configCache;
         std::unordered_map<std::string, std::shared_ptr<pugi::xml_document>> documentCache;
     };
 }
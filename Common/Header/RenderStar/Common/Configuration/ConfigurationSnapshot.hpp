@@ -0,0 +1,93 @@
+#pragma once
+
+#include "RenderStar/Common/Configuration/ConfigKey.hpp"
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace pugi
+{
+    class xml_node;
+}
+
+namespace RenderStar::Common::Configuration
+{
+    // Every typed reading of one configuration element, parsed when the snapshot is compiled
+    struct ConfigValue
+    {
+        std::string text;
+        int32_t integer = 0;
+        float floating = 0.0f;
+        bool boolean = false;
+        std::vector<std::string> list;
+    };
+
+    // An immutable, fully parsed copy of one configuration section. Values are addressed by dotted path
+    // through a hash map, or by the slots of previously resolved ConfigKeys through a flat array.
+    class ConfigurationSnapshot
+    {
+    public:
+
+        static constexpr uint32_t MISSING = std::numeric_limits<uint32_t>::max();
+
+        // keyPaths[i] is the path behind slot i
+        static std::shared_ptr<const ConfigurationSnapshot> Compile(pugi::xml_node scope, std::span<const std::string> keyPaths, uint64_t generation);
+
+        [[nodiscard]]
+        const ConfigValue* Find(std::string_view path) const;
+
+        template <typename T>
+        [[nodiscard]]
+        std::optional<T> Get(const ConfigKey<T>& key) const
+        {
+            const ConfigValue* value = key.GetSlot() < slots.size() ? FindSlot(key.GetSlot()) : Find(key.GetPath());
+
+            if (!value)
+                return std::nullopt;
+
+            if constexpr (std::is_same_v<T, std::string>)
+                return value->text;
+            else if constexpr (std::is_same_v<T, int32_t>)
+                return value->integer;
+            else if constexpr (std::is_same_v<T, float>)
+                return value->floating;
+            else if constexpr (std::is_same_v<T, bool>)
+                return value->boolean;
+            else
+                return value->list;
+        }
+
+        [[nodiscard]]
+        size_t GetValueCount() const { return values.size(); }
+
+        // Increases every time the owning configuration publishes a new snapshot
+        [[nodiscard]]
+        uint64_t GetGeneration() const { return generation; }
+
+    private:
+
+        struct PathHash
+        {
+            using is_transparent = void;
+
+            size_t operator()(const std::string_view path) const { return std::hash<std::string_view>{}(path); }
+        };
+
+        [[nodiscard]]
+        const ConfigValue* FindSlot(const uint32_t slot) const { return slots[slot] == MISSING ? nullptr : &values[slots[slot]]; }
+
+        void Flatten(pugi::xml_node node, std::string& path);
+
+        std::vector<ConfigValue> values;
+        std::unordered_map<std::string, uint32_t, PathHash, std::equal_to<>> indices;
+        std::vector<uint32_t> slots;
+        uint64_t generation = 0;
+    };
+}
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "RenderStar/Common/Configuration/ConfigKey.hpp"
+#include "RenderStar/Common/Configuration/ConfigurationSnapshot.hpp"
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -39,5 +42,25 @@ namespace RenderStar::Common::Configuration
         virtual void Save() = 0;
 
         virtual void Reload() = 0;
+
+        // The current values; a held snapshot never changes, later edits and reloads publish a new one
+        [[nodiscard]]
+        virtual std::shared_ptr<const ConfigurationSnapshot> GetSnapshot() const = 0;
+
+        // Registers path and returns its slot; the same path always maps to the same slot
+        virtual uint32_t ResolveSlot(const std::string& path) = 0;
+
+        template <typename T>
+        ConfigKey<T> Key(const std::string& path)
+        {
+            return ConfigKey<T>(path, ResolveSlot(path));
+        }
+
+        template <typename T>
+        [[nodiscard]]
+        std::optional<T> Get(const ConfigKey<T>& key) const
+        {
+            return GetSnapshot()->Get(key);
+        }
     };
 }
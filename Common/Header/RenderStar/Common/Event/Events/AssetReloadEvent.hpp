@@ -0,0 +1,32 @@
+#pragma once
+
+#include "RenderStar/Common/Asset/AssetLocation.hpp"
+#include "RenderStar/Common/Event/IEvent.hpp"
+#include <algorithm>
+#include <chrono>
+#include <string_view>
+#include <vector>
+
+namespace RenderStar::Common::Event::Events
+{
+    struct AssetReloadEvent final : TypedEvent<AssetReloadEvent>
+    {
+        Asset::AssetLocation changed;
+        std::vector<Asset::AssetLocation> affected;
+        std::chrono::steady_clock::time_point detectedAt;
+
+        AssetReloadEvent() = default;
+
+        AssetReloadEvent(Asset::AssetLocation changedValue, std::vector<Asset::AssetLocation> affectedValue, const std::chrono::steady_clock::time_point detectedAtValue)
+            : changed(std::move(changedValue)), affected(std::move(affectedValue)), detectedAt(detectedAtValue) { }
+
+        [[nodiscard]]
+        bool Affects(const Asset::AssetLocation& location) const
+        {
+            return std::ranges::find(affected, location) != affected.end();
+        }
+
+        [[nodiscard]]
+        std::string_view GetName() const override { return "AssetReloadEvent"; }
+    };
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "RenderStar/Common/Scene/MapbinLoader.hpp"
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace RenderStar::Common::Scene
+{
+    struct MapbinCluster
+    {
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+        glm::vec3 boundsMin = glm::vec3(0.0f);
+        glm::vec3 boundsMax = glm::vec3(0.0f);
+    };
+
+    struct MapbinClusterSet
+    {
+        // The group's triangles reordered so that every cluster is one contiguous index range
+        std::vector<uint32_t> indices;
+        std::vector<MapbinCluster> clusters;
+    };
+
+    // Splits a group into spatially coherent clusters by recursive median splits of triangle
+    // centroids along the longest axis. The result depends only on the input geometry.
+    class MapbinClusterer
+    {
+    public:
+
+        static constexpr uint32_t DEFAULT_MAX_TRIANGLES = 2048;
+
+        // Triangles that reference vertices outside the group are dropped
+        static MapbinClusterSet Build(const MapbinGroup& group, uint32_t maxTriangles = DEFAULT_MAX_TRIANGLES);
+    };
+}
@@ -26,6 +26,15 @@ namespace RenderStar::Common::Scene
         AO = 9
     };
 
+    enum class CompressedTextureFormat : uint32_t
+    {
+        NONE = 0,
+        BC1 = 1,
+        BC3 = 3,
+        BC4 = 4,
+        BC5 = 5
+    };
+
     enum class GameObjectType : uint32_t
     {
         PLAYER_START = 0,
@@ -63,6 +72,13 @@ namespace RenderStar::Common::Scene
         float colorFilterStrength = 0.0f;
     };
 
+    struct MapbinTextureMip
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        std::vector<uint8_t> data;
+    };
+
     struct MapbinTextureSlot
     {
         TextureSlotType slotType = TextureSlotType::BASE_COLOR;
@@ -73,6 +89,8 @@ namespace RenderStar::Common::Scene
         uint32_t minFilter = 0;
         uint32_t magFilter = 0;
         std::vector<uint8_t> pixelData;
+        CompressedTextureFormat compressedFormat = CompressedTextureFormat::NONE;
+        std::vector<MapbinTextureMip> compressedMips;
     };
 
     struct MapbinMaterial
@@ -124,11 +142,15 @@ namespace RenderStar::Common::Scene
         static std::optional<MapbinScene> LoadV5(const uint8_t* ptr, const uint8_t* end,
             uint32_t materialCount, uint32_t groupCount);
 
+        static std::optional<MapbinScene> LoadV6(const uint8_t* ptr, const uint8_t* end,
+            uint32_t materialCount, uint32_t groupCount);
+
         static bool ParseMaterialsAndGroups(const uint8_t*& ptr, const uint8_t* end,
             uint32_t materialCount, uint32_t groupCount, MapbinScene& scene);
 
         static bool ParseGameObjectsV4(const uint8_t*& ptr, const uint8_t* end, MapbinScene& scene);
         static bool ParseGameObjectsV5(const uint8_t*& ptr, const uint8_t* end, MapbinScene& scene);
+        static bool ParseCompressedTexturesV6(const uint8_t*& ptr, const uint8_t* end, MapbinScene& scene);
 
         static void ComputeNormalsForGroup(MapbinGroup& group);
 
@@ -137,6 +159,7 @@ namespace RenderStar::Common::Scene
         static constexpr uint32_t VERSION_3 = 3;
         static constexpr uint32_t VERSION_4 = 4;
         static constexpr uint32_t VERSION_5 = 5;
+        static constexpr uint32_t VERSION_6 = 6;
         static constexpr size_t HEADER_SIZE = 16;
         static constexpr size_t V2_TEXTURE_HEADER_SIZE = 32;
         static constexpr size_t V3_MATERIAL_SCALAR_SIZE = 32;
@@ -148,5 +171,9 @@ namespace RenderStar::Common::Scene
         static constexpr size_t V5_LIGHT_FIELDS_SIZE = 16;
         static constexpr size_t V5_SPOT_FIELDS_SIZE = 8;
         static constexpr size_t V5_VOLUME_FIELDS_SIZE = 80;
+        static constexpr size_t V6_COMPRESSED_TEXTURE_HEADER_SIZE = 16;
+        static constexpr size_t V6_MIP_HEADER_SIZE = 12;
+        // A full chain for 32-bit dimensions
+        static constexpr uint32_t MAX_COMPRESSED_MIPS = 32;
     };
 }
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "RenderStar/Common/Scene/MapbinLoader.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace RenderStar::Common::Scene
+{
+    class MapbinWriter
+    {
+    public:
+
+        static std::vector<uint8_t> Write(const MapbinScene& scene);
+
+    private:
+
+        static void WriteMaterials(std::vector<uint8_t>& buffer, const MapbinScene& scene);
+        static void WriteGroups(std::vector<uint8_t>& buffer, const MapbinScene& scene);
+        static void WriteGameObjects(std::vector<uint8_t>& buffer, const MapbinScene& scene);
+        static void WriteCompressedTextures(std::vector<uint8_t>& buffer, const MapbinScene& scene);
+
+        static constexpr uint32_t MAGIC = 0x4D415042;
+        static constexpr uint32_t VERSION = 6;
+    };
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "RenderStar/Common/Scene/MapbinLoader.hpp"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace RenderStar::Common::Scene
+{
+    class TextureTranscoder
+    {
+    public:
+
+        static CompressedTextureFormat SelectFormat(TextureSlotType slotType, std::span<const uint8_t> rgbaPixels);
+
+        static std::vector<MapbinTextureMip> GenerateMipChain(std::span<const uint8_t> rgbaPixels, uint32_t width, uint32_t height, bool normalMap);
+
+        static std::vector<uint8_t> Compress(CompressedTextureFormat format, std::span<const uint8_t> rgbaPixels, uint32_t width, uint32_t height);
+        static std::vector<uint8_t> Decompress(CompressedTextureFormat format, std::span<const uint8_t> blockData, uint32_t width, uint32_t height);
+
+        static bool TranscodeSlot(MapbinTextureSlot& slot, bool keepRawPixels);
+        static size_t TranscodeScene(MapbinScene& scene, bool keepRawPixels);
+
+        static uint32_t GetMipCount(uint32_t width, uint32_t height);
+        static size_t GetBlockSize(CompressedTextureFormat format);
+        static size_t GetCompressedSize(CompressedTextureFormat format, uint32_t width, uint32_t height);
+
+        static constexpr uint32_t BLOCK_DIMENSION = 4;
+
+    private:
+
+        static void EncodeColorBlock(const uint8_t* blockPixels, uint8_t* output);
+        static void EncodeSingleChannelBlock(const uint8_t* blockPixels, uint32_t channel, uint8_t* output);
+
+        static void DecodeColorBlock(const uint8_t* input, uint8_t* blockPixels, bool allowTransparent);
+        static void DecodeSingleChannelBlock(const uint8_t* input, uint32_t channel, uint8_t* blockPixels);
+    };
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace RenderStar::Common::Utility
+{
+    // Threads that stay alive between dispatches, for work that fans out every frame. The calling
+    // thread always takes part as worker 0, so a pool of one worker owns no threads at all.
+    class WorkerPool
+    {
+    public:
+
+        // A worker count of 0 picks GetDefaultWorkerCount()
+        explicit WorkerPool(size_t workerCount = 0);
+
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        // Calls body(worker) exactly once for every worker in [0, participants), capped at the pool size,
+        // and returns when all of them have finished. Worker w > 0 always runs on the same pooled thread.
+        void RunOnWorkers(size_t participants, const std::function<void(size_t)>& body);
+
+        // Hands out job indices in [0, jobCount) from a shared counter to at most maxWorkers workers (0 for all)
+        void Run(size_t jobCount, const std::function<void(size_t)>& job, size_t maxWorkers = 0);
+
+        [[nodiscard]]
+        size_t GetWorkerCount() const { return threads.size() + 1; }
+
+        // One per hardware thread, up to eight
+        [[nodiscard]]
+        static size_t GetDefaultWorkerCount();
+
+        // Same contract as Run, but on threads spawned for this call only; for one-off work such as loading
+        static void RunTransient(size_t jobCount, size_t workerCount, const std::function<void(size_t)>& job);
+
+    private:
+
+        void WorkerLoop(const std::stop_token& stopToken, size_t worker);
+        void WaitForWorkers();
+
+        // Serializes dispatches from different callers
+        std::mutex dispatchMutex;
+        std::mutex stateMutex;
+        std::condition_variable_any wake;
+        std::condition_variable finished;
+        const std::function<void(size_t)>* body = nullptr;
+        size_t participants = 0;
+        size_t remaining = 0;
+        uint64_t generation = 0;
+        // Declared last so the threads stop before the state they wait on is destroyed
+        std::vector<std::jthread> threads;
+    };
+}
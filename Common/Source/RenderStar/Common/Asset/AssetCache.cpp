@@ -1,75 +1,175 @@
 #include "RenderStar/Common/Asset/AssetCache.hpp"
+#include <mutex>
 
 namespace RenderStar::Common::Asset
 {
-    AssetCache::AssetCache() : maxCacheSize(DEFAULT_MAX_SIZE) { }
+    AssetCache::AssetCache() : AssetCache(DEFAULT_BYTE_BUDGET) { }
 
-    AssetCache::AssetCache(const size_t maxSize) : maxCacheSize(maxSize) { }
+    AssetCache::AssetCache(const size_t byteBudget)
+        : clockHand(clockOrder.end())
+        , residentBytes(0)
+        , byteBudget(byteBudget)
+        , hits(0)
+        , misses(0)
+        , insertions(0)
+        , evictions(0)
+        , rejections(0)
+    {
+    }
 
-    void AssetCache::Evict(const AssetLocation& location)
+    bool AssetCache::Contains(const AssetLocation& location) const
     {
-        std::lock_guard lock(cacheMutex);
+        std::shared_lock lock(cacheMutex);
+        return entries.contains(location);
+    }
 
-        if (const auto iterator = cache.find(location); iterator != cache.end())
-        {
-            cache.erase(iterator);
+    void AssetCache::Evict(const AssetLocation& location)
+    {
+        std::unique_lock lock(cacheMutex);
 
-            if (const auto lruIt = lruIterators.find(location); lruIt != lruIterators.end())
-            {
-                lruOrder.erase(lruIt->second);
-                lruIterators.erase(lruIt);
-            }
-        }
+        if (const auto iterator = entries.find(location); iterator != entries.end())
+            EraseEntry(iterator);
     }
 
     void AssetCache::Clear()
     {
-        std::lock_guard lock(cacheMutex);
-        cache.clear();
-        lruOrder.clear();
-        lruIterators.clear();
+        std::unique_lock lock(cacheMutex);
+
+        entries.clear();
+        clockOrder.clear();
+        clockHand = clockOrder.end();
+        residentBytes = 0;
     }
 
-    void AssetCache::SetMaxSize(const size_t size)
+    void AssetCache::SetByteBudget(const size_t budget)
     {
-        std::lock_guard lock(cacheMutex);
-        maxCacheSize = size;
+        std::unique_lock lock(cacheMutex);
 
-        while (cache.size() > maxCacheSize)
-            EvictLeastRecentlyUsed();
+        byteBudget = budget;
+        EvictToBudget();
     }
 
     size_t AssetCache::GetSize() const
     {
-        std::lock_guard lock(cacheMutex);
-        return cache.size();
+        std::shared_lock lock(cacheMutex);
+        return entries.size();
     }
 
-    size_t AssetCache::GetMaxSize() const
+    size_t AssetCache::GetResidentBytes() const
     {
-        return maxCacheSize;
+        std::shared_lock lock(cacheMutex);
+        return residentBytes;
     }
 
-    void AssetCache::TouchEntry(const AssetLocation& location)
+    size_t AssetCache::GetByteBudget() const
     {
-        if (const auto lruIt = lruIterators.find(location); lruIt != lruIterators.end())
-        {
-            lruOrder.erase(lruIt->second);
-            lruOrder.push_front(location);
+        std::shared_lock lock(cacheMutex);
+        return byteBudget;
+    }
 
-            lruIt->second = lruOrder.begin();
+    AssetCacheStatistics AssetCache::GetStatistics() const
+    {
+        std::shared_lock lock(cacheMutex);
+
+        AssetCacheStatistics statistics;
+        statistics.hits = hits.load(std::memory_order_relaxed);
+        statistics.misses = misses.load(std::memory_order_relaxed);
+        statistics.insertions = insertions;
+        statistics.evictions = evictions;
+        statistics.rejections = rejections;
+        statistics.entryCount = entries.size();
+        statistics.residentBytes = residentBytes;
+        statistics.byteBudget = byteBudget;
+
+        return statistics;
+    }
+
+    void AssetCache::ResetStatistics()
+    {
+        std::unique_lock lock(cacheMutex);
+
+        hits.store(0, std::memory_order_relaxed);
+        misses.store(0, std::memory_order_relaxed);
+        insertions = 0;
+        evictions = 0;
+        rejections = 0;
+    }
+
+    std::shared_ptr<IAsset> AssetCache::Find(const AssetLocation& location) const
+    {
+        std::shared_lock lock(cacheMutex);
+
+        const auto iterator = entries.find(location);
+
+        if (iterator == entries.end())
+        {
+            misses.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
         }
+
+        iterator->second.referenced.store(true, std::memory_order_relaxed);
+        hits.fetch_add(1, std::memory_order_relaxed);
+
+        return iterator->second.asset;
     }
 
-    void AssetCache::EvictLeastRecentlyUsed()
+    void AssetCache::Insert(const AssetLocation& location, std::shared_ptr<IAsset> asset)
     {
-        if (lruOrder.empty())
+        if (!asset)
             return;
 
-        const auto& lruLocation = lruOrder.back();
+        const size_t bytes = asset->GetMemoryFootprint();
+
+        std::unique_lock lock(cacheMutex);
+
+        if (const auto existing = entries.find(location); existing != entries.end())
+            EraseEntry(existing);
 
-        cache.erase(lruLocation);
-        lruIterators.erase(lruLocation);
-        lruOrder.pop_back();
+        if (bytes > byteBudget)
+        {
+            ++rejections;
+            return;
+        }
+
+        auto& entry = entries[location];
+        entry.asset = std::move(asset);
+        entry.bytes = bytes;
+        entry.clockPosition = clockOrder.insert(clockHand, location);
+
+        residentBytes += bytes;
+        ++insertions;
+
+        EvictToBudget();
+    }
+
+    void AssetCache::EraseEntry(const std::unordered_map<AssetLocation, Entry>::iterator iterator)
+    {
+        if (clockHand == iterator->second.clockPosition)
+            ++clockHand;
+
+        clockOrder.erase(iterator->second.clockPosition);
+        residentBytes -= iterator->second.bytes;
+
+        entries.erase(iterator);
+    }
+
+    void AssetCache::EvictToBudget()
+    {
+        while (residentBytes > byteBudget && !entries.empty())
+        {
+            if (clockHand == clockOrder.end())
+                clockHand = clockOrder.begin();
+
+            const auto iterator = entries.find(*clockHand);
+
+            if (iterator->second.referenced.exchange(false, std::memory_order_relaxed))
+            {
+                ++clockHand;
+                continue;
+            }
+
+            EraseEntry(iterator);
+            ++evictions;
+        }
     }
 }
@@ -0,0 +1,119 @@
+#include "RenderStar/Common/Asset/AssetDependencyGraph.hpp"
+
+#include <deque>
+#include <mutex>
+#include <ranges>
+
+namespace RenderStar::Common::Asset
+{
+    void AssetDependencyGraph::AddDependency(const AssetLocation& dependent, const AssetLocation& dependency)
+    {
+        if (dependent == dependency)
+            return;
+
+        std::unique_lock lock(mutex);
+
+        dependencies[dependent].insert(dependency);
+        dependents[dependency].insert(dependent);
+    }
+
+    void AssetDependencyGraph::ClearDependencies(const AssetLocation& dependent)
+    {
+        std::unique_lock lock(mutex);
+
+        const auto iterator = dependencies.find(dependent);
+
+        if (iterator == dependencies.end())
+            return;
+
+        for (const auto& dependency : iterator->second)
+        {
+            const auto reverseIterator = dependents.find(dependency);
+
+            if (reverseIterator == dependents.end())
+                continue;
+
+            reverseIterator->second.erase(dependent);
+
+            if (reverseIterator->second.empty())
+                dependents.erase(reverseIterator);
+        }
+
+        dependencies.erase(iterator);
+    }
+
+    void AssetDependencyGraph::Clear()
+    {
+        std::unique_lock lock(mutex);
+
+        dependencies.clear();
+        dependents.clear();
+    }
+
+    std::vector<AssetLocation> AssetDependencyGraph::GetDependencies(const AssetLocation& dependent) const
+    {
+        std::shared_lock lock(mutex);
+
+        const auto iterator = dependencies.find(dependent);
+
+        if (iterator == dependencies.end())
+            return {};
+
+        return { iterator->second.begin(), iterator->second.end() };
+    }
+
+    std::vector<AssetLocation> AssetDependencyGraph::GetDependents(const AssetLocation& dependency) const
+    {
+        std::shared_lock lock(mutex);
+
+        const auto iterator = dependents.find(dependency);
+
+        if (iterator == dependents.end())
+            return {};
+
+        return { iterator->second.begin(), iterator->second.end() };
+    }
+
+    std::vector<AssetLocation> AssetDependencyGraph::CollectAffected(const AssetLocation& changed) const
+    {
+        std::shared_lock lock(mutex);
+
+        std::vector<AssetLocation> affected { changed };
+        LocationSet visited { changed };
+        std::deque<AssetLocation> pending { changed };
+
+        while (!pending.empty())
+        {
+            const auto current = std::move(pending.front());
+            pending.pop_front();
+
+            const auto iterator = dependents.find(current);
+
+            if (iterator == dependents.end())
+                continue;
+
+            for (const auto& dependent : iterator->second)
+            {
+                if (!visited.insert(dependent).second)
+                    continue;
+
+                affected.push_back(dependent);
+                pending.push_back(dependent);
+            }
+        }
+
+        return affected;
+    }
+
+    size_t AssetDependencyGraph::GetEdgeCount() const
+    {
+        std::shared_lock lock(mutex);
+
+        size_t count = 0;
+
+        for (const auto& edges : dependencies | std::views::values)
+            count += edges.size();
+
+        return count;
+    }
+}
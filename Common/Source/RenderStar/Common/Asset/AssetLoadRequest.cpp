@@ -0,0 +1,111 @@
+#include "RenderStar/Common/Asset/AssetLoadRequest.hpp"
+#include <utility>
+
+namespace RenderStar::Common::Asset
+{
+    AssetLoadRequest::AssetLoadRequest(AssetLocation location, const AssetLoadPriority priority, LoadFunction loadFunction)
+        : location(std::move(location))
+        , loadFunction(std::move(loadFunction))
+        , priority(priority)
+        , status(AssetLoadStatus::PENDING)
+        , interestCount(1)
+    {
+    }
+
+    std::shared_ptr<AssetLoadRequest> AssetLoadRequest::Completed(const AssetLocation& location, std::shared_ptr<IAsset> asset)
+    {
+        const auto finalStatus = asset ? AssetLoadStatus::COMPLETED : AssetLoadStatus::FAILED;
+
+        auto request = std::make_shared<AssetLoadRequest>(location, AssetLoadPriority::HIGHEST, nullptr);
+        request->Finish(finalStatus, std::move(asset));
+
+        return request;
+    }
+
+    const AssetLocation& AssetLoadRequest::GetLocation() const
+    {
+        return location;
+    }
+
+    AssetLoadPriority AssetLoadRequest::GetPriority() const
+    {
+        return priority.load();
+    }
+
+    AssetLoadStatus AssetLoadRequest::GetStatus() const
+    {
+        return status.load();
+    }
+
+    bool AssetLoadRequest::IsDone() const
+    {
+        const auto current = status.load();
+        return current != AssetLoadStatus::PENDING && current != AssetLoadStatus::LOADING;
+    }
+
+    void AssetLoadRequest::Wait() const
+    {
+        std::unique_lock lock(resultMutex);
+        resultCondition.wait(lock, [this] { return IsDone(); });
+    }
+
+    bool AssetLoadRequest::WaitFor(const std::chrono::milliseconds timeout) const
+    {
+        std::unique_lock lock(resultMutex);
+        return resultCondition.wait_for(lock, timeout, [this] { return IsDone(); });
+    }
+
+    std::shared_ptr<IAsset> AssetLoadRequest::GetAsset() const
+    {
+        std::lock_guard lock(resultMutex);
+        return asset;
+    }
+
+    bool AssetLoadRequest::RaisePriority(const AssetLoadPriority newPriority)
+    {
+        auto current = priority.load();
+
+        while (static_cast<int32_t>(newPriority) < static_cast<int32_t>(current))
+        {
+            if (priority.compare_exchange_weak(current, newPriority))
+                return true;
+        }
+
+        return false;
+    }
+
+    bool AssetLoadRequest::TryBegin()
+    {
+        auto expected = AssetLoadStatus::PENDING;
+        return status.compare_exchange_strong(expected, AssetLoadStatus::LOADING);
+    }
+
+    std::shared_ptr<IAsset> AssetLoadRequest::Execute()
+    {
+        auto function = std::move(loadFunction);
+        loadFunction = nullptr;
+
+        return function();
+    }
+
+    void AssetLoadRequest::Finish(const AssetLoadStatus finalStatus, std::shared_ptr<IAsset> result)
+    {
+        {
+            std::lock_guard lock(resultMutex);
+            asset = std::move(result);
+            status.store(finalStatus);
+        }
+
+        resultCondition.notify_all();
+    }
+
+    void AssetLoadRequest::AddInterest()
+    {
+        interestCount.fetch_add(1);
+    }
+
+    bool AssetLoadRequest::ReleaseInterest()
+    {
+        return interestCount.fetch_sub(1) == 1;
+    }
+}
@@ -2,10 +2,12 @@
 
 #include "RenderStar/Common/Asset/BinaryAssetLoader.hpp"
 #include "RenderStar/Common/Asset/FilesystemAssetProvider.hpp"
+#include "RenderStar/Common/Asset/PackedAssetProvider.hpp"
 #include "RenderStar/Common/Asset/TextAssetLoader.hpp"
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <ranges>
 #include <utility>
 
@@ -19,10 +21,34 @@ namespace RenderStar::Common::Asset
     {
         RegisterDefaultLoaders();
         RegisterDefaultProvider();
+        WatchProviderRoots();
+
+        streamer.Start(AssetStreamer::GetDefaultWorkerCount());
 
         spdlog::info("AssetModule initialized with base path: {}", basePath.string());
     }
 
+    void AssetModule::OnCleanup()
+    {
+        streamer.Stop();
+
+        DisableHotReload();
+
+        const auto statistics = cache.GetStatistics();
+
+        spdlog::info("Asset cache: {} hits, {} misses ({:.1f}% hit rate), {} evictions, {} rejected, {}/{} bytes resident in {} entries",
+            statistics.hits, statistics.misses, statistics.GetHitRate() * 100.0, statistics.evictions, statistics.rejections,
+            statistics.residentBytes, statistics.byteBudget, statistics.entryCount);
+
+        if (const auto reloads = GetReloadStatistics(); reloads.changes > 0)
+        {
+            spdlog::info("Asset hot reload: {} changes, {} invalidations, reload-to-visible avg {:.2f} ms, max {:.2f} ms over {} reloads",
+                reloads.changes, reloads.invalidations,
+                std::chrono::duration<double, std::milli>(reloads.GetAverageLatency()).count(),
+                std::chrono::duration<double, std::milli>(reloads.maxLatency).count(), reloads.measuredReloads);
+        }
+    }
+
     void AssetModule::RegisterDefaultLoaders()
     {
         RegisterLoader<ITextAsset>(std::make_unique<TextAssetLoader>());
@@ -31,25 +57,47 @@ namespace RenderStar::Common::Asset
 
     void AssetModule::RegisterDefaultProvider()
     {
-        auto defaultProvider = std::make_unique<FilesystemAssetProvider>(AssetLocation::DEFAULT_NAMESPACE,basePath / "assets" / std::string(AssetLocation::DEFAULT_NAMESPACE));
+        const auto namespaceId = std::string(AssetLocation::DEFAULT_NAMESPACE);
+        const auto packPath = basePath / "assets" / (namespaceId + std::string(AssetPack::FILE_EXTENSION));
+
+        if (std::filesystem::exists(packPath))
+        {
+            try
+            {
+                auto packedProvider = std::make_unique<PackedAssetProvider>(AssetLocation::DEFAULT_NAMESPACE, packPath);
+
+                spdlog::info("Using asset pack {} with {} entries", packPath.string(), packedProvider->GetEntryCount());
 
-        providers[std::string(AssetLocation::DEFAULT_NAMESPACE)] = std::move(defaultProvider);
+                providers[namespaceId] = std::move(packedProvider);
+                return;
+            }
+            catch (const std::runtime_error& error)
+            {
+                spdlog::warn("Ignoring asset pack {}: {}", packPath.string(), error.what());
+            }
+        }
+
+        auto defaultProvider = std::make_unique<FilesystemAssetProvider>(AssetLocation::DEFAULT_NAMESPACE,basePath / "assets" / namespaceId);
+
+        providers[namespaceId] = std::move(defaultProvider);
     }
 
     void AssetModule::RegisterProvider(std::unique_ptr<IAssetProvider> provider)
     {
-        std::lock_guard lock(moduleMutex);
+        std::unique_lock lock(moduleMutex);
 
         auto namespaceId = provider->GetNamespace();
 
         providers[namespaceId] = std::move(provider);
 
+        WatchProviderRoots();
+
         spdlog::info("Registered asset provider for namespace: {}", namespaceId);
     }
 
     void AssetModule::UnregisterProvider(std::string_view namespaceId)
     {
-        std::lock_guard lock(moduleMutex);
+        std::unique_lock lock(moduleMutex);
 
         providers.erase(std::string(namespaceId));
 
@@ -68,7 +116,7 @@ namespace RenderStar::Common::Asset
 
     bool AssetModule::Exists(const AssetLocation& location) const
     {
-        std::lock_guard lock(moduleMutex);
+        std::shared_lock lock(moduleMutex);
 
         const auto provider = GetProviderForNamespace(location.GetNamespace());
 
@@ -80,7 +128,7 @@ namespace RenderStar::Common::Asset
 
     std::vector<AssetLocation> AssetModule::List(const std::string_view namespaceId, const std::string_view pathPrefix) const
     {
-        std::lock_guard lock(moduleMutex);
+        std::shared_lock lock(moduleMutex);
 
         const auto provider = GetProviderForNamespace(namespaceId);
 
@@ -92,7 +140,7 @@ namespace RenderStar::Common::Asset
 
     std::vector<std::string> AssetModule::GetRegisteredNamespaces() const
     {
-        std::lock_guard lock(moduleMutex);
+        std::shared_lock lock(moduleMutex);
         std::vector<std::string> namespaces;
 
         namespaces.reserve(providers.size());
@@ -113,6 +161,128 @@ namespace RenderStar::Common::Asset
         return cache;
     }
 
+    AssetStreamer& AssetModule::GetStreamer()
+    {
+        return streamer;
+    }
+
+    bool AssetModule::EnableHotReload()
+    {
+        std::shared_lock moduleLock(moduleMutex);
+
+        {
+            std::scoped_lock lock(reloadMutex);
+
+            if (!watcher)
+                watcher = std::make_unique<AssetWatcher>();
+        }
+
+        WatchProviderRoots();
+
+        std::scoped_lock lock(reloadMutex);
+
+        if (!watcher->IsWatching())
+        {
+            spdlog::warn("Asset hot reload enabled but no provider exposes a watchable root yet");
+            return false;
+        }
+
+        return true;
+    }
+
+    void AssetModule::DisableHotReload()
+    {
+        std::scoped_lock lock(reloadMutex);
+        watcher.reset();
+    }
+
+    bool AssetModule::IsHotReloadEnabled() const
+    {
+        std::scoped_lock lock(reloadMutex);
+        return watcher != nullptr;
+    }
+
+    void AssetModule::RecordDependency(const AssetLocation& dependent, const AssetLocation& dependency)
+    {
+        dependencyGraph.AddDependency(dependent, dependency);
+    }
+
+    void AssetModule::ClearDependencies(const AssetLocation& dependent)
+    {
+        dependencyGraph.ClearDependencies(dependent);
+    }
+
+    AssetDependencyGraph& AssetModule::GetDependencyGraph()
+    {
+        return dependencyGraph;
+    }
+
+    std::vector<Event::Events::AssetReloadEvent> AssetModule::PollReloads()
+    {
+        std::scoped_lock lock(reloadMutex);
+
+        if (!watcher)
+            return {};
+
+        const auto changes = watcher->Poll();
+
+        if (changes.empty())
+            return {};
+
+        const auto detectedAt = std::chrono::steady_clock::now();
+
+        std::vector<Event::Events::AssetReloadEvent> events;
+        events.reserve(changes.size());
+
+        for (const auto& changed : changes)
+        {
+            auto affected = dependencyGraph.CollectAffected(changed);
+
+            for (const auto& location : affected)
+            {
+                if (!cache.Contains(location))
+                    continue;
+
+                cache.Evict(location);
+                ++reloadStatistics.invalidations;
+            }
+
+            ++reloadStatistics.changes;
+
+            spdlog::info("Asset {} changed, {} dependent assets affected", changed.ToString(), affected.size() - 1);
+
+            events.emplace_back(changed, std::move(affected), detectedAt);
+        }
+
+        return events;
+    }
+
+    size_t AssetModule::PublishReloads(Event::IEventBus& eventBus)
+    {
+        auto events = PollReloads();
+
+        for (auto& event : events)
+            eventBus.PublishRaw(std::make_unique<Event::Events::AssetReloadEvent>(std::move(event)), Event::EventPriority::HIGH);
+
+        return events.size();
+    }
+
+    void AssetModule::RecordReloadLatency(const std::chrono::nanoseconds latency)
+    {
+        std::scoped_lock lock(reloadMutex);
+
+        ++reloadStatistics.measuredReloads;
+        reloadStatistics.lastLatency = latency;
+        reloadStatistics.maxLatency = std::max(reloadStatistics.maxLatency, latency);
+        reloadStatistics.totalLatency += latency;
+    }
+
+    AssetReloadStatistics AssetModule::GetReloadStatistics() const
+    {
+        std::scoped_lock lock(reloadMutex);
+        return reloadStatistics;
+    }
+
     const std::filesystem::path& AssetModule::GetBasePath() const
     {
         return basePath;
@@ -120,11 +290,13 @@ namespace RenderStar::Common::Asset
 
     void AssetModule::SetBasePath(const std::filesystem::path& path)
     {
-        std::lock_guard lock(moduleMutex);
+        std::unique_lock lock(moduleMutex);
         basePath = path;
 
         providers.clear();
         RegisterDefaultProvider();
+
+        WatchProviderRoots();
     }
 
     IAssetProvider* AssetModule::GetProviderForNamespace(const std::string_view namespaceId) const
@@ -136,4 +308,20 @@ namespace RenderStar::Common::Asset
 
         return iterator->second.get();
     }
+
+    void AssetModule::WatchProviderRoots()
+    {
+        std::scoped_lock lock(reloadMutex);
+
+        if (!watcher)
+            return;
+
+        watcher->UnwatchAll();
+
+        for (const auto& [namespaceId, provider] : providers)
+        {
+            if (const auto root = provider->GetRootPath(); root.has_value())
+                watcher->Watch(namespaceId, *root);
+        }
+    }
 }
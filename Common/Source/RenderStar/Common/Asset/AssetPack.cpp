@@ -0,0 +1,17 @@
+#include "RenderStar/Common/Asset/AssetPack.hpp"
+
+namespace RenderStar::Common::Asset
+{
+    uint64_t AssetPack::HashPath(const std::string_view path)
+    {
+        uint64_t hash = 0xCBF29CE484222325ull;
+
+        for (const char character : path)
+        {
+            hash ^= static_cast<uint8_t>(character);
+            hash *= 0x100000001B3ull;
+        }
+
+        return hash;
+    }
+}
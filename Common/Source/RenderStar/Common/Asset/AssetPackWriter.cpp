@@ -0,0 +1,154 @@
+#include "RenderStar/Common/Asset/AssetPackWriter.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace RenderStar::Common::Asset
+{
+    namespace
+    {
+        void WriteUint32(std::vector<uint8_t>& buffer, const size_t offset, const uint32_t value)
+        {
+            std::memcpy(buffer.data() + offset, &value, sizeof(uint32_t));
+        }
+
+        void WriteUint64(std::vector<uint8_t>& buffer, const size_t offset, const uint64_t value)
+        {
+            std::memcpy(buffer.data() + offset, &value, sizeof(uint64_t));
+        }
+
+        void AppendUint32(std::vector<uint8_t>& buffer, const uint32_t value)
+        {
+            buffer.resize(buffer.size() + sizeof(uint32_t));
+            WriteUint32(buffer, buffer.size() - sizeof(uint32_t), value);
+        }
+
+        void AppendUint64(std::vector<uint8_t>& buffer, const uint64_t value)
+        {
+            buffer.resize(buffer.size() + sizeof(uint64_t));
+            WriteUint64(buffer, buffer.size() - sizeof(uint64_t), value);
+        }
+    }
+
+    void AssetPackWriter::Add(std::string path, std::vector<uint8_t> data)
+    {
+        std::ranges::replace(path, '\\', '/');
+
+        const auto existing = std::ranges::find(pendingEntries, path, &PendingEntry::path);
+
+        if (existing != pendingEntries.end())
+        {
+            existing->data = std::move(data);
+            return;
+        }
+
+        pendingEntries.push_back({ std::move(path), std::move(data) });
+    }
+
+    size_t AssetPackWriter::AddDirectory(const std::filesystem::path& directory)
+    {
+        if (!std::filesystem::is_directory(directory))
+            return 0;
+
+        size_t added = 0;
+
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+        {
+            if (!entry.is_regular_file())
+                continue;
+
+            std::ifstream file(entry.path(), std::ios::binary);
+
+            if (!file.is_open())
+                continue;
+
+            std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+            Add(std::filesystem::relative(entry.path(), directory).generic_string(), std::move(data));
+            ++added;
+        }
+
+        return added;
+    }
+
+    std::vector<uint8_t> AssetPackWriter::Build() const
+    {
+        std::vector<const PendingEntry*> sortedEntries;
+        sortedEntries.reserve(pendingEntries.size());
+
+        for (const auto& pending : pendingEntries)
+            sortedEntries.push_back(&pending);
+
+        std::ranges::sort(sortedEntries, {}, &PendingEntry::path);
+
+        std::vector<uint8_t> output(AssetPack::HEADER_SIZE, 0);
+        std::vector<AssetPackEntry> tableOfContents;
+        tableOfContents.reserve(sortedEntries.size());
+
+        for (const auto* pending : sortedEntries)
+        {
+            output.resize((output.size() + AssetPack::DATA_ALIGNMENT - 1) / AssetPack::DATA_ALIGNMENT * AssetPack::DATA_ALIGNMENT, 0);
+
+            AssetPackEntry entry;
+            entry.path = pending->path;
+            entry.pathHash = AssetPack::HashPath(pending->path);
+            entry.offset = output.size();
+            entry.storedSize = pending->data.size();
+            entry.size = pending->data.size();
+            entry.compression = AssetPackCompression::NONE;
+
+            output.insert(output.end(), pending->data.begin(), pending->data.end());
+            tableOfContents.push_back(std::move(entry));
+        }
+
+        std::ranges::sort(tableOfContents, [](const AssetPackEntry& left, const AssetPackEntry& right)
+        {
+            if (left.pathHash != right.pathHash)
+                return left.pathHash < right.pathHash;
+
+            return left.path < right.path;
+        });
+
+        const uint64_t tocOffset = output.size();
+
+        for (const auto& entry : tableOfContents)
+        {
+            AppendUint64(output, entry.pathHash);
+            AppendUint64(output, entry.offset);
+            AppendUint64(output, entry.storedSize);
+            AppendUint64(output, entry.size);
+            AppendUint32(output, static_cast<uint32_t>(entry.compression));
+            AppendUint32(output, static_cast<uint32_t>(entry.path.size()));
+            output.insert(output.end(), entry.path.begin(), entry.path.end());
+        }
+
+        WriteUint32(output, 0, AssetPack::MAGIC);
+        WriteUint32(output, 4, AssetPack::VERSION);
+        WriteUint32(output, 8, static_cast<uint32_t>(tableOfContents.size()));
+        WriteUint32(output, 12, 0);
+        WriteUint64(output, 16, tocOffset);
+        WriteUint64(output, 24, output.size() - tocOffset);
+
+        return output;
+    }
+
+    bool AssetPackWriter::WriteToFile(const std::filesystem::path& path) const
+    {
+        const auto data = Build();
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+        if (!file.is_open())
+            return false;
+
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+        return file.good();
+    }
+
+    size_t AssetPackWriter::GetEntryCount() const
+    {
+        return pendingEntries.size();
+    }
+}
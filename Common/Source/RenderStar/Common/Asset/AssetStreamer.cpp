@@ -0,0 +1,169 @@
+#include "RenderStar/Common/Asset/AssetStreamer.hpp"
+#include <algorithm>
+#include <exception>
+
+namespace RenderStar::Common::Asset
+{
+    AssetStreamer::AssetStreamer() : logger(spdlog::default_logger()->clone("AssetStreamer")), nextSequence(0) { }
+
+    AssetStreamer::~AssetStreamer()
+    {
+        Stop();
+    }
+
+    void AssetStreamer::Start(const uint32_t workerCount)
+    {
+        if (IsRunning())
+            return;
+
+        const uint32_t count = std::max(workerCount, 1u);
+        workers.reserve(count);
+
+        for (uint32_t i = 0; i < count; ++i)
+            workers.emplace_back([this](const std::stop_token& stopToken) { WorkerLoop(stopToken); });
+
+        logger->info("Started {} asset streaming workers", count);
+    }
+
+    void AssetStreamer::Stop()
+    {
+        if (workers.empty())
+            return;
+
+        for (auto& worker : workers)
+            worker.request_stop();
+
+        queueCondition.notify_all();
+        workers.clear();
+
+        std::lock_guard lock(queueMutex);
+
+        while (!requestQueue.empty())
+        {
+            auto queued = requestQueue.top();
+            requestQueue.pop();
+
+            if (queued.request->TryBegin())
+                queued.request->Finish(AssetLoadStatus::CANCELLED, nullptr);
+        }
+
+        inFlight.clear();
+    }
+
+    bool AssetStreamer::IsRunning() const
+    {
+        return !workers.empty();
+    }
+
+    std::shared_ptr<AssetLoadRequest> AssetStreamer::Enqueue(const AssetLocation& location, const std::type_index assetType, const AssetLoadPriority priority, AssetLoadRequest::LoadFunction loadFunction)
+    {
+        RequestKey key{ location, assetType };
+
+        if (!IsRunning())
+        {
+            auto request = std::make_shared<AssetLoadRequest>(location, priority, std::move(loadFunction));
+
+            request->TryBegin();
+            Process(key, request);
+
+            return request;
+        }
+
+        {
+            std::lock_guard lock(queueMutex);
+
+            if (const auto iterator = inFlight.find(key); iterator != inFlight.end())
+            {
+                auto& existing = iterator->second;
+                existing->AddInterest();
+
+                if (existing->RaisePriority(priority) && existing->GetStatus() == AssetLoadStatus::PENDING)
+                    requestQueue.push({ existing, key, priority, nextSequence++ });
+
+                return existing;
+            }
+
+            auto request = std::make_shared<AssetLoadRequest>(location, priority, std::move(loadFunction));
+
+            inFlight.emplace(key, request);
+            requestQueue.push({ request, std::move(key), priority, nextSequence++ });
+
+            queueCondition.notify_one();
+
+            return request;
+        }
+    }
+
+    void AssetStreamer::Cancel(const std::shared_ptr<AssetLoadRequest>& request)
+    {
+        std::lock_guard lock(queueMutex);
+
+        if (!request->ReleaseInterest() || !request->TryBegin())
+            return;
+
+        std::erase_if(inFlight, [&request](const auto& entry) { return entry.second == request; });
+
+        request->Finish(AssetLoadStatus::CANCELLED, nullptr);
+    }
+
+    size_t AssetStreamer::GetInFlightCount() const
+    {
+        std::lock_guard lock(queueMutex);
+        return inFlight.size();
+    }
+
+    uint32_t AssetStreamer::GetDefaultWorkerCount()
+    {
+        return std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+    }
+
+    void AssetStreamer::WorkerLoop(const std::stop_token& stopToken)
+    {
+        while (!stopToken.stop_requested())
+        {
+            QueuedRequest queued;
+
+            {
+                std::unique_lock lock(queueMutex);
+
+                if (!queueCondition.wait(lock, stopToken, [this] { return !requestQueue.empty(); }))
+                    return;
+
+                queued = requestQueue.top();
+                requestQueue.pop();
+            }
+
+            if (!queued.request->TryBegin())
+                continue;
+
+            Process(queued.key, queued.request);
+        }
+    }
+
+    void AssetStreamer::Process(const RequestKey& key, const std::shared_ptr<AssetLoadRequest>& request)
+    {
+        std::shared_ptr<IAsset> result;
+
+        try
+        {
+            result = request->Execute();
+        }
+        catch (const std::exception& exception)
+        {
+            logger->error("Failed to load asset '{}': {}", key.location.ToString(), exception.what());
+        }
+
+        const auto finalStatus = result ? AssetLoadStatus::COMPLETED : AssetLoadStatus::FAILED;
+
+        Retire(key, request);
+        request->Finish(finalStatus, std::move(result));
+    }
+
+    void AssetStreamer::Retire(const RequestKey& key, const std::shared_ptr<AssetLoadRequest>& request)
+    {
+        std::lock_guard lock(queueMutex);
+
+        if (const auto iterator = inFlight.find(key); iterator != inFlight.end() && iterator->second == request)
+            inFlight.erase(iterator);
+    }
+}
@@ -0,0 +1,240 @@
+#include "RenderStar/Common/Asset/AssetWatcher.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <ranges>
+#include <system_error>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace RenderStar::Common::Asset
+{
+#ifdef __linux__
+    namespace
+    {
+        constexpr uint32_t DIRECTORY_EVENT_MASK = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE | IN_DELETE_SELF;
+    }
+#endif
+
+    AssetWatcher::AssetWatcher() : notifyDescriptor(-1)
+    {
+#ifdef __linux__
+        notifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+        if (notifyDescriptor < 0)
+            spdlog::warn("inotify unavailable, falling back to polling asset roots every {} ms", SCAN_INTERVAL.count());
+#endif
+    }
+
+    AssetWatcher::~AssetWatcher()
+    {
+#ifdef __linux__
+        if (notifyDescriptor >= 0)
+            close(notifyDescriptor);
+#endif
+    }
+
+    bool AssetWatcher::Watch(const std::string_view namespaceId, const std::filesystem::path& root)
+    {
+        std::error_code error;
+
+        if (!std::filesystem::is_directory(root, error))
+            return false;
+
+        roots.push_back(WatchedRoot { std::string(namespaceId), root });
+
+        if (UsesNativeNotifications())
+            AddDirectoryWatches(roots.size() - 1, root);
+        else
+            ScanForChanges(nullptr);
+
+        spdlog::info("Watching asset root {} for namespace {}", root.string(), namespaceId);
+
+        return true;
+    }
+
+    void AssetWatcher::UnwatchAll()
+    {
+#ifdef __linux__
+        for (const auto& watchDescriptor : directoryWatches | std::views::keys)
+            inotify_rm_watch(notifyDescriptor, watchDescriptor);
+#endif
+
+        directoryWatches.clear();
+        scannedFiles.clear();
+        roots.clear();
+    }
+
+    bool AssetWatcher::IsWatching() const
+    {
+        return !roots.empty();
+    }
+
+    bool AssetWatcher::UsesNativeNotifications() const
+    {
+        return notifyDescriptor >= 0;
+    }
+
+    std::vector<AssetLocation> AssetWatcher::Poll()
+    {
+        std::vector<AssetLocation> changes;
+
+        if (roots.empty())
+            return changes;
+
+        if (UsesNativeNotifications())
+        {
+            ReadNotifications(changes);
+        }
+        else if (const auto now = std::chrono::steady_clock::now(); now - lastScan >= SCAN_INTERVAL)
+        {
+            lastScan = now;
+            ScanForChanges(&changes);
+        }
+
+        std::ranges::sort(changes);
+        const auto duplicates = std::ranges::unique(changes);
+        changes.erase(duplicates.begin(), duplicates.end());
+
+        return changes;
+    }
+
+    void AssetWatcher::AddDirectoryWatches(const size_t rootIndex, const std::filesystem::path& directory)
+    {
+#ifdef __linux__
+        const int watchDescriptor = inotify_add_watch(notifyDescriptor, directory.c_str(), DIRECTORY_EVENT_MASK);
+
+        if (watchDescriptor < 0)
+        {
+            spdlog::warn("Failed to watch asset directory {}", directory.string());
+            return;
+        }
+
+        directoryWatches[watchDescriptor] = { rootIndex, directory };
+
+        std::error_code error;
+
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+        {
+            if (entry.is_directory(error))
+                AddDirectoryWatches(rootIndex, entry.path());
+        }
+#endif
+    }
+
+    void AssetWatcher::ReadNotifications(std::vector<AssetLocation>& changes)
+    {
+#ifdef __linux__
+        alignas(inotify_event) std::array<char, 16384> buffer {};
+
+        while (true)
+        {
+            const ssize_t length = read(notifyDescriptor, buffer.data(), buffer.size());
+
+            if (length <= 0)
+            {
+                if (length < 0 && errno != EAGAIN && errno != EINTR)
+                    spdlog::warn("Failed to read asset change notifications (errno {})", errno);
+
+                return;
+            }
+
+            for (ssize_t offset = 0; offset < length;)
+            {
+                const auto* event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+                const auto iterator = directoryWatches.find(event->wd);
+
+                if (iterator == directoryWatches.end())
+                    continue;
+
+                if ((event->mask & (IN_DELETE_SELF | IN_IGNORED)) != 0)
+                {
+                    directoryWatches.erase(iterator);
+                    continue;
+                }
+
+                if (event->len == 0)
+                    continue;
+
+                const auto [rootIndex, directory] = iterator->second;
+                const auto path = directory / event->name;
+
+                if ((event->mask & IN_ISDIR) != 0)
+                {
+                    if ((event->mask & (IN_CREATE | IN_MOVED_TO)) != 0)
+                        AddDirectoryWatches(rootIndex, path);
+
+                    continue;
+                }
+
+                if ((event->mask & IN_CREATE) != 0)
+                    continue;
+
+                changes.push_back(ToLocation(roots[rootIndex], path));
+            }
+        }
+#endif
+    }
+
+    void AssetWatcher::ScanForChanges(std::vector<AssetLocation>* changes)
+    {
+        for (auto& file : scannedFiles | std::views::values)
+            file.seen = false;
+
+        for (size_t rootIndex = 0; rootIndex < roots.size(); ++rootIndex)
+        {
+            std::error_code error;
+
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(roots[rootIndex].root, error))
+            {
+                if (!entry.is_regular_file(error))
+                    continue;
+
+                const auto modified = entry.last_write_time(error);
+
+                if (error)
+                    continue;
+
+                auto [iterator, inserted] = scannedFiles.try_emplace(entry.path().string(), ScannedFile { rootIndex, modified, true });
+
+                if (!inserted && iterator->second.modified == modified)
+                {
+                    iterator->second.seen = true;
+                    continue;
+                }
+
+                iterator->second = ScannedFile { rootIndex, modified, true };
+
+                if (changes)
+                    changes->push_back(ToLocation(roots[rootIndex], entry.path()));
+            }
+        }
+
+        for (auto iterator = scannedFiles.begin(); iterator != scannedFiles.end();)
+        {
+            if (iterator->second.seen)
+            {
+                ++iterator;
+                continue;
+            }
+
+            if (changes)
+                changes->push_back(ToLocation(roots[iterator->second.rootIndex], iterator->first));
+
+            iterator = scannedFiles.erase(iterator);
+        }
+    }
+
+    AssetLocation AssetWatcher::ToLocation(const WatchedRoot& watchedRoot, const std::filesystem::path& file) const
+    {
+        return { watchedRoot.namespaceId, file.lexically_relative(watchedRoot.root).generic_string() };
+    }
+}
@@ -16,6 +16,11 @@ namespace RenderStar::Common::Asset
         return loaded;
     }
 
+    size_t BinaryAsset::GetMemoryFootprint() const
+    {
+        return sizeof(*this) + location.GetNamespace().capacity() + location.GetPath().capacity() + data.capacity();
+    }
+
     const std::vector<uint8_t>& BinaryAsset::GetData() const
     {
         return data;
@@ -66,6 +66,11 @@ namespace RenderStar::Common::Asset
         return results;
     }
 
+    std::optional<std::filesystem::path> FilesystemAssetProvider::GetRootPath() const
+    {
+        return basePath;
+    }
+
     std::filesystem::path FilesystemAssetProvider::GetFullPath(const AssetLocation& location) const
     {
         return basePath / location.GetPath();
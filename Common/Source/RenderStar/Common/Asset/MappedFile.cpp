@@ -0,0 +1,165 @@
+#include "RenderStar/Common/Asset/MappedFile.hpp"
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace RenderStar::Common::Asset
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+        Swap(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Close();
+            Swap(other);
+        }
+
+        return *this;
+    }
+
+    bool MappedFile::Open(const std::filesystem::path& path)
+    {
+        Close();
+
+#ifdef _WIN32
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER fileSize{};
+
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        fileHandle = file;
+        size = static_cast<size_t>(fileSize.QuadPart);
+        open = true;
+
+        if (size == 0)
+            return true;
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (mapping == nullptr)
+        {
+            Close();
+            return false;
+        }
+
+        mappingHandle = mapping;
+        data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+
+        if (data == nullptr)
+        {
+            Close();
+            return false;
+        }
+#else
+        const int descriptor = ::open(path.c_str(), O_RDONLY);
+
+        if (descriptor < 0)
+            return false;
+
+        struct stat fileStatus{};
+
+        if (fstat(descriptor, &fileStatus) != 0)
+        {
+            ::close(descriptor);
+            return false;
+        }
+
+        fileDescriptor = descriptor;
+        size = static_cast<size_t>(fileStatus.st_size);
+        open = true;
+
+        if (size == 0)
+            return true;
+
+        void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+        if (mapped == MAP_FAILED)
+        {
+            Close();
+            return false;
+        }
+
+        data = static_cast<const uint8_t*>(mapped);
+        madvise(mapped, size, MADV_WILLNEED);
+#endif
+
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+#ifdef _WIN32
+        if (data != nullptr)
+            UnmapViewOfFile(data);
+
+        if (mappingHandle != nullptr)
+            CloseHandle(static_cast<HANDLE>(mappingHandle));
+
+        if (fileHandle != nullptr)
+            CloseHandle(static_cast<HANDLE>(fileHandle));
+
+        mappingHandle = nullptr;
+        fileHandle = nullptr;
+#else
+        if (data != nullptr)
+            munmap(const_cast<uint8_t*>(data), size);
+
+        if (fileDescriptor >= 0)
+            ::close(fileDescriptor);
+
+        fileDescriptor = -1;
+#endif
+
+        data = nullptr;
+        size = 0;
+        open = false;
+    }
+
+    bool MappedFile::IsOpen() const
+    {
+        return open;
+    }
+
+    std::span<const uint8_t> MappedFile::GetData() const
+    {
+        return { data, size };
+    }
+
+    void MappedFile::Swap(MappedFile& other) noexcept
+    {
+        std::swap(data, other.data);
+        std::swap(size, other.size);
+        std::swap(open, other.open);
+
+#ifdef _WIN32
+        std::swap(fileHandle, other.fileHandle);
+        std::swap(mappingHandle, other.mappingHandle);
+#else
+        std::swap(fileDescriptor, other.fileDescriptor);
+#endif
+    }
+}
@@ -0,0 +1,168 @@
+#include "RenderStar/Common/Asset/PackedAssetProvider.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace RenderStar::Common::Asset
+{
+    namespace
+    {
+        uint32_t ReadUint32(const uint8_t* ptr)
+        {
+            uint32_t value;
+            std::memcpy(&value, ptr, sizeof(uint32_t));
+            return value;
+        }
+
+        uint64_t ReadUint64(const uint8_t* ptr)
+        {
+            uint64_t value;
+            std::memcpy(&value, ptr, sizeof(uint64_t));
+            return value;
+        }
+    }
+
+    PackedAssetProvider::PackedAssetProvider(const std::string_view namespaceId, const std::filesystem::path& packPath) : namespaceId(namespaceId)
+    {
+        if (!packFile.Open(packPath))
+            throw std::runtime_error("Failed to open asset pack: " + packPath.string());
+
+        ReadTableOfContents();
+    }
+
+    std::string PackedAssetProvider::GetNamespace() const
+    {
+        return namespaceId;
+    }
+
+    bool PackedAssetProvider::Exists(const AssetLocation& location) const
+    {
+        return FindEntry(location) != nullptr;
+    }
+
+    std::vector<uint8_t> PackedAssetProvider::LoadBinary(const AssetLocation& location)
+    {
+        const auto data = GetEntryData(location);
+        return { data.begin(), data.end() };
+    }
+
+    std::string PackedAssetProvider::LoadText(const AssetLocation& location)
+    {
+        const auto data = GetEntryData(location);
+        return { reinterpret_cast<const char*>(data.data()), data.size() };
+    }
+
+    std::vector<AssetLocation> PackedAssetProvider::List(const std::string_view pathPrefix) const
+    {
+        std::vector<AssetLocation> results;
+
+        auto iterator = std::ranges::lower_bound(pathOrder, pathPrefix, {}, [this](const size_t index) -> std::string_view
+        {
+            return entries[index].path;
+        });
+
+        for (; iterator != pathOrder.end() && entries[*iterator].path.starts_with(pathPrefix); ++iterator)
+            results.emplace_back(AssetLocation::Of(namespaceId, entries[*iterator].path));
+
+        return results;
+    }
+
+    size_t PackedAssetProvider::GetEntryCount() const
+    {
+        return entries.size();
+    }
+
+    void PackedAssetProvider::ReadTableOfContents()
+    {
+        const auto data = packFile.GetData();
+
+        if (data.size() < AssetPack::HEADER_SIZE || ReadUint32(data.data()) != AssetPack::MAGIC)
+            throw std::runtime_error("Invalid asset pack header");
+
+        if (ReadUint32(data.data() + 4) != AssetPack::VERSION)
+            throw std::runtime_error("Unsupported asset pack version");
+
+        const uint32_t entryCount = ReadUint32(data.data() + 8);
+        const uint64_t tocOffset = ReadUint64(data.data() + 16);
+        const uint64_t tocSize = ReadUint64(data.data() + 24);
+
+        if (tocOffset > data.size() || tocSize > data.size() - tocOffset)
+            throw std::runtime_error("Asset pack table of contents is out of bounds");
+
+        const uint8_t* ptr = data.data() + tocOffset;
+        const uint8_t* end = ptr + tocSize;
+
+        entries.reserve(entryCount);
+        hashIndex.reserve(entryCount);
+
+        for (uint32_t i = 0; i < entryCount; ++i)
+        {
+            if (static_cast<size_t>(end - ptr) < AssetPack::ENTRY_HEADER_SIZE)
+                throw std::runtime_error("Asset pack table of contents is truncated");
+
+            AssetPackEntry entry;
+            entry.pathHash = ReadUint64(ptr);
+            entry.offset = ReadUint64(ptr + 8);
+            entry.storedSize = ReadUint64(ptr + 16);
+            entry.size = ReadUint64(ptr + 24);
+            entry.compression = static_cast<AssetPackCompression>(ReadUint32(ptr + 32));
+            const uint32_t pathLength = ReadUint32(ptr + 36);
+            ptr += AssetPack::ENTRY_HEADER_SIZE;
+
+            if (static_cast<size_t>(end - ptr) < pathLength)
+                throw std::runtime_error("Asset pack table of contents is truncated");
+
+            entry.path.assign(reinterpret_cast<const char*>(ptr), pathLength);
+            ptr += pathLength;
+
+            if (entry.offset > tocOffset || entry.storedSize > tocOffset - entry.offset)
+                throw std::runtime_error("Asset pack entry is out of bounds: " + entry.path);
+
+            if (entry.compression != AssetPackCompression::NONE)
+                throw std::runtime_error("Unsupported asset pack compression: " + entry.path);
+
+            if (!entries.empty() && entries.back().pathHash > entry.pathHash)
+                throw std::runtime_error("Asset pack table of contents is not sorted");
+
+            hashIndex.try_emplace(entry.pathHash, entries.size());
+            entries.push_back(std::move(entry));
+        }
+
+        pathOrder.resize(entries.size());
+
+        for (size_t i = 0; i < pathOrder.size(); ++i)
+            pathOrder[i] = i;
+
+        std::ranges::sort(pathOrder, {}, [this](const size_t index) -> const std::string& { return entries[index].path; });
+    }
+
+    const AssetPackEntry* PackedAssetProvider::FindEntry(const AssetLocation& location) const
+    {
+        if (location.GetNamespace() != namespaceId)
+            return nullptr;
+
+        const uint64_t hash = AssetPack::HashPath(location.GetPath());
+        const auto iterator = hashIndex.find(hash);
+
+        if (iterator == hashIndex.end())
+            return nullptr;
+
+        for (size_t i = iterator->second; i < entries.size() && entries[i].pathHash == hash; ++i)
+        {
+            if (entries[i].path == location.GetPath())
+                return &entries[i];
+        }
+
+        return nullptr;
+    }
+
+    std::span<const uint8_t> PackedAssetProvider::GetEntryData(const AssetLocation& location) const
+    {
+        const auto* entry = FindEntry(location);
+
+        if (!entry)
+            throw std::runtime_error("Failed to open asset: " + location.ToString());
+
+        return packFile.GetData().subspan(entry->offset, entry->storedSize);
+    }
+}
@@ -16,6 +16,11 @@ namespace RenderStar::Common::Asset
         return loaded;
     }
 
+    size_t TextAsset::GetMemoryFootprint() const
+    {
+        return sizeof(*this) + location.GetNamespace().capacity() + location.GetPath().capacity() + content.capacity();
+    }
+
     const std::string& TextAsset::GetContent() const
     {
         return content;
@@ -8,6 +8,25 @@
 
 namespace RenderStar::Common::Component::Affectors
 {
+    namespace
+    {
+        void SetWorldMatrix(Transform& transform, const glm::mat4& worldMatrix)
+        {
+            if (transform.worldMatrix == worldMatrix)
+                return;
+
+            transform.worldMatrix = worldMatrix;
+            ++transform.version;
+        }
+
+        bool HasParentTransform(ComponentModule& componentModule, const GameObject entity)
+        {
+            auto hierarchyOpt = componentModule.GetComponent<Hierarchy>(entity);
+
+            return hierarchyOpt.has_value() && hierarchyOpt->get().HasParent() && componentModule.HasComponent<Transform>(hierarchyOpt->get().parent);
+        }
+    }
+
     void TransformAffector::Affect(ComponentModule& componentModule)
     {
         auto& transformPool = componentModule.GetPool<Transform>();
@@ -19,7 +38,11 @@ namespace RenderStar::Common::Component::Affectors
             transform.localMatrix = transform.localMatrix * glm::toMat4(transform.rotation);
             transform.localMatrix = glm::scale(transform.localMatrix, transform.scale);
 
-            transform.worldMatrix = transform.localMatrix;
+            // Parented transforms take their world matrix from the hierarchy pass, which keeps their version stable
+            if (HasParentTransform(componentModule, entity))
+                continue;
+
+            SetWorldMatrix(transform, transform.localMatrix);
             transform.worldPosition = transform.position;
             transform.worldRotation = transform.rotation;
             transform.worldScale = transform.scale;
@@ -52,7 +75,7 @@ namespace RenderStar::Common::Component::Affectors
             transform.localMatrix = transform.localMatrix * glm::toMat4(transform.rotation);
             transform.localMatrix = glm::scale(transform.localMatrix, transform.scale);
 
-            transform.worldMatrix = parentTransform.worldMatrix * transform.localMatrix;
+            SetWorldMatrix(transform, parentTransform.worldMatrix * transform.localMatrix);
             transform.worldRotation = parentTransform.worldRotation * transform.rotation;
 
             glm::vec3 rotatedPosition = parentTransform.worldRotation * transform.position;
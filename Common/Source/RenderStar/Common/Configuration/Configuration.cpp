@@ -7,15 +7,19 @@ namespace RenderStar::Common::Configuration
     Configuration::Configuration(std::string configNamespace, std::string classScope, std::shared_ptr<pugi::xml_document> sharedDocument, std::filesystem::path sourceFilePath) : logger(spdlog::default_logger()), configNamespace(std::move(configNamespace)), classScope(std::move(classScope)), document(std::move(sharedDocument)), filePath(std::move(sourceFilePath))
     {
         InitializeScopedElement();
+        Publish();
     }
 
     Configuration::Configuration(std::string configNamespace, std::string classScope, std::shared_ptr<pugi::xml_document> sharedDocument) : logger(spdlog::default_logger()), configNamespace(std::move(configNamespace)), classScope(std::move(classScope)), document(std::move(sharedDocument))
     {
         InitializeScopedElement();
+        Publish();
     }
 
     void Configuration::InitializeScopedElement()
     {
+        scopedElement = {};
+
         pugi::xml_node root = document->document_element();
 
         if (root.empty())
@@ -41,109 +45,102 @@ namespace RenderStar::Common::Configuration
 
     std::optional<std::string> Configuration::GetString(const std::string& path) const
     {
-        const auto node = NavigateToNode(path);
+        const auto current = GetSnapshot();
+        const ConfigValue* value = current->Find(path);
 
-        if (node.empty())
+        if (!value)
         {
             logger->debug("Configuration key '{}' not found in section '{}'", path, classScope);
             return std::nullopt;
         }
 
-        std::string content = node.text().as_string();
-
-        if (content.size() >= 2 && content.front() == '"' && content.back() == '"')
-            content = content.substr(1, content.size() - 2);
-
-        return content;
+        return value->text;
     }
 
     std::optional<int32_t> Configuration::GetInteger(const std::string& path) const
     {
-        const auto node = NavigateToNode(path);
+        const auto current = GetSnapshot();
+        const ConfigValue* value = current->Find(path);
 
-        if (node.empty())
+        if (!value)
         {
             logger->debug("Configuration key '{}' not found in section '{}'", path, classScope);
             return std::nullopt;
         }
 
-        return node.text().as_int();
+        return value->integer;
     }
 
     std::optional<float> Configuration::GetFloat(const std::string& path) const
     {
-        const auto node = NavigateToNode(path);
+        const auto current = GetSnapshot();
+        const ConfigValue* value = current->Find(path);
 
-        if (node.empty())
+        if (!value)
         {
             logger->debug("Configuration key '{}' not found in section '{}'", path, classScope);
             return std::nullopt;
         }
 
-        return node.text().as_float();
+        return value->floating;
     }
 
     std::optional<bool> Configuration::GetBoolean(const std::string& path) const
     {
-        const auto node = NavigateToNode(path);
+        const auto current = GetSnapshot();
+        const ConfigValue* value = current->Find(path);
 
-        if (node.empty())
+        if (!value)
         {
             logger->debug("Configuration key '{}' not found in section '{}'", path, classScope);
             return std::nullopt;
         }
 
-        std::string value = node.text().as_string();
-        std::transform(value.begin(), value.end(), value.begin(), ::tolower);
-
-        return value == "true" || value == "1" || value == "yes";
+        return value->boolean;
     }
 
     std::vector<std::string> Configuration::GetStringList(const std::string& path) const
     {
-        std::vector<std::string> result;
-        const auto node = NavigateToNode(path);
-
-        if (node.empty())
-            return result;
-
-        std::string content = node.text().as_string();
-        std::istringstream stream(content);
-        std::string item;
+        const auto current = GetSnapshot();
+        const ConfigValue* value = current->Find(path);
 
-        while (std::getline(stream, item, ','))
-        {
-            const size_t start = item.find_first_not_of(" \t");
-
-            if (const size_t end = item.find_last_not_of(" \t"); start != std::string::npos && end != std::string::npos)
-                result.push_back(item.substr(start, end - start + 1));
-        }
-
-        return result;
+        return value ? value->list : std::vector<std::string>{};
     }
 
     void Configuration::SetString(const std::string& path, const std::string& value)
     {
+        std::scoped_lock lock(writeMutex);
+
         const auto node = NavigateOrCreateNode(path);
         node.text().set(value.c_str());
+        Publish();
     }
 
     void Configuration::SetInteger(const std::string& path, int32_t value)
     {
+        std::scoped_lock lock(writeMutex);
+
         const auto node = NavigateOrCreateNode(path);
         node.text().set(value);
+        Publish();
     }
 
     void Configuration::SetFloat(const std::string& path, float value)
     {
+        std::scoped_lock lock(writeMutex);
+
         const auto node = NavigateOrCreateNode(path);
         node.text().set(value);
+        Publish();
     }
 
     void Configuration::SetBoolean(const std::string& path, bool value)
     {
+        std::scoped_lock lock(writeMutex);
+
         const auto node = NavigateOrCreateNode(path);
         node.text().set(value ? "true" : "false");
+        Publish();
     }
 
     void Configuration::Save()
@@ -154,6 +151,7 @@ namespace RenderStar::Common::Configuration
             return;
         }
 
+        std::scoped_lock lock(writeMutex);
         (void)document->save_file(filePath.c_str(), "    ");
 
         logger->debug("Configuration saved to {}", filePath.string());
@@ -167,8 +165,43 @@ namespace RenderStar::Common::Configuration
             return;
         }
 
+        std::scoped_lock lock(writeMutex);
+
         document->load_file(filePath.c_str());
         InitializeScopedElement();
+        Publish();
+    }
+
+    std::unique_lock<std::mutex> Configuration::LockWrites()
+    {
+        return std::unique_lock(writeMutex);
+    }
+
+    void Configuration::Refresh()
+    {
+        InitializeScopedElement();
+        Publish();
+    }
+
+    std::shared_ptr<const ConfigurationSnapshot> Configuration::GetSnapshot() const
+    {
+        return snapshot.load(std::memory_order_acquire);
+    }
+
+    uint32_t Configuration::ResolveSlot(const std::string& path)
+    {
+        std::scoped_lock lock(writeMutex);
+
+        if (const auto iterator = keySlots.find(path); iterator != keySlots.end())
+            return iterator->second;
+
+        const auto slot = static_cast<uint32_t>(keyPaths.size());
+
+        keyPaths.push_back(path);
+        keySlots.emplace(path, slot);
+        Publish();
+
+        return slot;
     }
 
     const std::string& Configuration::GetNamespace() const
@@ -181,24 +214,19 @@ namespace RenderStar::Common::Configuration
         return classScope;
     }
 
-    pugi::xml_node Configuration::NavigateToNode(const std::string& path) const
+    const std::filesystem::path& Configuration::GetFilePath() const
     {
-        if (scopedElement.empty())
-            return {};
-
-        pugi::xml_node current = scopedElement;
-        std::istringstream stream(path);
-        std::string segment;
-
-        while (std::getline(stream, segment, '.'))
-        {
-            current = current.child(segment.c_str());
+        return filePath;
+    }
 
-            if (current.empty())
-                return {};
-        }
+    const std::shared_ptr<pugi::xml_document>& Configuration::GetDocument() const
+    {
+        return document;
+    }
 
-        return current;
+    void Configuration::Publish()
+    {
+        snapshot.store(ConfigurationSnapshot::Compile(scopedElement, keyPaths, ++generation), std::memory_order_release);
     }
 
     pugi::xml_node Configuration::NavigateOrCreateNode(const std::string& path) const
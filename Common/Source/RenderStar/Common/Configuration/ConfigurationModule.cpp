@@ -1,4 +1,7 @@
 #include "RenderStar/Common/Configuration/ConfigurationModule.hpp"
+#include <algorithm>
+#include <ranges>
+#include <vector>
 
 namespace RenderStar::Common::Configuration
 {
@@ -18,6 +21,60 @@ namespace RenderStar::Common::Configuration
         documentCache.clear();
     }
 
+    size_t ConfigurationModule::ReloadFile(const std::filesystem::path& filePath)
+    {
+        const auto target = filePath.lexically_normal();
+        std::vector<Configuration*> sections;
+        std::unordered_map<pugi::xml_document*, pugi::xml_document> parsedDocuments;
+
+        // Every affected document is parsed before any of them changes, so a bad file publishes nothing
+        for (const auto& config : configCache | std::views::values)
+        {
+            if (config->GetFilePath().lexically_normal() != target)
+                continue;
+
+            sections.push_back(config.get());
+
+            const auto& document = config->GetDocument();
+
+            if (parsedDocuments.contains(document.get()))
+                continue;
+
+            if (const pugi::xml_parse_result result = parsedDocuments[document.get()].load_file(target.c_str()); !result)
+            {
+                logger->error("Failed to reload configuration file {}: {}", target.string(), result.description());
+                return 0;
+            }
+        }
+
+        if (sections.empty())
+            return 0;
+
+        // Sections sharing a document are locked together, in address order, before it is swapped
+        std::ranges::sort(sections);
+
+        std::vector<std::unique_lock<std::mutex>> locks;
+        locks.reserve(sections.size());
+
+        for (Configuration* section : sections)
+            locks.push_back(section->LockWrites());
+
+        for (auto& [document, parsed] : parsedDocuments)
+            document->reset(parsed);
+
+        for (Configuration* section : sections)
+            section->Refresh();
+
+        logger->info("Reloaded {} configuration section(s) from {}", sections.size(), target.string());
+
+        return sections.size();
+    }
+
+    size_t ConfigurationModule::Reload(const Asset::AssetLocation& changed)
+    {
+        return ReloadFile(changed.ToFilesystemPath(resourceBasePath));
+    }
+
     void ConfigurationModule::OnInitialize(Module::ModuleContext& context)
     {
         logger->info("ConfigurationModule initialized with base path: {}", resourceBasePath.string());
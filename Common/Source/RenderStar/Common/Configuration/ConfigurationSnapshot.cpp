@@ -0,0 +1,96 @@
+#include "RenderStar/Common/Configuration/ConfigurationSnapshot.hpp"
+#include <pugixml.hpp>
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+
+namespace RenderStar::Common::Configuration
+{
+    namespace
+    {
+        ConfigValue ParseValue(const pugi::xml_node node)
+        {
+            ConfigValue value;
+            const std::string raw = node.text().as_string();
+
+            value.text = raw;
+
+            if (value.text.size() >= 2 && value.text.front() == '"' && value.text.back() == '"')
+                value.text = value.text.substr(1, value.text.size() - 2);
+
+            value.integer = node.text().as_int();
+            value.floating = node.text().as_float();
+
+            std::string lower = raw;
+            std::ranges::transform(lower, lower.begin(), [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            value.boolean = lower == "true" || lower == "1" || lower == "yes";
+
+            std::istringstream stream(raw);
+            std::string item;
+
+            while (std::getline(stream, item, ','))
+            {
+                const size_t start = item.find_first_not_of(" \t");
+
+                if (const size_t end = item.find_last_not_of(" \t"); start != std::string::npos && end != std::string::npos)
+                    value.list.push_back(item.substr(start, end - start + 1));
+            }
+
+            return value;
+        }
+    }
+
+    std::shared_ptr<const ConfigurationSnapshot> ConfigurationSnapshot::Compile(const pugi::xml_node scope, const std::span<const std::string> keyPaths, const uint64_t generation)
+    {
+        auto snapshot = std::make_shared<ConfigurationSnapshot>();
+        snapshot->generation = generation;
+
+        if (!scope.empty())
+        {
+            std::string path;
+            snapshot->Flatten(scope, path);
+        }
+
+        snapshot->slots.reserve(keyPaths.size());
+
+        for (const auto& keyPath : keyPaths)
+        {
+            const auto iterator = snapshot->indices.find(keyPath);
+            snapshot->slots.push_back(iterator == snapshot->indices.end() ? MISSING : iterator->second);
+        }
+
+        return snapshot;
+    }
+
+    const ConfigValue* ConfigurationSnapshot::Find(const std::string_view path) const
+    {
+        const auto iterator = indices.find(path);
+
+        return iterator == indices.end() ? nullptr : &values[iterator->second];
+    }
+
+    void ConfigurationSnapshot::Flatten(const pugi::xml_node node, std::string& path)
+    {
+        const size_t prefixLength = path.size();
+
+        for (const pugi::xml_node child : node.children())
+        {
+            if (child.type() != pugi::node_element)
+                continue;
+
+            if (prefixLength > 0)
+                path += '.';
+
+            path += child.name();
+
+            // Duplicate siblings resolve to the first, as a child-by-name walk would
+            if (const auto [iterator, inserted] = indices.try_emplace(path, static_cast<uint32_t>(values.size())); inserted)
+            {
+                values.push_back(ParseValue(child));
+                Flatten(child, path);
+            }
+
+            path.resize(prefixLength);
+        }
+    }
+}
@@ -0,0 +1,124 @@
+#include "RenderStar/Common/Scene/MapbinClusterer.hpp"
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace RenderStar::Common::Scene
+{
+    namespace
+    {
+        constexpr size_t FLOATS_PER_VERTEX = 8;
+
+        glm::vec3 ReadPosition(const MapbinGroup& group, const uint32_t vertex)
+        {
+            const float* position = group.vertexData.data() + static_cast<size_t>(vertex) * FLOATS_PER_VERTEX;
+            return glm::vec3(position[0], position[1], position[2]);
+        }
+    }
+
+    MapbinClusterSet MapbinClusterer::Build(const MapbinGroup& group, uint32_t maxTriangles)
+    {
+        maxTriangles = std::max(maxTriangles, 1u);
+
+        const size_t vertexCount = group.vertexData.size() / FLOATS_PER_VERTEX;
+
+        std::vector<uint32_t> triangles;
+        std::vector<glm::vec3> centroids;
+
+        triangles.reserve(group.indices.size() / 3);
+        centroids.reserve(group.indices.size() / 3);
+
+        for (size_t i = 0; i + 2 < group.indices.size(); i += 3)
+        {
+            const uint32_t a = group.indices[i];
+            const uint32_t b = group.indices[i + 1];
+            const uint32_t c = group.indices[i + 2];
+
+            if (a >= vertexCount || b >= vertexCount || c >= vertexCount)
+                continue;
+
+            triangles.push_back(static_cast<uint32_t>(i / 3));
+            centroids.push_back((ReadPosition(group, a) + ReadPosition(group, b) + ReadPosition(group, c)) / 3.0f);
+        }
+
+        // Centroids are indexed by position in the filtered list; order holds those positions
+        std::vector<uint32_t> order(triangles.size());
+
+        for (uint32_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+
+        MapbinClusterSet result;
+        result.indices.reserve(triangles.size() * 3);
+
+        std::vector<std::pair<size_t, size_t>> pending;
+
+        if (!order.empty())
+            pending.emplace_back(0, order.size());
+
+        while (!pending.empty())
+        {
+            const auto [begin, end] = pending.back();
+            pending.pop_back();
+
+            if (end - begin <= maxTriangles)
+            {
+                // Leaves keep the source triangle order, which preserves the exporter's vertex locality
+                std::sort(order.begin() + static_cast<ptrdiff_t>(begin), order.begin() + static_cast<ptrdiff_t>(end));
+
+                MapbinCluster cluster;
+                cluster.firstIndex = static_cast<uint32_t>(result.indices.size());
+                cluster.indexCount = static_cast<uint32_t>((end - begin) * 3);
+                cluster.boundsMin = glm::vec3(std::numeric_limits<float>::max());
+                cluster.boundsMax = glm::vec3(std::numeric_limits<float>::lowest());
+
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const size_t source = static_cast<size_t>(triangles[order[i]]) * 3;
+
+                    for (size_t corner = 0; corner < 3; ++corner)
+                    {
+                        const uint32_t vertex = group.indices[source + corner];
+                        const glm::vec3 position = ReadPosition(group, vertex);
+
+                        cluster.boundsMin = glm::min(cluster.boundsMin, position);
+                        cluster.boundsMax = glm::max(cluster.boundsMax, position);
+                        result.indices.push_back(vertex);
+                    }
+                }
+
+                result.clusters.push_back(cluster);
+                continue;
+            }
+
+            glm::vec3 centroidMin(std::numeric_limits<float>::max());
+            glm::vec3 centroidMax(std::numeric_limits<float>::lowest());
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                centroidMin = glm::min(centroidMin, centroids[order[i]]);
+                centroidMax = glm::max(centroidMax, centroids[order[i]]);
+            }
+
+            const glm::vec3 extent = centroidMax - centroidMin;
+            const int axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+            const size_t middle = begin + (end - begin) / 2;
+
+            // Ties break on triangle position so the partition is a strict total order
+            std::nth_element(
+                order.begin() + static_cast<ptrdiff_t>(begin),
+                order.begin() + static_cast<ptrdiff_t>(middle),
+                order.begin() + static_cast<ptrdiff_t>(end),
+                [&centroids, axis](const uint32_t left, const uint32_t right)
+                {
+                    const float a = centroids[left][axis];
+                    const float b = centroids[right][axis];
+                    return a < b || (a == b && left < right);
+                });
+
+            pending.emplace_back(middle, end);
+            pending.emplace_back(begin, middle);
+        }
+
+        return result;
+    }
+}
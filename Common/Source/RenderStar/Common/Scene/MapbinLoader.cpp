@@ -1,4 +1,5 @@
 #include "RenderStar/Common/Scene/MapbinLoader.hpp"
+#include "RenderStar/Common/Scene/TextureTranscoder.hpp"
 #include "RenderStar/Common/Asset/AssetModule.hpp"
 #include "RenderStar/Common/Asset/AssetLocation.hpp"
 #include "RenderStar/Common/Asset/IBinaryAsset.hpp"
@@ -65,6 +66,9 @@ namespace RenderStar::Common::Scene
         if (version == VERSION_5)
             return LoadV5(ptr, end, count1, count2);
 
+        if (version == VERSION_6)
+            return LoadV6(ptr, end, count1, count2);
+
         return std::nullopt;
     }
 
@@ -311,6 +315,23 @@ namespace RenderStar::Common::Scene
         return scene;
     }
 
+    std::optional<MapbinScene> MapbinLoader::LoadV6(const uint8_t* ptr, const uint8_t* end,
+        uint32_t materialCount, uint32_t groupCount)
+    {
+        MapbinScene scene;
+
+        if (!ParseMaterialsAndGroups(ptr, end, materialCount, groupCount, scene))
+            return std::nullopt;
+
+        if (!ParseGameObjectsV5(ptr, end, scene))
+            return std::nullopt;
+
+        if (!ParseCompressedTexturesV6(ptr, end, scene))
+            return std::nullopt;
+
+        return scene;
+    }
+
     bool MapbinLoader::ParseGameObjectsV4(const uint8_t*& ptr, const uint8_t* end, MapbinScene& scene)
     {
         if (ptr + 4 > end)
@@ -426,6 +447,92 @@ namespace RenderStar::Common::Scene
         return true;
     }
 
+    bool MapbinLoader::ParseCompressedTexturesV6(const uint8_t*& ptr, const uint8_t* end, MapbinScene& scene)
+    {
+        if (end - ptr < 4)
+            return false;
+
+        uint32_t count = ReadUint32(ptr);
+        ptr += 4;
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (static_cast<size_t>(end - ptr) < V6_COMPRESSED_TEXTURE_HEADER_SIZE)
+                return false;
+
+            int32_t materialId = static_cast<int32_t>(ReadUint32(ptr));
+            auto slotType = static_cast<TextureSlotType>(ReadUint32(ptr + 4));
+            auto format = static_cast<CompressedTextureFormat>(ReadUint32(ptr + 8));
+            uint32_t mipCount = ReadUint32(ptr + 12);
+            ptr += V6_COMPRESSED_TEXTURE_HEADER_SIZE;
+
+            // Uploaders copy each level straight from these sizes, so anything inconsistent fails the load
+            if (TextureTranscoder::GetBlockSize(format) == 0 || mipCount == 0 || mipCount > MAX_COMPRESSED_MIPS)
+                return false;
+
+            MapbinTextureSlot* slot = nullptr;
+
+            auto materialIt = std::ranges::find_if(scene.materials,
+                [materialId](const MapbinMaterial& material) { return material.materialId == materialId; });
+
+            if (materialIt != scene.materials.end())
+            {
+                auto slotIt = std::ranges::find_if(materialIt->textureSlots,
+                    [slotType](const MapbinTextureSlot& candidate) { return candidate.slotType == slotType; });
+
+                if (slotIt != materialIt->textureSlots.end())
+                    slot = &*slotIt;
+            }
+
+            // An orphaned texture is still validated, against its own first level
+            uint32_t baseWidth = slot ? slot->width : 0;
+            uint32_t baseHeight = slot ? slot->height : 0;
+
+            std::vector<MapbinTextureMip> mips;
+            mips.reserve(mipCount);
+
+            for (uint32_t m = 0; m < mipCount; ++m)
+            {
+                if (static_cast<size_t>(end - ptr) < V6_MIP_HEADER_SIZE)
+                    return false;
+
+                MapbinTextureMip mip;
+                mip.width = ReadUint32(ptr);
+                mip.height = ReadUint32(ptr + 4);
+                uint32_t dataSize = ReadUint32(ptr + 8);
+                ptr += V6_MIP_HEADER_SIZE;
+
+                if (!slot && m == 0)
+                {
+                    baseWidth = mip.width;
+                    baseHeight = mip.height;
+                }
+
+                if (m == 0 && (baseWidth == 0 || baseHeight == 0 || mipCount > TextureTranscoder::GetMipCount(baseWidth, baseHeight)))
+                    return false;
+
+                if (mip.width != std::max(baseWidth >> m, 1u) || mip.height != std::max(baseHeight >> m, 1u))
+                    return false;
+
+                if (dataSize != TextureTranscoder::GetCompressedSize(format, mip.width, mip.height) || dataSize > static_cast<size_t>(end - ptr))
+                    return false;
+
+                mip.data.assign(ptr, ptr + dataSize);
+                ptr += dataSize;
+
+                mips.push_back(std::move(mip));
+            }
+
+            if (!slot)
+                continue;
+
+            slot->compressedFormat = format;
+            slot->compressedMips = std::move(mips);
+        }
+
+        return true;
+    }
+
     void MapbinLoader::ComputeNormalsForGroup(MapbinGroup& group)
     {
         size_t vertexCount = static_cast<size_t>(group.vertexCount);
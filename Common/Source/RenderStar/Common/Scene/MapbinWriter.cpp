@@ -0,0 +1,186 @@
+#include "RenderStar/Common/Scene/MapbinWriter.hpp"
+#include <cstring>
+
+namespace RenderStar::Common::Scene
+{
+    namespace
+    {
+        void WriteUint32(std::vector<uint8_t>& buffer, uint32_t value)
+        {
+            size_t offset = buffer.size();
+            buffer.resize(offset + sizeof(uint32_t));
+            std::memcpy(buffer.data() + offset, &value, sizeof(uint32_t));
+        }
+
+        void WriteInt32(std::vector<uint8_t>& buffer, int32_t value)
+        {
+            WriteUint32(buffer, static_cast<uint32_t>(value));
+        }
+
+        void WriteFloat(std::vector<uint8_t>& buffer, float value)
+        {
+            size_t offset = buffer.size();
+            buffer.resize(offset + sizeof(float));
+            std::memcpy(buffer.data() + offset, &value, sizeof(float));
+        }
+
+        void WriteBytes(std::vector<uint8_t>& buffer, const std::vector<uint8_t>& bytes)
+        {
+            WriteUint32(buffer, static_cast<uint32_t>(bytes.size()));
+            buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+        }
+    }
+
+    std::vector<uint8_t> MapbinWriter::Write(const MapbinScene& scene)
+    {
+        std::vector<uint8_t> buffer;
+
+        WriteUint32(buffer, MAGIC);
+        WriteUint32(buffer, VERSION);
+        WriteUint32(buffer, static_cast<uint32_t>(scene.materials.size()));
+        WriteUint32(buffer, static_cast<uint32_t>(scene.groups.size()));
+
+        WriteMaterials(buffer, scene);
+        WriteGroups(buffer, scene);
+        WriteGameObjects(buffer, scene);
+        WriteCompressedTextures(buffer, scene);
+
+        return buffer;
+    }
+
+    void MapbinWriter::WriteMaterials(std::vector<uint8_t>& buffer, const MapbinScene& scene)
+    {
+        for (const auto& material : scene.materials)
+        {
+            WriteInt32(buffer, material.materialId);
+            WriteFloat(buffer, material.normalStrength);
+            WriteFloat(buffer, material.roughness);
+            WriteFloat(buffer, material.metallic);
+            WriteFloat(buffer, material.specularStrength);
+            WriteFloat(buffer, material.detailScale);
+            WriteFloat(buffer, material.emissionStrength);
+            WriteFloat(buffer, material.aoStrength);
+            WriteUint32(buffer, static_cast<uint32_t>(material.textureSlots.size()));
+
+            for (const auto& slot : material.textureSlots)
+            {
+                WriteUint32(buffer, static_cast<uint32_t>(slot.slotType));
+                WriteUint32(buffer, slot.width);
+                WriteUint32(buffer, slot.height);
+                WriteUint32(buffer, slot.wrapS);
+                WriteUint32(buffer, slot.wrapT);
+                WriteUint32(buffer, slot.minFilter);
+                WriteUint32(buffer, slot.magFilter);
+                WriteBytes(buffer, slot.pixelData);
+            }
+        }
+    }
+
+    void MapbinWriter::WriteGroups(std::vector<uint8_t>& buffer, const MapbinScene& scene)
+    {
+        for (const auto& group : scene.groups)
+        {
+            WriteInt32(buffer, group.materialId);
+            WriteUint32(buffer, static_cast<uint32_t>(group.vertexCount));
+            WriteUint32(buffer, static_cast<uint32_t>(group.indices.size()));
+
+            for (float value : group.vertexData)
+                WriteFloat(buffer, value);
+
+            for (uint32_t index : group.indices)
+                WriteUint32(buffer, index);
+        }
+    }
+
+    void MapbinWriter::WriteGameObjects(std::vector<uint8_t>& buffer, const MapbinScene& scene)
+    {
+        WriteUint32(buffer, static_cast<uint32_t>(scene.gameObjects.size()));
+
+        for (const auto& obj : scene.gameObjects)
+        {
+            WriteUint32(buffer, static_cast<uint32_t>(obj.type));
+            WriteFloat(buffer, obj.posX);
+            WriteFloat(buffer, obj.posY);
+            WriteFloat(buffer, obj.posZ);
+            WriteFloat(buffer, obj.rotX);
+            WriteFloat(buffer, obj.rotY);
+            WriteFloat(buffer, obj.rotZ);
+
+            uint32_t typeVal = static_cast<uint32_t>(obj.type);
+
+            if (typeVal >= 1 && typeVal <= 3)
+            {
+                WriteFloat(buffer, obj.colorR);
+                WriteFloat(buffer, obj.colorG);
+                WriteFloat(buffer, obj.colorB);
+                WriteFloat(buffer, obj.intensity);
+
+                if (obj.type == GameObjectType::SPOT_LIGHT)
+                {
+                    WriteFloat(buffer, obj.innerCone);
+                    WriteFloat(buffer, obj.outerCone);
+                }
+            }
+            else if (obj.type == GameObjectType::ADAPTIVE_VOLUME)
+            {
+                WriteFloat(buffer, obj.halfExtentX);
+                WriteFloat(buffer, obj.halfExtentY);
+                WriteFloat(buffer, obj.halfExtentZ);
+                WriteFloat(buffer, obj.blendDistance);
+                WriteInt32(buffer, obj.priority);
+                WriteUint32(buffer, obj.overrideMask);
+                WriteFloat(buffer, obj.exposureBias);
+                WriteFloat(buffer, obj.bloomIntensity);
+                WriteFloat(buffer, obj.contrast);
+                WriteFloat(buffer, obj.saturation);
+                WriteFloat(buffer, obj.vignetteStrength);
+                WriteFloat(buffer, obj.temperature);
+                WriteFloat(buffer, obj.fogColorR);
+                WriteFloat(buffer, obj.fogColorG);
+                WriteFloat(buffer, obj.fogColorB);
+                WriteFloat(buffer, obj.fogDensity);
+                WriteFloat(buffer, obj.colorFilterR);
+                WriteFloat(buffer, obj.colorFilterG);
+                WriteFloat(buffer, obj.colorFilterB);
+                WriteFloat(buffer, obj.colorFilterStrength);
+            }
+        }
+    }
+
+    void MapbinWriter::WriteCompressedTextures(std::vector<uint8_t>& buffer, const MapbinScene& scene)
+    {
+        uint32_t count = 0;
+
+        for (const auto& material : scene.materials)
+        {
+            for (const auto& slot : material.textureSlots)
+            {
+                if (slot.compressedFormat != CompressedTextureFormat::NONE && !slot.compressedMips.empty())
+                    ++count;
+            }
+        }
+
+        WriteUint32(buffer, count);
+
+        for (const auto& material : scene.materials)
+        {
+            for (const auto& slot : material.textureSlots)
+            {
+                if (slot.compressedFormat == CompressedTextureFormat::NONE || slot.compressedMips.empty())
+                    continue;
+
+                WriteInt32(buffer, material.materialId);
+                WriteUint32(buffer, static_cast<uint32_t>(slot.slotType));
+                WriteUint32(buffer, static_cast<uint32_t>(slot.compressedFormat));
+                WriteUint32(buffer, static_cast<uint32_t>(slot.compressedMips.size()));
+
+                for (const auto& mip : slot.compressedMips)
+                {
+                    WriteUint32(buffer, mip.width);
+                    WriteUint32(buffer, mip.height);
+                    WriteBytes(buffer, mip.data);
+                }
+            }
+        }
+    }
+}
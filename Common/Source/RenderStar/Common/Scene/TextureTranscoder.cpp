@@ -0,0 +1,614 @@
+#include "RenderStar/Common/Scene/TextureTranscoder.hpp"
+#include "RenderStar/Common/Utility/WorkerPool.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+namespace RenderStar::Common::Scene
+{
+    namespace
+    {
+        constexpr uint32_t PIXELS_PER_BLOCK = 16;
+
+        uint16_t PackRgb565(const uint8_t* rgb)
+        {
+            uint32_t r = (static_cast<uint32_t>(rgb[0]) * 31 + 127) / 255;
+            uint32_t g = (static_cast<uint32_t>(rgb[1]) * 63 + 127) / 255;
+            uint32_t b = (static_cast<uint32_t>(rgb[2]) * 31 + 127) / 255;
+
+            return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+        }
+
+        std::array<uint8_t, 3> UnpackRgb565(uint16_t color)
+        {
+            uint32_t r = (color >> 11) & 0x1F;
+            uint32_t g = (color >> 5) & 0x3F;
+            uint32_t b = color & 0x1F;
+
+            return {
+                static_cast<uint8_t>((r << 3) | (r >> 2)),
+                static_cast<uint8_t>((g << 2) | (g >> 4)),
+                static_cast<uint8_t>((b << 3) | (b >> 2))
+            };
+        }
+
+        uint16_t ReadUint16(const uint8_t* ptr)
+        {
+            uint16_t value;
+            std::memcpy(&value, ptr, sizeof(uint16_t));
+            return value;
+        }
+
+        void WriteUint16(uint8_t* ptr, uint16_t value)
+        {
+            std::memcpy(ptr, &value, sizeof(uint16_t));
+        }
+
+        std::array<std::array<uint8_t, 3>, 4> BuildColorPalette(uint16_t color0, uint16_t color1, bool fourColorMode)
+        {
+            std::array<std::array<uint8_t, 3>, 4> palette{};
+            palette[0] = UnpackRgb565(color0);
+            palette[1] = UnpackRgb565(color1);
+
+            for (size_t c = 0; c < 3; ++c)
+            {
+                uint32_t a = palette[0][c];
+                uint32_t b = palette[1][c];
+
+                if (fourColorMode)
+                {
+                    palette[2][c] = static_cast<uint8_t>((2 * a + b + 1) / 3);
+                    palette[3][c] = static_cast<uint8_t>((a + 2 * b + 1) / 3);
+                }
+                else
+                {
+                    palette[2][c] = static_cast<uint8_t>((a + b + 1) / 2);
+                    palette[3][c] = 0;
+                }
+            }
+
+            return palette;
+        }
+
+        std::array<uint8_t, 8> BuildSingleChannelPalette(uint8_t value0, uint8_t value1)
+        {
+            std::array<uint8_t, 8> palette{};
+            palette[0] = value0;
+            palette[1] = value1;
+
+            uint32_t a = value0;
+            uint32_t b = value1;
+
+            if (value0 > value1)
+            {
+                for (uint32_t i = 1; i <= 6; ++i)
+                    palette[i + 1] = static_cast<uint8_t>(((7 - i) * a + i * b + 3) / 7);
+            }
+            else
+            {
+                for (uint32_t i = 1; i <= 4; ++i)
+                    palette[i + 1] = static_cast<uint8_t>(((5 - i) * a + i * b + 2) / 5);
+
+                palette[6] = 0;
+                palette[7] = 255;
+            }
+
+            return palette;
+        }
+
+        void GatherBlock(std::span<const uint8_t> rgbaPixels, uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, uint8_t* blockPixels)
+        {
+            for (uint32_t y = 0; y < TextureTranscoder::BLOCK_DIMENSION; ++y)
+            {
+                uint32_t sourceY = std::min(blockY * TextureTranscoder::BLOCK_DIMENSION + y, height - 1);
+
+                for (uint32_t x = 0; x < TextureTranscoder::BLOCK_DIMENSION; ++x)
+                {
+                    uint32_t sourceX = std::min(blockX * TextureTranscoder::BLOCK_DIMENSION + x, width - 1);
+                    size_t sourceOffset = (static_cast<size_t>(sourceY) * width + sourceX) * 4;
+
+                    std::memcpy(blockPixels + (y * TextureTranscoder::BLOCK_DIMENSION + x) * 4, rgbaPixels.data() + sourceOffset, 4);
+                }
+            }
+        }
+
+        void ScatterBlock(const uint8_t* blockPixels, uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, std::vector<uint8_t>& rgbaPixels)
+        {
+            for (uint32_t y = 0; y < TextureTranscoder::BLOCK_DIMENSION; ++y)
+            {
+                uint32_t targetY = blockY * TextureTranscoder::BLOCK_DIMENSION + y;
+
+                if (targetY >= height)
+                    break;
+
+                for (uint32_t x = 0; x < TextureTranscoder::BLOCK_DIMENSION; ++x)
+                {
+                    uint32_t targetX = blockX * TextureTranscoder::BLOCK_DIMENSION + x;
+
+                    if (targetX >= width)
+                        break;
+
+                    size_t targetOffset = (static_cast<size_t>(targetY) * width + targetX) * 4;
+                    std::memcpy(rgbaPixels.data() + targetOffset, blockPixels + (y * TextureTranscoder::BLOCK_DIMENSION + x) * 4, 4);
+                }
+            }
+        }
+
+        bool IsNormalSlot(TextureSlotType slotType)
+        {
+            return slotType == TextureSlotType::NORMAL || slotType == TextureSlotType::DETAIL_NORMAL;
+        }
+    }
+
+    CompressedTextureFormat TextureTranscoder::SelectFormat(TextureSlotType slotType, std::span<const uint8_t> rgbaPixels)
+    {
+        switch (slotType)
+        {
+            case TextureSlotType::NORMAL:
+            case TextureSlotType::DETAIL_NORMAL:
+                return CompressedTextureFormat::BC5;
+            case TextureSlotType::ROUGHNESS:
+            case TextureSlotType::METALLIC:
+            case TextureSlotType::SPECULAR:
+            case TextureSlotType::AO:
+                return CompressedTextureFormat::BC4;
+            default:
+                break;
+        }
+
+        for (size_t i = 3; i < rgbaPixels.size(); i += 4)
+        {
+            if (rgbaPixels[i] != 255)
+                return CompressedTextureFormat::BC3;
+        }
+
+        return CompressedTextureFormat::BC1;
+    }
+
+    std::vector<MapbinTextureMip> TextureTranscoder::GenerateMipChain(std::span<const uint8_t> rgbaPixels, uint32_t width, uint32_t height, bool normalMap)
+    {
+        std::vector<MapbinTextureMip> mips;
+
+        if (width == 0 || height == 0 || rgbaPixels.size() < static_cast<size_t>(width) * height * 4)
+            return mips;
+
+        uint32_t mipCount = GetMipCount(width, height);
+        mips.reserve(mipCount);
+
+        MapbinTextureMip base;
+        base.width = width;
+        base.height = height;
+        base.data.assign(rgbaPixels.begin(), rgbaPixels.begin() + static_cast<ptrdiff_t>(width) * height * 4);
+        mips.push_back(std::move(base));
+
+        for (uint32_t level = 1; level < mipCount; ++level)
+        {
+            const auto& source = mips.back();
+
+            MapbinTextureMip mip;
+            mip.width = std::max(1u, source.width / 2);
+            mip.height = std::max(1u, source.height / 2);
+            mip.data.resize(static_cast<size_t>(mip.width) * mip.height * 4);
+
+            for (uint32_t y = 0; y < mip.height; ++y)
+            {
+                uint32_t y0 = std::min(y * 2, source.height - 1);
+                uint32_t y1 = std::min(y * 2 + 1, source.height - 1);
+
+                for (uint32_t x = 0; x < mip.width; ++x)
+                {
+                    uint32_t x0 = std::min(x * 2, source.width - 1);
+                    uint32_t x1 = std::min(x * 2 + 1, source.width - 1);
+
+                    const uint8_t* p00 = source.data.data() + (static_cast<size_t>(y0) * source.width + x0) * 4;
+                    const uint8_t* p10 = source.data.data() + (static_cast<size_t>(y0) * source.width + x1) * 4;
+                    const uint8_t* p01 = source.data.data() + (static_cast<size_t>(y1) * source.width + x0) * 4;
+                    const uint8_t* p11 = source.data.data() + (static_cast<size_t>(y1) * source.width + x1) * 4;
+
+                    uint8_t* target = mip.data.data() + (static_cast<size_t>(y) * mip.width + x) * 4;
+
+                    for (size_t c = 0; c < 4; ++c)
+                        target[c] = static_cast<uint8_t>((p00[c] + p10[c] + p01[c] + p11[c] + 2) / 4);
+
+                    if (normalMap)
+                    {
+                        float nx = target[0] / 127.5f - 1.0f;
+                        float ny = target[1] / 127.5f - 1.0f;
+                        float nz = target[2] / 127.5f - 1.0f;
+                        float length = std::sqrt(nx * nx + ny * ny + nz * nz);
+
+                        if (length > 1e-6f)
+                        {
+                            target[0] = static_cast<uint8_t>(std::clamp((nx / length + 1.0f) * 127.5f + 0.5f, 0.0f, 255.0f));
+                            target[1] = static_cast<uint8_t>(std::clamp((ny / length + 1.0f) * 127.5f + 0.5f, 0.0f, 255.0f));
+                            target[2] = static_cast<uint8_t>(std::clamp((nz / length + 1.0f) * 127.5f + 0.5f, 0.0f, 255.0f));
+                        }
+                    }
+                }
+            }
+
+            mips.push_back(std::move(mip));
+        }
+
+        return mips;
+    }
+
+    std::vector<uint8_t> TextureTranscoder::Compress(CompressedTextureFormat format, std::span<const uint8_t> rgbaPixels, uint32_t width, uint32_t height)
+    {
+        size_t blockSize = GetBlockSize(format);
+
+        if (blockSize == 0 || width == 0 || height == 0 || rgbaPixels.size() < static_cast<size_t>(width) * height * 4)
+            return {};
+
+        uint32_t blocksX = (width + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION;
+        uint32_t blocksY = (height + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION;
+
+        std::vector<uint8_t> output(static_cast<size_t>(blocksX) * blocksY * blockSize);
+        std::array<uint8_t, PIXELS_PER_BLOCK * 4> blockPixels{};
+
+        for (uint32_t by = 0; by < blocksY; ++by)
+        {
+            for (uint32_t bx = 0; bx < blocksX; ++bx)
+            {
+                GatherBlock(rgbaPixels, width, height, bx, by, blockPixels.data());
+
+                uint8_t* target = output.data() + (static_cast<size_t>(by) * blocksX + bx) * blockSize;
+
+                switch (format)
+                {
+                    case CompressedTextureFormat::BC1:
+                        EncodeColorBlock(blockPixels.data(), target);
+                        break;
+                    case CompressedTextureFormat::BC3:
+                        EncodeSingleChannelBlock(blockPixels.data(), 3, target);
+                        EncodeColorBlock(blockPixels.data(), target + 8);
+                        break;
+                    case CompressedTextureFormat::BC4:
+                        EncodeSingleChannelBlock(blockPixels.data(), 0, target);
+                        break;
+                    case CompressedTextureFormat::BC5:
+                        EncodeSingleChannelBlock(blockPixels.data(), 0, target);
+                        EncodeSingleChannelBlock(blockPixels.data(), 1, target + 8);
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+
+        return output;
+    }
+
+    std::vector<uint8_t> TextureTranscoder::Decompress(CompressedTextureFormat format, std::span<const uint8_t> blockData, uint32_t width, uint32_t height)
+    {
+        size_t blockSize = GetBlockSize(format);
+
+        if (blockSize == 0 || width == 0 || height == 0 || blockData.size() < GetCompressedSize(format, width, height))
+            return {};
+
+        uint32_t blocksX = (width + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION;
+        uint32_t blocksY = (height + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION;
+
+        std::vector<uint8_t> output(static_cast<size_t>(width) * height * 4);
+        std::array<uint8_t, PIXELS_PER_BLOCK * 4> blockPixels{};
+
+        for (uint32_t by = 0; by < blocksY; ++by)
+        {
+            for (uint32_t bx = 0; bx < blocksX; ++bx)
+            {
+                const uint8_t* source = blockData.data() + (static_cast<size_t>(by) * blocksX + bx) * blockSize;
+
+                for (uint32_t i = 0; i < PIXELS_PER_BLOCK; ++i)
+                {
+                    blockPixels[i * 4 + 0] = 0;
+                    blockPixels[i * 4 + 1] = 0;
+                    blockPixels[i * 4 + 2] = 0;
+                    blockPixels[i * 4 + 3] = 255;
+                }
+
+                switch (format)
+                {
+                    case CompressedTextureFormat::BC1:
+                        DecodeColorBlock(source, blockPixels.data(), true);
+                        break;
+                    case CompressedTextureFormat::BC3:
+                        DecodeColorBlock(source + 8, blockPixels.data(), false);
+                        DecodeSingleChannelBlock(source, 3, blockPixels.data());
+                        break;
+                    case CompressedTextureFormat::BC4:
+                        DecodeSingleChannelBlock(source, 0, blockPixels.data());
+                        break;
+                    case CompressedTextureFormat::BC5:
+                        DecodeSingleChannelBlock(source, 0, blockPixels.data());
+                        DecodeSingleChannelBlock(source + 8, 1, blockPixels.data());
+                        break;
+                    default:
+                        break;
+                }
+
+                ScatterBlock(blockPixels.data(), width, height, bx, by, output);
+            }
+        }
+
+        return output;
+    }
+
+    bool TextureTranscoder::TranscodeSlot(MapbinTextureSlot& slot, bool keepRawPixels)
+    {
+        size_t expectedSize = static_cast<size_t>(slot.width) * slot.height * 4;
+
+        if (slot.width == 0 || slot.height == 0 || slot.pixelData.size() != expectedSize)
+            return false;
+
+        CompressedTextureFormat format = SelectFormat(slot.slotType, slot.pixelData);
+        auto mips = GenerateMipChain(slot.pixelData, slot.width, slot.height, IsNormalSlot(slot.slotType));
+
+        slot.compressedMips.clear();
+        slot.compressedMips.reserve(mips.size());
+
+        for (const auto& mip : mips)
+        {
+            MapbinTextureMip compressed;
+            compressed.width = mip.width;
+            compressed.height = mip.height;
+            compressed.data = Compress(format, mip.data, mip.width, mip.height);
+            slot.compressedMips.push_back(std::move(compressed));
+        }
+
+        slot.compressedFormat = format;
+
+        if (!keepRawPixels)
+            slot.pixelData.clear();
+
+        return true;
+    }
+
+    size_t TextureTranscoder::TranscodeScene(MapbinScene& scene, bool keepRawPixels)
+    {
+        std::vector<MapbinTextureSlot*> slots;
+
+        for (auto& material : scene.materials)
+        {
+            for (auto& slot : material.textureSlots)
+                slots.push_back(&slot);
+        }
+
+        std::atomic<size_t> transcodedCount = 0;
+
+        // A fixed set of workers pulls slots from a shared index, however many textures the map has
+        Utility::WorkerPool::RunTransient(slots.size(), Utility::WorkerPool::GetDefaultWorkerCount(), [&](const size_t index)
+        {
+            if (TranscodeSlot(*slots[index], keepRawPixels))
+                ++transcodedCount;
+        });
+
+        return transcodedCount;
+    }
+
+    uint32_t TextureTranscoder::GetMipCount(uint32_t width, uint32_t height)
+    {
+        uint32_t largest = std::max(width, height);
+        uint32_t count = 1;
+
+        while (largest > 1)
+        {
+            largest /= 2;
+            ++count;
+        }
+
+        return count;
+    }
+
+    size_t TextureTranscoder::GetBlockSize(CompressedTextureFormat format)
+    {
+        switch (format)
+        {
+            case CompressedTextureFormat::BC1:
+            case CompressedTextureFormat::BC4:
+                return 8;
+            case CompressedTextureFormat::BC3:
+            case CompressedTextureFormat::BC5:
+                return 16;
+            default:
+                return 0;
+        }
+    }
+
+    size_t TextureTranscoder::GetCompressedSize(CompressedTextureFormat format, uint32_t width, uint32_t height)
+    {
+        size_t blocksX = (width + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION;
+        size_t blocksY = (height + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION;
+
+        return blocksX * blocksY * GetBlockSize(format);
+    }
+
+    void TextureTranscoder::EncodeColorBlock(const uint8_t* blockPixels, uint8_t* output)
+    {
+        float mean[3] = { 0.0f, 0.0f, 0.0f };
+
+        for (uint32_t i = 0; i < PIXELS_PER_BLOCK; ++i)
+        {
+            for (size_t c = 0; c < 3; ++c)
+                mean[c] += blockPixels[i * 4 + c];
+        }
+
+        for (float& value : mean)
+            value /= static_cast<float>(PIXELS_PER_BLOCK);
+
+        float covariance[6] = {};
+
+        for (uint32_t i = 0; i < PIXELS_PER_BLOCK; ++i)
+        {
+            float r = blockPixels[i * 4 + 0] - mean[0];
+            float g = blockPixels[i * 4 + 1] - mean[1];
+            float b = blockPixels[i * 4 + 2] - mean[2];
+
+            covariance[0] += r * r;
+            covariance[1] += r * g;
+            covariance[2] += r * b;
+            covariance[3] += g * g;
+            covariance[4] += g * b;
+            covariance[5] += b * b;
+        }
+
+        float axis[3] = { 1.0f, 1.0f, 1.0f };
+
+        for (int iteration = 0; iteration < 8; ++iteration)
+        {
+            float x = covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2];
+            float y = covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2];
+            float z = covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2];
+            float length = std::max({ std::fabs(x), std::fabs(y), std::fabs(z) });
+
+            if (length < 1e-6f)
+                break;
+
+            axis[0] = x / length;
+            axis[1] = y / length;
+            axis[2] = z / length;
+        }
+
+        uint32_t minIndex = 0;
+        uint32_t maxIndex = 0;
+        float minProjection = 0.0f;
+        float maxProjection = 0.0f;
+
+        for (uint32_t i = 0; i < PIXELS_PER_BLOCK; ++i)
+        {
+            float projection = blockPixels[i * 4 + 0] * axis[0] + blockPixels[i * 4 + 1] * axis[1] + blockPixels[i * 4 + 2] * axis[2];
+
+            if (i == 0 || projection < minProjection)
+            {
+                minProjection = projection;
+                minIndex = i;
+            }
+
+            if (i == 0 || projection > maxProjection)
+            {
+                maxProjection = projection;
+                maxIndex = i;
+            }
+        }
+
+        uint16_t color0 = PackRgb565(blockPixels + maxIndex * 4);
+        uint16_t color1 = PackRgb565(blockPixels + minIndex * 4);
+
+        if (color0 < color1)
+            std::swap(color0, color1);
+
+        WriteUint16(output, color0);
+        WriteUint16(output + 2, color1);
+
+        uint32_t indices = 0;
+
+        if (color0 != color1)
+        {
+            auto palette = BuildColorPalette(color0, color1, true);
+
+            for (uint32_t i = 0; i < PIXELS_PER_BLOCK; ++i)
+            {
+                uint32_t bestIndex = 0;
+                int32_t bestDistance = INT32_MAX;
+
+                for (uint32_t p = 0; p < 4; ++p)
+                {
+                    int32_t dr = static_cast<int32_t>(blockPixels[i * 4 + 0]) - palette[p][0];
+                    int32_t dg = static_cast<int32_t>(blockPixels[i * 4 + 1]) - palette[p][1];
+                    int32_t db = static_cast<int32_t>(blockPixels[i * 4 + 2]) - palette[p][2];
+                    int32_t distance = dr * dr + dg * dg + db * db;
+
+                    if (distance < bestDistance)
+                    {
+                        bestDistance = distance;
+                        bestIndex = p;
+                    }
+                }
+
+                indices |= bestIndex << (i * 2);
+            }
+        }
+
+        std::memcpy(output + 4, &indices, sizeof(uint32_t));
+    }
+
+    void TextureTranscoder::EncodeSingleChannelBlock(const uint8_t* blockPixels, uint32_t channel, uint8_t* output)
+    {
+        uint8_t minValue = 255;
+        uint8_t maxValue = 0;
+
+        for (uint32_t i = 0; i < PIXELS_PER_BLOCK; ++i)
+        {
+            minValue = std::min(minValue, blockPixels[i * 4 + channel]);
+            maxValue = std::max(maxValue, blockPixels[i * 4 + channel]);
+        }
+
+        output[0] = maxValue;
+        output[1] = minValue;
+
+        uint64_t indices = 0;
+
+        if (maxValue != minValue)
+        {
+            auto palette = BuildSingleChannelPalette(maxValue, minValue);
+
+            for (uint32_t i = 0; i < PIXELS_PER_BLOCK; ++i)
+            {
+                uint32_t bestIndex = 0;
+                int32_t bestDistance = INT32_MAX;
+
+                for (uint32_t p = 0; p < 8; ++p)
+                {
+                    int32_t distance = std::abs(static_cast<int32_t>(blockPixels[i * 4 + channel]) - palette[p]);
+
+                    if (distance < bestDistance)
+                    {
+                        bestDistance = distance;
+                        bestIndex = p;
+                    }
+                }
+
+                indices |= static_cast<uint64_t>(bestIndex) << (i * 3);
+            }
+        }
+
+        for (size_t b = 0; b < 6; ++b)
+            output[2 + b] = static_cast<uint8_t>((indices >> (b * 8)) & 0xFF);
+    }
+
+    void TextureTranscoder::DecodeColorBlock(const uint8_t* input, uint8_t* blockPixels, bool allowTransparent)
+    {
+        uint16_t color0 = ReadUint16(input);
+        uint16_t color1 = ReadUint16(input + 2);
+
+        uint32_t indices;
+        std::memcpy(&indices, input + 4, sizeof(uint32_t));
+
+        bool fourColorMode = !allowTransparent || color0 > color1;
+        auto palette = BuildColorPalette(color0, color1, fourColorMode);
+
+        for (uint32_t i = 0; i < PIXELS_PER_BLOCK; ++i)
+        {
+            uint32_t index = (indices >> (i * 2)) & 0x3;
+
+            blockPixels[i * 4 + 0] = palette[index][0];
+            blockPixels[i * 4 + 1] = palette[index][1];
+            blockPixels[i * 4 + 2] = palette[index][2];
+            blockPixels[i * 4 + 3] = (!fourColorMode && index == 3) ? 0 : 255;
+        }
+    }
+
+    void TextureTranscoder::DecodeSingleChannelBlock(const uint8_t* input, uint32_t channel, uint8_t* blockPixels)
+    {
+        auto palette = BuildSingleChannelPalette(input[0], input[1]);
+
+        uint64_t indices = 0;
+
+        for (size_t b = 0; b < 6; ++b)
+            indices |= static_cast<uint64_t>(input[2 + b]) << (b * 8);
+
+        for (uint32_t i = 0; i < PIXELS_PER_BLOCK; ++i)
+            blockPixels[i * 4 + channel] = palette[(indices >> (i * 3)) & 0x7];
+    }
+}
@@ -0,0 +1,152 @@
+#include "RenderStar/Common/Utility/WorkerPool.hpp"
+#include <algorithm>
+#include <atomic>
+
+namespace RenderStar::Common::Utility
+{
+    WorkerPool::WorkerPool(const size_t workerCount)
+    {
+        const size_t count = workerCount != 0 ? workerCount : GetDefaultWorkerCount();
+
+        threads.reserve(count - 1);
+
+        for (size_t worker = 1; worker < count; ++worker)
+            threads.emplace_back([this, worker](const std::stop_token& stopToken) { WorkerLoop(stopToken, worker); });
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        for (auto& thread : threads)
+            thread.request_stop();
+
+        threads.clear();
+    }
+
+    void WorkerPool::RunOnWorkers(size_t participants, const std::function<void(size_t)>& body)
+    {
+        participants = std::min(participants, GetWorkerCount());
+
+        if (participants <= 1)
+        {
+            if (participants == 1)
+                body(0);
+
+            return;
+        }
+
+        std::scoped_lock dispatchLock(dispatchMutex);
+
+        {
+            std::scoped_lock lock(stateMutex);
+            this->body = &body;
+            this->participants = participants;
+            remaining = participants - 1;
+            ++generation;
+        }
+
+        wake.notify_all();
+
+        // The pooled workers still hold a reference to body, so they are waited for even if the caller's share throws
+        try
+        {
+            body(0);
+        }
+        catch (...)
+        {
+            WaitForWorkers();
+            throw;
+        }
+
+        WaitForWorkers();
+    }
+
+    void WorkerPool::Run(const size_t jobCount, const std::function<void(size_t)>& job, const size_t maxWorkers)
+    {
+        const size_t participants = std::min({ jobCount, GetWorkerCount(), maxWorkers != 0 ? maxWorkers : jobCount });
+
+        if (participants <= 1)
+        {
+            for (size_t index = 0; index < jobCount; ++index)
+                job(index);
+
+            return;
+        }
+
+        std::atomic<size_t> next = 0;
+
+        RunOnWorkers(participants, [&](size_t)
+        {
+            for (size_t index = next++; index < jobCount; index = next++)
+                job(index);
+        });
+    }
+
+    size_t WorkerPool::GetDefaultWorkerCount()
+    {
+        return std::clamp<size_t>(std::thread::hardware_concurrency(), 1, 8);
+    }
+
+    void WorkerPool::RunTransient(const size_t jobCount, const size_t workerCount, const std::function<void(size_t)>& job)
+    {
+        const size_t threadCount = std::min(jobCount, workerCount);
+
+        if (threadCount <= 1)
+        {
+            for (size_t index = 0; index < jobCount; ++index)
+                job(index);
+
+            return;
+        }
+
+        std::atomic<size_t> next = 0;
+        std::vector<std::jthread> workers;
+        workers.reserve(threadCount);
+
+        for (size_t worker = 0; worker < threadCount; ++worker)
+        {
+            workers.emplace_back([&]
+            {
+                for (size_t index = next++; index < jobCount; index = next++)
+                    job(index);
+            });
+        }
+    }
+
+    void WorkerPool::WorkerLoop(const std::stop_token& stopToken, const size_t worker)
+    {
+        uint64_t seen = 0;
+
+        while (true)
+        {
+            const std::function<void(size_t)>* task = nullptr;
+
+            {
+                std::unique_lock lock(stateMutex);
+
+                if (!wake.wait(lock, stopToken, [&] { return generation != seen; }))
+                    return;
+
+                seen = generation;
+
+                // Workers past the dispatch's participant count sit this one out
+                if (worker >= participants)
+                    continue;
+
+                task = body;
+            }
+
+            (*task)(worker);
+
+            std::scoped_lock lock(stateMutex);
+
+            if (--remaining == 0)
+                finished.notify_one();
+        }
+    }
+
+    void WorkerPool::WaitForWorkers()
+    {
+        std::unique_lock lock(stateMutex);
+        finished.wait(lock, [&] { return remaining == 0; });
+    }
+}
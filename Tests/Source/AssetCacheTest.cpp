@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "RenderStar/Common/Asset/AssetCache.hpp"
+#include "RenderStar/Common/Asset/BinaryAsset.hpp"
 #include "RenderStar/Common/Asset/TextAsset.hpp"
 
 using namespace RenderStar::Common::Asset;
@@ -7,12 +8,17 @@ using namespace RenderStar::Common::Asset;
 class AssetCacheTest : public ::testing::Test
 {
 protected:
-    AssetCache cache{4};
+    AssetCache cache;
 
     std::shared_ptr<TextAsset> MakeAsset(const std::string& name)
     {
         return std::make_shared<TextAsset>(AssetLocation::Of("test", name), "content of " + name);
     }
+
+    std::shared_ptr<BinaryAsset> MakeBinary(const std::string& name, size_t size)
+    {
+        return std::make_shared<BinaryAsset>(AssetLocation::Of("test", name), std::vector<uint8_t>(size));
+    }
 };
 
 TEST_F(AssetCacheTest, PutAndGet)
@@ -38,6 +44,7 @@ TEST_F(AssetCacheTest, EvictRemovesEntry)
     cache.Put<TextAsset>(loc, MakeAsset("a"));
     cache.Evict(loc);
     EXPECT_EQ(cache.Get<TextAsset>(loc), nullptr);
+    EXPECT_EQ(cache.GetResidentBytes(), 0u);
 }
 
 TEST_F(AssetCacheTest, ClearRemovesAll)
@@ -46,51 +53,129 @@ TEST_F(AssetCacheTest, ClearRemovesAll)
     cache.Put<TextAsset>(AssetLocation::Of("test", "b"), MakeAsset("b"));
     cache.Clear();
     EXPECT_EQ(cache.GetSize(), 0);
+    EXPECT_EQ(cache.GetResidentBytes(), 0u);
+}
+
+TEST_F(AssetCacheTest, RetainsAssetAfterLastHandleDrops)
+{
+    auto loc = AssetLocation::Of("test", "a");
+
+    {
+        auto asset = MakeAsset("a");
+        cache.Put<TextAsset>(loc, asset);
+    }
+
+    auto retrieved = cache.Get<TextAsset>(loc);
+    ASSERT_NE(retrieved, nullptr);
+    EXPECT_EQ(retrieved->GetContent(), "content of a");
+}
+
+TEST_F(AssetCacheTest, TracksResidentBytes)
+{
+    auto asset = MakeBinary("a", 1000);
+    cache.Put<BinaryAsset>(AssetLocation::Of("test", "a"), asset);
+
+    EXPECT_EQ(cache.GetResidentBytes(), asset->GetMemoryFootprint());
+    EXPECT_GE(cache.GetResidentBytes(), 1000u);
+}
+
+TEST_F(AssetCacheTest, EvictsToStayWithinByteBudget)
+{
+    const size_t footprint = MakeBinary("probe", 1000)->GetMemoryFootprint();
+    cache.SetByteBudget(footprint * 3);
+
+    for (int i = 0; i < 5; ++i)
+        cache.Put<BinaryAsset>(AssetLocation::Of("test", std::to_string(i)), MakeBinary(std::to_string(i), 1000));
+
+    EXPECT_EQ(cache.GetSize(), 3u);
+    EXPECT_LE(cache.GetResidentBytes(), cache.GetByteBudget());
+    EXPECT_EQ(cache.GetStatistics().evictions, 2u);
+    EXPECT_EQ(cache.Get<BinaryAsset>(AssetLocation::Of("test", "0")), nullptr);
+    EXPECT_NE(cache.Get<BinaryAsset>(AssetLocation::Of("test", "4")), nullptr);
+}
+
+TEST_F(AssetCacheTest, LargeAssetEvictsSeveralSmallOnes)
+{
+    const size_t smallFootprint = MakeBinary("probe", 100)->GetMemoryFootprint();
+    cache.SetByteBudget(smallFootprint * 4);
+
+    for (int i = 0; i < 4; ++i)
+        cache.Put<BinaryAsset>(AssetLocation::Of("test", std::to_string(i)), MakeBinary(std::to_string(i), 100));
+
+    cache.Put<BinaryAsset>(AssetLocation::Of("test", "large"), MakeBinary("large", 250));
+
+    EXPECT_NE(cache.Get<BinaryAsset>(AssetLocation::Of("test", "large")), nullptr);
+    EXPECT_LE(cache.GetResidentBytes(), cache.GetByteBudget());
+    EXPECT_LT(cache.GetSize(), 4u);
 }
 
-TEST_F(AssetCacheTest, LruEviction)
+TEST_F(AssetCacheTest, RecentlyUsedEntrySurvivesEviction)
 {
+    const size_t footprint = MakeBinary("probe", 1000)->GetMemoryFootprint();
+    cache.SetByteBudget(footprint * 2);
+
     auto locA = AssetLocation::Of("test", "a");
     auto locB = AssetLocation::Of("test", "b");
     auto locC = AssetLocation::Of("test", "c");
-    auto locD = AssetLocation::Of("test", "d");
-    auto locE = AssetLocation::Of("test", "e");
 
-    cache.Put<TextAsset>(locA, MakeAsset("a"));
-    cache.Put<TextAsset>(locB, MakeAsset("b"));
-    cache.Put<TextAsset>(locC, MakeAsset("c"));
-    cache.Put<TextAsset>(locD, MakeAsset("d"));
-    cache.Put<TextAsset>(locE, MakeAsset("e"));
+    cache.Put<BinaryAsset>(locA, MakeBinary("a", 1000));
+    cache.Put<BinaryAsset>(locB, MakeBinary("b", 1000));
+    ASSERT_NE(cache.Get<BinaryAsset>(locA), nullptr);
+
+    cache.Put<BinaryAsset>(locC, MakeBinary("c", 1000));
 
-    EXPECT_EQ(cache.GetSize(), 4);
+    EXPECT_NE(cache.Get<BinaryAsset>(locA), nullptr);
+    EXPECT_EQ(cache.Get<BinaryAsset>(locB), nullptr);
+    EXPECT_NE(cache.Get<BinaryAsset>(locC), nullptr);
 }
 
-TEST_F(AssetCacheTest, ExpiredWeakPtrCleanedOnGet)
+TEST_F(AssetCacheTest, AssetLargerThanBudgetIsRejected)
 {
-    auto loc = AssetLocation::Of("test", "a");
+    cache.SetByteBudget(64);
+    cache.Put<BinaryAsset>(AssetLocation::Of("test", "huge"), MakeBinary("huge", 4096));
 
-    {
-        auto asset = MakeAsset("a");
-        cache.Put<TextAsset>(loc, asset);
-    }
+    EXPECT_EQ(cache.GetSize(), 0u);
+    EXPECT_EQ(cache.GetStatistics().rejections, 1u);
+}
 
-    auto retrieved = cache.Get<TextAsset>(loc);
-    EXPECT_EQ(retrieved, nullptr);
+TEST_F(AssetCacheTest, ShrinkingBudgetEvicts)
+{
+    cache.Put<BinaryAsset>(AssetLocation::Of("test", "a"), MakeBinary("a", 1000));
+    cache.Put<BinaryAsset>(AssetLocation::Of("test", "b"), MakeBinary("b", 1000));
+
+    cache.SetByteBudget(cache.GetResidentBytes() / 2);
+
+    EXPECT_EQ(cache.GetSize(), 1u);
+    EXPECT_EQ(cache.GetByteBudget(), cache.GetStatistics().byteBudget);
 }
 
-TEST_F(AssetCacheTest, SetMaxSize)
+TEST_F(AssetCacheTest, StatisticsCountHitsAndMisses)
 {
-    cache.SetMaxSize(2);
-    EXPECT_EQ(cache.GetMaxSize(), 2);
+    auto loc = AssetLocation::Of("test", "a");
+    cache.Put<TextAsset>(loc, MakeAsset("a"));
+
+    cache.Get<TextAsset>(loc);
+    cache.Get<TextAsset>(loc);
+    cache.Get<TextAsset>(AssetLocation::Of("test", "missing"));
+
+    auto statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.hits, 2u);
+    EXPECT_EQ(statistics.misses, 1u);
+    EXPECT_EQ(statistics.insertions, 1u);
+    EXPECT_DOUBLE_EQ(statistics.GetHitRate(), 2.0 / 3.0);
+
+    cache.ResetStatistics();
+    EXPECT_EQ(cache.GetStatistics().hits, 0u);
 }
 
-TEST_F(AssetCacheTest, GetSizeAndMaxSize)
+TEST_F(AssetCacheTest, GetSizeAndByteBudget)
 {
     EXPECT_EQ(cache.GetSize(), 0);
-    EXPECT_EQ(cache.GetMaxSize(), 4);
+    EXPECT_EQ(cache.GetByteBudget(), AssetCache::DEFAULT_BYTE_BUDGET);
 
     cache.Put<TextAsset>(AssetLocation::Of("test", "a"), MakeAsset("a"));
     EXPECT_EQ(cache.GetSize(), 1);
+    EXPECT_TRUE(cache.Contains(AssetLocation::Of("test", "a")));
 }
 
 TEST_F(AssetCacheTest, RePutSameKeyUpdates)
@@ -105,10 +190,12 @@ TEST_F(AssetCacheTest, RePutSameKeyUpdates)
     auto retrieved = cache.Get<TextAsset>(loc);
     ASSERT_NE(retrieved, nullptr);
     EXPECT_EQ(retrieved->GetContent(), "content of second");
+    EXPECT_EQ(cache.GetSize(), 1u);
+    EXPECT_EQ(cache.GetResidentBytes(), second->GetMemoryFootprint());
 }
 
-TEST_F(AssetCacheTest, DefaultCacheMaxSize)
+TEST_F(AssetCacheTest, ExplicitByteBudget)
 {
-    AssetCache defaultCache;
-    EXPECT_EQ(defaultCache.GetMaxSize(), AssetCache::DEFAULT_MAX_SIZE);
+    AssetCache smallCache(1024);
+    EXPECT_EQ(smallCache.GetByteBudget(), 1024u);
 }
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Common/Asset/AssetModule.hpp"
+#include "RenderStar/Common/Asset/FilesystemAssetProvider.hpp"
+#include "RenderStar/Common/Asset/TextAssetLoader.hpp"
+#include <fstream>
+#include <thread>
+
+using namespace RenderStar::Common::Asset;
+
+namespace
+{
+    AssetLocation Location(std::string_view path)
+    {
+        return AssetLocation::Of("test", path);
+    }
+
+    bool ContainsLocation(const std::vector<AssetLocation>& locations, const AssetLocation& location)
+    {
+        return std::ranges::find(locations, location) != locations.end();
+    }
+}
+
+TEST(AssetDependencyGraphTest, CollectAffectedIncludesTransitiveDependents)
+{
+    AssetDependencyGraph graph;
+    graph.AddDependency(Location("shader/scene.rssl"), Location("shader/lighting.rssli"));
+    graph.AddDependency(Location("shader/lighting.rssli"), Location("shader/common.rssli"));
+    graph.AddDependency(Location("shader/ui.rssl"), Location("shader/common.rssli"));
+
+    const auto affected = graph.CollectAffected(Location("shader/common.rssli"));
+
+    ASSERT_EQ(affected.size(), 4u);
+    EXPECT_EQ(affected.front(), Location("shader/common.rssli"));
+    EXPECT_TRUE(ContainsLocation(affected, Location("shader/lighting.rssli")));
+    EXPECT_TRUE(ContainsLocation(affected, Location("shader/scene.rssl")));
+    EXPECT_TRUE(ContainsLocation(affected, Location("shader/ui.rssl")));
+}
+
+TEST(AssetDependencyGraphTest, CollectAffectedLeavesUnrelatedAssetsAlone)
+{
+    AssetDependencyGraph graph;
+    graph.AddDependency(Location("ui/main.uibin"), Location("font/times.ttf"));
+    graph.AddDependency(Location("shader/ui.rssl"), Location("shader/common.rssli"));
+
+    const auto affected = graph.CollectAffected(Location("font/times.ttf"));
+
+    ASSERT_EQ(affected.size(), 2u);
+    EXPECT_FALSE(ContainsLocation(affected, Location("shader/ui.rssl")));
+}
+
+TEST(AssetDependencyGraphTest, CyclesTerminate)
+{
+    AssetDependencyGraph graph;
+    graph.AddDependency(Location("a"), Location("b"));
+    graph.AddDependency(Location("b"), Location("a"));
+
+    EXPECT_EQ(graph.CollectAffected(Location("a")).size(), 2u);
+}
+
+TEST(AssetDependencyGraphTest, ClearDependenciesRemovesReverseEdges)
+{
+    AssetDependencyGraph graph;
+    graph.AddDependency(Location("shader/scene.rssl"), Location("shader/common.rssli"));
+    graph.AddDependency(Location("shader/scene.rssl"), Location("shader/lighting.rssli"));
+
+    EXPECT_EQ(graph.GetEdgeCount(), 2u);
+
+    graph.ClearDependencies(Location("shader/scene.rssl"));
+
+    EXPECT_EQ(graph.GetEdgeCount(), 0u);
+    EXPECT_TRUE(graph.GetDependents(Location("shader/common.rssli")).empty());
+    EXPECT_EQ(graph.CollectAffected(Location("shader/common.rssli")).size(), 1u);
+}
+
+TEST(AssetDependencyGraphTest, SelfDependencyIsIgnored)
+{
+    AssetDependencyGraph graph;
+    graph.AddDependency(Location("a"), Location("a"));
+
+    EXPECT_EQ(graph.GetEdgeCount(), 0u);
+}
+
+class AssetHotReloadTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        root = std::filesystem::temp_directory_path() / ("renderstar_reload_test_" + std::to_string(reinterpret_cast<uintptr_t>(this)));
+        std::filesystem::create_directories(root / "shader");
+
+        WriteFile("shader/common.rssli", "common v1");
+        WriteFile("shader/scene.rssl", "scene v1");
+        WriteFile("shader/ui.rssl", "ui v1");
+
+        assetModule = std::make_unique<AssetModule>(root);
+        assetModule->RegisterLoader<ITextAsset>(std::make_unique<TextAssetLoader>());
+        assetModule->RegisterProvider(std::make_unique<FilesystemAssetProvider>("test", root));
+    }
+
+    void TearDown() override
+    {
+        assetModule.reset();
+        std::filesystem::remove_all(root);
+    }
+
+    void WriteFile(std::string_view path, std::string_view content) const
+    {
+        std::ofstream file(root / path, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+
+    std::vector<RenderStar::Common::Event::Events::AssetReloadEvent> WaitForReloads() const
+    {
+        for (int attempt = 0; attempt < 40; ++attempt)
+        {
+            auto events = assetModule->PollReloads();
+
+            if (!events.empty())
+                return events;
+
+            std::this_thread::sleep_for(AssetWatcher::SCAN_INTERVAL / 4);
+        }
+
+        return {};
+    }
+
+    std::filesystem::path root;
+    std::unique_ptr<AssetModule> assetModule;
+};
+
+TEST_F(AssetHotReloadTest, PollWithoutHotReloadReturnsNothing)
+{
+    EXPECT_FALSE(assetModule->IsHotReloadEnabled());
+    EXPECT_TRUE(assetModule->PollReloads().empty());
+}
+
+TEST_F(AssetHotReloadTest, ChangedFileInvalidatesOnlyAffectedEntries)
+{
+    ASSERT_TRUE(assetModule->EnableHotReload());
+
+    assetModule->RecordDependency(Location("shader/scene.rssl"), Location("shader/common.rssli"));
+
+    ASSERT_TRUE(assetModule->LoadText(Location("shader/common.rssli")).IsValid());
+    ASSERT_TRUE(assetModule->LoadText(Location("shader/scene.rssl")).IsValid());
+    ASSERT_TRUE(assetModule->LoadText(Location("shader/ui.rssl")).IsValid());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    WriteFile("shader/common.rssli", "common v2");
+
+    const auto events = WaitForReloads();
+
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].changed, Location("shader/common.rssli"));
+    EXPECT_TRUE(events[0].Affects(Location("shader/scene.rssl")));
+    EXPECT_FALSE(events[0].Affects(Location("shader/ui.rssl")));
+
+    EXPECT_FALSE(assetModule->GetCache().Contains(Location("shader/common.rssli")));
+    EXPECT_FALSE(assetModule->GetCache().Contains(Location("shader/scene.rssl")));
+    EXPECT_TRUE(assetModule->GetCache().Contains(Location("shader/ui.rssl")));
+
+    EXPECT_EQ(assetModule->LoadText(Location("shader/common.rssli")).Get()->GetContent(), "common v2");
+
+    const auto statistics = assetModule->GetReloadStatistics();
+    EXPECT_EQ(statistics.changes, 1u);
+    EXPECT_EQ(statistics.invalidations, 2u);
+}
+
+TEST_F(AssetHotReloadTest, FilesInNewDirectoriesAreReported)
+{
+    ASSERT_TRUE(assetModule->EnableHotReload());
+
+    std::filesystem::create_directories(root / "ui");
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    assetModule->PollReloads();
+
+    WriteFile("ui/main.uibin", "layout");
+
+    const auto events = WaitForReloads();
+
+    ASSERT_FALSE(events.empty());
+    EXPECT_EQ(events[0].changed, Location("ui/main.uibin"));
+}
+
+TEST_F(AssetHotReloadTest, RecordsReloadLatency)
+{
+    assetModule->RecordReloadLatency(std::chrono::milliseconds(4));
+    assetModule->RecordReloadLatency(std::chrono::milliseconds(8));
+
+    const auto statistics = assetModule->GetReloadStatistics();
+
+    EXPECT_EQ(statistics.measuredReloads, 2u);
+    EXPECT_EQ(statistics.lastLatency, std::chrono::milliseconds(8));
+    EXPECT_EQ(statistics.maxLatency, std::chrono::milliseconds(8));
+    EXPECT_EQ(statistics.GetAverageLatency(), std::chrono::milliseconds(6));
+}
@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Common/Asset/AssetModule.hpp"
+#include "RenderStar/Common/Asset/BinaryAssetLoader.hpp"
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+
+using namespace RenderStar::Common::Asset;
+
+namespace
+{
+    class GatedAssetProvider : public IAssetProvider
+    {
+    public:
+        std::string GetNamespace() const override
+        {
+            return "test";
+        }
+
+        bool Exists(const AssetLocation& location) const override
+        {
+            return location.GetPath() != "missing.bin";
+        }
+
+        std::vector<uint8_t> LoadBinary(const AssetLocation& location) override
+        {
+            std::unique_lock lock(mutex);
+
+            loadOrder.push_back(location.GetPath());
+            condition.notify_all();
+            condition.wait(lock, [this] { return open; });
+
+            if (location.GetPath() == "missing.bin")
+                throw std::runtime_error("Failed to open asset: " + location.ToString());
+
+            return { static_cast<uint8_t>(location.GetPath().size()) };
+        }
+
+        std::string LoadText(const AssetLocation&) override
+        {
+            return {};
+        }
+
+        std::vector<AssetLocation> List(std::string_view) const override
+        {
+            return {};
+        }
+
+        void Open()
+        {
+            std::lock_guard lock(mutex);
+            open = true;
+            condition.notify_all();
+        }
+
+        void WaitForLoads(size_t count)
+        {
+            std::unique_lock lock(mutex);
+            condition.wait(lock, [this, count] { return loadOrder.size() >= count; });
+        }
+
+        std::vector<std::string> GetLoadOrder()
+        {
+            std::lock_guard lock(mutex);
+            return loadOrder;
+        }
+
+    private:
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::vector<std::string> loadOrder;
+        bool open = false;
+    };
+}
+
+class AssetStreamerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        auto gatedProvider = std::make_unique<GatedAssetProvider>();
+        provider = gatedProvider.get();
+
+        assetModule.RegisterProvider(std::move(gatedProvider));
+        assetModule.RegisterLoader<IBinaryAsset>(std::make_unique<BinaryAssetLoader>());
+    }
+
+    AssetModule assetModule;
+    GatedAssetProvider* provider = nullptr;
+};
+
+TEST_F(AssetStreamerTest, LoadAsyncCompletes)
+{
+    assetModule.GetStreamer().Start(2);
+    provider->Open();
+
+    auto future = assetModule.LoadAsync<IBinaryAsset>(AssetLocation::Of("test", "a.bin"));
+    auto handle = future.Get();
+
+    ASSERT_TRUE(handle.IsValid());
+    EXPECT_EQ(handle->GetSize(), 1u);
+    EXPECT_EQ(future.GetStatus(), AssetLoadStatus::COMPLETED);
+}
+
+TEST_F(AssetStreamerTest, LoadAsyncRunsInlineWithoutWorkers)
+{
+    provider->Open();
+
+    auto future = assetModule.LoadAsync<IBinaryAsset>(AssetLocation::Of("test", "a.bin"));
+
+    EXPECT_TRUE(future.IsReady());
+    EXPECT_TRUE(future.Get().IsValid());
+}
+
+TEST_F(AssetStreamerTest, ConcurrentRequestsAreDeduplicated)
+{
+    assetModule.GetStreamer().Start(2);
+
+    auto location = AssetLocation::Of("test", "shared.bin");
+    auto first = assetModule.LoadAsync<IBinaryAsset>(location);
+    auto second = assetModule.LoadAsync<IBinaryAsset>(location);
+
+    provider->Open();
+
+    auto firstHandle = first.Get();
+    auto secondHandle = second.Get();
+
+    ASSERT_TRUE(firstHandle.IsValid());
+    EXPECT_EQ(firstHandle.Get(), secondHandle.Get());
+    EXPECT_EQ(provider->GetLoadOrder().size(), 1u);
+}
+
+TEST_F(AssetStreamerTest, HigherPriorityLoadsFirst)
+{
+    assetModule.GetStreamer().Start(1);
+
+    auto blocker = assetModule.LoadAsync<IBinaryAsset>(AssetLocation::Of("test", "blocker.bin"));
+    provider->WaitForLoads(1);
+
+    auto low = assetModule.LoadAsync<IBinaryAsset>(AssetLocation::Of("test", "low.bin"), AssetLoadPriority::LOW);
+    auto high = assetModule.LoadAsync<IBinaryAsset>(AssetLocation::Of("test", "high.bin"), AssetLoadPriority::HIGH);
+
+    provider->Open();
+    low.Wait();
+    high.Wait();
+
+    auto order = provider->GetLoadOrder();
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_EQ(order[1], "high.bin");
+    EXPECT_EQ(order[2], "low.bin");
+}
+
+TEST_F(AssetStreamerTest, DuplicateRequestRaisesPriority)
+{
+    assetModule.GetStreamer().Start(1);
+
+    auto blocker = assetModule.LoadAsync<IBinaryAsset>(AssetLocation::Of("test", "blocker.bin"));
+    provider->WaitForLoads(1);
+
+    auto normal = assetModule.LoadAsync<IBinaryAsset>(AssetLocation::Of("test", "normal.bin"), AssetLoadPriority::NORMAL);
+    auto low = assetModule.LoadAsync<IBinaryAsset>(AssetLocation::Of("test", "bumped.bin"), AssetLoadPriority::LOWEST);
+    auto bumped = assetModule.LoadAsync<IBinaryAsset>(AssetLocation::Of("test", "bumped.bin"), AssetLoadPriority::HIGHEST);
+
+    provider->Open();
+    normal.Wait();
+    bumped.Wait();
+
+    auto order = provider->GetLoadOrder();
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_EQ(order[1], "bumped.bin");
+}
+
+TEST_F(AssetStreamerTest, CancelledRequestIsNeverLoaded)
+{
+    assetModule.GetStreamer().Start(1);
+
+    auto blocker = assetModule.LoadAsync<IBinaryAsset>(AssetLocation::Of("test", "blocker.bin"));
+    provider->WaitForLoads(1);
+
+    auto cancelled = assetModule.LoadAsync<IBinaryAsset>(AssetLocation::Of("test", "cancelled.bin"));
+    auto kept = assetModule.LoadAsync<IBinaryAsset>(AssetLocation::Of("test", "kept.bin"));
+
+    cancelled.Cancel();
+    provider->Open();
+    kept.Wait();
+
+    auto order = provider->GetLoadOrder();
+    EXPECT_EQ(std::ranges::count(order, "cancelled.bin"), 0);
+    EXPECT_FALSE(cancelled.IsValid());
+    EXPECT_EQ(assetModule.GetStreamer().GetInFlightCount(), 0u);
+}
+
+TEST_F(AssetStreamerTest, CancelKeepsRequestAliveForOtherWaiters)
+{
+    assetModule.GetStreamer().Start(1);
+
+    auto blocker = assetModule.LoadAsync<IBinaryAsset>(AssetLocation::Of("test", "blocker.bin"));
+    provider->WaitForLoads(1);
+
+    auto location = AssetLocation::Of("test", "shared.bin");
+    auto first = assetModule.LoadAsync<IBinaryAsset>(location);
+    auto second = assetModule.LoadAsync<IBinaryAsset>(location);
+
+    first.Cancel();
+    provider->Open();
+
+    EXPECT_TRUE(second.Get().IsValid());
+    EXPECT_EQ(second.GetStatus(), AssetLoadStatus::COMPLETED);
+}
+
+TEST_F(AssetStreamerTest, ProviderFailureReportsFailed)
+{
+    assetModule.GetStreamer().Start(1);
+    provider->Open();
+
+    auto future = assetModule.LoadAsync<IBinaryAsset>(AssetLocation::Of("test", "missing.bin"));
+
+    EXPECT_FALSE(future.Get().IsValid());
+    EXPECT_EQ(future.GetStatus(), AssetLoadStatus::FAILED);
+}
+
+TEST_F(AssetStreamerTest, CachedAssetIsReadyImmediately)
+{
+    provider->Open();
+
+    auto location = AssetLocation::Of("test", "cached.bin");
+    auto handle = assetModule.Load<IBinaryAsset>(location);
+
+    assetModule.GetStreamer().Start(1);
+    auto future = assetModule.LoadAsync<IBinaryAsset>(location);
+
+    EXPECT_TRUE(future.IsReady());
+    EXPECT_EQ(future.Get().Get(), handle.Get());
+    EXPECT_EQ(provider->GetLoadOrder().size(), 1u);
+}
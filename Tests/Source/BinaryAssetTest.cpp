@@ -37,3 +37,12 @@ TEST(BinaryAssetTest, LocationAndSize)
     EXPECT_EQ(asset.GetSize(), 5);
     EXPECT_TRUE(asset.IsLoaded());
 }
+
+TEST(BinaryAssetTest, MemoryFootprintIncludesData)
+{
+    BinaryAsset small(AssetLocation::Of("test", "small.bin"), std::vector<uint8_t>(16));
+    BinaryAsset large(AssetLocation::Of("test", "large.bin"), std::vector<uint8_t>(4096));
+
+    EXPECT_GE(large.GetMemoryFootprint(), 4096u);
+    EXPECT_GT(large.GetMemoryFootprint(), small.GetMemoryFootprint());
+}
@@ -1,9 +1,22 @@
 #include <gtest/gtest.h>
 #include "RenderStar/Common/Configuration/Configuration.hpp"
+#include "RenderStar/Common/Configuration/ConfigurationModule.hpp"
 #include <filesystem>
+#include <fstream>
 
 using namespace RenderStar::Common::Configuration;
 
+namespace
+{
+    struct ReloadSectionA { };
+    struct ReloadSectionB { };
+
+    void WriteFile(const std::filesystem::path& path, const std::string& text)
+    {
+        std::ofstream(path) << text;
+    }
+}
+
 class ConfigurationTest : public ::testing::Test
 {
 protected:
@@ -165,3 +178,112 @@ TEST(ConfigurationMissingSectionTest, EmptyDocumentReturnsNullopt)
 
     EXPECT_FALSE(config.GetString("key").has_value());
 }
+
+TEST_F(ConfigurationTest, KeyResolvesOnceAndReadsCurrentValue)
+{
+    config->SetInteger("render.msaa", 4);
+
+    const auto key = config->Key<int32_t>("render.msaa");
+
+    ASSERT_TRUE(key.IsValid());
+    EXPECT_EQ(config->Key<int32_t>("render.msaa").GetSlot(), key.GetSlot());
+    EXPECT_EQ(config->Get(key), 4);
+
+    config->SetInteger("render.msaa", 8);
+    EXPECT_EQ(config->Get(key), 8);
+}
+
+TEST_F(ConfigurationTest, KeyForMissingPathPicksUpLaterValue)
+{
+    const auto key = config->Key<std::string>("later");
+
+    EXPECT_FALSE(config->Get(key).has_value());
+
+    config->SetString("later", "\"quoted\"");
+    EXPECT_EQ(config->Get(key), "quoted");
+}
+
+TEST_F(ConfigurationTest, KeysReadEveryValueType)
+{
+    config->SetFloat("scale", 0.5f);
+    config->SetBoolean("vsync", true);
+    config->SetString("stages", "geometry, post , ui");
+
+    EXPECT_FLOAT_EQ(*config->Get(config->Key<float>("scale")), 0.5f);
+    EXPECT_TRUE(*config->Get(config->Key<bool>("vsync")));
+    EXPECT_EQ(*config->Get(config->Key<std::vector<std::string>>("stages")), (std::vector<std::string>{"geometry", "post", "ui"}));
+}
+
+TEST_F(ConfigurationTest, HeldSnapshotDoesNotChange)
+{
+    config->SetInteger("val", 1);
+
+    const auto key = config->Key<int32_t>("val");
+    const auto before = config->GetSnapshot();
+
+    config->SetInteger("val", 2);
+
+    const auto after = config->GetSnapshot();
+
+    EXPECT_EQ(before->Get(key), 1);
+    EXPECT_EQ(after->Get(key), 2);
+    EXPECT_GT(after->GetGeneration(), before->GetGeneration());
+}
+
+TEST_F(ConfigurationTest, SnapshotKeepsFirstOfDuplicateElements)
+{
+    auto document = std::make_shared<pugi::xml_document>();
+    auto section = document->append_child("test_ns").append_child("TestClass");
+    section.append_child("mode").text().set("first");
+    section.append_child("mode").text().set("second");
+
+    Configuration duplicated("test_ns", "TestClass", document);
+
+    EXPECT_EQ(*duplicated.GetString("mode"), "first");
+    EXPECT_EQ(duplicated.GetSnapshot()->GetValueCount(), 1u);
+}
+
+TEST_F(ConfigurationTest, ReloadKeepsKeysValid)
+{
+    auto tempPath = std::filesystem::temp_directory_path() / "test_config_keys.xml";
+    auto fileDoc = std::make_shared<pugi::xml_document>();
+    fileDoc->append_child("test_ns").append_child("TestClass");
+
+    Configuration fileConfig("test_ns", "TestClass", fileDoc, tempPath);
+    const auto key = fileConfig.Key<int32_t>("width");
+
+    fileConfig.SetInteger("width", 1280);
+    fileConfig.Save();
+    fileConfig.SetInteger("width", 640);
+
+    fileConfig.Reload();
+    EXPECT_EQ(fileConfig.Get(key), 1280);
+
+    std::filesystem::remove(tempPath);
+}
+
+TEST(ConfigurationModuleTest, ReloadFilePublishesEverySectionOrNone)
+{
+    const auto tempPath = std::filesystem::temp_directory_path() / "test_config_reload.xml";
+    WriteFile(tempPath, "<test_ns><ReloadSectionA><value>1</value></ReloadSectionA><ReloadSectionB><value>2</value></ReloadSectionB></test_ns>");
+
+    ConfigurationModule module(std::filesystem::temp_directory_path());
+    const auto first = module.ForPath<ReloadSectionA>("test_ns", tempPath);
+    const auto second = module.ForPath<ReloadSectionB>("test_ns", tempPath);
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+
+    // A file that no longer parses leaves every section on its previous values
+    WriteFile(tempPath, "<test_ns><ReloadSectionA><value>3</value>");
+    EXPECT_EQ(module.ReloadFile(tempPath), 0u);
+    EXPECT_EQ((*first)->GetInteger("value"), 1);
+    EXPECT_EQ((*second)->GetInteger("value"), 2);
+
+    WriteFile(tempPath, "<test_ns><ReloadSectionA><value>3</value></ReloadSectionA><ReloadSectionB><value>4</value></ReloadSectionB></test_ns>");
+    EXPECT_EQ(module.ReloadFile(tempPath), 2u);
+    EXPECT_EQ((*first)->GetInteger("value"), 3);
+    EXPECT_EQ((*second)->GetInteger("value"), 4);
+
+    std::filesystem::remove(tempPath);
+}
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/Render/Backend/DrawList.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace RenderStar::Client::Render;
+
+namespace
+{
+    struct RecordedDraw
+    {
+        const void* pipeline = nullptr;
+        const void* binding = nullptr;
+        const void* geometry = nullptr;
+        uint32_t id = 0;
+    };
+
+    DrawStateTracker Replay(std::span<const RecordedDraw> draws, std::span<const uint32_t> order)
+    {
+        DrawStateTracker state;
+
+        for (const uint32_t index : order)
+        {
+            state.SetPipeline(draws[index].pipeline);
+            state.SetBinding(draws[index].binding, 0);
+            state.SetGeometry(draws[index].geometry);
+        }
+
+        return state;
+    }
+
+    std::vector<uint32_t> SubmissionOrder(const size_t count)
+    {
+        std::vector<uint32_t> order(count);
+
+        for (uint32_t i = 0; i < count; ++i)
+            order[i] = i;
+
+        return order;
+    }
+}
+
+TEST(DrawListTest, KeyFieldsOrderPassThenPipelineThenMaterialThenDepth)
+{
+    EXPECT_LT(DrawSortKey::Make(0, 9, 9, 1.0f), DrawSortKey::Make(1, 0, 0, 0.0f));
+    EXPECT_LT(DrawSortKey::Make(1, 0, 9, 1.0f), DrawSortKey::Make(1, 1, 0, 0.0f));
+    EXPECT_LT(DrawSortKey::Make(1, 1, 0, 1.0f), DrawSortKey::Make(1, 1, 1, 0.0f));
+    EXPECT_LT(DrawSortKey::Make(1, 1, 1, 0.25f), DrawSortKey::Make(1, 1, 1, 0.5f));
+
+    EXPECT_EQ(DrawSortKey::Make(0, 0, 0, -3.0f), DrawSortKey::Make(0, 0, 0, 0.0f));
+    EXPECT_EQ(DrawSortKey::Make(0, 0, 0, 7.0f), DrawSortKey::Make(0, 0, 0, 1.0f));
+    EXPECT_EQ(DrawSortKey::GetPass(DrawSortKey::MakeOrdered(5, 123)), 5u);
+}
+
+TEST(DrawListTest, RadixSortIsStableAndMatchesStableSort)
+{
+    std::mt19937_64 random(7);
+    std::vector<uint64_t> keys(5000);
+
+    for (auto& key : keys)
+        key = DrawSortKey::Make(static_cast<uint32_t>(random() % 3), static_cast<uint32_t>(random() % 5), static_cast<uint32_t>(random() % 40), 0.5f);
+
+    std::vector<uint32_t> order;
+    std::vector<uint32_t> scratch;
+    RadixSortByKey(keys, order, scratch);
+
+    std::vector<uint32_t> expected = SubmissionOrder(keys.size());
+    std::ranges::stable_sort(expected, {}, [&keys](const uint32_t index) { return keys[index]; });
+
+    EXPECT_EQ(order, expected);
+}
+
+TEST(DrawListTest, OrderedCommandsFenceSortedRuns)
+{
+    int pipelineA = 0;
+    int pipelineB = 0;
+
+    DrawList<uint32_t> list;
+    list.AddOrdered(0);
+    list.AddSorted(1, &pipelineB, 0, 0.0f);
+    list.AddSorted(2, &pipelineA, 0, 0.0f);
+    list.AddSorted(3, &pipelineB, 0, 0.0f);
+    list.AddOrdered(4);
+    list.AddOrdered(5);
+    list.AddSorted(6, &pipelineA, 0, 0.0f);
+    list.AddSorted(7, &pipelineB, 0, 0.0f);
+    list.AddSorted(8, &pipelineA, 0, 0.0f);
+
+    const auto commands = list.GetCommands();
+    std::vector<uint32_t> executed;
+
+    for (const uint32_t index : list.Sort())
+        executed.push_back(commands[index]);
+
+    // Pipeline ids follow first use in the frame, so B (first seen) sorts before A
+    EXPECT_EQ(executed, (std::vector<uint32_t>{0, 1, 3, 2, 4, 5, 7, 6, 8}));
+
+    list.Clear();
+    EXPECT_TRUE(list.IsEmpty());
+    EXPECT_TRUE(list.Sort().empty());
+}
+
+TEST(DrawListTest, SortingAMapFrameRemovesRedundantPipelineBinds)
+{
+    constexpr uint32_t MATERIAL_COUNT = 12;
+    constexpr uint32_t CLUSTERS_PER_GROUP = 8;
+    constexpr uint32_t VARIANT_COUNT = 3;
+
+    // Stand-ins for the objects the map renderer submits; only their addresses matter
+    std::vector<int> variants(VARIANT_COUNT + 2);
+    std::vector<int> groupMeshes(MATERIAL_COUNT + 2);
+    std::vector<int> uniformSlots(MATERIAL_COUNT * CLUSTERS_PER_GROUP + 2);
+
+    DrawList<RecordedDraw> list;
+    uint32_t nextSlot = 0;
+
+    const auto ordered = [&](const uint32_t pipeline, const uint32_t mesh)
+    {
+        list.AddOrdered({ &variants[pipeline], &uniformSlots[nextSlot], &groupMeshes[mesh], nextSlot });
+        ++nextSlot;
+    };
+
+    // Skybox, then one cluster draw per visible cluster in group order, then the player capsule,
+    // the way ClientLifecycleModule drives the affectors each frame
+    ordered(VARIANT_COUNT, MATERIAL_COUNT);
+
+    for (uint32_t material = 0; material < MATERIAL_COUNT; ++material)
+    {
+        const void* pipeline = &variants[material % VARIANT_COUNT];
+
+        for (uint32_t cluster = 0; cluster < CLUSTERS_PER_GROUP; ++cluster)
+        {
+            const float depth = static_cast<float>((cluster * 5 + material) % CLUSTERS_PER_GROUP) / CLUSTERS_PER_GROUP;
+
+            list.AddSorted({ pipeline, &uniformSlots[nextSlot], &groupMeshes[material], nextSlot }, pipeline, material, depth);
+            ++nextSlot;
+        }
+    }
+
+    ordered(VARIANT_COUNT + 1, MATERIAL_COUNT + 1);
+
+    const auto draws = list.GetCommands();
+    const DrawStateTracker before = Replay(draws, SubmissionOrder(draws.size()));
+    const auto sortedOrder = list.Sort();
+    const DrawStateTracker after = Replay(draws, sortedOrder);
+
+    EXPECT_EQ(before.GetPipelineChanges(), MATERIAL_COUNT + 2);
+    EXPECT_EQ(after.GetPipelineChanges(), VARIANT_COUNT + 2);
+    EXPECT_EQ(after.GetGeometryChanges(), before.GetGeometryChanges());
+    EXPECT_EQ(after.GetBindingChanges(), draws.size());
+
+    // The ordered skybox and player draws stay first and last
+    EXPECT_EQ(draws[sortedOrder.front()].id, 0u);
+    EXPECT_EQ(draws[sortedOrder.back()].id, nextSlot - 1);
+
+    // Within one material the clusters come out front to back
+    for (size_t i = 2; i + 1 < sortedOrder.size(); ++i)
+    {
+        if (draws[sortedOrder[i]].geometry != draws[sortedOrder[i - 1]].geometry)
+            continue;
+
+        EXPECT_LE(list.GetKeys()[sortedOrder[i - 1]], list.GetKeys()[sortedOrder[i]]);
+    }
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/Render/Culling/FrustumCuller.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+
+using namespace RenderStar::Client::Render::Culling;
+
+namespace
+{
+    BoundingBox MakeBox(const glm::vec3& center, const float halfSize)
+    {
+        return { center - glm::vec3(halfSize), center + glm::vec3(halfSize) };
+    }
+
+    // Camera at the origin looking down -Z with a 90 degree square frustum from 1 to 100
+    Frustum MakeCameraFrustum()
+    {
+        const glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, 1.0f, 100.0f);
+        const glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+        return Frustum::FromViewProjection(projection * view);
+    }
+}
+
+TEST(FrustumCullerTest, PerspectivePlanesClassifyBoxes)
+{
+    const Frustum frustum = MakeCameraFrustum();
+
+    EXPECT_TRUE(frustum.Intersects(MakeBox({0.0f, 0.0f, -10.0f}, 1.0f)));
+    EXPECT_TRUE(frustum.Intersects(MakeBox({0.0f, 0.0f, -100.5f}, 1.0f)));
+    EXPECT_TRUE(frustum.Intersects(MakeBox({11.5f, 0.0f, -10.0f}, 2.0f)));
+    EXPECT_FALSE(frustum.Intersects(MakeBox({0.0f, 0.0f, 10.0f}, 1.0f)));
+    EXPECT_FALSE(frustum.Intersects(MakeBox({0.0f, 0.0f, -0.25f}, 0.5f)));
+    EXPECT_FALSE(frustum.Intersects(MakeBox({0.0f, 0.0f, -110.0f}, 1.0f)));
+    EXPECT_FALSE(frustum.Intersects(MakeBox({13.0f, 0.0f, -10.0f}, 1.0f)));
+    EXPECT_FALSE(frustum.Intersects(MakeBox({0.0f, -13.0f, -10.0f}, 1.0f)));
+}
+
+TEST(FrustumCullerTest, OrthographicLightFrustumIsABox)
+{
+    const glm::mat4 projection = glm::ortho(-10.0f, 10.0f, -10.0f, 10.0f, 0.0f, 50.0f);
+    const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 25.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f));
+    const Frustum frustum = Frustum::FromViewProjection(projection * view);
+
+    EXPECT_TRUE(frustum.Intersects(MakeBox({0.0f, 0.0f, 0.0f}, 1.0f)));
+    EXPECT_TRUE(frustum.Intersects(MakeBox({9.5f, -24.0f, 9.5f}, 1.0f)));
+    EXPECT_FALSE(frustum.Intersects(MakeBox({12.0f, 0.0f, 0.0f}, 1.0f)));
+    EXPECT_FALSE(frustum.Intersects(MakeBox({0.0f, 27.0f, 0.0f}, 1.0f)));
+    EXPECT_FALSE(frustum.Intersects(MakeBox({0.0f, -27.0f, 0.0f}, 1.0f)));
+
+    EXPECT_TRUE(frustum.Intersects(BoundingSphere{{10.5f, 0.0f, 0.0f}, 1.0f}));
+    EXPECT_FALSE(frustum.Intersects(BoundingSphere{{11.5f, 0.0f, 0.0f}, 1.0f}));
+}
+
+TEST(FrustumCullerTest, BatchedCullMatchesScalarTest)
+{
+    const Frustum frustum = MakeCameraFrustum();
+
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> position(-120.0f, 120.0f);
+    std::uniform_real_distribution<float> size(0.1f, 5.0f);
+
+    FrustumCuller culler;
+    std::vector<uint32_t> expected;
+
+    // Not a multiple of the batch size, so the padded tail lanes are exercised
+    for (uint32_t i = 0; i < 1003; ++i)
+    {
+        const BoundingBox box = MakeBox({position(random), position(random), position(random)}, size(random));
+
+        EXPECT_EQ(culler.Add(box), i);
+
+        if (frustum.Intersects(box))
+            expected.push_back(i);
+    }
+
+    std::vector<uint32_t> visible;
+    culler.Cull(frustum, visible);
+
+    EXPECT_FALSE(expected.empty());
+    EXPECT_LT(expected.size(), culler.GetCount());
+    EXPECT_EQ(visible, expected);
+}
+
+TEST(FrustumCullerTest, SetMovesBoxAndClearEmpties)
+{
+    const Frustum frustum = MakeCameraFrustum();
+
+    FrustumCuller culler;
+    culler.Add(MakeBox({0.0f, 0.0f, -10.0f}, 1.0f));
+    culler.Add(MakeBox({0.0f, 0.0f, 10.0f}, 1.0f));
+
+    std::vector<uint32_t> visible;
+    culler.Cull(frustum, visible);
+    EXPECT_EQ(visible, (std::vector<uint32_t>{0}));
+
+    culler.Set(0, MakeBox({0.0f, 50.0f, 10.0f}, 1.0f));
+    culler.Set(1, MakeBox({0.0f, 0.0f, -50.0f}, 1.0f));
+    culler.Cull(frustum, visible);
+    EXPECT_EQ(visible, (std::vector<uint32_t>{1}));
+
+    culler.Clear();
+    culler.Cull(frustum, visible);
+    EXPECT_EQ(culler.GetCount(), 0u);
+    EXPECT_TRUE(visible.empty());
+}
+
+TEST(FrustumCullerTest, TransformedBoxEnclosesRotatedCorners)
+{
+    const BoundingBox box{{-1.0f, -2.0f, -3.0f}, {1.0f, 2.0f, 3.0f}};
+    const glm::mat4 matrix = glm::scale(glm::translate(glm::mat4(1.0f), {5.0f, 0.0f, 0.0f}), glm::vec3(0.1f));
+    const BoundingBox transformed = box.Transformed(matrix);
+
+    EXPECT_NEAR(transformed.min.x, 4.9f, 1e-5f);
+    EXPECT_NEAR(transformed.max.z, 0.3f, 1e-5f);
+
+    glm::mat4 swapXZ(0.0f);
+    swapXZ[0] = {0.0f, 0.0f, 1.0f, 0.0f};
+    swapXZ[1] = {0.0f, 1.0f, 0.0f, 0.0f};
+    swapXZ[2] = {1.0f, 0.0f, 0.0f, 0.0f};
+    swapXZ[3] = {0.0f, 0.0f, 0.0f, 1.0f};
+
+    const BoundingBox swapped = box.Transformed(swapXZ);
+
+    EXPECT_FLOAT_EQ(swapped.max.x, 3.0f);
+    EXPECT_FLOAT_EQ(swapped.max.z, 1.0f);
+    EXPECT_FLOAT_EQ(BoundingSphere::FromBox(box).radius, std::sqrt(14.0f));
+    EXPECT_FALSE(BoundingBox{}.IsValid());
+}
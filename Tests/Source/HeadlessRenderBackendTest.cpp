@@ -0,0 +1,364 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/Render/Command/IRenderCommandBuffer.hpp"
+#include "RenderStar/Client/Render/Command/IRenderCommandQueue.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessPlatformBackend.hpp"
+#include "RenderStar/Client/Render/Headless/HeadlessRenderBackend.hpp"
+#include "RenderStar/Client/Render/Platform/FullscreenStage.hpp"
+#include "RenderStar/Client/Render/Platform/StageExecutionContext.hpp"
+#include "RenderStar/Client/Render/Resource/IBufferManager.hpp"
+#include "RenderStar/Client/Render/Resource/IShaderManager.hpp"
+#include "RenderStar/Client/Render/Resource/ITextureManager.hpp"
+#include "RenderStar/Client/Render/Resource/IUniformManager.hpp"
+#include <array>
+
+using namespace RenderStar::Client::Render;
+using namespace RenderStar::Client::Render::Headless;
+using namespace RenderStar::Client::Render::Platform;
+
+namespace
+{
+    std::unique_ptr<IShaderProgram> MakeShader(HeadlessRenderBackend& backend)
+    {
+        return backend.GetShaderManager()->CreateFromSource({ "void main() {}", "void main() {}", "" });
+    }
+
+    // A quad: four position-only vertices and six 32-bit indices
+    std::unique_ptr<IMesh> MakeQuad(HeadlessRenderBackend& backend)
+    {
+        constexpr std::array<float, 12> vertices = { 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0 };
+        constexpr std::array<uint32_t, 6> indices = { 0, 1, 2, 2, 3, 0 };
+
+        auto mesh = backend.GetBufferManager()->CreateMesh(VertexLayout::PositionOnly());
+        mesh->SetVertexData(vertices.data(), sizeof(vertices));
+        mesh->SetIndexData(indices.data(), sizeof(indices), IndexType::UINT32);
+        return mesh;
+    }
+
+    size_t CountCommands(const HeadlessFrame& frame, const HeadlessCommandType type)
+    {
+        size_t count = 0;
+
+        for (const auto& command : frame.commands)
+        {
+            if (command.type == type)
+                ++count;
+        }
+
+        return count;
+    }
+
+    class HeadlessRenderBackendTest : public ::testing::Test
+    {
+    protected:
+
+        void SetUp() override
+        {
+            backend.Initialize(nullptr, 640, 480);
+        }
+
+        HeadlessRenderBackend backend;
+    };
+}
+
+TEST_F(HeadlessRenderBackendTest, InitializesWithoutWindow)
+{
+    EXPECT_TRUE(backend.IsInitialized());
+    EXPECT_EQ(backend.GetType(), RenderBackend::HEADLESS);
+    EXPECT_EQ(backend.GetWidth(), 640u);
+    EXPECT_EQ(backend.GetHeight(), 480u);
+    EXPECT_NE(backend.GetTextureManager()->GetDefaultTexture(), nullptr);
+}
+
+TEST_F(HeadlessRenderBackendTest, CountsDrawsAndRedundantStateOnce)
+{
+    auto shader = MakeShader(backend);
+    auto binding = backend.GetUniformManager()->CreateBindingForShader(shader.get());
+    auto mesh = MakeQuad(backend);
+
+    backend.BeginFrame();
+
+    for (int i = 0; i < 3; ++i)
+        backend.SubmitDrawCommand(shader.get(), binding.get(), 0, mesh.get());
+
+    backend.ExecuteDrawCommands();
+    backend.EndFrame();
+
+    const auto& stats = backend.GetFrameLog().GetCompletedFrames().back().statistics;
+    EXPECT_EQ(stats.drawCalls, 3u);
+    EXPECT_EQ(stats.elementsDrawn, 18u);
+    EXPECT_EQ(stats.pipelineChanges, 1u);
+    EXPECT_EQ(stats.bindingChanges, 1u);
+    EXPECT_EQ(stats.geometryChanges, 1u);
+    EXPECT_GE(stats.cpuMilliseconds, 0.0);
+}
+
+TEST_F(HeadlessRenderBackendTest, SortedDrawsGroupByPipeline)
+{
+    auto first = MakeShader(backend);
+    auto second = MakeShader(backend);
+    auto mesh = MakeQuad(backend);
+
+    backend.BeginFrame();
+
+    for (int i = 0; i < 4; ++i)
+    {
+        SortedDrawSubmission submission;
+        submission.shader = i % 2 == 0 ? first.get() : second.get();
+        submission.mesh = mesh.get();
+        backend.SubmitSortedDrawCommand(submission);
+    }
+
+    backend.ExecuteDrawCommands();
+    backend.EndFrame();
+
+    const auto& frame = backend.GetFrameLog().GetCompletedFrames().back();
+    EXPECT_EQ(frame.statistics.drawCalls, 4u);
+    EXPECT_EQ(frame.statistics.pipelineChanges, 2u);
+    ASSERT_EQ(frame.commands.size(), 4u);
+    EXPECT_EQ(frame.commands[0].shader, frame.commands[1].shader);
+    EXPECT_EQ(frame.commands[2].shader, frame.commands[3].shader);
+}
+
+TEST_F(HeadlessRenderBackendTest, DrawRangeRecordsSubmittedRange)
+{
+    auto shader = MakeShader(backend);
+    auto mesh = MakeQuad(backend);
+
+    backend.BeginFrame();
+    backend.SubmitDrawRangeCommand(shader.get(), nullptr, 0, mesh.get(), 3, 3);
+    backend.ExecuteDrawCommands();
+    backend.EndFrame();
+
+    const auto& command = backend.GetFrameLog().GetCompletedFrames().back().commands.at(0);
+    EXPECT_EQ(command.type, HeadlessCommandType::DRAW);
+    EXPECT_EQ(command.firstIndex, 3u);
+    EXPECT_EQ(command.elementCount, 3u);
+    EXPECT_EQ(command.mesh, GetHeadlessResourceId(mesh.get()));
+}
+
+TEST_F(HeadlessRenderBackendTest, IndirectDrawReadsArgumentsBack)
+{
+    auto shader = MakeShader(backend);
+    auto mesh = MakeQuad(backend);
+
+    std::array<DrawIndexedIndirectCommand, 3> arguments = {};
+    arguments[0] = { 6, 1, 0, 0, 0 };
+    arguments[1] = { 3, 2, 3, 0, 0 };
+    arguments[2] = { 3, 1, 0, 0, 0 };
+    auto argumentBuffer = backend.GetBufferManager()->CreateBuffer(BufferType::INDIRECT, BufferUsage::DYNAMIC, sizeof(arguments), arguments.data());
+
+    backend.BeginFrame();
+
+    IndirectDrawSubmission submission;
+    submission.shader = shader.get();
+    submission.mesh = mesh.get();
+    submission.argumentBuffer = argumentBuffer.get();
+    submission.firstCommand = 1;
+    submission.commandCount = 2;
+    backend.SubmitIndirectDrawCommand(submission);
+
+    // Reading past the end of the buffer only counts what is there
+    submission.firstCommand = 2;
+    submission.commandCount = 4;
+    backend.SubmitIndirectDrawCommand(submission);
+
+    backend.ExecuteDrawCommands();
+    backend.EndFrame();
+
+    const auto& frame = backend.GetFrameLog().GetCompletedFrames().back();
+    ASSERT_EQ(frame.commands.size(), 2u);
+    EXPECT_EQ(frame.commands[0].type, HeadlessCommandType::DRAW_INDIRECT);
+    EXPECT_EQ(frame.commands[0].count, 2u);
+    EXPECT_EQ(frame.commands[0].elementCount, 9u);
+    EXPECT_EQ(frame.commands[1].elementCount, 3u);
+    EXPECT_EQ(frame.statistics.drawCalls, 2u);
+    EXPECT_EQ(frame.statistics.indirectCommands, 6u);
+    EXPECT_EQ(frame.statistics.elementsDrawn, 12u);
+    EXPECT_EQ(frame.statistics.geometryChanges, 1u);
+}
+
+TEST_F(HeadlessRenderBackendTest, NullMeshIsFullscreenTriangle)
+{
+    auto shader = MakeShader(backend);
+
+    backend.BeginFrame();
+    backend.SubmitDrawCommand(shader.get(), nullptr, 0, nullptr);
+    backend.ExecuteDrawCommands();
+    backend.EndFrame();
+
+    const auto& frame = backend.GetFrameLog().GetCompletedFrames().back();
+    ASSERT_EQ(frame.commands.size(), 1u);
+    EXPECT_EQ(frame.commands[0].type, HeadlessCommandType::DRAW_FULLSCREEN);
+    EXPECT_EQ(frame.statistics.elementsDrawn, 3u);
+}
+
+TEST_F(HeadlessRenderBackendTest, UploadsBetweenFramesChargeTheNextFrame)
+{
+    auto mesh = MakeQuad(backend);
+
+    backend.BeginFrame();
+    backend.EndFrame();
+
+    backend.GetUniformManager()->CreateUniformBuffer("scene", UniformBinding{ 0, "scene", UniformType::UNIFORM_BUFFER, 64, ShaderStage::VERTEX });
+
+    backend.BeginFrame();
+    constexpr std::array<float, 16> matrix = {};
+    backend.GetUniformManager()->UpdateUniformBuffer("scene", matrix.data(), sizeof(matrix));
+    backend.EndFrame();
+
+    const auto& frames = backend.GetFrameLog().GetCompletedFrames();
+    ASSERT_EQ(frames.size(), 2u);
+    // The first frame also carries the 1x1 default texture created at initialization
+    EXPECT_EQ(frames[0].statistics.bufferUploads, 2u);
+    EXPECT_EQ(frames[0].statistics.textureUploads, 1u);
+    EXPECT_EQ(frames[0].statistics.bytesUploaded, 12 * sizeof(float) + 6 * sizeof(uint32_t) + 4);
+    EXPECT_EQ(frames[1].statistics.bufferUploads, 1u);
+    EXPECT_EQ(frames[1].statistics.bytesUploaded, sizeof(matrix));
+}
+
+TEST_F(HeadlessRenderBackendTest, OutOfRangeSubDataIsIgnored)
+{
+    auto buffer = backend.GetBufferManager()->CreateUniformBuffer(16);
+    constexpr std::array<uint8_t, 32> bytes = {};
+
+    buffer->SetSubData(bytes.data(), bytes.size(), 0);
+    buffer->SetSubData(bytes.data(), 8, 12);
+
+    EXPECT_EQ(backend.GetFrameLog().GetCurrentFrame().statistics.bufferUploads, 0u);
+}
+
+TEST_F(HeadlessRenderBackendTest, TextureUploadsCountBytes)
+{
+    TextureDescription description;
+    description.width = 4;
+    description.height = 4;
+
+    std::array<uint8_t, 64> pixels = {};
+    auto texture = backend.GetTextureManager()->CreateFromMemory(description, pixels.data());
+
+    backend.BeginFrame();
+    constexpr std::array<uint8_t, 16> region = { 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255 };
+    EXPECT_TRUE(backend.GetTextureManager()->UpdateRegion(*texture, 1, 1, 2, 2, region.data()));
+    EXPECT_FALSE(backend.GetTextureManager()->UpdateRegion(*texture, 3, 3, 2, 2, region.data()));
+    backend.EndFrame();
+
+    const auto& stats = backend.GetFrameLog().GetCompletedFrames().back().statistics;
+    EXPECT_EQ(stats.textureUploads, 3u);
+    EXPECT_EQ(stats.bytesUploaded, 4u + 64u + 16u);
+
+    const auto& stored = static_cast<HeadlessTextureHandle*>(texture.get())->GetPixels();
+    EXPECT_EQ(stored[(1 * 4 + 1) * 4], 255);
+    EXPECT_EQ(stored[0], 0);
+}
+
+TEST_F(HeadlessRenderBackendTest, ScissorsKeepSubmissionOrder)
+{
+    auto shader = MakeShader(backend);
+    auto mesh = MakeQuad(backend);
+
+    backend.BeginFrame();
+    backend.BeginOverlayPass();
+    backend.SubmitSetScissor(10, 20, 30, 40);
+    backend.SubmitDrawCommand(shader.get(), nullptr, 0, mesh.get());
+    backend.SubmitClearScissor();
+    backend.ExecuteDrawCommands();
+    backend.EndOverlayPass();
+    backend.EndFrame();
+
+    const auto& frame = backend.GetFrameLog().GetCompletedFrames().back();
+    ASSERT_EQ(frame.commands.size(), 5u);
+    EXPECT_EQ(frame.commands[0].type, HeadlessCommandType::BEGIN_OVERLAY);
+    EXPECT_EQ(frame.commands[1].type, HeadlessCommandType::SET_SCISSOR);
+    EXPECT_EQ(frame.commands[1].width, 30u);
+    EXPECT_EQ(frame.commands[2].type, HeadlessCommandType::DRAW);
+    EXPECT_EQ(frame.commands[3].type, HeadlessCommandType::CLEAR_SCISSOR);
+    EXPECT_EQ(frame.commands[4].type, HeadlessCommandType::END_OVERLAY);
+    EXPECT_EQ(frame.statistics.scissorChanges, 2u);
+}
+
+TEST_F(HeadlessRenderBackendTest, CommandQueueSubmitAppendsToFrame)
+{
+    auto shader = MakeShader(backend);
+    auto mesh = MakeQuad(backend);
+    IRenderCommandQueue* queue = backend.GetCommandQueue();
+
+    backend.BeginFrame();
+    IRenderCommandBuffer* buffer = queue->AcquireCommandBuffer();
+    buffer->Begin();
+    buffer->BindPipeline(shader.get());
+    buffer->DrawMesh(mesh.get());
+    buffer->Draw(3, 0);
+    buffer->End();
+    queue->Submit(buffer);
+    backend.EndFrame();
+
+    const auto& frame = backend.GetFrameLog().GetCompletedFrames().back();
+    EXPECT_EQ(frame.statistics.drawCalls, 2u);
+    EXPECT_EQ(frame.statistics.elementsDrawn, 9u);
+    EXPECT_EQ(frame.statistics.pipelineChanges, 1u);
+    EXPECT_EQ(queue->AcquireCommandBuffer(), buffer);
+}
+
+TEST(HeadlessFrameLogTest, RetainsRecentFramesAndSumsAll)
+{
+    HeadlessFrameLog log(2);
+
+    for (uint32_t frame = 0; frame < 5; ++frame)
+    {
+        log.BeginFrame();
+        log.RecordBufferUpload(10);
+        log.EndFrame();
+    }
+
+    EXPECT_EQ(log.GetCompletedFrameCount(), 5u);
+    ASSERT_EQ(log.GetCompletedFrames().size(), 2u);
+    EXPECT_EQ(log.GetCompletedFrames().front().index, 3u);
+    EXPECT_EQ(log.GetCompletedFrames().back().index, 4u);
+    EXPECT_EQ(log.GetTotals().bufferUploads, 5u);
+    EXPECT_EQ(log.GetTotals().bytesUploaded, 50u);
+    EXPECT_TRUE(log.GetCurrentFrame().commands.empty());
+}
+
+TEST_F(HeadlessRenderBackendTest, FullscreenStageRecordsTargetPass)
+{
+    HeadlessPlatformBackend platform(&backend);
+
+    RenderTargetDescription description;
+    description.name = "bloom";
+    description.scale = 0.5f;
+    auto bloom = platform.CreateRenderTarget(description);
+    auto scene = platform.CreateRenderTarget({ .name = "scene", .hasDepth = true });
+
+    EXPECT_EQ(bloom->GetWidth(), 320u);
+    EXPECT_EQ(scene->GetType(), RenderTargetType::COLOR_DEPTH);
+    EXPECT_NE(scene->GetDepthAttachment(), nullptr);
+
+    std::unordered_map<std::string, IRenderTarget*> targets = { { "bloom", bloom.get() }, { "scene", scene.get() } };
+
+    FullscreenStage stage("bloom_blur", "void main() {}", "void main() {}", { "scene" }, "bloom");
+    stage.Initialize(&platform, targets);
+    ASSERT_TRUE(stage.IsEnabled());
+
+    const std::array barriers = {
+        RenderGraphBarrier{ 0, RenderGraphAccess::WRITE, RenderGraphAccess::READ }
+    };
+
+    backend.BeginFrame();
+    platform.InsertBarriers(barriers);
+    StageExecutionContext context(&platform, targets, backend.GetCurrentFrame());
+    stage.Execute(context);
+    backend.EndFrame();
+
+    const auto& frame = backend.GetFrameLog().GetCompletedFrames().back();
+    ASSERT_EQ(frame.commands.size(), 5u);
+    EXPECT_EQ(frame.commands[0].type, HeadlessCommandType::BARRIER);
+    EXPECT_EQ(frame.commands[1].type, HeadlessCommandType::BIND_INPUTS);
+    EXPECT_EQ(frame.commands[1].count, 1u);
+    EXPECT_EQ(frame.commands[2].type, HeadlessCommandType::BEGIN_TARGET);
+    EXPECT_EQ(frame.commands[2].target, "bloom");
+    EXPECT_TRUE(frame.commands[2].clear);
+    EXPECT_EQ(CountCommands(frame, HeadlessCommandType::DRAW_FULLSCREEN), 1u);
+    EXPECT_EQ(frame.commands[4].type, HeadlessCommandType::END_TARGET);
+    EXPECT_EQ(frame.statistics.barriers, 1u);
+    EXPECT_EQ(frame.statistics.renderTargetChanges, 1u);
+}
@@ -0,0 +1,241 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/Render/Backend/IndirectDraw.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using namespace RenderStar::Client::Render;
+
+namespace
+{
+    struct ReferenceDraw
+    {
+        uint32_t batch = 0;
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+    };
+
+    // Expands every command back into per-index coverage, so merged and unmerged argument lists compare equal
+    std::vector<uint32_t> CoveredIndices(std::span<const DrawIndexedIndirectCommand> commands)
+    {
+        std::vector<uint32_t> covered;
+
+        for (const auto& command : commands)
+        {
+            for (uint32_t index = 0; index < command.indexCount; ++index)
+                covered.push_back(command.firstIndex + index);
+        }
+
+        std::ranges::sort(covered);
+        return covered;
+    }
+
+    std::vector<uint32_t> CoveredIndices(std::span<const ReferenceDraw> draws, std::span<const uint32_t> visible, const uint32_t batch)
+    {
+        std::vector<uint32_t> covered;
+
+        for (const uint32_t id : visible)
+        {
+            if (draws[id].batch != batch)
+                continue;
+
+            for (uint32_t index = 0; index < draws[id].indexCount; ++index)
+                covered.push_back(draws[id].firstIndex + index);
+        }
+
+        std::ranges::sort(covered);
+        return covered;
+    }
+}
+
+TEST(IndirectDrawTest, CommandMatchesVulkanAndOpenGLLayout)
+{
+    EXPECT_EQ(sizeof(DrawIndexedIndirectCommand), 5 * sizeof(uint32_t));
+    EXPECT_EQ(offsetof(DrawIndexedIndirectCommand, indexCount), 0u);
+    EXPECT_EQ(offsetof(DrawIndexedIndirectCommand, instanceCount), 4u);
+    EXPECT_EQ(offsetof(DrawIndexedIndirectCommand, firstIndex), 8u);
+    EXPECT_EQ(offsetof(DrawIndexedIndirectCommand, vertexOffset), 12u);
+    EXPECT_EQ(offsetof(DrawIndexedIndirectCommand, firstInstance), 16u);
+}
+
+TEST(IndirectDrawTest, DrawIdsFollowRegistrationOrder)
+{
+    IndirectDrawBuilder builder;
+
+    EXPECT_EQ(builder.AddDraw(2, 0, 3), 0u);
+    EXPECT_EQ(builder.AddDraw(0, 3, 3), 1u);
+    EXPECT_EQ(builder.GetDrawCount(), 2u);
+    EXPECT_EQ(builder.GetBatchCount(), 3u);
+}
+
+TEST(IndirectDrawTest, CompactsVisibleDrawsIntoContiguousBatches)
+{
+    IndirectDrawBuilder builder;
+    builder.AddDraw(1, 0, 6);
+    builder.AddDraw(0, 12, 6);
+    builder.AddDraw(1, 24, 3);
+    builder.AddDraw(0, 30, 9);
+
+    const std::vector<uint32_t> visible = { 0, 1, 2, 3 };
+    builder.Build(visible);
+
+    const auto batches = builder.GetBatches();
+    ASSERT_EQ(batches.size(), 2u);
+    EXPECT_EQ(batches[0].batch, 0u);
+    EXPECT_EQ(batches[0].firstCommand, 0u);
+    EXPECT_EQ(batches[0].commandCount, 2u);
+    EXPECT_EQ(batches[1].batch, 1u);
+    EXPECT_EQ(batches[1].firstCommand, 2u);
+    EXPECT_EQ(batches[1].commandCount, 2u);
+
+    const auto commands = builder.GetCommands();
+    ASSERT_EQ(commands.size(), 4u);
+    EXPECT_EQ(commands[0].firstIndex, 12u);
+    EXPECT_EQ(commands[1].firstIndex, 30u);
+    EXPECT_EQ(commands[2].firstIndex, 0u);
+    EXPECT_EQ(commands[3].firstIndex, 24u);
+
+    for (const auto& command : commands)
+    {
+        EXPECT_EQ(command.instanceCount, 1u);
+        EXPECT_EQ(command.vertexOffset, 0);
+        EXPECT_EQ(command.firstInstance, 0u);
+    }
+}
+
+TEST(IndirectDrawTest, MergesTouchingRangesWithinABatch)
+{
+    IndirectDrawBuilder builder;
+    builder.AddDraw(0, 0, 6);
+    builder.AddDraw(0, 6, 6);
+    builder.AddDraw(0, 12, 6);
+    builder.AddDraw(0, 18, 6);
+
+    const std::vector<uint32_t> allVisible = { 0, 1, 2, 3 };
+    builder.Build(allVisible);
+
+    ASSERT_EQ(builder.GetCommands().size(), 1u);
+    EXPECT_EQ(builder.GetCommands()[0].firstIndex, 0u);
+    EXPECT_EQ(builder.GetCommands()[0].indexCount, 24u);
+
+    // A culled draw in the middle splits the run
+    const std::vector<uint32_t> gap = { 0, 1, 3 };
+    builder.Build(gap);
+
+    ASSERT_EQ(builder.GetCommands().size(), 2u);
+    EXPECT_EQ(builder.GetCommands()[0].indexCount, 12u);
+    EXPECT_EQ(builder.GetCommands()[1].firstIndex, 18u);
+    EXPECT_EQ(builder.GetCommands()[1].indexCount, 6u);
+}
+
+TEST(IndirectDrawTest, NeverMergesAcrossBatchesOrVertexOffsets)
+{
+    IndirectDrawBuilder builder;
+    builder.AddDraw(0, 0, 6);
+    builder.AddDraw(1, 6, 6);
+    builder.AddDraw(1, 12, 6, 100);
+
+    const std::vector<uint32_t> visible = { 0, 1, 2 };
+    builder.Build(visible);
+
+    EXPECT_EQ(builder.GetCommands().size(), 3u);
+    EXPECT_EQ(builder.GetBatches().size(), 2u);
+    EXPECT_EQ(builder.GetCommands()[2].vertexOffset, 100);
+}
+
+TEST(IndirectDrawTest, SkipsEmptyAndUnknownDraws)
+{
+    IndirectDrawBuilder builder;
+    builder.AddDraw(0, 0, 0);
+    builder.AddDraw(1, 0, 3);
+
+    const std::vector<uint32_t> visible = { 0, 1, 7 };
+    builder.Build(visible);
+
+    ASSERT_EQ(builder.GetBatches().size(), 1u);
+    EXPECT_EQ(builder.GetBatches()[0].batch, 1u);
+    EXPECT_EQ(builder.GetCommands().size(), 1u);
+}
+
+TEST(IndirectDrawTest, NothingVisibleBuildsNothing)
+{
+    IndirectDrawBuilder builder;
+    builder.AddDraw(0, 0, 3);
+    builder.Build({});
+
+    EXPECT_TRUE(builder.GetBatches().empty());
+    EXPECT_TRUE(builder.GetCommands().empty());
+}
+
+TEST(IndirectDrawTest, ClearForgetsRegisteredDraws)
+{
+    IndirectDrawBuilder builder;
+    builder.AddDraw(4, 0, 3);
+
+    const std::vector<uint32_t> visible = { 0 };
+    builder.Build(visible);
+    builder.Clear();
+
+    EXPECT_EQ(builder.GetDrawCount(), 0u);
+    EXPECT_EQ(builder.GetBatchCount(), 0u);
+    EXPECT_TRUE(builder.GetCommands().empty());
+    EXPECT_EQ(builder.AddDraw(0, 0, 3), 0u);
+}
+
+TEST(IndirectDrawTest, MatchesPerDrawReferenceOnRandomScenes)
+{
+    std::mt19937 random(1234);
+
+    for (int scene = 0; scene < 50; ++scene)
+    {
+        const uint32_t batchCount = 1 + random() % 6;
+        const uint32_t drawCount = 1 + random() % 200;
+
+        // Clusters are laid out back to back, the way the map merges its groups
+        std::vector<ReferenceDraw> draws;
+        IndirectDrawBuilder builder;
+        uint32_t nextIndex = 0;
+
+        for (uint32_t draw = 0; draw < drawCount; ++draw)
+        {
+            const ReferenceDraw reference{ static_cast<uint32_t>(random() % batchCount), nextIndex, 3 * (1 + static_cast<uint32_t>(random() % 8)) };
+            draws.push_back(reference);
+            builder.AddDraw(reference.batch, reference.firstIndex, reference.indexCount);
+            nextIndex += reference.indexCount;
+        }
+
+        std::vector<uint32_t> visible;
+
+        for (uint32_t draw = 0; draw < drawCount; ++draw)
+        {
+            if (random() % 3 != 0)
+                visible.push_back(draw);
+        }
+
+        builder.Build(visible);
+
+        uint32_t expectedCommand = 0;
+        uint32_t previousBatch = 0;
+
+        for (const auto& batch : builder.GetBatches())
+        {
+            EXPECT_EQ(batch.firstCommand, expectedCommand);
+            EXPECT_GT(batch.commandCount, 0u);
+
+            if (expectedCommand > 0)
+            {
+                EXPECT_GT(batch.batch, previousBatch);
+            }
+
+            const auto commands = builder.GetCommands().subspan(batch.firstCommand, batch.commandCount);
+            EXPECT_EQ(CoveredIndices(commands), CoveredIndices(draws, visible, batch.batch));
+
+            expectedCommand += batch.commandCount;
+            previousBatch = batch.batch;
+        }
+
+        EXPECT_EQ(expectedCommand, builder.GetCommands().size());
+        EXPECT_LE(builder.GetCommands().size(), visible.size());
+    }
+}
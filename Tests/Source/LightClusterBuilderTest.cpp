@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/Render/Framework/LightClusterBuilder.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace RenderStar::Client::Render::Framework;
+
+namespace
+{
+    LightClusterView MakeView()
+    {
+        const glm::mat4 projection = glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, 200.0f);
+        const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 2.0f, 0.0f), glm::vec3(0.0f, 2.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+        LightClusterView clusterView;
+        clusterView.viewProjection = projection * view;
+        clusterView.nearDepth = 0.1f;
+        clusterView.farDepth = 200.0f;
+
+        return clusterView;
+    }
+
+    ClusteredLightGPU MakeLight(const glm::vec3& position, const float range, const float intensity = 1.0f)
+    {
+        ClusteredLightGPU light;
+        light.positionAndRange = glm::vec4(position, range);
+        light.colorAndIntensity = glm::vec4(1.0f, 1.0f, 1.0f, intensity);
+        return light;
+    }
+
+    std::vector<ClusteredLightGPU> MakeRandomLights(const size_t count, const uint32_t seed)
+    {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<float> horizontal(-60.0f, 60.0f);
+        std::uniform_real_distribution<float> height(-5.0f, 15.0f);
+        std::uniform_real_distribution<float> range(0.5f, 5.0f);
+
+        std::vector<ClusteredLightGPU> lights;
+
+        for (size_t i = 0; i < count; ++i)
+            lights.push_back(MakeLight({ horizontal(random), height(random), horizontal(random) - 40.0f }, range(random)));
+
+        return lights;
+    }
+
+    // Mirrors ClusterIndex() in scene_geometry.rssl
+    uint32_t ShaderClusterIndex(const ClusteredLightData& data, const glm::mat4& viewProjection, const glm::vec3& position)
+    {
+        const glm::vec4 clip = viewProjection * glm::vec4(position, 1.0f);
+        const int x = std::clamp(static_cast<int>((clip.x / clip.w * 0.5f + 0.5f) * data.gridX), 0, data.gridX - 1);
+        const int y = std::clamp(static_cast<int>((clip.y / clip.w * 0.5f + 0.5f) * data.gridY), 0, data.gridY - 1);
+        const int z = clip.w <= data.depthParams.x ? 0 : std::clamp(static_cast<int>(std::log(clip.w) * data.depthParams.z + data.depthParams.w), 0, data.gridZ - 1);
+
+        return static_cast<uint32_t>((z * data.gridY + y) * data.gridX + x);
+    }
+}
+
+TEST(LightClusterBuilderTest, ParallelBinningMatchesBruteForce)
+{
+    const LightClusterView view = MakeView();
+    const auto lights = MakeRandomLights(150, 7);
+
+    LightClusterBuilder builder(4);
+    builder.Build(lights, view);
+
+    const auto& data = builder.GetLightData();
+
+    ASSERT_GT(data.lightCount, 32);
+    EXPECT_EQ(builder.GetStatistics().droppedIndices, 0u);
+
+    for (uint32_t z = 0; z < CLUSTER_GRID_Z; ++z)
+    {
+        for (uint32_t y = 0; y < CLUSTER_GRID_Y; ++y)
+        {
+            for (uint32_t x = 0; x < CLUSTER_GRID_X; ++x)
+            {
+                std::vector<uint8_t> expected;
+
+                for (int32_t light = 0; light < data.lightCount; ++light)
+                {
+                    const auto range = LightClusterBuilder::ComputeClusterRange(data.lights[light].positionAndRange, view);
+
+                    if (range && x >= range->minX && x <= range->maxX && y >= range->minY && y <= range->maxY && z >= range->minZ && z <= range->maxZ)
+                        expected.push_back(static_cast<uint8_t>(light));
+                }
+
+                const auto actual = builder.GetClusterLights(LightClusterBuilder::GetClusterIndex(x, y, z));
+
+                ASSERT_EQ(std::vector<uint8_t>(actual.begin(), actual.end()), expected) << x << ", " << y << ", " << z;
+            }
+        }
+    }
+
+    LightClusterBuilder serial(1);
+    serial.Build(lights, view);
+
+    EXPECT_EQ(std::memcmp(serial.GetGridData().cells, builder.GetGridData().cells, ClusterGridData::Size()), 0);
+    EXPECT_EQ(std::memcmp(serial.GetIndexData().indices, builder.GetIndexData().indices, builder.GetStatistics().indexCount), 0);
+}
+
+TEST(LightClusterBuilderTest, EveryLitPointFindsItsLightInItsCluster)
+{
+    const LightClusterView view = MakeView();
+    const auto lights = MakeRandomLights(100, 11);
+
+    LightClusterBuilder builder;
+    builder.Build(lights, view);
+
+    const auto& data = builder.GetLightData();
+    std::mt19937 random(3);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    size_t tested = 0;
+
+    for (int32_t light = 0; light < data.lightCount; ++light)
+    {
+        const glm::vec3 center(data.lights[light].positionAndRange);
+        const float range = data.lights[light].positionAndRange.w;
+
+        for (int sample = 0; sample < 64; ++sample)
+        {
+            const glm::vec3 point = center + glm::vec3(unit(random), unit(random), unit(random)) * (range * 0.577f);
+            const glm::vec4 clip = view.viewProjection * glm::vec4(point, 1.0f);
+
+            // Only fragments that survive clipping are shaded
+            if (clip.w <= view.nearDepth || clip.w >= view.farDepth || std::abs(clip.x) > clip.w || std::abs(clip.y) > clip.w)
+                continue;
+
+            const auto clusterLights = builder.GetClusterLights(ShaderClusterIndex(data, view.viewProjection, point));
+
+            EXPECT_NE(std::ranges::find(clusterLights, static_cast<uint8_t>(light)), clusterLights.end());
+            ++tested;
+        }
+    }
+
+    EXPECT_GT(tested, 1000u);
+}
+
+TEST(LightClusterBuilderTest, KeepsTheMostRelevantLightsAndSkipsHiddenOnes)
+{
+    const LightClusterView view = MakeView();
+    std::vector<ClusteredLightGPU> lights;
+
+    lights.push_back(MakeLight({ 0.0f, 2.0f, 20.0f }, 5.0f, 100.0f));
+
+    for (uint32_t i = 0; i < MAX_CLUSTERED_LIGHTS + 40; ++i)
+        lights.push_back(MakeLight({ static_cast<float>(i % 20) - 10.0f, 2.0f, -10.0f - 0.5f * static_cast<float>(i) }, 2.0f));
+
+    lights.push_back(MakeLight({ 0.0f, 2.0f, -5.0f }, 2.0f, 50.0f));
+
+    LightClusterBuilder builder;
+    builder.Build(lights, view);
+
+    const auto& statistics = builder.GetStatistics();
+    const auto& data = builder.GetLightData();
+
+    EXPECT_EQ(statistics.candidateLights, lights.size());
+    EXPECT_EQ(statistics.visibleLights, lights.size() - 1);
+    EXPECT_EQ(statistics.packedLights, MAX_CLUSTERED_LIGHTS);
+    ASSERT_EQ(data.lightCount, static_cast<int32_t>(MAX_CLUSTERED_LIGHTS));
+
+    // The bright light in front leads, the nearest dim ones follow and the farthest are dropped
+    EXPECT_FLOAT_EQ(data.lights[0].positionAndRange.z, -5.0f);
+    EXPECT_FLOAT_EQ(data.lights[1].positionAndRange.z, -10.0f);
+    EXPECT_FLOAT_EQ(data.lights[MAX_CLUSTERED_LIGHTS - 1].positionAndRange.z, -10.0f - 0.5f * static_cast<float>(MAX_CLUSTERED_LIGHTS - 2));
+}
+
+TEST(LightClusterBuilderTest, IndexBudgetTruncatesLeastRelevantEntries)
+{
+    const LightClusterView view = MakeView();
+    std::vector<ClusteredLightGPU> lights;
+
+    // Lights around the eye cover every cluster of the grid
+    for (uint32_t i = 0; i < 8; ++i)
+        lights.push_back(MakeLight({ 0.0f, 2.0f, 0.0f }, 500.0f, static_cast<float>(8 - i)));
+
+    LightClusterBuilder builder;
+    builder.Build(lights, view);
+
+    const auto& statistics = builder.GetStatistics();
+
+    // Every cluster is cut to the same length, the largest that fits the budget
+    const uint32_t cap = MAX_CLUSTER_LIGHT_INDICES / CLUSTER_COUNT;
+
+    EXPECT_EQ(statistics.indexCount, cap * CLUSTER_COUNT);
+    EXPECT_EQ(statistics.droppedIndices, (8u - cap) * CLUSTER_COUNT);
+
+    // The far end of the grid keeps its most relevant lights, just like the near end
+    for (const uint32_t cluster : { 0u, CLUSTER_COUNT / 2, CLUSTER_COUNT - 1 })
+    {
+        const auto lightsInCluster = builder.GetClusterLights(cluster);
+
+        ASSERT_EQ(lightsInCluster.size(), cap);
+
+        for (uint32_t i = 0; i < cap; ++i)
+            EXPECT_EQ(lightsInCluster[i], i);
+    }
+}
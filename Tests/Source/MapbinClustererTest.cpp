@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Common/Scene/MapbinClusterer.hpp"
+#include <algorithm>
+#include <vector>
+
+using namespace RenderStar::Common::Scene;
+
+namespace
+{
+    // A flat grid of quads along X and Z, two triangles per cell
+    MapbinGroup MakeGrid(const uint32_t cellsX, const uint32_t cellsZ)
+    {
+        MapbinGroup group;
+
+        for (uint32_t z = 0; z <= cellsZ; ++z)
+        {
+            for (uint32_t x = 0; x <= cellsX; ++x)
+            {
+                const float vertex[8] = { static_cast<float>(x), 0.0f, static_cast<float>(z), 0.0f, 1.0f, 0.0f, 0.0f, 0.0f };
+                group.vertexData.insert(group.vertexData.end(), std::begin(vertex), std::end(vertex));
+            }
+        }
+
+        const uint32_t stride = cellsX + 1;
+
+        for (uint32_t z = 0; z < cellsZ; ++z)
+        {
+            for (uint32_t x = 0; x < cellsX; ++x)
+            {
+                const uint32_t corner = z * stride + x;
+                group.indices.insert(group.indices.end(), { corner, corner + stride, corner + 1, corner + 1, corner + stride, corner + stride + 1 });
+            }
+        }
+
+        group.vertexCount = static_cast<int32_t>(group.vertexData.size() / 8);
+        return group;
+    }
+
+    std::vector<std::vector<uint32_t>> SortedTriangles(const std::vector<uint32_t>& indices)
+    {
+        std::vector<std::vector<uint32_t>> triangles;
+
+        for (size_t i = 0; i + 2 < indices.size(); i += 3)
+            triangles.push_back({ indices[i], indices[i + 1], indices[i + 2] });
+
+        std::ranges::sort(triangles);
+        return triangles;
+    }
+}
+
+TEST(MapbinClustererTest, ClustersPartitionEveryTriangleIntoBoundedRanges)
+{
+    const MapbinGroup group = MakeGrid(64, 32);
+    const MapbinClusterSet set = MapbinClusterer::Build(group, 256);
+
+    ASSERT_EQ(set.indices.size(), group.indices.size());
+    EXPECT_EQ(SortedTriangles(set.indices), SortedTriangles(group.indices));
+    EXPECT_EQ(set.clusters.size(), 16u);
+
+    uint32_t expectedFirst = 0;
+
+    for (const auto& cluster : set.clusters)
+    {
+        EXPECT_EQ(cluster.firstIndex, expectedFirst);
+        EXPECT_LE(cluster.indexCount, 256u * 3u);
+        EXPECT_EQ(cluster.indexCount % 3, 0u);
+
+        for (uint32_t i = cluster.firstIndex; i < cluster.firstIndex + cluster.indexCount; ++i)
+        {
+            const float x = group.vertexData[set.indices[i] * 8];
+            const float z = group.vertexData[set.indices[i] * 8 + 2];
+
+            EXPECT_GE(x, cluster.boundsMin.x);
+            EXPECT_LE(x, cluster.boundsMax.x);
+            EXPECT_GE(z, cluster.boundsMin.z);
+            EXPECT_LE(z, cluster.boundsMax.z);
+        }
+
+        expectedFirst += cluster.indexCount;
+    }
+
+    EXPECT_EQ(expectedFirst, set.indices.size());
+}
+
+TEST(MapbinClustererTest, ClustersAreSpatiallyCompact)
+{
+    const MapbinGroup group = MakeGrid(64, 64);
+    const MapbinClusterSet set = MapbinClusterer::Build(group, 512);
+
+    ASSERT_EQ(set.clusters.size(), 16u);
+
+    // 8192 triangles in 16 clusters is one 16x16 block of cells each, give or take a diagonal seam
+    for (const auto& cluster : set.clusters)
+    {
+        const float area = (cluster.boundsMax.x - cluster.boundsMin.x) * (cluster.boundsMax.z - cluster.boundsMin.z);
+        EXPECT_LE(area, 17.0f * 17.0f);
+    }
+}
+
+TEST(MapbinClustererTest, BuildIsDeterministicAndKeepsSmallGroupsWhole)
+{
+    const MapbinGroup group = MakeGrid(40, 40);
+
+    const MapbinClusterSet first = MapbinClusterer::Build(group, 100);
+    const MapbinClusterSet second = MapbinClusterer::Build(group, 100);
+
+    EXPECT_EQ(first.indices, second.indices);
+    ASSERT_EQ(first.clusters.size(), second.clusters.size());
+
+    const MapbinClusterSet whole = MapbinClusterer::Build(group, 10000);
+
+    ASSERT_EQ(whole.clusters.size(), 1u);
+    EXPECT_EQ(whole.indices, group.indices);
+    EXPECT_EQ(whole.clusters[0].boundsMax.x, 40.0f);
+}
+
+TEST(MapbinClustererTest, DropsTrianglesWithOutOfRangeVertices)
+{
+    MapbinGroup group = MakeGrid(2, 1);
+    group.indices.insert(group.indices.end(), { 0, 1, 999 });
+    group.indices.push_back(0);
+
+    const MapbinClusterSet set = MapbinClusterer::Build(group, 64);
+
+    ASSERT_EQ(set.clusters.size(), 1u);
+    EXPECT_EQ(set.clusters[0].indexCount, 12u);
+    EXPECT_TRUE(MapbinClusterer::Build(MapbinGroup{}, 64).clusters.empty());
+}
@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Common/Scene/MapbinLoader.hpp"
+#include "RenderStar/Common/Scene/MapbinWriter.hpp"
+#include "RenderStar/Common/Scene/TextureTranscoder.hpp"
+#include <cstring>
+#include <vector>
+
+using namespace RenderStar::Common::Scene;
+
+namespace
+{
+    MapbinScene MakeScene()
+    {
+        MapbinScene scene;
+
+        MapbinMaterial material;
+        material.materialId = 3;
+        material.roughness = 0.25f;
+
+        MapbinTextureSlot baseColor;
+        baseColor.slotType = TextureSlotType::BASE_COLOR;
+        baseColor.width = 8;
+        baseColor.height = 8;
+        baseColor.wrapS = 0x2901;
+        baseColor.wrapT = 0x812F;
+        baseColor.minFilter = 0x2601;
+        baseColor.magFilter = 0x2600;
+        baseColor.pixelData.assign(8 * 8 * 4, 255);
+        material.textureSlots.push_back(baseColor);
+
+        MapbinTextureSlot normal;
+        normal.slotType = TextureSlotType::NORMAL;
+        normal.width = 4;
+        normal.height = 4;
+
+        for (int i = 0; i < 16; ++i)
+            normal.pixelData.insert(normal.pixelData.end(), { 128, 128, 255, 255 });
+
+        material.textureSlots.push_back(normal);
+        scene.materials.push_back(material);
+
+        MapbinGroup group;
+        group.materialId = 3;
+        group.vertexCount = 3;
+        group.vertexData = {
+            0, 0, 0, 0, 1, 0, 0, 0,
+            1, 0, 0, 0, 1, 0, 1, 0,
+            0, 0, 1, 0, 1, 0, 0, 1
+        };
+        group.indices = { 0, 1, 2 };
+        scene.groups.push_back(group);
+
+        MapbinGameObject light;
+        light.type = GameObjectType::SPOT_LIGHT;
+        light.posX = 4.0f;
+        light.intensity = 2.5f;
+        light.innerCone = 10.0f;
+        light.outerCone = 20.0f;
+        scene.gameObjects.push_back(light);
+
+        return scene;
+    }
+}
+
+TEST(MapbinLoaderV6Test, RoundTripWithoutCompressedTextures)
+{
+    auto scene = MakeScene();
+    auto bytes = MapbinWriter::Write(scene);
+
+    auto result = MapbinLoader::Parse(bytes);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->materials.size(), 1u);
+    ASSERT_EQ(result->materials[0].textureSlots.size(), 2u);
+    EXPECT_EQ(result->materials[0].textureSlots[0].pixelData, scene.materials[0].textureSlots[0].pixelData);
+    EXPECT_EQ(result->materials[0].textureSlots[0].wrapT, 0x812Fu);
+    EXPECT_EQ(result->materials[0].textureSlots[0].compressedFormat, CompressedTextureFormat::NONE);
+    EXPECT_FLOAT_EQ(result->materials[0].roughness, 0.25f);
+
+    ASSERT_EQ(result->groups.size(), 1u);
+    EXPECT_EQ(result->groups[0].indices, scene.groups[0].indices);
+    EXPECT_EQ(result->groups[0].vertexData, scene.groups[0].vertexData);
+
+    ASSERT_EQ(result->gameObjects.size(), 1u);
+    EXPECT_EQ(result->gameObjects[0].type, GameObjectType::SPOT_LIGHT);
+    EXPECT_FLOAT_EQ(result->gameObjects[0].outerCone, 20.0f);
+}
+
+TEST(MapbinLoaderV6Test, CompressedTexturesAttachToSlots)
+{
+    auto scene = MakeScene();
+    ASSERT_EQ(TextureTranscoder::TranscodeScene(scene, false), 2u);
+
+    auto bytes = MapbinWriter::Write(scene);
+    auto result = MapbinLoader::Parse(bytes);
+    ASSERT_TRUE(result.has_value());
+
+    const auto& baseColor = result->materials[0].textureSlots[0];
+    EXPECT_TRUE(baseColor.pixelData.empty());
+    EXPECT_EQ(baseColor.width, 8u);
+    EXPECT_EQ(baseColor.compressedFormat, CompressedTextureFormat::BC1);
+    ASSERT_EQ(baseColor.compressedMips.size(), 4u);
+    EXPECT_EQ(baseColor.compressedMips[0].data, scene.materials[0].textureSlots[0].compressedMips[0].data);
+    EXPECT_EQ(baseColor.compressedMips[3].width, 1u);
+
+    const auto& normal = result->materials[0].textureSlots[1];
+    EXPECT_EQ(normal.compressedFormat, CompressedTextureFormat::BC5);
+    ASSERT_EQ(normal.compressedMips.size(), 3u);
+
+    auto decoded = TextureTranscoder::Decompress(normal.compressedFormat, normal.compressedMips[0].data, 4, 4);
+    ASSERT_EQ(decoded.size(), 64u);
+    EXPECT_EQ(decoded[0], 128);
+    EXPECT_EQ(decoded[1], 128);
+}
+
+TEST(MapbinLoaderV6Test, TruncatedCompressedSectionFails)
+{
+    auto scene = MakeScene();
+    TextureTranscoder::TranscodeScene(scene, true);
+
+    auto bytes = MapbinWriter::Write(scene);
+    bytes.resize(bytes.size() - 3);
+
+    EXPECT_FALSE(MapbinLoader::Parse(bytes).has_value());
+}
+
+TEST(MapbinLoaderV6Test, MissingCompressedSectionFails)
+{
+    auto scene = MakeScene();
+    auto bytes = MapbinWriter::Write(scene);
+    bytes.resize(bytes.size() - 4);
+
+    EXPECT_FALSE(MapbinLoader::Parse(bytes).has_value());
+}
+
+TEST(MapbinLoaderV6Test, UnknownCompressedFormatFails)
+{
+    auto scene = MakeScene();
+    TextureTranscoder::TranscodeScene(scene, false);
+    scene.materials[0].textureSlots[0].compressedFormat = static_cast<CompressedTextureFormat>(2);
+
+    EXPECT_FALSE(MapbinLoader::Parse(MapbinWriter::Write(scene)).has_value());
+}
+
+TEST(MapbinLoaderV6Test, MipSizeMismatchFails)
+{
+    auto scene = MakeScene();
+    TextureTranscoder::TranscodeScene(scene, false);
+
+    // A level shorter than its dimensions need would be read past by the uploaders
+    scene.materials[0].textureSlots[0].compressedMips[1].data.resize(4);
+
+    EXPECT_FALSE(MapbinLoader::Parse(MapbinWriter::Write(scene)).has_value());
+}
+
+TEST(MapbinLoaderV6Test, MipDimensionsMustHalveFromSlot)
+{
+    auto scene = MakeScene();
+    TextureTranscoder::TranscodeScene(scene, false);
+
+    auto widened = scene;
+    auto& widenedMip = widened.materials[0].textureSlots[0].compressedMips[0];
+    widenedMip.width = 16;
+    widenedMip.height = 16;
+    widenedMip.data.resize(TextureTranscoder::GetCompressedSize(CompressedTextureFormat::BC1, 16, 16));
+
+    EXPECT_FALSE(MapbinLoader::Parse(MapbinWriter::Write(widened)).has_value());
+
+    auto extraLevel = scene;
+    auto& mips = extraLevel.materials[0].textureSlots[0].compressedMips;
+    mips.push_back(mips.back());
+
+    EXPECT_FALSE(MapbinLoader::Parse(MapbinWriter::Write(extraLevel)).has_value());
+}
+
+TEST(MapbinLoaderV6Test, HugeMipCountFailsWithoutAllocating)
+{
+    auto scene = MakeScene();
+    TextureTranscoder::TranscodeScene(scene, false);
+    auto bytes = MapbinWriter::Write(scene);
+
+    // The normal map is the last compressed texture; its mip count sits 4 bytes before its first level
+    size_t levelBytes = 0;
+
+    for (const auto& mip : scene.materials[0].textureSlots[1].compressedMips)
+        levelBytes += 12 + mip.data.size();
+
+    const uint32_t mipCount = 0xFFFFFFFFu;
+    std::memcpy(bytes.data() + bytes.size() - levelBytes - 4, &mipCount, sizeof(mipCount));
+
+    EXPECT_FALSE(MapbinLoader::Parse(bytes).has_value());
+}
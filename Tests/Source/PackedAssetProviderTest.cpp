@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Common/Asset/AssetPackWriter.hpp"
+#include "RenderStar/Common/Asset/PackedAssetProvider.hpp"
+#include <fstream>
+
+using namespace RenderStar::Common::Asset;
+
+class PackedAssetProviderTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        packPath = std::filesystem::temp_directory_path() / ("renderstar_pack_test_" + std::to_string(reinterpret_cast<uintptr_t>(this)) + ".rspak");
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(packPath);
+    }
+
+    void WritePack(const AssetPackWriter& writer) const
+    {
+        ASSERT_TRUE(writer.WriteToFile(packPath));
+    }
+
+    static std::vector<uint8_t> Bytes(std::string_view text)
+    {
+        return { text.begin(), text.end() };
+    }
+
+    std::filesystem::path packPath;
+};
+
+TEST_F(PackedAssetProviderTest, LoadsStoredEntries)
+{
+    AssetPackWriter writer;
+    writer.Add("shader/a.rssl", Bytes("shader a"));
+    writer.Add("ui/main.uibin", { 0x01, 0x02, 0x03 });
+    WritePack(writer);
+
+    PackedAssetProvider provider("renderstar", packPath);
+
+    EXPECT_EQ(provider.GetEntryCount(), 2u);
+    EXPECT_EQ(provider.LoadText(AssetLocation::Of("renderstar", "shader/a.rssl")), "shader a");
+    EXPECT_EQ(provider.LoadBinary(AssetLocation::Of("renderstar", "ui/main.uibin")), (std::vector<uint8_t>{ 0x01, 0x02, 0x03 }));
+}
+
+TEST_F(PackedAssetProviderTest, ExistsChecksNamespaceAndPath)
+{
+    AssetPackWriter writer;
+    writer.Add("config.xml", Bytes("<config/>"));
+    WritePack(writer);
+
+    PackedAssetProvider provider("renderstar", packPath);
+
+    EXPECT_TRUE(provider.Exists(AssetLocation::Of("renderstar", "config.xml")));
+    EXPECT_FALSE(provider.Exists(AssetLocation::Of("renderstar", "missing.xml")));
+    EXPECT_FALSE(provider.Exists(AssetLocation::Of("other", "config.xml")));
+}
+
+TEST_F(PackedAssetProviderTest, MissingEntryThrows)
+{
+    AssetPackWriter writer;
+    writer.Add("a.txt", Bytes("a"));
+    WritePack(writer);
+
+    PackedAssetProvider provider("renderstar", packPath);
+
+    EXPECT_THROW(provider.LoadBinary(AssetLocation::Of("renderstar", "b.txt")), std::runtime_error);
+}
+
+TEST_F(PackedAssetProviderTest, ListReturnsSortedPrefixMatches)
+{
+    AssetPackWriter writer;
+    writer.Add("shader/b.rssl", Bytes("b"));
+    writer.Add("font/default.ttf", Bytes("f"));
+    writer.Add("shader/a.rssl", Bytes("a"));
+    writer.Add("shaders.txt", Bytes("s"));
+    WritePack(writer);
+
+    PackedAssetProvider provider("renderstar", packPath);
+    auto listed = provider.List("shader/");
+
+    ASSERT_EQ(listed.size(), 2u);
+    EXPECT_EQ(listed[0].GetPath(), "shader/a.rssl");
+    EXPECT_EQ(listed[1].GetPath(), "shader/b.rssl");
+    EXPECT_EQ(provider.List("").size(), 4u);
+}
+
+TEST_F(PackedAssetProviderTest, EntriesAreAligned)
+{
+    AssetPackWriter writer;
+    writer.Add("odd.bin", { 0x01, 0x02, 0x03 });
+    writer.Add("next.bin", { 0x04 });
+
+    auto data = writer.Build();
+    WritePack(writer);
+
+    PackedAssetProvider provider("renderstar", packPath);
+
+    ASSERT_GT(data.size(), AssetPack::HEADER_SIZE + AssetPack::DATA_ALIGNMENT);
+    EXPECT_EQ(data[AssetPack::HEADER_SIZE], 0x04);
+    EXPECT_EQ(data[AssetPack::HEADER_SIZE + AssetPack::DATA_ALIGNMENT], 0x01);
+    EXPECT_EQ(provider.LoadBinary(AssetLocation::Of("renderstar", "next.bin")), (std::vector<uint8_t>{ 0x04 }));
+}
+
+TEST_F(PackedAssetProviderTest, EmptyEntryLoads)
+{
+    AssetPackWriter writer;
+    writer.Add("empty.txt", {});
+    WritePack(writer);
+
+    PackedAssetProvider provider("renderstar", packPath);
+
+    EXPECT_TRUE(provider.Exists(AssetLocation::Of("renderstar", "empty.txt")));
+    EXPECT_TRUE(provider.LoadText(AssetLocation::Of("renderstar", "empty.txt")).empty());
+}
+
+TEST_F(PackedAssetProviderTest, DuplicateAddReplacesData)
+{
+    AssetPackWriter writer;
+    writer.Add("a.txt", Bytes("first"));
+    writer.Add("a.txt", Bytes("second"));
+    WritePack(writer);
+
+    PackedAssetProvider provider("renderstar", packPath);
+
+    EXPECT_EQ(provider.GetEntryCount(), 1u);
+    EXPECT_EQ(provider.LoadText(AssetLocation::Of("renderstar", "a.txt")), "second");
+}
+
+TEST_F(PackedAssetProviderTest, InvalidPackThrows)
+{
+    {
+        std::ofstream file(packPath, std::ios::binary);
+        file << "not a pack file at all, definitely not";
+    }
+
+    EXPECT_THROW(PackedAssetProvider("renderstar", packPath), std::runtime_error);
+}
+
+TEST_F(PackedAssetProviderTest, MissingPackThrows)
+{
+    EXPECT_THROW(PackedAssetProvider("renderstar", packPath), std::runtime_error);
+}
+
+TEST_F(PackedAssetProviderTest, AddDirectoryUsesRelativePaths)
+{
+    auto directory = std::filesystem::temp_directory_path() / "renderstar_pack_test_dir";
+    std::filesystem::create_directories(directory / "shader");
+
+    {
+        std::ofstream file(directory / "shader" / "x.rssl", std::ios::binary);
+        file << "x";
+    }
+
+    AssetPackWriter writer;
+    EXPECT_EQ(writer.AddDirectory(directory), 1u);
+    WritePack(writer);
+
+    std::filesystem::remove_all(directory);
+
+    PackedAssetProvider provider("renderstar", packPath);
+    EXPECT_EQ(provider.LoadText(AssetLocation::Of("renderstar", "shader/x.rssl")), "x");
+}
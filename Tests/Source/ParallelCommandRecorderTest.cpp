@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/Render/Backend/ParallelCommandRecorder.hpp"
+#include <algorithm>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace RenderStar::Client::Render;
+
+namespace
+{
+    // Stands in for a backend: each chunk "records" its command indices into its own buffer
+    class MockChunkRecorder final : public ICommandChunkRecorder
+    {
+    public:
+
+        explicit MockChunkRecorder(const uint32_t workerCount) : buffers(workerCount) { }
+
+        void RecordChunk(const CommandChunk& chunk, const uint32_t chunkIndex, const std::span<const uint32_t> commands) override
+        {
+            auto& buffer = buffers[chunkIndex];
+            buffer.worker = chunk.worker;
+            buffer.commands.assign(commands.begin(), commands.end());
+
+            std::scoped_lock lock(mutex);
+            threads.insert(std::this_thread::get_id());
+        }
+
+        void ExecuteChunks(const std::span<const CommandChunk> chunks) override
+        {
+            executeThread = std::this_thread::get_id();
+
+            for (uint32_t chunk = 0; chunk < chunks.size(); ++chunk)
+            {
+                executedWorkers.push_back(buffers[chunk].worker);
+                executed.insert(executed.end(), buffers[chunk].commands.begin(), buffers[chunk].commands.end());
+            }
+        }
+
+        struct Buffer
+        {
+            uint32_t worker = 0;
+            std::vector<uint32_t> commands;
+        };
+
+        std::vector<Buffer> buffers;
+        std::vector<uint32_t> executed;
+        std::vector<uint32_t> executedWorkers;
+        std::set<std::thread::id> threads;
+        std::thread::id executeThread;
+        std::mutex mutex;
+    };
+
+    std::vector<uint32_t> ShuffledOrder(const uint32_t count)
+    {
+        std::vector<uint32_t> order(count);
+        std::iota(order.begin(), order.end(), 0u);
+
+        // A fixed permutation stands in for the sorted draw order
+        for (uint32_t i = 0; i < count; ++i)
+            std::swap(order[i], order[(i * 7919u) % count]);
+
+        return order;
+    }
+}
+
+TEST(ParallelCommandRecorderTest, PartitionCoversEveryCommandContiguously)
+{
+    for (const uint32_t count : { 1u, 63u, 64u, 129u, 1000u, 4099u })
+    {
+        const auto chunks = ParallelCommandRecorder::Partition(count, 6, 64);
+
+        ASSERT_FALSE(chunks.empty());
+        EXPECT_LE(chunks.size(), 6u);
+        EXPECT_EQ(chunks.front().first, 0u);
+
+        uint32_t next = 0;
+        uint32_t smallest = count;
+        uint32_t largest = 0;
+
+        for (uint32_t chunk = 0; chunk < chunks.size(); ++chunk)
+        {
+            EXPECT_EQ(chunks[chunk].first, next);
+            EXPECT_EQ(chunks[chunk].worker, chunk);
+
+            next += chunks[chunk].count;
+            smallest = std::min(smallest, chunks[chunk].count);
+            largest = std::max(largest, chunks[chunk].count);
+        }
+
+        EXPECT_EQ(next, count);
+        EXPECT_LE(largest - smallest, 1u);
+
+        if (chunks.size() > 1)
+        {
+            EXPECT_GE(smallest, 64u);
+        }
+    }
+}
+
+TEST(ParallelCommandRecorderTest, SmallListsStayOnOneWorker)
+{
+    EXPECT_TRUE(ParallelCommandRecorder::Partition(0, 4, 64).empty());
+    EXPECT_EQ(ParallelCommandRecorder::Partition(127, 4, 64).size(), 1u);
+    EXPECT_EQ(ParallelCommandRecorder::Partition(128, 4, 64).size(), 2u);
+    EXPECT_EQ(ParallelCommandRecorder::Partition(100000, 4, 64).size(), 4u);
+    EXPECT_EQ(ParallelCommandRecorder::Partition(100000, 0, 64).size(), 1u);
+}
+
+TEST(ParallelCommandRecorderTest, ExecutesChunksInOrderOnTheCallingThread)
+{
+    ParallelCommandRecorder recorder(4, 16);
+    MockChunkRecorder mock(recorder.GetWorkerCount());
+    const auto order = ShuffledOrder(1000);
+    const auto chunks = recorder.Partition(static_cast<uint32_t>(order.size()));
+
+    ASSERT_EQ(chunks.size(), 4u);
+
+    recorder.Record(chunks, order, mock);
+
+    EXPECT_EQ(mock.executed, order);
+    EXPECT_EQ(mock.executedWorkers, (std::vector<uint32_t>{ 0, 1, 2, 3 }));
+    EXPECT_EQ(mock.executeThread, std::this_thread::get_id());
+    EXPECT_EQ(mock.threads.size(), 4u);
+    EXPECT_TRUE(mock.threads.contains(std::this_thread::get_id()));
+}
+
+TEST(ParallelCommandRecorderTest, ReportsRecordingPerWorker)
+{
+    ParallelCommandRecorder recorder(3, 8);
+    MockChunkRecorder mock(recorder.GetWorkerCount());
+    const auto order = ShuffledOrder(100);
+
+    recorder.Record(recorder.Partition(100), order, mock);
+    recorder.Record(recorder.Partition(10), std::span(order).first(10), mock);
+
+    const auto statistics = recorder.GetStatistics();
+    ASSERT_EQ(statistics.size(), 3u);
+
+    EXPECT_EQ(statistics[0].chunks, 2u);
+    EXPECT_EQ(statistics[1].chunks, 1u);
+    EXPECT_EQ(statistics[2].chunks, 1u);
+    EXPECT_EQ(statistics[0].commands + statistics[1].commands + statistics[2].commands, 110u);
+
+    for (const auto& worker : statistics)
+        EXPECT_GE(worker.recordMilliseconds, 0.0);
+
+    recorder.ResetStatistics();
+
+    for (const auto& worker : recorder.GetStatistics())
+    {
+        EXPECT_EQ(worker.chunks, 0u);
+        EXPECT_EQ(worker.commands, 0u);
+    }
+}
+
+TEST(ParallelCommandRecorderTest, ReusesWorkerThreadsAcrossRecords)
+{
+    ParallelCommandRecorder recorder(4, 16);
+    MockChunkRecorder mock(recorder.GetWorkerCount());
+    const auto order = ShuffledOrder(1000);
+    const auto chunks = recorder.Partition(static_cast<uint32_t>(order.size()));
+
+    for (int frame = 0; frame < 10; ++frame)
+        recorder.Record(chunks, order, mock);
+
+    EXPECT_EQ(mock.threads.size(), 4u);
+}
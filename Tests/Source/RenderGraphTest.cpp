@@ -0,0 +1,358 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/Render/Platform/RenderGraph.hpp"
+#include "RenderStar/Common/Configuration/Configuration.hpp"
+#include <algorithm>
+
+using namespace RenderStar::Client::Render;
+using namespace RenderStar::Client::Render::Platform;
+using RenderStar::Common::Configuration::Configuration;
+
+namespace
+{
+    // Parses a RenderingPlatformModule section laid out like render_settings.xml
+    RenderGraphConfig LoadConfig(const std::string& section)
+    {
+        auto document = std::make_shared<pugi::xml_document>();
+        const std::string xml = "<render_star><RenderingPlatformModule>" + section + "</RenderingPlatformModule></render_star>";
+
+        EXPECT_TRUE(document->load_string(xml.c_str()));
+
+        const Configuration configuration("render_star", "RenderingPlatformModule", document);
+        return RenderGraphConfig::Load(configuration);
+    }
+
+    RenderGraphTargetConfig Target(const std::string& name, const TextureFormat format = TextureFormat::RGBA16F, const float scale = 1.0f)
+    {
+        RenderGraphTargetConfig target;
+        target.name = name;
+        target.format = format;
+        target.scale = scale;
+        return target;
+    }
+
+    RenderGraphStageConfig Stage(const std::string& name, const std::string& output, std::vector<std::string> inputs, const std::string& type = "fullscreen")
+    {
+        RenderGraphStageConfig stage;
+        stage.name = name;
+        stage.type = type;
+        stage.output = output;
+        stage.inputs = std::move(inputs);
+        return stage;
+    }
+
+    std::vector<std::string> StepNames(const RenderGraph& graph, const RenderGraphConfig& config)
+    {
+        std::vector<std::string> names;
+
+        for (const auto& step : graph.GetSteps())
+            names.push_back(config.stages[step.stage].name);
+
+        return names;
+    }
+}
+
+TEST(RenderGraphTest, LoadsTargetsAndStagesFromConfiguration)
+{
+    const auto config = LoadConfig(
+        "<target_names>history, half</target_names>"
+        "<targets>"
+        "<history><format>RGBA32F</format><depth>true</depth><msaa>4</msaa><persistent>true</persistent></history>"
+        "<half><match_swapchain>false</match_swapchain><width>640</width><height>360</height><scale>0.5</scale></half>"
+        "</targets>"
+        "<stage_order>draw, resolve</stage_order>"
+        "<stages>"
+        "<draw><type>geometry</type><shader>renderstar:shader/a.rssl</shader><output>history</output><clear>false</clear></draw>"
+        "<resolve><type>fullscreen</type><inputs>history, half</inputs></resolve>"
+        "</stages>");
+
+    ASSERT_EQ(config.targets.size(), 2u);
+    EXPECT_EQ(config.targets[0].format, TextureFormat::RGBA32F);
+    EXPECT_TRUE(config.targets[0].hasDepth);
+    EXPECT_EQ(config.targets[0].sampleCount, 4u);
+    EXPECT_TRUE(config.targets[0].persistent);
+    EXPECT_TRUE(config.targets[0].matchSwapchain);
+    EXPECT_EQ(config.targets[1].format, TextureFormat::RGBA8);
+    EXPECT_FALSE(config.targets[1].matchSwapchain);
+    EXPECT_EQ(config.targets[1].width, 640u);
+    EXPECT_EQ(config.targets[1].height, 360u);
+    EXPECT_FLOAT_EQ(config.targets[1].scale, 0.5f);
+    EXPECT_FALSE(config.targets[1].persistent);
+
+    ASSERT_EQ(config.stages.size(), 2u);
+    EXPECT_EQ(config.stages[0].shader, "renderstar:shader/a.rssl");
+    EXPECT_FALSE(config.stages[0].clear);
+    EXPECT_TRUE(config.stages[0].inputs.empty());
+    EXPECT_EQ(config.stages[1].output, SWAPCHAIN_TARGET);
+    EXPECT_EQ(config.stages[1].vertexFormat, "standard");
+    EXPECT_EQ(config.stages[1].inputs, (std::vector<std::string>{ "history", "half" }));
+}
+
+TEST(RenderGraphTest, CullsStagesWhoseOutputsNothingReads)
+{
+    RenderGraphConfig config;
+    config.targets = { Target("scene"), Target("debug"), Target("debug_blur"), Target("unused_depth") };
+    config.stages = {
+        Stage("geometry", "scene", {}, "geometry"),
+        Stage("debug", "debug", { "scene" }),
+        Stage("debug_blur", "debug_blur", { "debug" }),
+        Stage("overdraw", "unused_depth", {}, "geometry"),
+        Stage("tonemap", std::string(SWAPCHAIN_TARGET), { "scene" })
+    };
+
+    const auto graph = RenderGraph::Compile(config);
+
+    EXPECT_EQ(StepNames(graph, config), (std::vector<std::string>{ "geometry", "overdraw", "tonemap" }));
+    EXPECT_EQ(graph.GetCulledStages(), (std::vector<std::string>{ "debug", "debug_blur" }));
+    EXPECT_FALSE(graph.FindPhysicalTarget("debug"));
+    EXPECT_FALSE(graph.FindPhysicalTarget("debug_blur"));
+    EXPECT_TRUE(graph.FindPhysicalTarget("unused_depth"));
+    EXPECT_FALSE(graph.FindPhysicalTarget(std::string(SWAPCHAIN_TARGET)));
+    EXPECT_TRUE(graph.GetWarnings().empty());
+}
+
+TEST(RenderGraphTest, AliasesTransientTargetsWithDisjointLifetimes)
+{
+    RenderGraphConfig config;
+    config.targets = { Target("scene"), Target("ping"), Target("pong"), Target("pang"), Target("pung") };
+    config.stages = {
+        Stage("geometry", "scene", {}, "geometry"),
+        Stage("a", "ping", { "scene" }),
+        Stage("b", "pong", { "ping" }),
+        Stage("c", "pang", { "pong" }),
+        Stage("d", "pung", { "pang" }),
+        Stage("present", std::string(SWAPCHAIN_TARGET), { "pung", "scene" })
+    };
+
+    const auto graph = RenderGraph::Compile(config);
+
+    ASSERT_EQ(graph.GetLifetime("ping")->firstStep, 1u);
+    ASSERT_EQ(graph.GetLifetime("ping")->lastStep, 2u);
+    EXPECT_EQ(graph.GetLifetime("scene")->lastStep, 5u);
+
+    EXPECT_EQ(graph.GetPhysicalTargets().size(), 3u);
+    EXPECT_EQ(graph.FindPhysicalTarget("ping"), graph.FindPhysicalTarget("pang"));
+    EXPECT_EQ(graph.FindPhysicalTarget("pong"), graph.FindPhysicalTarget("pung"));
+    EXPECT_NE(graph.FindPhysicalTarget("ping"), graph.FindPhysicalTarget("pong"));
+    EXPECT_NE(graph.FindPhysicalTarget("scene"), graph.FindPhysicalTarget("ping"));
+
+    const auto& shared = graph.GetPhysicalTargets()[*graph.FindPhysicalTarget("ping")];
+    EXPECT_TRUE(shared.transient);
+    EXPECT_EQ(shared.aliases, (std::vector<std::string>{ "ping", "pang" }));
+}
+
+TEST(RenderGraphTest, OnlyAliasesTargetsWithTheSameShape)
+{
+    RenderGraphConfig config;
+    config.targets = { Target("a"), Target("half", TextureFormat::RGBA16F, 0.5f), Target("depth"), Target("msaa"), Target("fixed"), Target("b") };
+    config.targets[2].hasDepth = true;
+    config.targets[3].sampleCount = 4;
+    config.targets[4].matchSwapchain = false;
+    config.targets[4].width = 256;
+    config.targets[4].height = 256;
+    config.stages = {
+        Stage("a", "a", {}),
+        Stage("half", "half", { "a" }),
+        Stage("depth", "depth", { "half" }),
+        Stage("msaa", "msaa", { "depth" }),
+        Stage("fixed", "fixed", { "msaa" }),
+        Stage("b", "b", { "fixed" }),
+        Stage("present", std::string(SWAPCHAIN_TARGET), { "b" })
+    };
+
+    const auto graph = RenderGraph::Compile(config);
+
+    // Only b can reuse a; every other target differs from everything free before it in size, depth or samples
+    EXPECT_EQ(graph.GetPhysicalTargets().size(), 5u);
+    EXPECT_EQ(graph.FindPhysicalTarget("a"), graph.FindPhysicalTarget("b"));
+}
+
+TEST(RenderGraphTest, WidensColourFormatsWhenAliasing)
+{
+    RenderGraphConfig config;
+    config.targets = {
+        Target("low_a", TextureFormat::RGBA8), Target("high_a", TextureFormat::RGBA32F),
+        Target("high_b", TextureFormat::RGBA32F), Target("low_b", TextureFormat::RGBA8), Target("low_c", TextureFormat::RGBA8)
+    };
+    config.stages = {
+        Stage("1", "low_a", {}),
+        Stage("2", "high_a", { "low_a" }),
+        Stage("3", "high_b", { "high_a" }),
+        Stage("4", "low_b", { "high_b" }),
+        Stage("5", "low_c", { "low_b" }),
+        Stage("present", std::string(SWAPCHAIN_TARGET), { "low_c" })
+    };
+
+    const auto graph = RenderGraph::Compile(config);
+
+    ASSERT_EQ(graph.GetPhysicalTargets().size(), 2u);
+    EXPECT_EQ(graph.FindPhysicalTarget("low_a"), graph.FindPhysicalTarget("high_b"));
+    EXPECT_EQ(graph.FindPhysicalTarget("high_a"), graph.FindPhysicalTarget("low_b"));
+    EXPECT_EQ(graph.FindPhysicalTarget("low_a"), graph.FindPhysicalTarget("low_c"));
+
+    for (const auto& physical : graph.GetPhysicalTargets())
+        EXPECT_EQ(physical.description.format, TextureFormat::RGBA32F);
+}
+
+TEST(RenderGraphTest, PrefersExactFormatMatchesOverWiderTargets)
+{
+    RenderGraphConfig config;
+    config.targets = {
+        Target("wide", TextureFormat::RGBA32F), Target("narrow", TextureFormat::RGBA8),
+        Target("middle", TextureFormat::RGBA8), Target("last", TextureFormat::RGBA8)
+    };
+    config.stages = {
+        Stage("1", "wide", {}),
+        Stage("2", "narrow", { "wide" }),
+        Stage("3", "middle", { "wide", "narrow" }),
+        Stage("4", "last", { "middle" }),
+        Stage("present", std::string(SWAPCHAIN_TARGET), { "last" })
+    };
+
+    const auto graph = RenderGraph::Compile(config);
+
+    // Both wide and narrow are free again when last starts; the narrow one fits without widening
+    EXPECT_EQ(graph.FindPhysicalTarget("last"), graph.FindPhysicalTarget("narrow"));
+    EXPECT_EQ(graph.GetPhysicalTargets()[*graph.FindPhysicalTarget("last")].description.format, TextureFormat::RGBA8);
+}
+
+TEST(RenderGraphTest, KeepsPersistentAndExternalTargetsOutOfAliasing)
+{
+    RenderGraphConfig config;
+    config.targets = { Target("shadow_map"), Target("history"), Target("ping"), Target("pong"), Target("accumulate") };
+    config.targets[1].persistent = true;
+    config.stages = {
+        Stage("ping", "ping", {}),
+        Stage("history", "history", { "ping" }),
+        Stage("pong", "pong", {}),
+        Stage("accumulate", "accumulate", { "accumulate", "pong" }),
+        Stage("present", std::string(SWAPCHAIN_TARGET), { "pong", "accumulate" })
+    };
+
+    const auto graph = RenderGraph::Compile(config);
+
+    const auto shadowMap = graph.FindPhysicalTarget("shadow_map");
+    const auto history = graph.FindPhysicalTarget("history");
+    const auto accumulate = graph.FindPhysicalTarget("accumulate");
+
+    ASSERT_TRUE(shadowMap && history && accumulate);
+    EXPECT_FALSE(graph.GetPhysicalTargets()[*shadowMap].transient);
+    EXPECT_FALSE(graph.GetPhysicalTargets()[*history].transient);
+    EXPECT_FALSE(graph.GetPhysicalTargets()[*accumulate].transient);
+    EXPECT_FALSE(graph.GetLifetime("shadow_map"));
+
+    // ping ends before pong starts, but neither may land on the persistent or read-before-written targets
+    EXPECT_EQ(graph.FindPhysicalTarget("ping"), graph.FindPhysicalTarget("pong"));
+    EXPECT_EQ(graph.GetPhysicalTargets().size(), 4u);
+
+    // history has no reader inside the graph but is kept because it is persistent
+    EXPECT_TRUE(graph.GetCulledStages().empty());
+    EXPECT_EQ(graph.GetWarnings().size(), 2u);
+}
+
+TEST(RenderGraphTest, EmitsBarriersOnlyForHazards)
+{
+    RenderGraphConfig config;
+    config.targets = { Target("scene"), Target("blur") };
+    config.stages = {
+        Stage("geometry", "scene", {}, "geometry"),
+        Stage("overlay", "scene", {}, "geometry"),
+        Stage("blur", "blur", { "scene", "scene" }),
+        Stage("present", std::string(SWAPCHAIN_TARGET), { "scene", "blur" })
+    };
+    config.stages[1].clear = false;
+
+    const auto graph = RenderGraph::Compile(config);
+    const auto steps = graph.GetSteps();
+    const auto scene = *graph.FindPhysicalTarget("scene");
+    const auto blur = *graph.FindPhysicalTarget("blur");
+
+    ASSERT_EQ(steps.size(), 4u);
+
+    // Last frame's reads of scene finish before geometry overwrites it
+    ASSERT_EQ(steps[0].barriers.size(), 1u);
+    EXPECT_EQ(steps[0].barriers[0].target, scene);
+    EXPECT_EQ(steps[0].barriers[0].before, RenderGraphAccess::READ);
+    EXPECT_EQ(steps[0].barriers[0].after, RenderGraphAccess::WRITE);
+
+    ASSERT_EQ(steps[1].barriers.size(), 1u);
+    EXPECT_EQ(steps[1].barriers[0].before, RenderGraphAccess::WRITE);
+    EXPECT_EQ(steps[1].barriers[0].after, RenderGraphAccess::WRITE);
+
+    // A duplicated input still needs one barrier; blur's first write follows last frame's read
+    ASSERT_EQ(steps[2].barriers.size(), 2u);
+    EXPECT_EQ(steps[2].barriers[0].target, scene);
+    EXPECT_EQ(steps[2].barriers[0].after, RenderGraphAccess::READ);
+    EXPECT_EQ(steps[2].barriers[1].target, blur);
+    EXPECT_EQ(steps[2].barriers[1].before, RenderGraphAccess::READ);
+
+    // scene was already made readable for blur, so only blur needs a barrier
+    ASSERT_EQ(steps[3].barriers.size(), 1u);
+    EXPECT_EQ(steps[3].barriers[0].target, blur);
+    EXPECT_EQ(steps[3].barriers[0].before, RenderGraphAccess::WRITE);
+    EXPECT_EQ(steps[3].barriers[0].after, RenderGraphAccess::READ);
+
+    EXPECT_EQ(graph.GetBarrierCount(), 5u);
+}
+
+TEST(RenderGraphTest, WarnsAboutUnknownTargets)
+{
+    RenderGraphConfig config;
+    config.targets = { Target("scene") };
+    config.stages = {
+        Stage("geometry", "scene", {}, "geometry"),
+        Stage("present", std::string(SWAPCHAIN_TARGET), { "scene", "missing" })
+    };
+
+    const auto graph = RenderGraph::Compile(config);
+
+    ASSERT_EQ(graph.GetWarnings().size(), 1u);
+    EXPECT_NE(graph.GetWarnings()[0].find("missing"), std::string::npos);
+    EXPECT_EQ(graph.GetSteps().size(), 2u);
+}
+
+TEST(RenderGraphTest, CompilesTheShippedPipelineLayout)
+{
+    const auto config = LoadConfig(
+        "<target_names>shadow_map, scene_color, ssao_raw, ssao_blur, bloom_threshold, bloom_down_1, bloom_down_2, bloom_up_1, bloom_up_0</target_names>"
+        "<targets>"
+        "<shadow_map><format>RGBA32F</format><depth>true</depth><match_swapchain>false</match_swapchain><width>2048</width><height>2048</height></shadow_map>"
+        "<scene_color><format>RGBA16F</format><depth>true</depth><msaa>4</msaa></scene_color>"
+        "<ssao_raw><scale>0.5</scale></ssao_raw>"
+        "<ssao_blur><scale>0.5</scale></ssao_blur>"
+        "<bloom_threshold><format>RGBA16F</format><scale>0.5</scale></bloom_threshold>"
+        "<bloom_down_1><format>RGBA16F</format><scale>0.25</scale></bloom_down_1>"
+        "<bloom_down_2><format>RGBA16F</format><scale>0.125</scale></bloom_down_2>"
+        "<bloom_up_1><format>RGBA16F</format><scale>0.25</scale></bloom_up_1>"
+        "<bloom_up_0><format>RGBA16F</format><scale>0.5</scale></bloom_up_0>"
+        "</targets>"
+        "<stage_order>main_geometry, ssao, ssao_blur, bloom_extract, bloom_down_1, bloom_down_2, bloom_up_1, bloom_up_0, tonemap</stage_order>"
+        "<stages>"
+        "<main_geometry><type>geometry</type><output>scene_color</output></main_geometry>"
+        "<ssao><type>fullscreen</type><output>ssao_raw</output><inputs>scene_color</inputs></ssao>"
+        "<ssao_blur><type>fullscreen</type><output>ssao_blur</output><inputs>ssao_raw, scene_color</inputs></ssao_blur>"
+        "<bloom_extract><type>fullscreen</type><output>bloom_threshold</output><inputs>scene_color</inputs></bloom_extract>"
+        "<bloom_down_1><type>fullscreen</type><output>bloom_down_1</output><inputs>bloom_threshold</inputs></bloom_down_1>"
+        "<bloom_down_2><type>fullscreen</type><output>bloom_down_2</output><inputs>bloom_down_1</inputs></bloom_down_2>"
+        "<bloom_up_1><type>fullscreen</type><output>bloom_up_1</output><inputs>bloom_down_2, bloom_down_1</inputs></bloom_up_1>"
+        "<bloom_up_0><type>fullscreen</type><output>bloom_up_0</output><inputs>bloom_up_1, bloom_threshold</inputs></bloom_up_0>"
+        "<tonemap><type>fullscreen</type><output>SWAPCHAIN</output><inputs>scene_color, bloom_up_0, ssao_blur</inputs></tonemap>"
+        "</stages>");
+
+    const auto graph = RenderGraph::Compile(config);
+
+    EXPECT_EQ(graph.GetSteps().size(), 9u);
+    EXPECT_TRUE(graph.GetCulledStages().empty());
+    EXPECT_TRUE(graph.GetWarnings().empty());
+
+    // ssao_raw is dead once ssao_blur has run, so the bloom threshold reuses its storage
+    EXPECT_EQ(graph.GetPhysicalTargets().size(), 8u);
+    EXPECT_EQ(graph.FindPhysicalTarget("ssao_raw"), graph.FindPhysicalTarget("bloom_threshold"));
+    EXPECT_EQ(graph.GetPhysicalTargets()[*graph.FindPhysicalTarget("ssao_raw")].description.format, TextureFormat::RGBA16F);
+    EXPECT_FALSE(graph.GetPhysicalTargets()[*graph.FindPhysicalTarget("shadow_map")].transient);
+
+    for (const auto& step : graph.GetSteps())
+    {
+        for (const auto& barrier : step.barriers)
+            EXPECT_NE(barrier.before, barrier.after);
+    }
+}
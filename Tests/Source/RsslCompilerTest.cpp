@@ -678,3 +678,179 @@ TEST(RsslCompilerTest, CompileErrorHasLineNumbers)
     EXPECT_FALSE(result.errors.empty());
     EXPECT_TRUE(result.errors[0].find("error:") != std::string::npos);
 }
+
+TEST(RsslCompilerTest, CompileBatchParsesSharedIncludeOnce)
+{
+    int resolveCount = 0;
+
+    auto resolver = [&](const std::string& path, const std::string&) -> std::string
+    {
+        if (path == "common.rssl")
+        {
+            resolveCount++;
+            return
+                "@uniform Camera : binding(0)\n"
+                "{\n"
+                "    mat4 vp;\n"
+                "}\n";
+        }
+
+        throw std::runtime_error("File not found: " + path);
+    };
+
+    std::vector<RsslBatchSource> sources;
+
+    for (const std::string name : {"a.rssl", "b.rssl", "c.rssl"})
+    {
+        sources.push_back({name,
+            "#rssl 1\n"
+            "#include \"common.rssl\"\n"
+            "@stage vertex\n"
+            "void main() { gl_Position = ubo.vp * vec4(float(gl_VertexIndex)); }\n"
+            "@stage fragment\n"
+            "void main() {}\n"});
+    }
+
+    auto result = RsslCompiler::CompileBatch(sources, resolver);
+
+    EXPECT_TRUE(result.IsValid());
+    EXPECT_EQ(resolveCount, 1);
+    EXPECT_EQ(result.parsedIncludeCount, 1);
+    ASSERT_EQ(result.programs.size(), 3);
+
+    for (const auto& program : result.programs)
+    {
+        const auto* vulkan = program.GetCompiled(RsslTarget::VULKAN_GLSL);
+        const auto* opengl = program.GetCompiled(RsslTarget::OPENGL_GLSL);
+
+        ASSERT_NE(vulkan, nullptr);
+        ASSERT_NE(opengl, nullptr);
+        EXPECT_TRUE(vulkan->vertexGlsl.find("uniform Camera") != std::string::npos);
+        EXPECT_TRUE(vulkan->vertexGlsl.find("gl_VertexIndex") != std::string::npos);
+        EXPECT_TRUE(opengl->vertexGlsl.find("gl_VertexID") != std::string::npos);
+        EXPECT_FALSE(opengl->fragmentGlsl.empty());
+    }
+}
+
+TEST(RsslCompilerTest, CompileBatchMatchesSingleCompile)
+{
+    auto resolver = [](const std::string& path, const std::string&) -> std::string
+    {
+        if (path == "outer.rssl")
+            return "#include \"inner.rssl\"\n@sampler outerTex : binding(1)\n";
+        if (path == "inner.rssl")
+            return "@uniform Camera : binding(0)\n{\n    mat4 vp;\n}\n";
+
+        throw std::runtime_error("File not found: " + path);
+    };
+
+    const std::string source =
+        "#rssl 1\n"
+        "#define SCALE 2.0\n"
+        "#include \"outer.rssl\"\n"
+        "@stage vertex\n"
+        "void main() { gl_Position = ubo.vp * vec4(SCALE); }\n";
+
+    auto batch = RsslCompiler::CompileBatch({{"test.rssl", source}}, resolver, {RsslTarget::OPENGL_GLSL}, 4);
+    auto single = RsslCompiler::Compile(source, resolver, "test.rssl", RsslTarget::OPENGL_GLSL);
+
+    ASSERT_EQ(batch.programs.size(), 1);
+    EXPECT_EQ(batch.programs[0].GetCompiled(RsslTarget::VULKAN_GLSL), nullptr);
+
+    const auto* compiled = batch.programs[0].GetCompiled(RsslTarget::OPENGL_GLSL);
+
+    ASSERT_NE(compiled, nullptr);
+    EXPECT_TRUE(compiled->IsValid());
+    EXPECT_EQ(compiled->vertexGlsl, single.vertexGlsl);
+}
+
+TEST(RsslCompilerTest, CompileBatchReportsDependencyManifest)
+{
+    auto resolver = [](const std::string& path, const std::string&) -> std::string
+    {
+        if (path == "lighting.rssl")
+            return "#include \"math.rssl\"\nfloat Light() { return 1.0; }\n";
+        if (path == "math.rssl")
+            return "float Square(float x) { return x * x; }\n";
+
+        throw std::runtime_error("File not found: " + path);
+    };
+
+    auto result = RsslCompiler::CompileBatch({
+        {"lit.rssl", "#rssl 1\n#include \"lighting.rssl\"\n@stage fragment\nvoid main() {}\n"},
+        {"math_only.rssl", "#rssl 1\n#include \"math.rssl\"\n@stage fragment\nvoid main() {}\n"},
+        {"broken.rssl", "#rssl 1\n#include \"missing.rssl\"\n@stage fragment\nvoid main() {}\n"}}, resolver);
+
+    EXPECT_FALSE(result.IsValid());
+    EXPECT_TRUE(result.Find("lit.rssl")->IsValid());
+    EXPECT_FALSE(result.Find("broken.rssl")->IsValid());
+    EXPECT_EQ(result.Find("unknown.rssl"), nullptr);
+
+    EXPECT_EQ(result.dependencies.includesByProgram.at("lit.rssl"), (std::vector<std::string>{"lighting.rssl", "math.rssl"}));
+    EXPECT_EQ(result.dependencies.GetAffectedPrograms("math.rssl"), (std::vector<std::string>{"lit.rssl", "math_only.rssl"}));
+    EXPECT_EQ(result.dependencies.GetAffectedPrograms("missing.rssl"), std::vector<std::string>{"broken.rssl"});
+    EXPECT_TRUE(result.dependencies.GetAffectedPrograms("other.rssl").empty());
+}
+
+TEST(RsslCompilerTest, ParsePermutationKeys)
+{
+    auto result = RsslCompiler::Parse(
+        "#rssl 1\n"
+        "@permutation HAS_NORMAL_MAP\n"
+        "@permutation HAS_SHADOWS\n"
+        "@stage fragment\n"
+        "void main() {}\n");
+
+    EXPECT_TRUE(result.IsValid());
+    ASSERT_EQ(result.permutationKeys.size(), 2);
+    EXPECT_EQ(result.permutationKeys[0], "HAS_NORMAL_MAP");
+    EXPECT_EQ(result.GetPermutationBit("HAS_NORMAL_MAP"), 1u);
+    EXPECT_EQ(result.GetPermutationBit("HAS_SHADOWS"), 2u);
+    EXPECT_EQ(result.GetPermutationBit("UNKNOWN"), 0u);
+    EXPECT_EQ(result.GetFullPermutationMask(), 3u);
+}
+
+TEST(RsslCompilerTest, ParseDuplicatePermutationKeyFails)
+{
+    auto result = RsslCompiler::Parse(
+        "#rssl 1\n"
+        "@permutation HAS_SHADOWS\n"
+        "@permutation HAS_SHADOWS\n"
+        "@stage fragment\n"
+        "void main() {}\n");
+
+    EXPECT_FALSE(result.IsValid());
+    ASSERT_FALSE(result.errors.empty());
+    EXPECT_TRUE(result.errors[0].find("Duplicate @permutation") != std::string::npos);
+}
+
+TEST(RsslCompilerTest, CompilePermutationUsesSpecializationConstantsOnVulkan)
+{
+    auto parsed = RsslCompiler::Parse(
+        "#rssl 1\n"
+        "@permutation HAS_NORMAL_MAP\n"
+        "@permutation HAS_SHADOWS\n"
+        "@stage fragment\n"
+        "void main() { if (HAS_SHADOWS) {} }\n");
+
+    auto result = RsslCompiler::Compile(parsed, RsslTarget::VULKAN_GLSL, parsed.GetPermutationBit("HAS_SHADOWS"));
+
+    EXPECT_TRUE(result.IsValid());
+    EXPECT_TRUE(result.fragmentGlsl.find("layout(constant_id = 0) const bool HAS_NORMAL_MAP = false;") != std::string::npos);
+    EXPECT_TRUE(result.fragmentGlsl.find("layout(constant_id = 1) const bool HAS_SHADOWS = true;") != std::string::npos);
+}
+
+TEST(RsslCompilerTest, CompilePermutationInjectsDefinesOnOpenGL)
+{
+    auto parsed = RsslCompiler::Parse(
+        "#rssl 1\n"
+        "@permutation HAS_NORMAL_MAP\n"
+        "@stage fragment\n"
+        "void main() { if (HAS_NORMAL_MAP) {} }\n");
+
+    auto disabled = RsslCompiler::Compile(parsed, RsslTarget::OPENGL_GLSL, 0);
+    auto full = RsslCompiler::Compile(parsed, RsslTarget::OPENGL_GLSL);
+
+    EXPECT_EQ(disabled.fragmentGlsl.find("#version 410 core\n\n#define HAS_NORMAL_MAP false\n"), 0u);
+    EXPECT_TRUE(full.fragmentGlsl.find("#define HAS_NORMAL_MAP true") != std::string::npos);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/Render/Shader/RsslCompiler.hpp"
+#include "RenderStar/Client/Render/Shader/RsslVariantCache.hpp"
+
+using namespace RenderStar::Client::Render::Shader;
+
+namespace
+{
+    const std::string PERMUTED_SHADER =
+        "#rssl 1\n"
+        "@permutation HAS_NORMAL_MAP\n"
+        "@permutation HAS_DETAIL_MAP\n"
+        "@stage vertex\n"
+        "void main() {}\n"
+        "@stage fragment\n"
+        "void main() { if (HAS_DETAIL_MAP) {} }\n";
+}
+
+TEST(RsslVariantCacheTest, UnregisteredProgramReturnsNull)
+{
+    RsslVariantCache cache;
+
+    EXPECT_FALSE(cache.Contains("scene"));
+    EXPECT_EQ(cache.GetParsed("scene"), nullptr);
+    EXPECT_EQ(cache.GetOrCompile("scene", RsslTarget::VULKAN_GLSL, 0), nullptr);
+}
+
+TEST(RsslVariantCacheTest, KeyMasksUndeclaredPermutationBits)
+{
+    RsslVariantCache cache;
+    cache.Register("scene", RsslCompiler::Parse(PERMUTED_SHADER));
+
+    EXPECT_EQ(cache.MakeKey("scene", RsslTarget::VULKAN_GLSL, 0xFFu).permutation, 0x3u);
+    EXPECT_EQ(cache.MakeKey("scene", RsslTarget::OPENGL_GLSL, 0x6u).permutation, 0x2u);
+    EXPECT_NE(cache.MakeKey("scene", RsslTarget::VULKAN_GLSL, 1), cache.MakeKey("scene", RsslTarget::OPENGL_GLSL, 1));
+}
+
+TEST(RsslVariantCacheTest, CompilesEachVariantOnce)
+{
+    RsslVariantCache cache;
+    cache.Register("scene", RsslCompiler::Parse(PERMUTED_SHADER));
+
+    auto first = cache.GetOrCompile("scene", RsslTarget::VULKAN_GLSL, 0x2);
+    auto second = cache.GetOrCompile("scene", RsslTarget::VULKAN_GLSL, 0x6);
+    auto other = cache.GetOrCompile("scene", RsslTarget::VULKAN_GLSL, 0x1);
+
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+    EXPECT_TRUE(first->fragmentGlsl.find("const bool HAS_DETAIL_MAP = true;") != std::string::npos);
+    EXPECT_TRUE(other->fragmentGlsl.find("const bool HAS_DETAIL_MAP = false;") != std::string::npos);
+
+    const auto statistics = cache.GetStatistics();
+
+    EXPECT_EQ(statistics.hits, 1u);
+    EXPECT_EQ(statistics.misses, 2u);
+    EXPECT_EQ(statistics.variantCount, 2u);
+}
+
+TEST(RsslVariantCacheTest, RegisterDropsStaleVariants)
+{
+    RsslVariantCache cache;
+    cache.Register("scene", RsslCompiler::Parse(PERMUTED_SHADER));
+    cache.Register("sky", RsslCompiler::Parse(PERMUTED_SHADER));
+
+    auto stale = cache.GetOrCompile("scene", RsslTarget::OPENGL_GLSL, 0);
+    cache.GetOrCompile("sky", RsslTarget::OPENGL_GLSL, 0);
+
+    cache.Register("scene", RsslCompiler::Parse("#rssl 1\n@stage fragment\nvoid main() {}\n"));
+
+    EXPECT_EQ(cache.GetStatistics().variantCount, 1u);
+
+    auto fresh = cache.GetOrCompile("scene", RsslTarget::OPENGL_GLSL, 0);
+
+    ASSERT_NE(fresh, nullptr);
+    EXPECT_NE(stale, fresh);
+    EXPECT_TRUE(fresh->fragmentGlsl.find("HAS_DETAIL_MAP") == std::string::npos);
+
+    cache.Invalidate("sky");
+
+    EXPECT_FALSE(cache.Contains("sky"));
+    EXPECT_EQ(cache.GetStatistics().variantCount, 1u);
+}
+
+TEST(RsslVariantCacheTest, BatchProgramKeepsItsCompiledVariants)
+{
+    const IncludeResolver resolver = [](const std::string& path, const std::string&) -> std::string
+    {
+        throw std::runtime_error("Include not found: " + path);
+    };
+
+    const auto batch = RsslCompiler::CompileBatch({{"scene", PERMUTED_SHADER}}, resolver, {RsslTarget::VULKAN_GLSL});
+    ASSERT_EQ(batch.programs.size(), 1u);
+
+    RsslVariantCache cache;
+    cache.Register(batch.programs.front());
+
+    const auto full = cache.GetOrCompile("scene", RsslTarget::VULKAN_GLSL, 0x3);
+    ASSERT_NE(full, nullptr);
+    EXPECT_EQ(full->fragmentGlsl, batch.programs.front().compiled.front().fragmentGlsl);
+    EXPECT_EQ(cache.GetStatistics().misses, 0u);
+
+    // Other permutations and targets still compile on demand
+    EXPECT_NE(cache.GetOrCompile("scene", RsslTarget::OPENGL_GLSL, 0x3), nullptr);
+    EXPECT_EQ(cache.GetStatistics().misses, 1u);
+}
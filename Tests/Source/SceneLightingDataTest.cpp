@@ -29,48 +29,9 @@ TEST(SceneLightingDataTest, SizeMatchesSizeof)
     EXPECT_EQ(SceneLightingData::Size(), sizeof(SceneLightingData));
 }
 
-TEST(SceneLightingDataTest, MaxLightConstants)
-{
-    EXPECT_EQ(MAX_POINT_LIGHTS, 16);
-    EXPECT_EQ(MAX_SPOT_LIGHTS, 8);
-}
-
-TEST(SceneLightingDataTest, PointLightGPULayout)
-{
-    PointLightGPU point{};
-    point.positionAndRange = glm::vec4(1.0f, 2.0f, 3.0f, 10.0f);
-    point.colorAndIntensity = glm::vec4(1.0f, 0.5f, 0.0f, 2.0f);
-
-    EXPECT_FLOAT_EQ(point.positionAndRange.x, 1.0f);
-    EXPECT_FLOAT_EQ(point.positionAndRange.y, 2.0f);
-    EXPECT_FLOAT_EQ(point.positionAndRange.z, 3.0f);
-    EXPECT_FLOAT_EQ(point.positionAndRange.w, 10.0f);
-    EXPECT_FLOAT_EQ(point.colorAndIntensity.w, 2.0f);
-}
-
-TEST(SceneLightingDataTest, SpotLightGPULayout)
-{
-    SpotLightGPU spot{};
-    spot.positionAndRange = glm::vec4(1.0f, 2.0f, 3.0f, 15.0f);
-    spot.directionAndAngle = glm::vec4(0.0f, -1.0f, 0.0f, 0.707f);
-    spot.colorAndIntensity = glm::vec4(1.0f, 1.0f, 1.0f, 3.0f);
-    spot.spotParams = glm::vec4(0.866f, 0.0f, 0.0f, 0.0f);
-
-    EXPECT_FLOAT_EQ(spot.positionAndRange.w, 15.0f);
-    EXPECT_FLOAT_EQ(spot.directionAndAngle.y, -1.0f);
-    EXPECT_NEAR(spot.directionAndAngle.w, 0.707f, 0.001f);
-    EXPECT_FLOAT_EQ(spot.colorAndIntensity.w, 3.0f);
-    EXPECT_NEAR(spot.spotParams.x, 0.866f, 0.001f);
-}
-
-TEST(SceneLightingDataTest, SpotLightGPUSize)
-{
-    EXPECT_EQ(sizeof(SpotLightGPU), 64u);
-}
-
 TEST(SceneLightingDataTest, SceneLightingDataTotalSize)
 {
-    EXPECT_EQ(SceneLightingData::Size(), 1184u);
+    EXPECT_EQ(SceneLightingData::Size(), 480u);
 }
 
 TEST(SceneLightingDataTest, FieldAssignment)
@@ -83,32 +44,33 @@ TEST(SceneLightingDataTest, FieldAssignment)
     data.pointLightCount = 3;
     data.spotLightCount = 1;
 
-    data.pointLights[0].positionAndRange = glm::vec4(5.0f, 5.0f, 5.0f, 10.0f);
-    data.pointLights[0].colorAndIntensity = glm::vec4(1.0f, 0.0f, 0.0f, 2.0f);
-
     EXPECT_FLOAT_EQ(data.cameraPosition.x, 10.0f);
     EXPECT_FLOAT_EQ(data.ambientColor.w, 1.0f);
     EXPECT_FLOAT_EQ(data.directionalColor.w, 1.5f);
     EXPECT_EQ(data.pointLightCount, 3);
     EXPECT_EQ(data.spotLightCount, 1);
-    EXPECT_FLOAT_EQ(data.pointLights[0].colorAndIntensity.r, 1.0f);
 }
 
 TEST(SceneLightingDataTest, PaddingFieldsExist)
 {
     SceneLightingData data{};
+    EXPECT_EQ(data.shadowCascadeCount, 0);
     EXPECT_EQ(data._pad0, 0);
-    EXPECT_EQ(data._pad1, 0);
 }
 
-TEST(SceneLightingDataTest, DirectionalLightVPDefault)
+TEST(SceneLightingDataTest, CascadeViewProjectionsDefault)
 {
     SceneLightingData data{};
-    EXPECT_FLOAT_EQ(data.directionalLightVP[0][0], 1.0f);
-    EXPECT_FLOAT_EQ(data.directionalLightVP[1][1], 1.0f);
-    EXPECT_FLOAT_EQ(data.directionalLightVP[2][2], 1.0f);
-    EXPECT_FLOAT_EQ(data.directionalLightVP[3][3], 1.0f);
-    EXPECT_FLOAT_EQ(data.directionalLightVP[0][1], 0.0f);
+
+    for (uint32_t cascade = 0; cascade < MAX_SHADOW_CASCADES; ++cascade)
+    {
+        EXPECT_FLOAT_EQ(data.cascadeViewProjections[cascade][0][0], 1.0f);
+        EXPECT_FLOAT_EQ(data.cascadeViewProjections[cascade][1][1], 1.0f);
+        EXPECT_FLOAT_EQ(data.cascadeViewProjections[cascade][2][2], 1.0f);
+        EXPECT_FLOAT_EQ(data.cascadeViewProjections[cascade][3][3], 1.0f);
+        EXPECT_FLOAT_EQ(data.cascadeViewProjections[cascade][0][1], 0.0f);
+        EXPECT_FLOAT_EQ(data.cascadeParams[cascade].x, 0.0f);
+    }
 }
 
 TEST(SceneLightingDataTest, ShadowParamsDefault)
@@ -120,13 +82,14 @@ TEST(SceneLightingDataTest, ShadowParamsDefault)
     EXPECT_FLOAT_EQ(data.shadowParams.w, 0.0f);
 }
 
-TEST(SceneLightingDataTest, DirectionalLightVPAssignment)
+TEST(SceneLightingDataTest, CascadeViewProjectionAssignment)
 {
     SceneLightingData data{};
     glm::mat4 testVP(2.0f);
-    data.directionalLightVP = testVP;
-    EXPECT_FLOAT_EQ(data.directionalLightVP[0][0], 2.0f);
-    EXPECT_FLOAT_EQ(data.directionalLightVP[1][1], 2.0f);
+    data.cascadeViewProjections[2] = testVP;
+    EXPECT_FLOAT_EQ(data.cascadeViewProjections[2][0][0], 2.0f);
+    EXPECT_FLOAT_EQ(data.cascadeViewProjections[2][1][1], 2.0f);
+    EXPECT_FLOAT_EQ(data.cascadeViewProjections[1][0][0], 1.0f);
 }
 
 TEST(SceneLightingDataTest, ShadowParamsAssignment)
@@ -145,6 +108,7 @@ TEST(SceneLightingDataTest, Vec4Alignment)
     EXPECT_EQ(offsetof(SceneLightingData, directionalDirection) % 16, 0u);
     EXPECT_EQ(offsetof(SceneLightingData, directionalColor) % 16, 0u);
     EXPECT_EQ(offsetof(SceneLightingData, pointLightCount) % 16, 0u);
-    EXPECT_EQ(offsetof(SceneLightingData, directionalLightVP) % 16, 0u);
+    EXPECT_EQ(offsetof(SceneLightingData, cascadeViewProjections) % 16, 0u);
+    EXPECT_EQ(offsetof(SceneLightingData, cascadeParams) % 16, 0u);
     EXPECT_EQ(offsetof(SceneLightingData, shadowParams) % 16, 0u);
 }
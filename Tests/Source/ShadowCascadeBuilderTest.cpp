@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/Render/Framework/ShadowCascadeBuilder.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+#include <array>
+#include <cmath>
+#include <random>
+
+using namespace RenderStar::Client::Render::Framework;
+
+namespace
+{
+    constexpr float NEAR_DEPTH = 0.1f;
+    constexpr float FAR_DEPTH = 1000.0f;
+
+    glm::mat4 MakeViewProjection(const glm::vec3& eye, const float yawDegrees)
+    {
+        const float yaw = glm::radians(yawDegrees);
+        const glm::vec3 forward(std::sin(yaw), -0.2f, -std::cos(yaw));
+        const glm::mat4 projection = glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, NEAR_DEPTH, FAR_DEPTH);
+
+        return projection * glm::lookAt(eye, eye + forward, glm::vec3(0.0f, 1.0f, 0.0f));
+    }
+
+    glm::vec3 LightDirection()
+    {
+        return glm::normalize(glm::vec3(0.4f, -1.0f, 0.3f));
+    }
+}
+
+TEST(ShadowCascadeBuilderTest, SplitsBlendUniformAndLogarithmicSpacing)
+{
+    const auto uniform = ShadowCascadeBuilder::ComputeSplitDepths(1.0f, 101.0f, 4, 0.0f);
+    const auto logarithmic = ShadowCascadeBuilder::ComputeSplitDepths(1.0f, 10000.0f, 4, 1.0f);
+    const auto practical = ShadowCascadeBuilder::ComputeSplitDepths(NEAR_DEPTH, 150.0f, 4, 0.75f);
+
+    for (uint32_t index = 0; index <= 4; ++index)
+    {
+        EXPECT_NEAR(uniform[index], 1.0f + 25.0f * static_cast<float>(index), 1e-3f);
+        EXPECT_NEAR(logarithmic[index], std::pow(10.0f, static_cast<float>(index)), 1e-2f * logarithmic[index]);
+    }
+
+    EXPECT_FLOAT_EQ(practical[0], NEAR_DEPTH);
+    EXPECT_FLOAT_EQ(practical[4], 150.0f);
+
+    for (uint32_t index = 1; index <= 4; ++index)
+        EXPECT_GT(practical[index], practical[index - 1]);
+
+    // Fewer cascades leave the unused boundaries at the far split
+    const auto two = ShadowCascadeBuilder::ComputeSplitDepths(NEAR_DEPTH, 150.0f, 2, 0.75f);
+    EXPECT_FLOAT_EQ(two[2], 150.0f);
+    EXPECT_FLOAT_EQ(two[3], 150.0f);
+    EXPECT_FLOAT_EQ(two[4], 150.0f);
+}
+
+TEST(ShadowCascadeBuilderTest, EveryCascadeContainsItsFrustumSlice)
+{
+    const glm::mat4 viewProjection = MakeViewProjection(glm::vec3(12.0f, 3.0f, -7.0f), 35.0f);
+    const glm::mat4 inverseViewProjection = glm::inverse(viewProjection);
+
+    ShadowCascadeBuilder builder;
+    builder.Build(viewProjection, NEAR_DEPTH, FAR_DEPTH, LightDirection());
+
+    const auto cascades = builder.GetCascades();
+    ASSERT_EQ(cascades.size(), MAX_SHADOW_CASCADES);
+    EXPECT_FLOAT_EQ(cascades.back().farDepth, 150.0f);
+
+    std::mt19937 random(5);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> depth(0.0f, 1.0f);
+
+    for (uint32_t sample = 0; sample < 4000; ++sample)
+    {
+        // Pick a point on a random view ray, then find the cascade the shader would pick for it
+        const float x = unit(random);
+        const float y = unit(random);
+        const glm::vec4 nearPoint = inverseViewProjection * glm::vec4(x, y, 0.0f, 1.0f);
+        const glm::vec4 farPoint = inverseViewProjection * glm::vec4(x, y, 0.5f, 1.0f);
+        const glm::vec3 start = glm::vec3(nearPoint) / nearPoint.w;
+        const glm::vec3 direction = glm::normalize(glm::vec3(farPoint) / farPoint.w - start);
+        const glm::vec3 point = start + direction * (depth(random) * 160.0f);
+        const float viewDepth = (viewProjection * glm::vec4(point, 1.0f)).w;
+
+        for (const ShadowCascade& cascade : cascades)
+        {
+            if (viewDepth < cascade.nearDepth || viewDepth >= cascade.farDepth)
+                continue;
+
+            const glm::vec4 light = cascade.viewProjection * glm::vec4(point, 1.0f);
+
+            EXPECT_LE(std::abs(light.x / light.w), 1.0f);
+            EXPECT_LE(std::abs(light.y / light.w), 1.0f);
+            EXPECT_LE(std::abs(light.z / light.w), 1.0f);
+        }
+    }
+}
+
+TEST(ShadowCascadeBuilderTest, CasterBehindTheSliceStaysInDepthRange)
+{
+    const glm::mat4 viewProjection = MakeViewProjection(glm::vec3(0.0f, 2.0f, 0.0f), 0.0f);
+    const ShadowCascadeSettings settings;
+
+    ShadowCascadeBuilder builder;
+    builder.Build(viewProjection, NEAR_DEPTH, FAR_DEPTH, LightDirection());
+
+    const ShadowCascade& cascade = builder.GetCascades()[0];
+    const glm::vec3 receiver(0.0f, 2.0f, -1.0f);
+    const glm::vec3 caster = receiver - LightDirection() * (settings.casterDistance * 0.9f);
+    const glm::vec4 receiverClip = cascade.viewProjection * glm::vec4(receiver, 1.0f);
+    const glm::vec4 casterClip = cascade.viewProjection * glm::vec4(caster, 1.0f);
+
+    // The caster lies between the light and the receiver, so it must store a smaller depth
+    EXPECT_LE(std::abs(casterClip.z), 1.0f);
+    EXPECT_LT(casterClip.z, receiverClip.z);
+    EXPECT_NEAR(casterClip.x, receiverClip.x, 1e-3f);
+    EXPECT_NEAR(casterClip.y, receiverClip.y, 1e-3f);
+}
+
+TEST(ShadowCascadeBuilderTest, CameraTranslationMovesCascadesInWholeTexels)
+{
+    ShadowCascadeBuilder builder;
+    const glm::vec3 probe(3.0f, 0.0f, -20.0f);
+    std::array<std::array<float, 2>, MAX_SHADOW_CASCADES> firstOffsets{};
+
+    for (uint32_t step = 0; step < 16; ++step)
+    {
+        const glm::vec3 eye(0.37f * static_cast<float>(step), 2.0f, -0.21f * static_cast<float>(step));
+        builder.Build(MakeViewProjection(eye, 10.0f), NEAR_DEPTH, FAR_DEPTH, LightDirection());
+
+        for (uint32_t index = 0; index < MAX_SHADOW_CASCADES; ++index)
+        {
+            // A fixed world point must keep its position within a texel while the cascade slides
+            const glm::vec4 clip = builder.GetCascades()[index].viewProjection * glm::vec4(probe, 1.0f);
+            const float halfResolution = builder.GetSettings().mapResolution * 0.5f;
+            const float texelX = clip.x * halfResolution;
+            const float texelY = clip.y * halfResolution;
+            const std::array<float, 2> offset = { texelX - std::floor(texelX), texelY - std::floor(texelY) };
+
+            if (step == 0)
+            {
+                firstOffsets[index] = offset;
+                continue;
+            }
+
+            const float dx = std::abs(offset[0] - firstOffsets[index][0]);
+            const float dy = std::abs(offset[1] - firstOffsets[index][1]);
+
+            EXPECT_LT(std::min(dx, 1.0f - dx), 0.02f) << "cascade " << index << " step " << step;
+            EXPECT_LT(std::min(dy, 1.0f - dy), 0.02f) << "cascade " << index << " step " << step;
+        }
+    }
+}
+
+TEST(ShadowCascadeBuilderTest, CameraRotationKeepsCascadeScale)
+{
+    ShadowCascadeBuilder first;
+    ShadowCascadeBuilder second;
+
+    first.Build(MakeViewProjection(glm::vec3(0.0f, 2.0f, 0.0f), 0.0f), NEAR_DEPTH, FAR_DEPTH, LightDirection());
+    second.Build(MakeViewProjection(glm::vec3(0.0f, 2.0f, 0.0f), 73.0f), NEAR_DEPTH, FAR_DEPTH, LightDirection());
+
+    for (uint32_t index = 0; index < MAX_SHADOW_CASCADES; ++index)
+    {
+        EXPECT_FLOAT_EQ(first.GetCascades()[index].texelSize, second.GetCascades()[index].texelSize);
+        EXPECT_FLOAT_EQ(first.GetCascades()[index].depthRange, second.GetCascades()[index].depthRange);
+        EXPECT_GT(first.GetCascades()[index].depthBias, 0.0f);
+    }
+
+    // Later cascades trade resolution for coverage
+    EXPECT_LT(first.GetCascades()[0].texelSize, first.GetCascades()[3].texelSize);
+}
+
+TEST(ShadowCascadeBuilderTest, SettingsClampCascadeCount)
+{
+    ShadowCascadeBuilder builder;
+    ShadowCascadeSettings settings;
+
+    settings.cascadeCount = 9;
+    builder.SetSettings(settings);
+    builder.Build(MakeViewProjection(glm::vec3(0.0f), 0.0f), NEAR_DEPTH, FAR_DEPTH, LightDirection());
+    EXPECT_EQ(builder.GetCascades().size(), MAX_SHADOW_CASCADES);
+
+    settings.cascadeCount = 2;
+    settings.shadowDistance = 60.0f;
+    builder.SetSettings(settings);
+    builder.Build(MakeViewProjection(glm::vec3(0.0f), 0.0f), NEAR_DEPTH, FAR_DEPTH, LightDirection());
+    ASSERT_EQ(builder.GetCascades().size(), 2u);
+    EXPECT_FLOAT_EQ(builder.GetCascades()[1].farDepth, 60.0f);
+
+    builder.Clear();
+    EXPECT_TRUE(builder.GetCascades().empty());
+}
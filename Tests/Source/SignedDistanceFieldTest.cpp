@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/UI/SignedDistanceField.hpp"
+#include <cmath>
+
+using namespace RenderStar::Client::UI;
+
+namespace
+{
+    // Encoded distances across a vertical edge between texel 5 (inside) and texel 6 (outside), spread 4
+    constexpr uint8_t HALF_PLANE_GOLDEN[12] = {255, 255, 239, 207, 175, 143, 112, 80, 48, 16, 0, 0};
+
+    std::vector<uint8_t> HalfPlane(uint32_t width, uint32_t height, uint32_t edge)
+    {
+        std::vector<uint8_t> coverage(static_cast<size_t>(width) * height, 0);
+
+        for (uint32_t y = 0; y < height; ++y)
+            for (uint32_t x = 0; x < edge; ++x)
+                coverage[static_cast<size_t>(y) * width + x] = 255;
+
+        return coverage;
+    }
+}
+
+TEST(SignedDistanceFieldTest, HalfPlaneMatchesGolden)
+{
+    const auto coverage = HalfPlane(12, 4, 6);
+    const auto field = GenerateSignedDistanceField(coverage, 12, 4, 1, 4.0f);
+
+    ASSERT_EQ(field.size(), 48u);
+
+    for (uint32_t y = 0; y < 4; ++y)
+        for (uint32_t x = 0; x < 12; ++x)
+            EXPECT_EQ(field[y * 12 + x], HALF_PLANE_GOLDEN[x]) << "texel " << x << "," << y;
+}
+
+TEST(SignedDistanceFieldTest, DownsampledHalfPlaneMatchesGolden)
+{
+    const auto coverage = HalfPlane(24, 8, 12);
+    const auto field = GenerateSignedDistanceField(coverage, 24, 8, 2, 4.0f);
+
+    ASSERT_EQ(field.size(), 48u);
+
+    for (uint32_t x = 0; x < 12; ++x)
+        EXPECT_EQ(field[x], HALF_PLANE_GOLDEN[x]) << "texel " << x;
+}
+
+TEST(SignedDistanceFieldTest, SupersampledCircleTracksAnalyticDistance)
+{
+    constexpr uint32_t SUPERSAMPLE = 4;
+    constexpr uint32_t SIZE = 32;
+    constexpr uint32_t SOURCE_SIZE = SIZE * SUPERSAMPLE;
+    constexpr float RADIUS = 9.0f;
+    constexpr float SPREAD = 4.0f;
+
+    std::vector<uint8_t> coverage(SOURCE_SIZE * SOURCE_SIZE, 0);
+    const float center = static_cast<float>(SOURCE_SIZE) * 0.5f;
+
+    for (uint32_t y = 0; y < SOURCE_SIZE; ++y)
+    {
+        for (uint32_t x = 0; x < SOURCE_SIZE; ++x)
+        {
+            const float dx = static_cast<float>(x) + 0.5f - center;
+            const float dy = static_cast<float>(y) + 0.5f - center;
+
+            if (std::sqrt(dx * dx + dy * dy) <= RADIUS * SUPERSAMPLE)
+                coverage[y * SOURCE_SIZE + x] = 255;
+        }
+    }
+
+    const auto field = GenerateSignedDistanceField(coverage, SOURCE_SIZE, SOURCE_SIZE, SUPERSAMPLE, SPREAD);
+
+    ASSERT_EQ(field.size(), SIZE * SIZE);
+
+    for (uint32_t y = 0; y < SIZE; ++y)
+    {
+        for (uint32_t x = 0; x < SIZE; ++x)
+        {
+            const float dx = static_cast<float>(x) + 0.5f - SIZE * 0.5f;
+            const float dy = static_cast<float>(y) + 0.5f - SIZE * 0.5f;
+            const float expected = std::sqrt(dx * dx + dy * dy) - RADIUS;
+
+            if (std::abs(expected) >= SPREAD - 0.5f)
+                continue;
+
+            const float decoded = (0.5f - static_cast<float>(field[y * SIZE + x]) / 255.0f) * 2.0f * SPREAD;
+
+            EXPECT_NEAR(decoded, expected, 0.3f) << "texel " << x << "," << y;
+        }
+    }
+}
+
+TEST(SignedDistanceFieldTest, EmptyCoverageSaturatesOutside)
+{
+    const std::vector<uint8_t> coverage(16, 0);
+    const auto field = GenerateSignedDistanceField(coverage, 4, 4, 1, 2.0f);
+
+    ASSERT_EQ(field.size(), 16u);
+
+    for (const uint8_t value : field)
+        EXPECT_EQ(value, 0);
+}
+
+TEST(SignedDistanceFieldTest, RejectsUndersizedInput)
+{
+    const std::vector<uint8_t> coverage(8, 255);
+
+    EXPECT_TRUE(GenerateSignedDistanceField(coverage, 4, 4, 1, 2.0f).empty());
+    EXPECT_TRUE(GenerateSignedDistanceField(coverage, 1, 8, 2, 2.0f).empty());
+}
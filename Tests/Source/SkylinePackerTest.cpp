@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/UI/SkylinePacker.hpp"
+
+using namespace RenderStar::Client::UI;
+
+namespace
+{
+    bool Overlaps(const PackedRect& a, uint32_t aw, uint32_t ah, const PackedRect& b, uint32_t bw, uint32_t bh)
+    {
+        return a.x < b.x + bw && b.x < a.x + aw && a.y < b.y + bh && b.y < a.y + ah;
+    }
+}
+
+TEST(SkylinePackerTest, PacksRowAlongTheBottomFirst)
+{
+    SkylinePacker packer;
+    packer.Reset(64, 64);
+
+    const auto first = packer.Pack(16, 10);
+    const auto second = packer.Pack(16, 12);
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(first->x, 0u);
+    EXPECT_EQ(first->y, 0u);
+    EXPECT_EQ(second->x, 16u);
+    EXPECT_EQ(second->y, 0u);
+    EXPECT_EQ(packer.GetUsedArea(), 16u * 10u + 16u * 12u);
+}
+
+TEST(SkylinePackerTest, FillsLowestGapBeforeGrowing)
+{
+    SkylinePacker packer;
+    packer.Reset(32, 64);
+
+    ASSERT_TRUE(packer.Pack(16, 20).has_value());
+    ASSERT_TRUE(packer.Pack(16, 8).has_value());
+
+    const auto gap = packer.Pack(16, 8);
+
+    ASSERT_TRUE(gap.has_value());
+    EXPECT_EQ(gap->x, 16u);
+    EXPECT_EQ(gap->y, 8u);
+}
+
+TEST(SkylinePackerTest, NeverOverlapsAndRejectsWhenFull)
+{
+    SkylinePacker packer;
+    packer.Reset(100, 100);
+
+    std::vector<std::pair<PackedRect, std::pair<uint32_t, uint32_t>>> placed;
+
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        const uint32_t w = 5 + (i * 7) % 13;
+        const uint32_t h = 5 + (i * 11) % 17;
+        const auto rect = packer.Pack(w, h);
+
+        if (!rect)
+            continue;
+
+        EXPECT_LE(rect->x + w, 100u);
+        EXPECT_LE(rect->y + h, 100u);
+
+        for (const auto& [other, size] : placed)
+            EXPECT_FALSE(Overlaps(*rect, w, h, other, size.first, size.second));
+
+        placed.push_back({*rect, {w, h}});
+    }
+
+    EXPECT_FALSE(placed.empty());
+    EXPECT_FALSE(packer.Pack(101, 1).has_value());
+    EXPECT_LE(packer.GetUsedArea(), 100u * 100u);
+}
+
+TEST(SkylinePackerTest, ResetReclaimsTheWholePage)
+{
+    SkylinePacker packer;
+    packer.Reset(16, 16);
+
+    ASSERT_TRUE(packer.Pack(16, 16).has_value());
+    EXPECT_FALSE(packer.Pack(1, 1).has_value());
+
+    packer.Reset(16, 16);
+
+    const auto rect = packer.Pack(16, 16);
+
+    ASSERT_TRUE(rect.has_value());
+    EXPECT_EQ(rect->x, 0u);
+    EXPECT_EQ(rect->y, 0u);
+}
@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/Render/Vulkan/SpirvCache.hpp"
+#include <atomic>
+#include <fstream>
+#include <stdexcept>
+
+using namespace RenderStar::Client::Render::Vulkan;
+
+namespace
+{
+    struct StubCompilerState
+    {
+        std::atomic<int> compilations = 0;
+        std::string version = "stub-1";
+        size_t wordCount = 4;
+    };
+
+    class StubSpirvCompiler final : public ISpirvCompiler
+    {
+    public:
+        explicit StubSpirvCompiler(StubCompilerState& state) : state(state) { }
+
+        std::string GetVersion() const override
+        {
+            return state.version;
+        }
+
+        std::string GetTargetEnvironment() const override
+        {
+            return "vulkan1.3";
+        }
+
+        std::vector<uint32_t> Compile(const SpirvCompileJob& job) override
+        {
+            ++state.compilations;
+
+            if (job.source == "invalid")
+                throw std::runtime_error("Shader compilation failed: invalid");
+
+            std::vector<uint32_t> spirv(state.wordCount, static_cast<uint32_t>(job.source.size()));
+            spirv[0] = SpirvCache::SPIRV_MAGIC;
+            spirv[1] = static_cast<uint32_t>(job.stage);
+
+            return spirv;
+        }
+
+    private:
+        StubCompilerState& state;
+    };
+}
+
+class SpirvCacheTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        directory = std::filesystem::temp_directory_path() / ("renderstar_spirv_test_" + std::to_string(reinterpret_cast<uintptr_t>(this)));
+        std::filesystem::remove_all(directory);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(directory);
+    }
+
+    std::unique_ptr<SpirvCache> CreateCache(size_t byteBudget = SpirvCache::DEFAULT_BYTE_BUDGET)
+    {
+        return std::make_unique<SpirvCache>(directory, std::make_unique<StubSpirvCompiler>(state), byteBudget);
+    }
+
+    size_t CountEntries() const
+    {
+        size_t count = 0;
+
+        for (const auto& entry : std::filesystem::directory_iterator(directory))
+            count += entry.path().extension() == SpirvCache::FILE_EXTENSION ? 1 : 0;
+
+        return count;
+    }
+
+    std::filesystem::path directory;
+    StubCompilerState state;
+};
+
+TEST_F(SpirvCacheTest, WarmCacheSkipsCompiler)
+{
+    const SpirvCompileJob job { "void main() {}", VulkanShaderStage::VERTEX, "test" };
+
+    const auto first = CreateCache()->GetOrCompile(job);
+    EXPECT_EQ(state.compilations, 1);
+
+    auto warmCache = CreateCache();
+    const auto second = warmCache->GetOrCompile(job);
+
+    EXPECT_EQ(state.compilations, 1);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(warmCache->GetStatistics().hits, 1u);
+    EXPECT_EQ(warmCache->GetStatistics().misses, 0u);
+}
+
+TEST_F(SpirvCacheTest, KeyCoversSourceStageAndCompilerVersion)
+{
+    auto cache = CreateCache();
+
+    const SpirvCompileJob vertex { "void main() {}", VulkanShaderStage::VERTEX, "a" };
+    const SpirvCompileJob fragment { "void main() {}", VulkanShaderStage::FRAGMENT, "a" };
+    const SpirvCompileJob edited { "void main() { }", VulkanShaderStage::VERTEX, "a" };
+    const SpirvCompileJob renamed { "void main() {}", VulkanShaderStage::VERTEX, "b" };
+
+    EXPECT_NE(cache->ComputeKey(vertex), cache->ComputeKey(fragment));
+    EXPECT_NE(cache->ComputeKey(vertex), cache->ComputeKey(edited));
+    EXPECT_EQ(cache->ComputeKey(vertex), cache->ComputeKey(renamed));
+
+    state.version = "stub-2";
+
+    EXPECT_NE(cache->ComputeKey(vertex), CreateCache()->ComputeKey(vertex));
+}
+
+TEST_F(SpirvCacheTest, BatchCompilesMissesAndPreservesOrder)
+{
+    auto cache = CreateCache();
+
+    cache->GetOrCompile({ "cached", VulkanShaderStage::VERTEX, "cached" });
+
+    const std::vector<SpirvCompileJob> jobs
+    {
+        { "cached", VulkanShaderStage::VERTEX, "cached" },
+        { "vertex source", VulkanShaderStage::VERTEX, "v" },
+        { "fragment", VulkanShaderStage::FRAGMENT, "f" },
+        { "vertex source", VulkanShaderStage::VERTEX, "duplicate" },
+        { "compute shader source", VulkanShaderStage::COMPUTE, "c" }
+    };
+
+    const auto results = cache->GetOrCompileBatch(jobs);
+
+    ASSERT_EQ(results.size(), jobs.size());
+    EXPECT_EQ(state.compilations, 4);
+
+    for (size_t index = 0; index < jobs.size(); ++index)
+    {
+        ASSERT_EQ(results[index].size(), state.wordCount);
+        EXPECT_EQ(results[index][1], static_cast<uint32_t>(jobs[index].stage));
+        EXPECT_EQ(results[index][2], static_cast<uint32_t>(jobs[index].source.size()));
+    }
+
+    EXPECT_EQ(CountEntries(), 4u);
+}
+
+TEST_F(SpirvCacheTest, CompileFailurePropagatesAndStoresNothing)
+{
+    auto cache = CreateCache();
+
+    EXPECT_THROW(cache->GetOrCompile({ "invalid", VulkanShaderStage::FRAGMENT, "bad" }), std::runtime_error);
+    EXPECT_EQ(CountEntries(), 0u);
+}
+
+TEST_F(SpirvCacheTest, CorruptEntryIsRecompiled)
+{
+    const SpirvCompileJob job { "void main() {}", VulkanShaderStage::FRAGMENT, "test" };
+
+    auto cache = CreateCache();
+    cache->GetOrCompile(job);
+
+    {
+        std::ofstream file(directory / (cache->ComputeKey(job) + std::string(SpirvCache::FILE_EXTENSION)), std::ios::binary | std::ios::trunc);
+        file << "garbage";
+    }
+
+    const auto spirv = cache->GetOrCompile(job);
+
+    EXPECT_EQ(state.compilations, 2);
+    ASSERT_FALSE(spirv.empty());
+    EXPECT_EQ(spirv[0], SpirvCache::SPIRV_MAGIC);
+}
+
+TEST_F(SpirvCacheTest, TrimEvictsOldestEntriesToBudget)
+{
+    const size_t entryBytes = state.wordCount * sizeof(uint32_t);
+    auto cache = CreateCache(entryBytes * 2);
+
+    const SpirvCompileJob oldest { "a", VulkanShaderStage::VERTEX, "a" };
+
+    cache->GetOrCompile(oldest);
+
+    std::filesystem::last_write_time(directory / (cache->ComputeKey(oldest) + std::string(SpirvCache::FILE_EXTENSION)),
+        std::filesystem::file_time_type::clock::now() - std::chrono::hours(1));
+
+    cache->GetOrCompile({ "b", VulkanShaderStage::VERTEX, "b" });
+    cache->GetOrCompile({ "c", VulkanShaderStage::VERTEX, "c" });
+
+    const auto statistics = cache->GetStatistics();
+
+    EXPECT_EQ(CountEntries(), 2u);
+    EXPECT_EQ(statistics.evictions, 1u);
+    EXPECT_LE(statistics.residentBytes, entryBytes * 2);
+    EXPECT_FALSE(std::filesystem::exists(directory / (cache->ComputeKey(oldest) + std::string(SpirvCache::FILE_EXTENSION))));
+}
+
+TEST_F(SpirvCacheTest, ClearRemovesEntries)
+{
+    auto cache = CreateCache();
+    cache->GetOrCompile({ "a", VulkanShaderStage::VERTEX, "a" });
+
+    cache->Clear();
+
+    EXPECT_EQ(CountEntries(), 0u);
+    EXPECT_EQ(cache->GetStatistics().residentBytes, 0u);
+}
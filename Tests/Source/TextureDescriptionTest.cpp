@@ -54,3 +54,31 @@ TEST(TextureDescriptionTest, MixedWrapAndFilter)
     EXPECT_NE(desc.wrapS, desc.wrapT);
     EXPECT_NE(desc.minFilter, desc.magFilter);
 }
+
+TEST(TextureDescriptionTest, UncompressedLevelSize)
+{
+    TextureDescription desc;
+    desc.width = 64;
+    desc.height = 32;
+
+    EXPECT_FALSE(desc.IsCompressed());
+    EXPECT_EQ(desc.GetLevelSize(0), 64u * 32u * 4u);
+    EXPECT_EQ(desc.GetLevelSize(1), 32u * 16u * 4u);
+}
+
+TEST(TextureDescriptionTest, CompressedLevelSizeRoundsToBlocks)
+{
+    TextureDescription desc;
+    desc.width = 10;
+    desc.height = 6;
+    desc.format = TextureFormat::BC1_RGBA;
+
+    EXPECT_TRUE(desc.IsCompressed());
+    EXPECT_EQ(desc.GetLevelSize(0), 3u * 2u * 8u);
+    EXPECT_EQ(desc.GetLevelWidth(3), 1u);
+    EXPECT_EQ(desc.GetLevelHeight(3), 1u);
+    EXPECT_EQ(desc.GetLevelSize(3), 8u);
+
+    desc.format = TextureFormat::BC5_RG;
+    EXPECT_EQ(desc.GetLevelSize(0), 3u * 2u * 16u);
+}
@@ -0,0 +1,260 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Common/Scene/TextureTranscoder.hpp"
+#include <cstdlib>
+#include <vector>
+
+using namespace RenderStar::Common::Scene;
+
+namespace
+{
+    std::vector<uint8_t> MakeSolid(uint32_t width, uint32_t height, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+    {
+        std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+
+        for (size_t i = 0; i < pixels.size(); i += 4)
+        {
+            pixels[i + 0] = r;
+            pixels[i + 1] = g;
+            pixels[i + 2] = b;
+            pixels[i + 3] = a;
+        }
+
+        return pixels;
+    }
+
+    std::vector<uint8_t> MakeChecker(uint32_t width, uint32_t height)
+    {
+        std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+
+        for (uint32_t y = 0; y < height; ++y)
+        {
+            for (uint32_t x = 0; x < width; ++x)
+            {
+                uint8_t value = ((x + y) % 2 == 0) ? 255 : 0;
+                size_t offset = (static_cast<size_t>(y) * width + x) * 4;
+                pixels[offset + 0] = value;
+                pixels[offset + 1] = value;
+                pixels[offset + 2] = value;
+                pixels[offset + 3] = 255;
+            }
+        }
+
+        return pixels;
+    }
+
+    std::vector<uint8_t> MakeGradient(uint32_t width, uint32_t height)
+    {
+        std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+
+        for (uint32_t y = 0; y < height; ++y)
+        {
+            for (uint32_t x = 0; x < width; ++x)
+            {
+                size_t offset = (static_cast<size_t>(y) * width + x) * 4;
+                pixels[offset + 0] = static_cast<uint8_t>(x * 255 / (width - 1));
+                pixels[offset + 1] = static_cast<uint8_t>(y * 255 / (height - 1));
+                pixels[offset + 2] = 64;
+                pixels[offset + 3] = static_cast<uint8_t>(255 - x * 255 / (width - 1));
+            }
+        }
+
+        return pixels;
+    }
+
+    int MaxChannelError(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, size_t channel)
+    {
+        int maxError = 0;
+
+        for (size_t i = channel; i < a.size() && i < b.size(); i += 4)
+            maxError = std::max(maxError, std::abs(static_cast<int>(a[i]) - static_cast<int>(b[i])));
+
+        return maxError;
+    }
+
+    double MeanChannelError(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, size_t channel)
+    {
+        double total = 0.0;
+        size_t count = 0;
+
+        for (size_t i = channel; i < a.size() && i < b.size(); i += 4, ++count)
+            total += std::abs(static_cast<int>(a[i]) - static_cast<int>(b[i]));
+
+        return count > 0 ? total / static_cast<double>(count) : 0.0;
+    }
+}
+
+TEST(TextureTranscoderTest, MipCount)
+{
+    EXPECT_EQ(TextureTranscoder::GetMipCount(1, 1), 1u);
+    EXPECT_EQ(TextureTranscoder::GetMipCount(4, 4), 3u);
+    EXPECT_EQ(TextureTranscoder::GetMipCount(256, 64), 9u);
+    EXPECT_EQ(TextureTranscoder::GetMipCount(5, 3), 3u);
+}
+
+TEST(TextureTranscoderTest, CompressedSizes)
+{
+    EXPECT_EQ(TextureTranscoder::GetCompressedSize(CompressedTextureFormat::BC1, 4, 4), 8u);
+    EXPECT_EQ(TextureTranscoder::GetCompressedSize(CompressedTextureFormat::BC3, 4, 4), 16u);
+    EXPECT_EQ(TextureTranscoder::GetCompressedSize(CompressedTextureFormat::BC4, 8, 8), 32u);
+    EXPECT_EQ(TextureTranscoder::GetCompressedSize(CompressedTextureFormat::BC5, 5, 1), 32u);
+    EXPECT_EQ(TextureTranscoder::GetCompressedSize(CompressedTextureFormat::BC1, 1, 1), 8u);
+    EXPECT_EQ(TextureTranscoder::GetCompressedSize(CompressedTextureFormat::NONE, 4, 4), 0u);
+}
+
+TEST(TextureTranscoderTest, SelectFormatBySlotType)
+{
+    auto opaque = MakeSolid(4, 4, 10, 20, 30, 255);
+    auto translucent = MakeSolid(4, 4, 10, 20, 30, 128);
+
+    EXPECT_EQ(TextureTranscoder::SelectFormat(TextureSlotType::BASE_COLOR, opaque), CompressedTextureFormat::BC1);
+    EXPECT_EQ(TextureTranscoder::SelectFormat(TextureSlotType::BASE_COLOR, translucent), CompressedTextureFormat::BC3);
+    EXPECT_EQ(TextureTranscoder::SelectFormat(TextureSlotType::NORMAL, opaque), CompressedTextureFormat::BC5);
+    EXPECT_EQ(TextureTranscoder::SelectFormat(TextureSlotType::DETAIL_NORMAL, opaque), CompressedTextureFormat::BC5);
+    EXPECT_EQ(TextureTranscoder::SelectFormat(TextureSlotType::ROUGHNESS, opaque), CompressedTextureFormat::BC4);
+    EXPECT_EQ(TextureTranscoder::SelectFormat(TextureSlotType::AO, opaque), CompressedTextureFormat::BC4);
+    EXPECT_EQ(TextureTranscoder::SelectFormat(TextureSlotType::EMISSION, opaque), CompressedTextureFormat::BC1);
+}
+
+TEST(TextureTranscoderTest, SolidRedBc1Golden)
+{
+    auto pixels = MakeSolid(4, 4, 255, 0, 0, 255);
+    auto blocks = TextureTranscoder::Compress(CompressedTextureFormat::BC1, pixels, 4, 4);
+
+    const std::vector<uint8_t> golden = { 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00 };
+    EXPECT_EQ(blocks, golden);
+
+    auto decoded = TextureTranscoder::Decompress(CompressedTextureFormat::BC1, blocks, 4, 4);
+    EXPECT_EQ(decoded, pixels);
+}
+
+TEST(TextureTranscoderTest, CheckerBc1Golden)
+{
+    auto pixels = MakeChecker(4, 4);
+    auto blocks = TextureTranscoder::Compress(CompressedTextureFormat::BC1, pixels, 4, 4);
+
+    const std::vector<uint8_t> golden = { 0xFF, 0xFF, 0x00, 0x00, 0x44, 0x11, 0x44, 0x11 };
+    EXPECT_EQ(blocks, golden);
+
+    auto decoded = TextureTranscoder::Decompress(CompressedTextureFormat::BC1, blocks, 4, 4);
+    EXPECT_EQ(decoded, pixels);
+}
+
+TEST(TextureTranscoderTest, TwoLevelBc4Golden)
+{
+    std::vector<uint8_t> pixels = MakeSolid(4, 4, 200, 0, 0, 255);
+
+    for (size_t i = 8; i < 16; ++i)
+        pixels[i * 4] = 100;
+
+    auto blocks = TextureTranscoder::Compress(CompressedTextureFormat::BC4, pixels, 4, 4);
+
+    const std::vector<uint8_t> golden = { 200, 100, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24 };
+    EXPECT_EQ(blocks, golden);
+
+    auto decoded = TextureTranscoder::Decompress(CompressedTextureFormat::BC4, blocks, 4, 4);
+    EXPECT_EQ(MaxChannelError(decoded, pixels, 0), 0);
+    EXPECT_EQ(decoded[1], 0);
+    EXPECT_EQ(decoded[3], 255);
+}
+
+TEST(TextureTranscoderTest, GradientBc3WithinTolerance)
+{
+    auto pixels = MakeGradient(16, 16);
+    auto blocks = TextureTranscoder::Compress(CompressedTextureFormat::BC3, pixels, 16, 16);
+    ASSERT_EQ(blocks.size(), TextureTranscoder::GetCompressedSize(CompressedTextureFormat::BC3, 16, 16));
+
+    auto decoded = TextureTranscoder::Decompress(CompressedTextureFormat::BC3, blocks, 16, 16);
+    ASSERT_EQ(decoded.size(), pixels.size());
+
+    EXPECT_LE(MeanChannelError(decoded, pixels, 0), 12.0);
+    EXPECT_LE(MeanChannelError(decoded, pixels, 1), 12.0);
+    EXPECT_LE(MaxChannelError(decoded, pixels, 3), 4);
+}
+
+TEST(TextureTranscoderTest, Bc5KeepsTwoChannels)
+{
+    auto pixels = MakeGradient(8, 8);
+    auto blocks = TextureTranscoder::Compress(CompressedTextureFormat::BC5, pixels, 8, 8);
+    auto decoded = TextureTranscoder::Decompress(CompressedTextureFormat::BC5, blocks, 8, 8);
+
+    EXPECT_LE(MaxChannelError(decoded, pixels, 0), 8);
+    EXPECT_LE(MaxChannelError(decoded, pixels, 1), 8);
+    EXPECT_EQ(decoded[2], 0);
+}
+
+TEST(TextureTranscoderTest, NonMultipleOfFourDimensions)
+{
+    auto pixels = MakeSolid(5, 3, 0, 255, 0, 255);
+    auto blocks = TextureTranscoder::Compress(CompressedTextureFormat::BC1, pixels, 5, 3);
+    EXPECT_EQ(blocks.size(), 16u);
+
+    auto decoded = TextureTranscoder::Decompress(CompressedTextureFormat::BC1, blocks, 5, 3);
+    EXPECT_EQ(decoded, pixels);
+}
+
+TEST(TextureTranscoderTest, MipChainBoxFilter)
+{
+    auto pixels = MakeChecker(4, 4);
+    auto mips = TextureTranscoder::GenerateMipChain(pixels, 4, 4, false);
+
+    ASSERT_EQ(mips.size(), 3u);
+    EXPECT_EQ(mips[1].width, 2u);
+    EXPECT_EQ(mips[1].height, 2u);
+    EXPECT_EQ(mips[2].width, 1u);
+    EXPECT_EQ(mips[2].height, 1u);
+    EXPECT_EQ(mips[1].data[0], 128);
+    EXPECT_EQ(mips[2].data[0], 128);
+    EXPECT_EQ(mips[2].data[3], 255);
+}
+
+TEST(TextureTranscoderTest, MipChainRenormalizesNormals)
+{
+    std::vector<uint8_t> pixels = MakeSolid(2, 1, 128, 128, 255, 255);
+    pixels[0] = 255;
+    pixels[2] = 128;
+
+    auto mips = TextureTranscoder::GenerateMipChain(pixels, 2, 1, true);
+    ASSERT_EQ(mips.size(), 2u);
+
+    float nx = mips[1].data[0] / 127.5f - 1.0f;
+    float ny = mips[1].data[1] / 127.5f - 1.0f;
+    float nz = mips[1].data[2] / 127.5f - 1.0f;
+    EXPECT_NEAR(nx * nx + ny * ny + nz * nz, 1.0f, 0.03f);
+}
+
+TEST(TextureTranscoderTest, TranscodeSlotBuildsFullChain)
+{
+    MapbinTextureSlot slot;
+    slot.slotType = TextureSlotType::BASE_COLOR;
+    slot.width = 16;
+    slot.height = 8;
+    slot.pixelData = MakeGradient(16, 8);
+
+    for (size_t i = 3; i < slot.pixelData.size(); i += 4)
+        slot.pixelData[i] = 255;
+
+    ASSERT_TRUE(TextureTranscoder::TranscodeSlot(slot, false));
+    EXPECT_EQ(slot.compressedFormat, CompressedTextureFormat::BC1);
+    ASSERT_EQ(slot.compressedMips.size(), 5u);
+    EXPECT_TRUE(slot.pixelData.empty());
+
+    for (const auto& mip : slot.compressedMips)
+        EXPECT_EQ(mip.data.size(), TextureTranscoder::GetCompressedSize(CompressedTextureFormat::BC1, mip.width, mip.height));
+}
+
+TEST(TextureTranscoderTest, TranscodeSlotRejectsMismatchedSize)
+{
+    MapbinTextureSlot slot;
+    slot.width = 4;
+    slot.height = 4;
+    slot.pixelData.resize(10);
+
+    EXPECT_FALSE(TextureTranscoder::TranscodeSlot(slot, true));
+    EXPECT_EQ(slot.compressedFormat, CompressedTextureFormat::NONE);
+}
+
+TEST(TextureTranscoderTest, DecompressRejectsShortData)
+{
+    std::vector<uint8_t> tooShort(4);
+    EXPECT_TRUE(TextureTranscoder::Decompress(CompressedTextureFormat::BC1, tooShort, 4, 4).empty());
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/UI/UIBatcher.hpp"
+#include "RenderStar/Client/Render/Resource/ITextureHandle.hpp"
+
+using namespace RenderStar::Client;
+using namespace RenderStar::Client::UI;
+
+namespace
+{
+    class StubTexture final : public Render::ITextureHandle
+    {
+    public:
+
+        void Release() override {}
+        Render::GraphicsResourceType GetResourceType() const override { return Render::GraphicsResourceType::TEXTURE; }
+        uint32_t GetWidth() const override { return 1; }
+        uint32_t GetHeight() const override { return 1; }
+        bool IsValid() const override { return true; }
+    };
+
+    UIQuad MakeQuad(float x, float y, float w, float h)
+    {
+        UIQuad quad;
+        quad.x = x;
+        quad.y = y;
+        quad.width = w;
+        quad.height = h;
+        return quad;
+    }
+}
+
+TEST(UIBatcherTest, GlyphRunCollapsesIntoSingleDraw)
+{
+    StubTexture atlas;
+    UIBatcher batcher;
+
+    batcher.Begin(1280.0f, 720.0f);
+
+    for (int i = 0; i < 32; ++i)
+        batcher.AddQuad(&atlas, MakeQuad(10.0f + i * 12.0f, 10.0f, 10.0f, 16.0f));
+
+    batcher.End();
+
+    ASSERT_EQ(batcher.GetRuns().size(), 1u);
+    EXPECT_EQ(batcher.GetRuns()[0].texture, &atlas);
+    EXPECT_EQ(batcher.GetRuns()[0].firstIndex, 0u);
+    EXPECT_EQ(batcher.GetRuns()[0].indexCount, 32u * 6u);
+    EXPECT_EQ(batcher.GetVertices().size(), 32u * 4u);
+
+    const auto statistics = batcher.GetStatistics();
+
+    EXPECT_EQ(statistics.primitiveCount, 32u);
+    EXPECT_EQ(statistics.drawCount, 1u);
+    EXPECT_EQ(statistics.vertexBytes, 32u * 4u * sizeof(UIVertex));
+    EXPECT_EQ(statistics.indexBytes, 32u * 6u * sizeof(uint32_t));
+}
+
+TEST(UIBatcherTest, DisjointQuadsMergeAcrossTextureChanges)
+{
+    StubTexture white;
+    StubTexture atlas;
+    UIBatcher batcher;
+
+    batcher.Begin(1280.0f, 720.0f);
+    batcher.AddQuad(&white, MakeQuad(0.0f, 0.0f, 100.0f, 40.0f));
+    batcher.AddQuad(&atlas, MakeQuad(10.0f, 10.0f, 8.0f, 12.0f));
+    batcher.AddQuad(&white, MakeQuad(0.0f, 100.0f, 100.0f, 40.0f));
+    batcher.AddQuad(&atlas, MakeQuad(10.0f, 110.0f, 8.0f, 12.0f));
+    batcher.End();
+
+    const auto runs = batcher.GetRuns();
+
+    ASSERT_EQ(runs.size(), 2u);
+    EXPECT_EQ(runs[0].texture, &white);
+    EXPECT_EQ(runs[0].indexCount, 12u);
+    EXPECT_EQ(runs[1].texture, &atlas);
+    EXPECT_EQ(runs[1].firstIndex, 12u);
+}
+
+TEST(UIBatcherTest, OverlappingQuadsKeepPainterOrder)
+{
+    StubTexture white;
+    StubTexture atlas;
+    UIBatcher batcher;
+
+    batcher.Begin(1280.0f, 720.0f);
+    batcher.AddQuad(&white, MakeQuad(0.0f, 0.0f, 100.0f, 100.0f));
+    batcher.AddQuad(&atlas, MakeQuad(10.0f, 10.0f, 20.0f, 20.0f));
+    batcher.AddQuad(&white, MakeQuad(15.0f, 15.0f, 20.0f, 20.0f));
+    batcher.End();
+
+    const auto runs = batcher.GetRuns();
+
+    ASSERT_EQ(runs.size(), 3u);
+    EXPECT_EQ(runs[0].texture, &white);
+    EXPECT_EQ(runs[1].texture, &atlas);
+    EXPECT_EQ(runs[2].texture, &white);
+}
+
+TEST(UIBatcherTest, ScissorSplitsRunsAndCullsOutsideQuads)
+{
+    StubTexture white;
+    UIBatcher batcher;
+
+    batcher.Begin(1280.0f, 720.0f);
+    batcher.AddQuad(&white, MakeQuad(0.0f, 0.0f, 50.0f, 50.0f));
+    batcher.PushScissor({100, 100, 200, 200});
+    batcher.AddQuad(&white, MakeQuad(150.0f, 150.0f, 50.0f, 50.0f));
+    batcher.AddQuad(&white, MakeQuad(500.0f, 500.0f, 50.0f, 50.0f));
+    batcher.PushScissor({250, 250, 200, 200});
+    batcher.AddQuad(&white, MakeQuad(260.0f, 260.0f, 10.0f, 10.0f));
+    batcher.PopScissor();
+    batcher.PopScissor();
+    batcher.AddQuad(&white, MakeQuad(-100.0f, -100.0f, 50.0f, 50.0f));
+    batcher.End();
+
+    const auto runs = batcher.GetRuns();
+
+    ASSERT_EQ(runs.size(), 3u);
+    EXPECT_FALSE(runs[0].scissor.has_value());
+    ASSERT_TRUE(runs[1].scissor.has_value());
+    EXPECT_EQ(*runs[1].scissor, (UIScissorRect{100, 100, 200, 200}));
+    ASSERT_TRUE(runs[2].scissor.has_value());
+    EXPECT_EQ(*runs[2].scissor, (UIScissorRect{250, 250, 50, 50}));
+    EXPECT_EQ(batcher.GetStatistics().culledCount, 2u);
+}
+
+TEST(UIBatcherTest, QuadVerticesCarryTintUvAndRotation)
+{
+    StubTexture white;
+    UIBatcher batcher;
+
+    UIQuad quad = MakeQuad(0.0f, 0.0f, 20.0f, 10.0f);
+    quad.u0 = 0.25f;
+    quad.u1 = 0.75f;
+    quad.tint = {0.5f, 0.25f, 1.0f, 0.5f};
+    quad.rotationDegrees = 180.0f;
+    quad.cornerRadius = 3.0f;
+    quad.distanceField = true;
+
+    batcher.Begin(1280.0f, 720.0f);
+    batcher.AddQuad(&white, quad);
+    batcher.End();
+
+    const auto vertices = batcher.GetVertices();
+
+    ASSERT_EQ(vertices.size(), 4u);
+    EXPECT_NEAR(vertices[0].posX, 20.0f, 1e-4f);
+    EXPECT_NEAR(vertices[0].posY, 10.0f, 1e-4f);
+    EXPECT_FLOAT_EQ(vertices[2].texU, 0.75f);
+    EXPECT_FLOAT_EQ(vertices[2].localX, 1.0f);
+    EXPECT_FLOAT_EQ(vertices[1].colorG, 0.25f);
+    EXPECT_FLOAT_EQ(vertices[3].cornerRadius, 3.0f);
+    EXPECT_FLOAT_EQ(vertices[3].width, 20.0f);
+    EXPECT_FLOAT_EQ(vertices[0].distanceField, 1.0f);
+}
+
+TEST(UIBatcherTest, BeginResetsPreviousFrame)
+{
+    StubTexture white;
+    UIBatcher batcher;
+
+    batcher.Begin(1280.0f, 720.0f);
+    batcher.AddQuad(&white, MakeQuad(0.0f, 0.0f, 10.0f, 10.0f));
+    batcher.End();
+
+    batcher.Begin(1280.0f, 720.0f);
+    batcher.End();
+
+    EXPECT_TRUE(batcher.IsEmpty());
+    EXPECT_TRUE(batcher.GetVertices().empty());
+    EXPECT_TRUE(batcher.GetIndices().empty());
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/UI/UISpatialIndex.hpp"
+#include "RenderStar/Client/UI/UIElement.hpp"
+
+using namespace RenderStar::Client::UI;
+
+TEST(UISpatialIndexTest, QueryReturnsTopmostRectUnderPoint)
+{
+    UIElement panel;
+    UIElement button;
+    UISpatialIndex index;
+
+    index.Reset(1280.0f, 720.0f);
+    index.Insert(&panel, 100.0f, 100.0f, 400.0f, 300.0f);
+    index.Insert(&button, 150.0f, 150.0f, 100.0f, 40.0f);
+
+    EXPECT_EQ(index.Query(160.0, 160.0), &button);
+    EXPECT_EQ(index.Query(450.0, 350.0), &panel);
+    EXPECT_EQ(index.Query(50.0, 50.0), nullptr);
+    EXPECT_EQ(index.GetEntryCount(), 2u);
+}
+
+TEST(UISpatialIndexTest, EdgesAreInclusiveAcrossCellBoundaries)
+{
+    UIElement element;
+    UISpatialIndex index;
+
+    index.Reset(256.0f, 256.0f, 64.0f);
+    index.Insert(&element, 32.0f, 32.0f, 64.0f, 64.0f);
+
+    EXPECT_EQ(index.Query(96.0, 96.0), &element);
+    EXPECT_EQ(index.Query(32.0, 70.0), &element);
+    EXPECT_EQ(index.Query(96.5, 96.0), nullptr);
+}
+
+TEST(UISpatialIndexTest, PointsOutsideGridFallBackToScan)
+{
+    UIElement element;
+    UISpatialIndex index;
+
+    index.Reset(100.0f, 100.0f);
+    index.Insert(&element, -50.0f, -50.0f, 300.0f, 300.0f);
+
+    EXPECT_EQ(index.Query(-10.0, -10.0), &element);
+    EXPECT_EQ(index.Query(200.0, 200.0), &element);
+    EXPECT_EQ(index.Query(50.0, 50.0), &element);
+}
+
+TEST(UISpatialIndexTest, ClearDropsEntries)
+{
+    UIElement element;
+    UISpatialIndex index;
+
+    index.Reset(100.0f, 100.0f);
+    index.Insert(&element, 0.0f, 0.0f, 10.0f, 10.0f);
+    index.Clear();
+
+    EXPECT_EQ(index.Query(5.0, 5.0), nullptr);
+    EXPECT_EQ(index.GetEntryCount(), 0u);
+}
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/UI/UibinLoader.hpp"
+#include "RenderStar/Client/UI/UibinSceneBuilder.hpp"
+#include "RenderStar/Client/UI/UibinWriter.hpp"
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace RenderStar::Client::UI;
+
+namespace
+{
+    void AppendUint32BE(std::vector<uint8_t>& out, uint32_t value)
+    {
+        out.push_back(static_cast<uint8_t>(value >> 24));
+        out.push_back(static_cast<uint8_t>(value >> 16));
+        out.push_back(static_cast<uint8_t>(value >> 8));
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    std::vector<uint8_t> MakeVersion1(const std::string& json, const std::string& assetKey, const std::vector<uint8_t>& assetData)
+    {
+        std::vector<uint8_t> out;
+
+        AppendUint32BE(out, UibinLoader::MAGIC);
+        AppendUint32BE(out, UibinLoader::VERSION_1);
+        AppendUint32BE(out, static_cast<uint32_t>(json.size()));
+        AppendUint32BE(out, 1);
+        out.insert(out.end(), json.begin(), json.end());
+        AppendUint32BE(out, static_cast<uint32_t>(assetKey.size()));
+        out.insert(out.end(), assetKey.begin(), assetKey.end());
+        AppendUint32BE(out, static_cast<uint32_t>(assetData.size()));
+        out.insert(out.end(), assetData.begin(), assetData.end());
+
+        return out;
+    }
+
+    const std::string SCENE_JSON = R"({
+        "id": "root", "name": "Root", "designWidth": 1280, "designHeight": 720,
+        "components": [{ "kind": "Transform", "scaleX": 1280, "scaleY": 720 }],
+        "children": [
+            { "id": "panel", "name": "Panel",
+              "components": [{ "kind": "Panel", "borderWidth": 3 }, { "kind": "Text", "text": "Title" }],
+              "children": [
+                  { "id": "play", "name": "Play", "components": [{ "kind": "Button", "text": "Play" }] },
+                  { "id": "quit", "name": "Quit", "components": [{ "kind": "Button", "text": "Quit" }] }
+              ] },
+            { "id": "volume", "name": "Volume", "components": [{ "kind": "Toggle", "checked": true, "label": "Sound" }] }
+        ]
+    })";
+}
+
+TEST(UibinSceneTest, BuilderFlattensDepthFirstWithChildRanges)
+{
+    UibinSceneBuilder builder;
+
+    const uint32_t root = builder.AddElement(UIElement::NO_PARENT, "root", "Root");
+    const uint32_t a = builder.AddElement(root, "a", "A");
+    const uint32_t a1 = builder.AddElement(a, "a1", "A1");
+    const uint32_t b = builder.AddElement(root, "b", "B");
+
+    EXPECT_EQ(builder.AddElement(a, "late", "Late"), UIElement::NO_PARENT);
+    EXPECT_EQ(builder.AddElement(UIElement::NO_PARENT, "second", "Second"), UIElement::NO_PARENT);
+
+    UibinScene scene = builder.Build();
+
+    ASSERT_EQ(scene.elements.size(), 4u);
+    EXPECT_EQ(a1, 2u);
+    EXPECT_EQ(scene.elements[root].subtreeSize, 4u);
+    EXPECT_EQ(scene.elements[a].subtreeSize, 2u);
+    EXPECT_EQ(scene.elements[b].parent, root);
+
+    std::vector<std::string_view> children;
+
+    for (const auto& child : scene.GetRoot()->Children())
+        children.push_back(child.id);
+
+    EXPECT_EQ(children, (std::vector<std::string_view>{"a", "b"}));
+    EXPECT_TRUE(scene.elements[a1].Children().empty());
+}
+
+TEST(UibinSceneTest, FirstComponentOfAKindWins)
+{
+    UibinSceneBuilder builder;
+
+    const uint32_t root = builder.AddElement(UIElement::NO_PARENT, "root", "");
+    builder.AddComponent<TextData>(root).text = "first";
+    builder.AddComponent<TextData>(root).text = "second";
+    builder.AddComponent<TransformData>(root);
+
+    UibinScene scene = builder.Build();
+    const UIElement* element = scene.GetRoot();
+
+    ASSERT_NE(element->GetText(), nullptr);
+    EXPECT_EQ(element->GetText()->text, "first");
+    EXPECT_NE(element->GetTransform(), nullptr);
+    EXPECT_EQ(element->GetButton(), nullptr);
+    EXPECT_TRUE(element->HasComponent(UIComponentKind::Transform));
+}
+
+TEST(UibinSceneTest, FindByIdUsesHashIndexAndKeepsFirstDuplicate)
+{
+    UibinSceneBuilder builder;
+
+    const uint32_t root = builder.AddElement(UIElement::NO_PARENT, "root", "");
+
+    for (int i = 0; i < 100; ++i)
+        builder.AddElement(root, "item" + std::to_string(i), "");
+
+    builder.AddElement(root, "item7", "duplicate");
+
+    UibinScene scene = builder.Build();
+
+    EXPECT_EQ(scene.idBuckets.size(), 256u);
+    ASSERT_NE(scene.FindById("item42"), nullptr);
+    EXPECT_EQ(scene.FindById("item42")->index, 43u);
+    EXPECT_EQ(scene.FindById("item7")->index, 8u);
+    EXPECT_EQ(scene.FindById("missing"), nullptr);
+    EXPECT_EQ(scene.FindById(""), nullptr);
+    EXPECT_EQ(scene.FindByName("duplicate")->index, 101u);
+}
+
+TEST(UibinSceneTest, Version1JsonRoundTripsThroughVersion2)
+{
+    const auto v1 = UibinLoader::Parse(MakeVersion1(SCENE_JSON, "fonts/ui.ttf", {1, 2, 3}));
+
+    ASSERT_TRUE(v1.has_value());
+
+    const std::vector<uint8_t> bytes = UibinWriter::Write(*v1);
+    const auto v2 = UibinLoader::Parse(bytes);
+
+    ASSERT_TRUE(v2.has_value());
+    ASSERT_EQ(v2->elements.size(), 5u);
+    EXPECT_EQ(v2->designWidth, 1280.0);
+    EXPECT_EQ(v2->designHeight, 720.0);
+    EXPECT_EQ(v2->assets.at("fonts/ui.ttf"), (std::vector<uint8_t>{1, 2, 3}));
+
+    const UIElement* panel = v2->FindById("panel");
+
+    ASSERT_NE(panel, nullptr);
+    EXPECT_EQ(panel->name, "Panel");
+    EXPECT_EQ(panel->childCount, 2u);
+    EXPECT_EQ(panel->GetPanel()->borderWidth, 3.0);
+    EXPECT_EQ(panel->GetText()->text, "Title");
+    EXPECT_EQ(panel->GetText()->fontFamily, "Inter");
+
+    const UIElement* volume = v2->FindById("volume");
+
+    ASSERT_NE(volume, nullptr);
+    EXPECT_TRUE(volume->GetToggle()->checked);
+    EXPECT_EQ(volume->GetToggle()->label, "Sound");
+    EXPECT_EQ(v2->FindById("quit")->GetButton()->text, "Quit");
+    EXPECT_EQ(v2->FindById("quit")->parent, panel->index);
+
+    EXPECT_EQ(UibinWriter::Write(*v2), bytes);
+}
+
+TEST(UibinSceneTest, Version2RejectsTruncatedAndCorruptData)
+{
+    const auto scene = UibinLoader::Parse(MakeVersion1(SCENE_JSON, "key", {9}));
+
+    ASSERT_TRUE(scene.has_value());
+
+    const std::vector<uint8_t> bytes = UibinWriter::Write(*scene);
+
+    for (size_t size = 0; size < bytes.size(); size += 7)
+        EXPECT_FALSE(UibinLoader::Parse(std::span(bytes.data(), size)).has_value()) << size;
+
+    uint64_t elementsOffset;
+    std::memcpy(&elementsOffset, bytes.data() + 64, sizeof(elementsOffset));
+
+    // Second element claims a subtree that runs past its parent's
+    std::vector<uint8_t> corrupt = bytes;
+    const uint32_t subtreeSize = 99;
+    std::memcpy(corrupt.data() + elementsOffset + UibinLoader::V2_ELEMENT_SIZE + 12, &subtreeSize, sizeof(subtreeSize));
+    EXPECT_FALSE(UibinLoader::Parse(corrupt).has_value());
+
+    // Root references a transform row that does not exist
+    corrupt = bytes;
+    const int32_t row = 50;
+    std::memcpy(corrupt.data() + elementsOffset + 20, &row, sizeof(row));
+    EXPECT_FALSE(UibinLoader::Parse(corrupt).has_value());
+
+    // Unknown version
+    corrupt = bytes;
+    corrupt[7] = 3;
+    EXPECT_FALSE(UibinLoader::Parse(corrupt).has_value());
+}
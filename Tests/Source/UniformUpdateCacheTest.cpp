@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/Render/Resource/UniformUpdateCache.hpp"
+
+using namespace RenderStar::Client::Render;
+
+TEST(UniformUpdateCacheTest, UploadsOnlyWhenVersionChanges)
+{
+    UniformUpdateCache cache;
+    cache.Reset(3, 2);
+
+    EXPECT_TRUE(cache.ClaimUpload(0, 0, 144));
+    EXPECT_TRUE(cache.ClaimUpload(1, 0, 144));
+    EXPECT_FALSE(cache.ClaimUpload(0, 0, 144));
+    EXPECT_TRUE(cache.ClaimUpload(0, 1, 144));
+    EXPECT_FALSE(cache.ClaimUpload(3, 0, 144));
+
+    const auto& statistics = cache.GetStatistics();
+
+    EXPECT_EQ(statistics.bufferUploads, 3u);
+    EXPECT_EQ(statistics.skippedUploads, 1u);
+    EXPECT_EQ(statistics.uploadBytes, 3u * 144u);
+
+    cache.Invalidate(1);
+    EXPECT_TRUE(cache.ClaimUpload(1, 0, 144));
+
+    cache.RecordUpload(64);
+    EXPECT_EQ(statistics.bufferUploads, 5u);
+    EXPECT_EQ(statistics.uploadBytes, 4u * 144u + 64u);
+}
+
+TEST(UniformUpdateCacheTest, SteadyStateFrameTouchesNothing)
+{
+    UniformUpdateCache cache;
+    cache.Reset(100, 2);
+
+    int texture = 0;
+
+    for (uint32_t object = 0; object < 100; ++object)
+    {
+        cache.ClaimUpload(object, 0, 144);
+        cache.ClaimBinding(object, -1, 1, &texture);
+    }
+
+    cache.BeginFrame();
+
+    for (int32_t frame = 0; frame < 4; ++frame)
+    {
+        for (uint32_t object = 0; object < 100; ++object)
+        {
+            EXPECT_FALSE(cache.ClaimUpload(object, 0, 144));
+            EXPECT_FALSE(cache.ClaimBinding(object, frame % 2, 1, &texture));
+        }
+    }
+
+    EXPECT_EQ(cache.GetStatistics().uploadBytes, 0u);
+    EXPECT_EQ(cache.GetStatistics().bufferUploads, 0u);
+    EXPECT_EQ(cache.GetStatistics().descriptorUpdates, 0u);
+}
+
+TEST(UniformUpdateCacheTest, BindingsAreTrackedPerFrameSet)
+{
+    UniformUpdateCache cache;
+    cache.Reset(1, 2);
+
+    int shadowA = 0;
+    int shadowB = 0;
+
+    EXPECT_TRUE(cache.ClaimBinding(0, -1, 8, &shadowA));
+    EXPECT_FALSE(cache.ClaimBinding(0, 1, 8, &shadowA));
+
+    // The new texture reaches each frame's set once, when that frame records
+    EXPECT_TRUE(cache.ClaimBinding(0, 0, 8, &shadowB));
+    EXPECT_FALSE(cache.ClaimBinding(0, 0, 8, &shadowB));
+    EXPECT_TRUE(cache.ClaimBinding(0, 1, 8, &shadowB));
+    EXPECT_FALSE(cache.ClaimBinding(0, -1, 8, &shadowB));
+
+    EXPECT_FALSE(cache.ClaimBinding(0, 2, 8, &shadowB));
+    EXPECT_FALSE(cache.ClaimBinding(0, 0, UniformUpdateCache::MAX_BINDINGS, &shadowB));
+    EXPECT_EQ(cache.GetStatistics().descriptorUpdates, 3u);
+}
+
+TEST(UniformUpdateCacheTest, ResetForgetsEverything)
+{
+    UniformUpdateCache cache;
+    int texture = 0;
+
+    cache.Reset(2, 1);
+    cache.ClaimUpload(1, 5, 16);
+    cache.ClaimBinding(1, 0, 3, &texture);
+
+    cache.Reset(2, 1);
+
+    EXPECT_TRUE(cache.ClaimUpload(1, 5, 16));
+    EXPECT_TRUE(cache.ClaimBinding(1, 0, 3, &texture));
+
+    cache.Clear();
+
+    EXPECT_EQ(cache.GetObjectCount(), 0u);
+    EXPECT_FALSE(cache.ClaimUpload(0, 0, 16));
+    EXPECT_EQ(cache.GetStatistics().bufferUploads, 0u);
+}
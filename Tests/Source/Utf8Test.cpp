@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Client/UI/Utf8.hpp"
+#include <vector>
+
+using namespace RenderStar::Client::UI;
+
+namespace
+{
+    std::vector<uint32_t> DecodeAll(std::string_view text)
+    {
+        std::vector<uint32_t> codepoints;
+
+        for (size_t offset = 0; offset < text.size();)
+            codepoints.push_back(DecodeUtf8(text, offset));
+
+        return codepoints;
+    }
+}
+
+TEST(Utf8Test, DecodesAsciiAndMultiByteSequences)
+{
+    EXPECT_EQ(DecodeAll("Hi"), (std::vector<uint32_t>{'H', 'i'}));
+    EXPECT_EQ(DecodeAll("\xC3\xA9"), (std::vector<uint32_t>{0xE9}));
+    EXPECT_EQ(DecodeAll("\xE2\x82\xAC"), (std::vector<uint32_t>{0x20AC}));
+    EXPECT_EQ(DecodeAll("\xF0\x9F\x98\x80"), (std::vector<uint32_t>{0x1F600}));
+}
+
+TEST(Utf8Test, MalformedInputYieldsReplacementAndResynchronizes)
+{
+    EXPECT_EQ(DecodeAll("\x80" "a"), (std::vector<uint32_t>{REPLACEMENT_CODEPOINT, 'a'}));
+    EXPECT_EQ(DecodeAll("\xE2\x82" "a"), (std::vector<uint32_t>{REPLACEMENT_CODEPOINT, REPLACEMENT_CODEPOINT, 'a'}));
+    EXPECT_EQ(DecodeAll("\xC0\xAF"), (std::vector<uint32_t>{REPLACEMENT_CODEPOINT, REPLACEMENT_CODEPOINT}));
+    EXPECT_EQ(DecodeAll("\xED\xA0\x80").front(), REPLACEMENT_CODEPOINT);
+    EXPECT_EQ(DecodeAll("\xF4\x90\x80\x80").front(), REPLACEMENT_CODEPOINT);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "RenderStar/Common/Utility/WorkerPool.hpp"
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using namespace RenderStar::Common::Utility;
+
+TEST(WorkerPoolTest, SingleWorkerRunsOnTheCallingThread)
+{
+    WorkerPool pool(1);
+    std::vector<std::thread::id> threads;
+
+    pool.Run(5, [&](size_t) { threads.push_back(std::this_thread::get_id()); });
+
+    EXPECT_EQ(pool.GetWorkerCount(), 1u);
+    ASSERT_EQ(threads.size(), 5u);
+
+    for (const auto& thread : threads)
+        EXPECT_EQ(thread, std::this_thread::get_id());
+}
+
+TEST(WorkerPoolTest, RunVisitsEveryJobOnceAcrossDispatches)
+{
+    WorkerPool pool(4);
+
+    for (int dispatch = 0; dispatch < 200; ++dispatch)
+    {
+        std::vector<std::atomic<int>> visits(97);
+        pool.Run(visits.size(), [&](const size_t index) { ++visits[index]; });
+
+        for (const auto& count : visits)
+            ASSERT_EQ(count.load(), 1);
+    }
+}
+
+TEST(WorkerPoolTest, WorkersKeepTheirThreadsBetweenDispatches)
+{
+    WorkerPool pool(3);
+    std::vector<std::thread::id> first(3);
+    std::vector<std::thread::id> second(3);
+
+    pool.RunOnWorkers(3, [&](const size_t worker) { first[worker] = std::this_thread::get_id(); });
+    pool.RunOnWorkers(3, [&](const size_t worker) { second[worker] = std::this_thread::get_id(); });
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first[0], std::this_thread::get_id());
+    EXPECT_EQ(std::set<std::thread::id>(first.begin(), first.end()).size(), 3u);
+}
+
+TEST(WorkerPoolTest, ParticipantsAreCappedAtThePoolSize)
+{
+    WorkerPool pool(2);
+    std::mutex mutex;
+    std::set<size_t> workers;
+
+    pool.RunOnWorkers(8, [&](const size_t worker)
+    {
+        std::scoped_lock lock(mutex);
+        workers.insert(worker);
+    });
+
+    EXPECT_EQ(workers, (std::set<size_t>{ 0, 1 }));
+
+    workers.clear();
+    pool.Run(100, [&](size_t)
+    {
+        std::scoped_lock lock(mutex);
+        workers.insert(0);
+    }, 1);
+
+    EXPECT_EQ(workers.size(), 1u);
+}
+
+TEST(WorkerPoolTest, CallerExceptionWaitsForWorkers)
+{
+    WorkerPool pool(4);
+    std::atomic<int> finished = 0;
+
+    EXPECT_THROW(pool.RunOnWorkers(4, [&](const size_t worker)
+    {
+        if (worker == 0)
+            throw std::runtime_error("caller");
+
+        ++finished;
+    }), std::runtime_error);
+
+    EXPECT_EQ(finished.load(), 3);
+
+    pool.Run(10, [&](size_t) { ++finished; });
+    EXPECT_EQ(finished.load(), 13);
+}
+
+TEST(WorkerPoolTest, TransientRunVisitsEveryJob)
+{
+    std::vector<std::atomic<int>> visits(64);
+
+    WorkerPool::RunTransient(visits.size(), 4, [&](const size_t index) { ++visits[index]; });
+    WorkerPool::RunTransient(0, 4, [&](size_t) { FAIL(); });
+
+    for (const auto& count : visits)
+        EXPECT_EQ(count.load(), 1);
+}
@@ -0,0 +1,55 @@
+#include "RenderStar/Common/Asset/AssetPack.hpp"
+#include "RenderStar/Common/Asset/AssetPackWriter.hpp"
+#include <spdlog/spdlog.h>
+#include <filesystem>
+
+using namespace RenderStar::Common::Asset;
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3)
+    {
+        spdlog::error("Usage: {} <assets-directory> [output-directory]", argv[0]);
+        spdlog::error("Packs every namespace directory under <assets-directory> into <namespace>{}", AssetPack::FILE_EXTENSION);
+        return 1;
+    }
+
+    const std::filesystem::path assetsDirectory = argv[1];
+    const std::filesystem::path outputDirectory = argc == 3 ? std::filesystem::path(argv[2]) : assetsDirectory;
+
+    if (!std::filesystem::is_directory(assetsDirectory))
+    {
+        spdlog::error("Assets directory does not exist: {}", assetsDirectory.string());
+        return 1;
+    }
+
+    std::filesystem::create_directories(outputDirectory);
+
+    size_t packCount = 0;
+
+    for (const auto& entry : std::filesystem::directory_iterator(assetsDirectory))
+    {
+        if (!entry.is_directory())
+            continue;
+
+        const auto namespaceId = entry.path().filename().string();
+        const auto packPath = outputDirectory / (namespaceId + std::string(AssetPack::FILE_EXTENSION));
+
+        AssetPackWriter writer;
+        const size_t fileCount = writer.AddDirectory(entry.path());
+
+        if (!writer.WriteToFile(packPath))
+        {
+            spdlog::error("Failed to write asset pack: {}", packPath.string());
+            return 1;
+        }
+
+        spdlog::info("Packed {} files from namespace '{}' into {} ({} bytes)", fileCount, namespaceId, packPath.string(), std::filesystem::file_size(packPath));
+        ++packCount;
+    }
+
+    if (packCount == 0)
+        spdlog::warn("No namespace directories found in {}", assetsDirectory.string());
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include "RenderStar/Client/Render/Culling/FrustumCuller.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+#include <spdlog/spdlog.h>
+#include <chrono>
+#include <random>
+#include <string>
+
+using namespace RenderStar::Client::Render::Culling;
+
+namespace
+{
+    constexpr float WORLD_HALF_SIZE = 500.0f;
+
+    template <typename Function>
+    double MeasureSeconds(const size_t iterations, Function&& function)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        for (size_t iteration = 0; iteration < iterations; ++iteration)
+            function();
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        return elapsed.count();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 3)
+    {
+        spdlog::error("Usage: {} [box-count] [iterations]", argv[0]);
+        spdlog::error("Culls randomly placed boxes against a camera frustum and reports batched and per-box throughput");
+        return 1;
+    }
+
+    const size_t boxCount = argc >= 2 ? std::stoul(argv[1]) : 100000;
+    const size_t iterations = argc == 3 ? std::stoul(argv[2]) : 200;
+
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> position(-WORLD_HALF_SIZE, WORLD_HALF_SIZE);
+    std::uniform_real_distribution<float> size(0.5f, 8.0f);
+
+    FrustumCuller culler;
+    std::vector<BoundingBox> boxes;
+    boxes.reserve(boxCount);
+
+    for (size_t i = 0; i < boxCount; ++i)
+    {
+        const glm::vec3 center(position(random), position(random) * 0.1f, position(random));
+        const glm::vec3 halfSize(size(random));
+
+        boxes.push_back({center - halfSize, center + halfSize});
+        culler.Add(boxes.back());
+    }
+
+    const glm::mat4 projection = glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, WORLD_HALF_SIZE);
+    const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 10.0f, 0.0f), glm::vec3(1.0f, 10.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const Frustum frustum = Frustum::FromViewProjection(projection * view);
+
+    std::vector<uint32_t> visible;
+    visible.reserve(boxCount);
+
+    size_t scalarVisible = 0;
+
+    const double scalarSeconds = MeasureSeconds(iterations, [&]
+    {
+        scalarVisible = 0;
+
+        for (const auto& box : boxes)
+            scalarVisible += frustum.Intersects(box) ? 1 : 0;
+    });
+
+    const double batchedSeconds = MeasureSeconds(iterations, [&]
+    {
+        culler.Cull(frustum, visible);
+    });
+
+    if (visible.size() != scalarVisible)
+        spdlog::error("Batched and per-box culling disagree: {} vs {} visible", visible.size(), scalarVisible);
+
+    const auto perIteration = [iterations](const double seconds) { return seconds * 1e6 / static_cast<double>(iterations); };
+
+    spdlog::info("Culled {} boxes x {} iterations, {} visible", boxCount, iterations, visible.size());
+    spdlog::info("Per-box: {:.2f} us per cull, {:.2f} ns per box", perIteration(scalarSeconds), perIteration(scalarSeconds) * 1e3 / static_cast<double>(boxCount));
+    spdlog::info("Batched: {:.2f} us per cull, {:.2f} ns per box ({:.2f}x)", perIteration(batchedSeconds), perIteration(batchedSeconds) * 1e3 / static_cast<double>(boxCount), scalarSeconds / batchedSeconds);
+
+    return visible.size() == scalarVisible ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+#include "RenderStar/Common/Scene/MapbinLoader.hpp"
+#include "RenderStar/Common/Scene/MapbinWriter.hpp"
+#include "RenderStar/Common/Scene/TextureTranscoder.hpp"
+#include <spdlog/spdlog.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+#include <vector>
+
+using namespace RenderStar::Common::Scene;
+
+namespace
+{
+    constexpr std::string_view MAPBIN_EXTENSION = ".mapbin";
+    constexpr std::string_view KEEP_RAW_FLAG = "--keep-raw";
+
+    bool TranscodeFile(const std::filesystem::path& input, const std::filesystem::path& output, const bool keepRawPixels)
+    {
+        std::ifstream file(input, std::ios::binary);
+
+        if (!file)
+        {
+            spdlog::error("Failed to open {}", input.string());
+            return false;
+        }
+
+        const std::vector<uint8_t> data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+        file.close();
+
+        auto scene = MapbinLoader::Parse(data);
+
+        if (!scene.has_value())
+        {
+            spdlog::error("Failed to parse {}", input.string());
+            return false;
+        }
+
+        const size_t transcoded = TextureTranscoder::TranscodeScene(*scene, keepRawPixels);
+        const auto bytes = MapbinWriter::Write(*scene);
+
+        if (output.has_parent_path())
+            std::filesystem::create_directories(output.parent_path());
+
+        std::ofstream out(output, std::ios::binary | std::ios::trunc);
+
+        if (!out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+        {
+            spdlog::error("Failed to write {}", output.string());
+            return false;
+        }
+
+        spdlog::info("Transcoded {} textures in {} ({} -> {} bytes)", transcoded, output.string(), data.size(), bytes.size());
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string_view> arguments(argv + 1, argv + argc);
+    const bool keepRawPixels = std::erase(arguments, KEEP_RAW_FLAG) > 0;
+
+    if (arguments.empty() || arguments.size() > 2)
+    {
+        spdlog::error("Usage: {} <mapbin-file-or-directory> [output] [{}]", argv[0], KEEP_RAW_FLAG);
+        spdlog::error("Compresses every texture slot to BC1/BC3/BC4/BC5 with a full mip chain and writes mapbin v6");
+        spdlog::error("Without [output] files are rewritten in place; {} keeps the RGBA pixels alongside", KEEP_RAW_FLAG);
+        return 1;
+    }
+
+    const std::filesystem::path input = arguments[0];
+    const std::filesystem::path output = arguments.size() == 2 ? std::filesystem::path(arguments[1]) : input;
+
+    if (!std::filesystem::is_directory(input))
+        return TranscodeFile(input, output, keepRawPixels) ? 0 : 1;
+
+    size_t failures = 0;
+    size_t fileCount = 0;
+
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(input))
+    {
+        if (!entry.is_regular_file() || entry.path().extension() != MAPBIN_EXTENSION)
+            continue;
+
+        ++fileCount;
+
+        if (!TranscodeFile(entry.path(), output / std::filesystem::relative(entry.path(), input), keepRawPixels))
+            ++failures;
+    }
+
+    if (fileCount == 0)
+        spdlog::warn("No {} files found in {}", MAPBIN_EXTENSION, input.string());
+
+    return failures == 0 ? 0 : 1;
+}
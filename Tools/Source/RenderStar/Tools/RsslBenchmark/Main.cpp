@@ -0,0 +1,107 @@
+#include "RenderStar/Client/Render/Shader/RsslCompiler.hpp"
+#include <spdlog/spdlog.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+using namespace RenderStar::Client::Render::Shader;
+
+namespace
+{
+    struct ShaderSource
+    {
+        std::string name;
+        std::string source;
+    };
+
+    std::vector<ShaderSource> LoadShaders(const std::filesystem::path& directory)
+    {
+        std::vector<ShaderSource> shaders;
+
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+        {
+            if (!entry.is_regular_file() || entry.path().extension() != ".rssl")
+                continue;
+
+            std::ifstream file(entry.path(), std::ios::binary);
+            std::stringstream buffer;
+            buffer << file.rdbuf();
+
+            shaders.push_back({std::filesystem::relative(entry.path(), directory).generic_string(), buffer.str()});
+        }
+
+        std::ranges::sort(shaders, {}, &ShaderSource::name);
+
+        return shaders;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3)
+    {
+        spdlog::error("Usage: {} <shader-directory> [iterations]", argv[0]);
+        spdlog::error("Parses every .rssl file under <shader-directory> and reports parse throughput");
+        return 1;
+    }
+
+    const std::filesystem::path shaderDirectory = argv[1];
+    const size_t iterations = argc == 3 ? std::stoul(argv[2]) : 1000;
+
+    if (!std::filesystem::is_directory(shaderDirectory))
+    {
+        spdlog::error("Shader directory does not exist: {}", shaderDirectory.string());
+        return 1;
+    }
+
+    const auto shaders = LoadShaders(shaderDirectory);
+
+    if (shaders.empty())
+    {
+        spdlog::warn("No .rssl files found in {}", shaderDirectory.string());
+        return 0;
+    }
+
+    const IncludeResolver resolver = [&shaderDirectory](const std::string& path, const std::string&) -> std::string
+    {
+        std::ifstream file(shaderDirectory / path, std::ios::binary);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+
+        return buffer.str();
+    };
+
+    size_t totalBytes = 0;
+    size_t totalLines = 0;
+
+    for (const auto& shader : shaders)
+    {
+        totalBytes += shader.source.size();
+        totalLines += std::ranges::count(shader.source, '\n');
+
+        const auto result = RsslCompiler::Parse(shader.source, resolver, shader.name);
+
+        for (const auto& error : result.errors)
+            spdlog::warn("{}: {}", shader.name, error);
+    }
+
+    size_t checksum = 0;
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t iteration = 0; iteration < iterations; ++iteration)
+    {
+        for (const auto& shader : shaders)
+            checksum += RsslCompiler::Parse(shader.source, resolver, shader.name).stages.size();
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    const double seconds = elapsed.count();
+    const double parsedBytes = static_cast<double>(totalBytes * iterations);
+    const double parsedLines = static_cast<double>(totalLines * iterations);
+
+    spdlog::info("Parsed {} shaders ({} bytes, {} lines) x {} iterations in {:.3f} s (checksum {})", shaders.size(), totalBytes, totalLines, iterations, seconds, checksum);
+    spdlog::info("Throughput: {:.2f} MiB/s, {:.0f} lines/s, {:.2f} us per shader", parsedBytes / seconds / (1024.0 * 1024.0), parsedLines / seconds, seconds * 1e6 / static_cast<double>(shaders.size() * iterations));
+
+    return 0;
+}
@@ -0,0 +1,294 @@
+#include "RenderStar/Client/Render/Resource/ITextureHandle.hpp"
+#include "RenderStar/Client/UI/UIBatcher.hpp"
+#include "RenderStar/Client/UI/UibinLoader.hpp"
+#include <spdlog/spdlog.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+
+using namespace RenderStar::Client;
+using namespace RenderStar::Client::UI;
+
+namespace
+{
+    // Size of the per-quad uniform block the unbatched renderer uploaded for every draw
+    constexpr size_t LEGACY_UNIFORM_BYTES = 64;
+
+    constexpr float SCREEN_WIDTH = 1920.0f;
+    constexpr float SCREEN_HEIGHT = 1080.0f;
+
+    class BenchmarkTexture final : public Render::ITextureHandle
+    {
+    public:
+
+        void Release() override {}
+        Render::GraphicsResourceType GetResourceType() const override { return Render::GraphicsResourceType::TEXTURE; }
+        uint32_t GetWidth() const override { return 1; }
+        uint32_t GetHeight() const override { return 1; }
+        bool IsValid() const override { return true; }
+    };
+
+    // Walks a scene the way UIStackModule does and feeds its quads to the batcher.
+    // Glyph metrics are synthetic; only the quad count and texture switches matter here.
+    class SceneEmitter
+    {
+    public:
+
+        SceneEmitter(UIBatcher& batcher, float scaleX, float scaleY)
+            : batcher(batcher), scaleX(scaleX), scaleY(scaleY)
+        {
+        }
+
+        void Emit(const UIElement& element, float parentX, float parentY, float parentW, float parentH)
+        {
+            float x = parentX, y = parentY, w = parentW, h = parentH, rotation = 0.0f;
+
+            if (const auto* transform = element.GetTransform())
+            {
+                ComputeRect(*transform, parentX, parentY, parentW, parentH, x, y, w, h);
+                rotation = static_cast<float>(transform->rotationDegrees);
+            }
+
+            const float uniformScale = std::min(scaleX, scaleY);
+
+            if (const auto* panel = element.GetPanel())
+                Bordered(x, y, w, h, static_cast<float>(panel->borderWidth) * uniformScale, panel->borderColor, panel->backgroundColor, rotation);
+
+            if (const auto* image = element.GetImage())
+                Quad(Texture(image->assetPath), x, y, w, h, image->tint, rotation);
+
+            if (const auto* icon = element.GetIcon())
+                Quad(Texture(icon->assetPath), x, y, w, h, icon->tintColor, rotation);
+
+            if (const auto* sprite = element.GetSprite())
+                Quad(Texture(sprite->assetPath), x, y, w, h, {1, 1, 1, 1}, rotation);
+
+            if (const auto* button = element.GetButton())
+            {
+                Bordered(x, y, w, h, 2.0f * uniformScale, {1, 1, 1, 0.3f}, button->backgroundColor, rotation);
+                Text(button->text, button->fontPath, button->pixelSize, button->textColor, x, y);
+            }
+
+            if (const auto* progress = element.GetProgressBar())
+            {
+                Quad(&white, x, y, w, h, progress->backgroundColor);
+                Quad(&white, x, y, w * static_cast<float>(progress->value), h, progress->fillColor);
+            }
+
+            if (const auto* toggle = element.GetToggle())
+            {
+                Quad(&white, x, y, w, h, toggle->checked ? toggle->onColor : toggle->offColor);
+                Quad(&white, x + 2.0f, y + 2.0f, h - 4.0f, h - 4.0f, toggle->knobColor);
+            }
+
+            if (const auto* input = element.GetTextInput())
+            {
+                Bordered(x, y, w, h, uniformScale, input->borderColor, input->backgroundColor);
+                Text(input->text.empty() ? input->placeholder : input->text, "", input->pixelSize, input->textColor, x, y);
+            }
+
+            if (const auto* dropdown = element.GetDropdown())
+            {
+                Bordered(x, y, w, h, uniformScale, dropdown->borderColor, dropdown->backgroundColor);
+                Text(dropdown->options.substr(0, dropdown->options.find(',')), "", dropdown->pixelSize, dropdown->textColor, x, y);
+            }
+
+            if (const auto* tooltip = element.GetTooltip())
+            {
+                Bordered(x, y, w, h, uniformScale, tooltip->borderColor, tooltip->backgroundColor);
+                Text(tooltip->tooltipText, "", tooltip->pixelSize, tooltip->textColor, x, y);
+            }
+
+            if (const auto* minimap = element.GetMinimap())
+            {
+                Bordered(x, y, w, h, static_cast<float>(minimap->borderWidth) * uniformScale, minimap->borderColor, minimap->backgroundColor);
+                Quad(&white, x + w * 0.4f, y + h * 0.4f, w * 0.2f, h * 0.2f, minimap->viewportColor);
+            }
+
+            if (const auto* slot = element.GetDragSlot())
+            {
+                const float size = static_cast<float>(slot->slotSize) * uniformScale;
+                Bordered(x, y, size, size, uniformScale, slot->borderColor, slot->isEmpty ? slot->emptyColor : slot->backgroundColor);
+            }
+
+            if (const auto* tabs = element.GetTabContainer())
+            {
+                const float tabHeight = static_cast<float>(tabs->tabHeight) * scaleY;
+                const auto tabCount = static_cast<float>(std::ranges::count(tabs->tabNames, ',') + 1);
+
+                for (float i = 0.0f; i < tabCount; i += 1.0f)
+                    Quad(&white, x + i * w / tabCount, y, w / tabCount, tabHeight, i == 0.0f ? tabs->activeColor : tabs->inactiveColor);
+
+                Quad(&white, x, y + tabHeight, w, h - tabHeight, tabs->backgroundColor);
+            }
+
+            if (const auto* repeater = element.GetListRepeater())
+            {
+                const float itemHeight = static_cast<float>(repeater->itemHeight) * scaleY;
+
+                for (int32_t i = 0; i < repeater->itemCount; ++i)
+                    Quad(&white, x, y + static_cast<float>(i) * itemHeight, w, itemHeight, i % 2 ? repeater->alternateColor : repeater->itemColor);
+            }
+
+            if (const auto* radial = element.GetRadialMenu())
+            {
+                for (int32_t i = 0; i < radial->sliceCount + 2; ++i)
+                    Quad(&white, x, y, w, h, radial->sliceColor);
+            }
+
+            if (const auto* text = element.GetText())
+                Text(text->text, text->fontPath, text->pixelSize, text->color, x, y);
+
+            const bool clips = element.GetScrollBox() != nullptr;
+
+            if (clips)
+                batcher.PushScissor({static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<uint32_t>(w), static_cast<uint32_t>(h)});
+
+            for (const auto& child : element.Children())
+                Emit(child, x, y, w, h);
+
+            if (clips)
+                batcher.PopScissor();
+        }
+
+    private:
+
+        void ComputeRect(const TransformData& t, float parentX, float parentY, float parentW, float parentH, float& outX, float& outY, float& outW, float& outH) const
+        {
+            const bool stretchH = (t.stretch & (AnchorFlags::LEFT | AnchorFlags::RIGHT)) == (AnchorFlags::LEFT | AnchorFlags::RIGHT);
+            const bool stretchV = (t.stretch & (AnchorFlags::TOP | AnchorFlags::BOTTOM)) == (AnchorFlags::TOP | AnchorFlags::BOTTOM);
+
+            outW = stretchH ? parentW : static_cast<float>(t.scaleX) * scaleX;
+            outH = stretchV ? parentH : static_cast<float>(t.scaleY) * scaleY;
+
+            const float baseX = (t.anchors & AnchorFlags::CENTER_X) ? parentX + (parentW - outW) * 0.5f
+                              : (t.anchors & AnchorFlags::RIGHT)    ? parentX + parentW - outW
+                              : parentX;
+
+            const float baseY = (t.anchors & AnchorFlags::CENTER_Y) ? parentY + (parentH - outH) * 0.5f
+                              : (t.anchors & AnchorFlags::BOTTOM)   ? parentY + parentH - outH
+                              : parentY;
+
+            outX = baseX + static_cast<float>(t.x) * scaleX;
+            outY = baseY + static_cast<float>(t.y) * scaleY;
+        }
+
+        Render::ITextureHandle* Texture(const std::string& key)
+        {
+            return key.empty() ? &white : &textures[key];
+        }
+
+        void Quad(Render::ITextureHandle* texture, float x, float y, float w, float h, const UibinColor& tint, float rotation = 0.0f)
+        {
+            UIQuad quad;
+            quad.x = x;
+            quad.y = y;
+            quad.width = w;
+            quad.height = h;
+            quad.tint = tint;
+            quad.rotationDegrees = rotation;
+
+            batcher.AddQuad(texture, quad);
+        }
+
+        void Bordered(float x, float y, float w, float h, float border, const UibinColor& borderColor, const UibinColor& fillColor, float rotation = 0.0f)
+        {
+            if (border > 0.0f)
+                Quad(&white, x, y, w, h, borderColor, rotation);
+
+            Quad(&white, x + border, y + border, w - 2 * border, h - 2 * border, fillColor, rotation);
+        }
+
+        void Text(const std::string& text, const std::string& fontPath, int32_t pixelSize, const UibinColor& color, float x, float y)
+        {
+            const float size = static_cast<float>(pixelSize) * std::min(scaleX, scaleY);
+            Render::ITextureHandle* atlas = Texture("font:" + fontPath + ":" + std::to_string(static_cast<int>(size + 0.5f)));
+
+            float cursorX = x;
+
+            for (const char c : text)
+            {
+                if (c != ' ')
+                    Quad(atlas, cursorX, y, size * 0.5f, size * 0.7f, color);
+
+                cursorX += size * 0.55f;
+            }
+        }
+
+        UIBatcher& batcher;
+        float scaleX;
+        float scaleY;
+        BenchmarkTexture white;
+        std::map<std::string, BenchmarkTexture> textures;
+    };
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3)
+    {
+        spdlog::error("Usage: {} <uibin-file> [iterations]", argv[0]);
+        spdlog::error("Builds the batched UI draw list for <uibin-file> and reports draws, bytes and build time");
+        return 1;
+    }
+
+    const std::filesystem::path scenePath = argv[1];
+    const size_t iterations = argc == 3 ? std::stoul(argv[2]) : 10000;
+
+    std::ifstream file(scenePath, std::ios::binary);
+
+    if (!file)
+    {
+        spdlog::error("Failed to open {}", scenePath.string());
+        return 1;
+    }
+
+    const std::vector<uint8_t> data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    const auto scene = UibinLoader::Parse(data);
+
+    if (!scene.has_value() || !scene->GetRoot())
+    {
+        spdlog::error("Failed to parse {}", scenePath.string());
+        return 1;
+    }
+
+    const float designW = scene->designWidth > 0.0 ? static_cast<float>(scene->designWidth) : SCREEN_WIDTH;
+    const float designH = scene->designHeight > 0.0 ? static_cast<float>(scene->designHeight) : SCREEN_HEIGHT;
+
+    UIBatcher batcher;
+    SceneEmitter emitter(batcher, SCREEN_WIDTH / designW, SCREEN_HEIGHT / designH);
+
+    const auto buildFrame = [&]
+    {
+        batcher.Begin(SCREEN_WIDTH, SCREEN_HEIGHT);
+        emitter.Emit(*scene->GetRoot(), 0.0f, 0.0f, SCREEN_WIDTH, SCREEN_HEIGHT);
+        batcher.End();
+    };
+
+    buildFrame();
+
+    const auto statistics = batcher.GetStatistics();
+    const size_t submitted = statistics.primitiveCount - statistics.culledCount;
+
+    spdlog::info("Unbatched: {} draws, {} bytes of per-quad uniforms", submitted, submitted * LEGACY_UNIFORM_BYTES);
+    spdlog::info("Batched:   {} draws, {} vertex bytes + {} index bytes ({} primitives, {} culled)",
+        statistics.drawCount, statistics.vertexBytes, statistics.indexBytes, statistics.primitiveCount, statistics.culledCount);
+
+    size_t checksum = 0;
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t iteration = 0; iteration < iterations; ++iteration)
+    {
+        buildFrame();
+        checksum += batcher.GetIndices().size();
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    spdlog::info("Built {} frames in {:.3f} s, {:.2f} us per frame (checksum {})",
+        iterations, elapsed.count(), elapsed.count() * 1e6 / static_cast<double>(iterations), checksum);
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include "RenderStar/Client/UI/UibinLoader.hpp"
+#include "RenderStar/Client/UI/UibinWriter.hpp"
+#include <spdlog/spdlog.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+using namespace RenderStar::Client::UI;
+
+namespace
+{
+    double MeasureParseMicroseconds(const std::vector<uint8_t>& data, size_t iterations)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        for (size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            if (!UibinLoader::Parse(data).has_value())
+                return 0.0;
+        }
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() * 1e6 / static_cast<double>(iterations);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3)
+    {
+        spdlog::error("Usage: {} <input.uibin> [output.uibin]", argv[0]);
+        spdlog::error("Rewrites a uibin file of any version as version {}; the input is rewritten in place when no output is given", UibinLoader::VERSION_2);
+        return 1;
+    }
+
+    const std::filesystem::path inputPath = argv[1];
+    const std::filesystem::path outputPath = argc == 3 ? std::filesystem::path(argv[2]) : inputPath;
+
+    std::ifstream input(inputPath, std::ios::binary);
+
+    if (!input)
+    {
+        spdlog::error("Failed to open {}", inputPath.string());
+        return 1;
+    }
+
+    const std::vector<uint8_t> data{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+    input.close();
+
+    const auto scene = UibinLoader::Parse(data);
+
+    if (!scene.has_value())
+    {
+        spdlog::error("Failed to parse {}", inputPath.string());
+        return 1;
+    }
+
+    const std::vector<uint8_t> converted = UibinWriter::Write(*scene);
+
+    if (!UibinLoader::Parse(converted).has_value())
+    {
+        spdlog::error("Converted scene does not load back; {} was left untouched", outputPath.string());
+        return 1;
+    }
+
+    std::ofstream output(outputPath, std::ios::binary | std::ios::trunc);
+
+    if (!output || !output.write(reinterpret_cast<const char*>(converted.data()), static_cast<std::streamsize>(converted.size())))
+    {
+        spdlog::error("Failed to write {}", outputPath.string());
+        return 1;
+    }
+
+    constexpr size_t PARSE_ITERATIONS = 100;
+
+    spdlog::info("Converted {} ({} elements, {} strings, {} assets): {} -> {} bytes",
+        inputPath.string(), scene->elements.size(), scene->GetStringCount(), scene->assets.size(), data.size(), converted.size());
+    spdlog::info("Parse time: {:.1f} us before, {:.1f} us after",
+        MeasureParseMicroseconds(data, PARSE_ITERATIONS), MeasureParseMicroseconds(converted, PARSE_ITERATIONS));
+
+    return 0;
+}